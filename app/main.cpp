@@ -4,6 +4,7 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser_manager.h"
 #include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/netlist/project_manager.h"
 #include "hal_core/plugin_system/plugin_interface_base.h"
@@ -52,6 +53,9 @@ void initialize_cli_options(ProgramOptions& cli_options)
     generic_options.add({"-e", "--empty-project"}, "create an empty project (requires gate library to be specified)");
     generic_options.add("--volatile-mode", "prevent HAL from creating a .hal progress file (e.g., for cluster use)");
     generic_options.add("--no-log", "prevent hal from creating a .log file");
+    generic_options.add("--compress-hal", "write the .hal file compressed using 'gzip' or 'zstd'", {ProgramOptions::A_REQUIRED_PARAMETER});
+    generic_options.add("--binary-hal", "write the .hal file in the binary format instead of JSON");
+    generic_options.add("--convert-hal", "convert a .hal file between the JSON and the binary format and exit", {ProgramOptions::A_REQUIRED_PARAMETER, ProgramOptions::A_REQUIRED_PARAMETER});
 
     /* initialize netlist parser options */
     generic_options.add(netlist_parser_manager::get_cli_options());
@@ -211,6 +215,17 @@ int main(int argc, const char* argv[])
         return cleanup();
     }
 
+    if (args.is_option_set("--convert-hal"))
+    {
+        const std::vector<std::string> files = args.get_parameters("--convert-hal");
+        if (!netlist_binary_serializer::convert_file(files.at(0), files.at(1)))
+        {
+            log_error("core", "Cannot convert '{}' into '{}'", files.at(0), files.at(1));
+            return cleanup(ERROR);
+        }
+        return cleanup();
+    }
+
     /* empty project requires gate library, import or existing project args not allowed */
     if (args.is_option_set("--empty-project") && args.is_option_set("--import-netlist"))
     {
@@ -274,6 +289,22 @@ int main(int argc, const char* argv[])
             return cleanup();
         }
     }
+    if (args.is_option_set("--compress-hal"))
+    {
+        const std::string format_name = args.get_parameter("--compress-hal");
+        const CompressionFormat format  = enum_from_string<CompressionFormat>(format_name, CompressionFormat::none);
+        if (format == CompressionFormat::none || !compression::is_supported(format))
+        {
+            log_error("core", "unsupported compression format '{}' specified (--compress-hal).", format_name);
+            return cleanup();
+        }
+        pm->set_compression_format(format);
+    }
+    if (args.is_option_set("--binary-hal"))
+    {
+        pm->set_binary_format(true);
+    }
+
     if (args.is_option_set("--no-log"))
     {
         log_warning("core",
@@ -0,0 +1,143 @@
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/parser.h"
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace hal;
+
+namespace
+{
+    using BooleanFunctionParser::ParserType;
+
+    /**
+     * Generates random well-formed expressions in the standard or Liberty syntax, resembling the functions found in gate libraries.
+     */
+    class ExpressionGenerator
+    {
+    public:
+        ExpressionGenerator(u32 seed) : m_rng(seed)
+        {
+        }
+
+        std::string generate(ParserType type, u32 depth)
+        {
+            return (type == ParserType::Standard) ? standard(depth) : liberty(depth);
+        }
+
+    private:
+        std::mt19937 m_rng;
+
+        template<typename T>
+        const T& pick(const std::vector<T>& elements)
+        {
+            return elements.at(std::uniform_int_distribution<u32>(0, elements.size() - 1)(m_rng));
+        }
+
+        u32 random(u32 max)
+        {
+            return std::uniform_int_distribution<u32>(0, max)(m_rng);
+        }
+
+        std::string standard(u32 depth)
+        {
+            switch ((depth == 0) ? random(1) : random(5))
+            {
+                case 0:
+                    return pick<std::string>({"A", "B", "I0", "I1", "RDATA(3)", "Q[2]", "\\O[0]", "CLK"});
+                case 1:
+                    return pick<std::string>({"0", "1", "0b0", "0b1", "1'b1"});
+                case 2:
+                    return pick<std::string>({"!", "~"}) + standard(depth - 1);
+                case 3:
+                    return "(" + standard(depth - 1) + ")";
+                default:
+                    return standard(depth - 1) + pick<std::string>({" & ", " | ", " ^ "}) + standard(depth - 1);
+            }
+        }
+
+        std::string liberty(u32 depth)
+        {
+            switch ((depth == 0) ? 0 : random(3))
+            {
+                case 0:
+                    return pick<std::string>({"A", "B", "I0", "I1", "RDATA(3)", "CLK"}) + std::string(random(3) / 2, '\'');
+                case 1:
+                    return "!(" + liberty(depth - 1) + ")";
+                default:
+                    return "(" + liberty(depth - 1) + pick<std::string>({" ", "&", "*", "|", "+", "^"}) + liberty(depth - 1) + ")";
+            }
+        }
+    };
+
+    /**
+     * The same set of expressions is used for all benchmarks, every fourth of them in the Liberty syntax.
+     */
+    const std::vector<std::string>& get_expressions()
+    {
+        static const std::vector<std::string> expressions = [] {
+            ExpressionGenerator generator(0xbe4c);
+            std::vector<std::string> res;
+            for (u32 i = 0; i < 2000; i++)
+            {
+                res.push_back(generator.generate((i % 4 == 0) ? ParserType::Liberty : ParserType::Standard, 6));
+            }
+            return res;
+        }();
+        return expressions;
+    }
+
+    /**
+     * Parses an expression by tokenizing it with the grammar-based parsers and translating the tokens in reverse polish notation, trying the standard syntax first.
+     */
+    Result<BooleanFunction> parse_with_tokens(const std::string& expression)
+    {
+        const std::vector<std::tuple<ParserType, std::function<Result<std::vector<BooleanFunctionParser::Token>>(const std::string&)>>> parsers = {
+            {ParserType::Standard, BooleanFunctionParser::parse_with_standard_grammar},
+            {ParserType::Liberty, BooleanFunctionParser::parse_with_liberty_grammar},
+        };
+
+        for (const auto& [parser_type, parser] : parsers)
+        {
+            auto tokens = parser(expression);
+            if (tokens.is_error())
+            {
+                continue;
+            }
+            tokens = BooleanFunctionParser::reverse_polish_notation(tokens.get(), expression, parser_type);
+            if (tokens.is_error())
+            {
+                continue;
+            }
+            if (auto function = BooleanFunctionParser::translate(tokens.get(), expression); function.is_ok())
+            {
+                return function;
+            }
+        }
+        return ERR("could not parse '" + expression + "'");
+    }
+
+    void BM_parse(benchmark::State& state, Result<BooleanFunction> (*parse)(const std::string&))
+    {
+        const std::vector<std::string>& expressions = get_expressions();
+        for (auto _ : state)
+        {
+            for (const auto& expression : expressions)
+            {
+                auto res = parse(expression);
+                if (res.is_error())
+                {
+                    state.SkipWithError(res.get_error().get().c_str());
+                    return;
+                }
+                benchmark::DoNotOptimize(res);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * expressions.size());
+    }
+}    // namespace
+
+BENCHMARK_CAPTURE(BM_parse, token_based, parse_with_tokens)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_parse, recursive_descent, BooleanFunction::from_string)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
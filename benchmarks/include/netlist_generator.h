@@ -0,0 +1,120 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <memory>
+
+namespace hal
+{
+    /* forward declaration */
+    class GateLibrary;
+    class Netlist;
+
+    /**
+     * Deterministic generator for synthetic netlists that are used to benchmark netlist I/O.
+     * All netlists are built from the primitives of `example_library.hgl`.
+     */
+    namespace netlist_generator
+    {
+        /**
+         * The distribution used to select the driver of each gate input.
+         */
+        enum class FanoutDistribution
+        {
+            uniform,  /**< Every preceding gate is equally likely to drive an input, resulting in an approximately Poisson-distributed fan-out. */
+            power_law /**< Early gates are preferred as drivers, resulting in a heavy-tailed fan-out with a few high-fan-out nets. */
+        };
+
+        /**
+         * Parameters of a synthetic netlist.
+         */
+        struct Configuration
+        {
+            /**
+             * The number of gates to generate.
+             */
+            u32 gate_count = 10000;
+
+            /**
+             * The fraction of gates that are flip-flops.
+             */
+            double ff_ratio = 0.1;
+
+            /**
+             * The distribution used to select the drivers of gate inputs.
+             */
+            FanoutDistribution fanout_distribution = FanoutDistribution::power_law;
+
+            /**
+             * The exponent of the power law distribution. Larger values result in more skewed fan-outs.
+             */
+            double fanout_skew = 2.0;
+
+            /**
+             * The depth of the module hierarchy below the top module. With a depth of 0 all gates are placed in the top module.
+             */
+            u32 hierarchy_depth = 2;
+
+            /**
+             * The number of submodules of every non-leaf module.
+             */
+            u32 modules_per_level = 4;
+
+            /**
+             * The number of global input nets in addition to the clock and enable nets.
+             */
+            u32 input_count = 64;
+
+            /**
+             * The seed of the pseudo-random number generator. Equal configurations always produce identical netlists.
+             */
+            u64 seed = 0x68616c;
+        };
+
+        /**
+         * Generate a synthetic netlist according to the given configuration.
+         *
+         * @param[in] gate_library - The gate library providing the primitives of `example_library.hgl`.
+         * @param[in] config - The configuration.
+         * @returns The netlist on success, an error otherwise.
+         */
+        Result<std::unique_ptr<Netlist>> generate(GateLibrary* gate_library, const Configuration& config);
+
+        /**
+         * Write a flat structural VHDL description of the netlist that can be read by the VHDL parser.
+         * The module hierarchy is not preserved.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] file_path - The output path.
+         * @returns Ok() on success, an error otherwise.
+         */
+        Result<std::monostate> write_vhdl(const Netlist* netlist, const std::filesystem::path& file_path);
+    }    // namespace netlist_generator
+}    // namespace hal
@@ -0,0 +1,370 @@
+#include "aiger/aiger_parser.h"
+#include "aiger/aiger_writer.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/plugin_system/plugin_manager.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/utils.h"
+#include "netlist_generator.h"
+#include "verilog_parser/verilog_parser.h"
+#include "verilog_writer/verilog_writer.h"
+#include "vhdl_parser/vhdl_parser.h"
+
+#include <benchmark/benchmark.h>
+#include <map>
+
+using namespace hal;
+
+namespace
+{
+    const std::filesystem::path BENCHMARK_DIRECTORY = std::filesystem::temp_directory_path() / "hal_benchmarks";
+
+    GateLibrary* get_gate_library()
+    {
+        static GateLibrary* gate_library = gate_library_manager::get_gate_library("example_library.hgl");
+        return gate_library;
+    }
+
+    netlist_generator::Configuration get_configuration(const benchmark::State& state)
+    {
+        netlist_generator::Configuration config;
+        config.gate_count      = (u32)state.range(0);
+        config.hierarchy_depth = (u32)state.range(1);
+        return config;
+    }
+
+    /**
+     * Generated netlists are cached so that every configuration is only generated once per run.
+     */
+    std::map<std::pair<u32, u32>, std::unique_ptr<Netlist>>& get_netlist_cache()
+    {
+        static std::map<std::pair<u32, u32>, std::unique_ptr<Netlist>> cache;
+        return cache;
+    }
+
+    Netlist* get_netlist(const netlist_generator::Configuration& config)
+    {
+        auto& cache = get_netlist_cache();
+
+        auto key = std::make_pair(config.gate_count, config.hierarchy_depth);
+        if (auto it = cache.find(key); it != cache.end())
+        {
+            return it->second.get();
+        }
+
+        auto res = netlist_generator::generate(get_gate_library(), config);
+        if (res.is_error())
+        {
+            log_error("benchmarks", "{}", res.get_error().get());
+            return nullptr;
+        }
+        return cache.emplace(key, res.get()).first->second.get();
+    }
+
+    /**
+     * Removes a generated netlist from the cache, so that it does not add to the memory usage of the following benchmarks.
+     */
+    void release_netlist(const netlist_generator::Configuration& config)
+    {
+        get_netlist_cache().erase(std::make_pair(config.gate_count, config.hierarchy_depth));
+    }
+
+    /**
+     * Returns the path of a file that contains the generated netlist in the format indicated by the extension, writing it on first use.
+     */
+    std::filesystem::path get_netlist_file(const netlist_generator::Configuration& config, const std::string& extension)
+    {
+        std::filesystem::path file_path = BENCHMARK_DIRECTORY / ("synthetic_" + std::to_string(config.gate_count) + "_" + std::to_string(config.hierarchy_depth) + extension);
+        if (std::filesystem::exists(file_path))
+        {
+            return file_path;
+        }
+
+        Netlist* netlist = get_netlist(config);
+        if (netlist == nullptr)
+        {
+            return {};
+        }
+
+        std::filesystem::create_directories(BENCHMARK_DIRECTORY);
+        bool success = false;
+        if (extension == ".v")
+        {
+            VerilogWriter writer;
+            success = writer.write(netlist, file_path).is_ok();
+        }
+        else if (extension == ".vhd")
+        {
+            success = netlist_generator::write_vhdl(netlist, file_path).is_ok();
+        }
+        else if (extension == ".hal")
+        {
+            success = netlist_serializer::serialize_to_file(netlist, file_path);
+        }
+        else if (extension == ".halb")
+        {
+            success = netlist_binary_serializer::serialize_to_file(netlist, file_path);
+        }
+        else if (extension == ".aig")
+        {
+            AigerWriter writer;
+            success = writer.write(netlist, file_path).is_ok();
+        }
+        return success ? file_path : std::filesystem::path();
+    }
+
+    /**
+     * The peak resident set size is that of the whole process so far, so select a single benchmark using `--benchmark_filter` to attribute it to that benchmark.
+     */
+    void set_counters(benchmark::State& state, const netlist_generator::Configuration& config)
+    {
+        state.SetItemsProcessed(state.iterations() * config.gate_count);
+        state.counters["gates"]        = config.gate_count;
+        state.counters["peak_rss_MiB"] = (double)utils::get_peak_memory_usage() / (1024 * 1024);
+    }
+
+    void BM_generate(benchmark::State& state)
+    {
+        auto config = get_configuration(state);
+        for (auto _ : state)
+        {
+            auto res = netlist_generator::generate(get_gate_library(), config);
+            if (res.is_error())
+            {
+                state.SkipWithError(res.get_error().get().c_str());
+                return;
+            }
+            benchmark::DoNotOptimize(res);
+        }
+        set_counters(state, config);
+    }
+
+    using ParserFactory = std::unique_ptr<NetlistParser> (*)();
+
+    template<typename T>
+    std::unique_ptr<NetlistParser> create_parser()
+    {
+        return std::make_unique<T>();
+    }
+
+    void BM_parse(benchmark::State& state, ParserFactory create, const std::string& extension)
+    {
+        auto config                     = get_configuration(state);
+        std::filesystem::path file_path = get_netlist_file(config, extension);
+        if (file_path.empty())
+        {
+            state.SkipWithError("failed to create input file");
+            return;
+        }
+
+        for (auto _ : state)
+        {
+            auto parser = create();
+            if (parser->parse(file_path).is_error())
+            {
+                state.SkipWithError("failed to parse input file");
+                return;
+            }
+        }
+        set_counters(state, config);
+    }
+
+    void BM_instantiate(benchmark::State& state, ParserFactory create, const std::string& extension)
+    {
+        auto config                     = get_configuration(state);
+        std::filesystem::path file_path = get_netlist_file(config, extension);
+        if (file_path.empty())
+        {
+            state.SkipWithError("failed to create input file");
+            return;
+        }
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto parser = create();
+            if (parser->parse(file_path).is_error())
+            {
+                state.SkipWithError("failed to parse input file");
+                return;
+            }
+            state.ResumeTiming();
+
+            auto res = parser->instantiate(get_gate_library());
+            if (res.is_error())
+            {
+                state.SkipWithError(res.get_error().get().c_str());
+                return;
+            }
+            std::unique_ptr<Netlist> netlist = res.get();
+
+            // do not measure the destruction of the netlist
+            state.PauseTiming();
+            netlist.reset();
+            state.ResumeTiming();
+        }
+        set_counters(state, config);
+    }
+
+    void BM_save_hal(benchmark::State& state, bool binary)
+    {
+        auto config      = get_configuration(state);
+        Netlist* netlist = get_netlist(config);
+        if (netlist == nullptr)
+        {
+            state.SkipWithError("failed to generate netlist");
+            return;
+        }
+
+        std::filesystem::create_directories(BENCHMARK_DIRECTORY);
+        std::filesystem::path file_path = BENCHMARK_DIRECTORY / (binary ? "save.halb" : "save.hal");
+        for (auto _ : state)
+        {
+            bool success = binary ? netlist_binary_serializer::serialize_to_file(netlist, file_path) : netlist_serializer::serialize_to_file(netlist, file_path);
+            if (!success)
+            {
+                state.SkipWithError("failed to serialize netlist");
+                return;
+            }
+        }
+        set_counters(state, config);
+    }
+
+    void BM_load_hal(benchmark::State& state, bool binary)
+    {
+        auto config                     = get_configuration(state);
+        std::filesystem::path file_path = get_netlist_file(config, binary ? ".halb" : ".hal");
+        if (file_path.empty())
+        {
+            state.SkipWithError("failed to create input file");
+            return;
+        }
+        release_netlist(config);
+
+        for (auto _ : state)
+        {
+            std::unique_ptr<Netlist> netlist = binary ? netlist_binary_serializer::deserialize_from_file(file_path) : netlist_serializer::deserialize_from_file(file_path);
+            if (netlist == nullptr)
+            {
+                state.SkipWithError("failed to deserialize netlist");
+                return;
+            }
+
+            state.PauseTiming();
+            netlist.reset();
+            state.ResumeTiming();
+        }
+        set_counters(state, config);
+    }
+
+    void BM_write_verilog(benchmark::State& state)
+    {
+        auto config      = get_configuration(state);
+        Netlist* netlist = get_netlist(config);
+        if (netlist == nullptr)
+        {
+            state.SkipWithError("failed to generate netlist");
+            return;
+        }
+
+        std::filesystem::create_directories(BENCHMARK_DIRECTORY);
+        std::filesystem::path file_path = BENCHMARK_DIRECTORY / "write.v";
+        for (auto _ : state)
+        {
+            VerilogWriter writer;
+            if (auto res = writer.write(netlist, file_path); res.is_error())
+            {
+                state.SkipWithError(res.get_error().get().c_str());
+                return;
+            }
+        }
+        set_counters(state, config);
+    }
+
+    void BM_copy(benchmark::State& state)
+    {
+        auto config      = get_configuration(state);
+        Netlist* netlist = get_netlist(config);
+        if (netlist == nullptr)
+        {
+            state.SkipWithError("failed to generate netlist");
+            return;
+        }
+
+        for (auto _ : state)
+        {
+            auto res = netlist->copy();
+            if (res.is_error())
+            {
+                state.SkipWithError(res.get_error().get().c_str());
+                return;
+            }
+            std::unique_ptr<Netlist> copy = res.get();
+
+            state.PauseTiming();
+            copy.reset();
+            state.ResumeTiming();
+        }
+        set_counters(state, config);
+    }
+
+    /**
+     * All benchmarks are run for every combination of gate count and hierarchy depth.
+     */
+    void apply_arguments(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({"gates", "depth"})->ArgsProduct({{1 << 10, 1 << 13, 1 << 16}, {0, 3}})->Unit(benchmark::kMillisecond);
+    }
+
+    /**
+     * Saving and loading is additionally measured once on a netlist of about one million gates, which requires several GiB of memory.
+     */
+    void apply_large_arguments(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({"gates", "depth"})->Args({1 << 20, 3})->Iterations(1)->Unit(benchmark::kSecond);
+    }
+}    // namespace
+
+BENCHMARK(BM_generate)->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_parse, verilog, create_parser<VerilogParser>, ".v")->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_instantiate, verilog, create_parser<VerilogParser>, ".v")->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_parse, vhdl, create_parser<VHDLParser>, ".vhd")->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_instantiate, vhdl, create_parser<VHDLParser>, ".vhd")->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_parse, aiger, create_parser<AigerParser>, ".aig")->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_instantiate, aiger, create_parser<AigerParser>, ".aig")->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_save_hal, json, false)->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_load_hal, json, false)->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_save_hal, binary, true)->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_load_hal, binary, true)->Apply(apply_arguments);
+BENCHMARK_CAPTURE(BM_save_hal, json, false)->Apply(apply_large_arguments);
+BENCHMARK_CAPTURE(BM_load_hal, json, false)->Apply(apply_large_arguments);
+BENCHMARK_CAPTURE(BM_save_hal, binary, true)->Apply(apply_large_arguments);
+BENCHMARK_CAPTURE(BM_load_hal, binary, true)->Apply(apply_large_arguments);
+BENCHMARK(BM_write_verilog)->Apply(apply_arguments);
+BENCHMARK(BM_copy)->Apply(apply_arguments);
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    plugin_manager::load_all_plugins();
+    if (get_gate_library() == nullptr)
+    {
+        log_error("benchmarks", "could not load gate library 'example_library.hgl'");
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    plugin_manager::unload_all_plugins();
+    std::error_code ec;
+    std::filesystem::remove_all(BENCHMARK_DIRECTORY, ec);
+    return 0;
+}
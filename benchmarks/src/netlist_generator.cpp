@@ -0,0 +1,346 @@
+#include "netlist_generator.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace hal
+{
+    namespace netlist_generator
+    {
+        namespace
+        {
+            const std::vector<std::string> COMBINATIONAL_TYPES = {"BUF", "INV", "AND2", "AND3", "AND4", "OR2", "OR3", "OR4", "XOR", "MUX", "LUT4", "LUT6"};
+            const std::string FF_TYPE                          = "FF";
+
+            /**
+             * SplitMix64 pseudo-random number generator.
+             * Unlike the standard library distributions, its output does not depend on the platform.
+             */
+            class Random
+            {
+            public:
+                explicit Random(u64 seed) : m_state(seed)
+                {
+                }
+
+                u64 next()
+                {
+                    u64 z = (m_state += 0x9E3779B97F4A7C15ULL);
+                    z     = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                    z     = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                    return z ^ (z >> 31);
+                }
+
+                u32 next_below(u32 bound)
+                {
+                    return (u32)(next() % bound);
+                }
+
+                double next_double()
+                {
+                    return (double)(next() >> 11) * (1.0 / (double)(1ULL << 53));
+                }
+
+            private:
+                u64 m_state;
+            };
+
+            u32 pick_driver(Random& rng, const Configuration& config, u32 bound)
+            {
+                if (config.fanout_distribution == FanoutDistribution::uniform)
+                {
+                    return rng.next_below(bound);
+                }
+                u32 index = (u32)(bound * std::pow(rng.next_double(), config.fanout_skew));
+                return std::min(index, bound - 1);
+            }
+
+            std::string random_hex(Random& rng, u32 bits)
+            {
+                static const char* digits = "0123456789ABCDEF";
+                std::string res;
+                for (u32 i = 0; i < std::max(bits / 4, 1u); i++)
+                {
+                    res += digits[rng.next_below(16)];
+                }
+                return res;
+            }
+        }    // namespace
+
+        Result<std::unique_ptr<Netlist>> generate(GateLibrary* gate_library, const Configuration& config)
+        {
+            if (gate_library == nullptr)
+            {
+                return ERR("could not generate netlist: gate library is a 'nullptr'");
+            }
+            if (config.gate_count == 0)
+            {
+                return ERR("could not generate netlist: gate count must be larger than 0");
+            }
+            if (config.ff_ratio < 0.0 || config.ff_ratio > 1.0)
+            {
+                return ERR("could not generate netlist: flip-flop ratio must be between 0 and 1");
+            }
+            if (config.hierarchy_depth > 0 && config.modules_per_level == 0)
+            {
+                return ERR("could not generate netlist: number of modules per level must be larger than 0");
+            }
+
+            std::vector<GateType*> comb_types;
+            for (const auto& name : COMBINATIONAL_TYPES)
+            {
+                GateType* type = gate_library->get_gate_type_by_name(name);
+                if (type == nullptr)
+                {
+                    return ERR("could not generate netlist: gate type '" + name + "' does not exist in gate library '" + gate_library->get_name() + "'");
+                }
+                comb_types.push_back(type);
+            }
+            GateType* ff_type = gate_library->get_gate_type_by_name(FF_TYPE);
+            if (ff_type == nullptr)
+            {
+                return ERR("could not generate netlist: gate type '" + FF_TYPE + "' does not exist in gate library '" + gate_library->get_name() + "'");
+            }
+
+            Random rng(config.seed);
+            auto netlist = std::make_unique<Netlist>(gate_library);
+            netlist->set_design_name("synthetic_" + std::to_string(config.gate_count));
+
+            // module nets and pins are set up once the netlist is complete, like the parsers do
+            netlist->enable_automatic_net_checks(false);
+
+            Net* clk = netlist->create_net("clk");
+            Net* en  = netlist->create_net("en");
+            netlist->mark_global_input_net(clk);
+            netlist->mark_global_input_net(en);
+
+            std::vector<Net*> inputs;
+            for (u32 i = 0; i < std::max(config.input_count, 1u); i++)
+            {
+                Net* net = netlist->create_net("in_" + std::to_string(i));
+                netlist->mark_global_input_net(net);
+                inputs.push_back(net);
+            }
+
+            // create all gates and their output nets first so that flip-flops can be driven by later gates
+            std::vector<Gate*> gates;
+            std::vector<Net*> outputs;
+            gates.reserve(config.gate_count);
+            outputs.reserve(config.gate_count);
+            for (u32 i = 0; i < config.gate_count; i++)
+            {
+                GateType* type = (rng.next_double() < config.ff_ratio) ? ff_type : comb_types.at(rng.next_below((u32)comb_types.size()));
+                Gate* gate     = netlist->create_gate(type, "g_" + std::to_string(i));
+                if (type->has_property(GateTypeProperty::c_lut))
+                {
+                    gate->set_data("generic", "INIT", "bit_vector", random_hex(rng, 1u << type->get_input_pins().size()));
+                }
+
+                Net* net = netlist->create_net("n_" + std::to_string(i));
+                net->add_source(gate, type->get_output_pins().front());
+                gates.push_back(gate);
+                outputs.push_back(net);
+            }
+
+            for (u32 i = 0; i < config.gate_count; i++)
+            {
+                Gate* gate = gates.at(i);
+                bool is_ff = gate->get_type() == ff_type;
+                for (GatePin* pin : gate->get_type()->get_input_pins())
+                {
+                    Net* driver;
+                    if (pin->get_type() == PinType::clock)
+                    {
+                        driver = clk;
+                    }
+                    else if (pin->get_type() == PinType::enable)
+                    {
+                        driver = en;
+                    }
+                    else if (is_ff)
+                    {
+                        // flip-flops may be driven by any gate, which introduces sequential feedback
+                        driver = outputs.at(pick_driver(rng, config, config.gate_count));
+                    }
+                    else if (i == 0 || rng.next_below(16) == 0)
+                    {
+                        driver = inputs.at(rng.next_below((u32)inputs.size()));
+                    }
+                    else
+                    {
+                        // combinational gates are only driven by preceding gates to avoid combinational loops
+                        driver = outputs.at(pick_driver(rng, config, i));
+                    }
+                    driver->add_destination(gate, pin);
+                }
+            }
+
+            for (Net* net : outputs)
+            {
+                if (net->get_num_of_destinations() == 0)
+                {
+                    netlist->mark_global_output_net(net);
+                }
+            }
+
+            // build the module hierarchy and distribute the gates evenly across the leaf modules
+            std::vector<Module*> level = {netlist->get_top_module()};
+            for (u32 depth = 1; depth <= config.hierarchy_depth; depth++)
+            {
+                std::vector<Module*> next_level;
+                u32 index = 0;
+                for (Module* parent : level)
+                {
+                    for (u32 j = 0; j < config.modules_per_level; j++)
+                    {
+                        next_level.push_back(netlist->create_module("m_" + std::to_string(depth) + "_" + std::to_string(index++), parent));
+                    }
+                }
+                level = std::move(next_level);
+            }
+
+            if (config.hierarchy_depth > 0)
+            {
+                u64 leaf_count = level.size();
+                for (u64 leaf = 0; leaf < leaf_count; leaf++)
+                {
+                    u64 begin = leaf * config.gate_count / leaf_count;
+                    u64 end   = (leaf + 1) * config.gate_count / leaf_count;
+                    if (begin < end)
+                    {
+                        level.at(leaf)->assign_gates(std::vector<Gate*>(gates.begin() + begin, gates.begin() + end));
+                    }
+                }
+            }
+
+            netlist->update_module_nets();
+
+            // pins are named after their nets and created in the order of the net IDs, so that equal configurations produce identical netlists
+            for (Module* module : netlist->get_modules())
+            {
+                std::vector<Net*> port_nets;
+                for (Net* net : module->get_input_nets())
+                {
+                    port_nets.push_back(net);
+                }
+                for (Net* net : module->get_output_nets())
+                {
+                    if (!module->is_input_net(net))
+                    {
+                        port_nets.push_back(net);
+                    }
+                }
+                std::sort(port_nets.begin(), port_nets.end(), [](const Net* a, const Net* b) { return a->get_id() < b->get_id(); });
+
+                for (Net* net : port_nets)
+                {
+                    if (auto res = module->create_pin(net->get_name(), net); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not generate netlist: failed to create pin for net '" + net->get_name() + "' of module '" + module->get_name() + "'");
+                    }
+                }
+            }
+
+            netlist->enable_automatic_net_checks(true);
+
+            return OK(std::move(netlist));
+        }
+
+        Result<std::monostate> write_vhdl(const Netlist* netlist, const std::filesystem::path& file_path)
+        {
+            if (netlist == nullptr)
+            {
+                return ERR("could not write VHDL file '" + file_path.string() + "': netlist is a 'nullptr'");
+            }
+
+            std::ofstream out(file_path, std::ios::trunc);
+            if (!out.is_open())
+            {
+                return ERR("could not write VHDL file '" + file_path.string() + "': failed to open file");
+            }
+
+            const std::string& design = netlist->get_design_name();
+            out << "library IEEE;\n";
+            out << "use IEEE.STD_LOGIC_1164.ALL;\n\n";
+
+            std::vector<std::string> ports;
+            for (const Net* net : netlist->get_global_input_nets())
+            {
+                ports.push_back(net->get_name() + " : in STD_LOGIC");
+            }
+            for (const Net* net : netlist->get_global_output_nets())
+            {
+                ports.push_back(net->get_name() + " : out STD_LOGIC");
+            }
+
+            out << "entity " << design << " is\n";
+            out << "  port (\n";
+            for (u32 i = 0; i < ports.size(); i++)
+            {
+                out << "    " << ports.at(i) << ((i + 1 < ports.size()) ? ";\n" : "\n");
+            }
+            out << "  );\n";
+            out << "end " << design << ";\n\n";
+
+            out << "architecture STRUCTURE of " << design << " is\n";
+            for (const Net* net : netlist->get_nets())
+            {
+                if (!net->is_global_input_net() && !net->is_global_output_net())
+                {
+                    out << "  signal " << net->get_name() << " : STD_LOGIC;\n";
+                }
+            }
+            out << "begin\n";
+
+            for (const Gate* gate : netlist->get_gates())
+            {
+                out << "  " << gate->get_name() << " : " << gate->get_type()->get_name() << "\n";
+
+                std::vector<std::string> generics;
+                for (const auto& [key, value] : gate->get_data_map())
+                {
+                    if (std::get<0>(key) == "generic" && std::get<0>(value) == "bit_vector")
+                    {
+                        generics.push_back(std::get<1>(key) + " => X\"" + std::get<1>(value) + "\"");
+                    }
+                }
+                if (!generics.empty())
+                {
+                    out << "    generic map (\n";
+                    for (u32 i = 0; i < generics.size(); i++)
+                    {
+                        out << "      " << generics.at(i) << ((i + 1 < generics.size()) ? ",\n" : "\n");
+                    }
+                    out << "    )\n";
+                }
+
+                std::vector<Endpoint*> endpoints = gate->get_fan_in_endpoints();
+                std::vector<Endpoint*> fan_out   = gate->get_fan_out_endpoints();
+                endpoints.insert(endpoints.end(), fan_out.begin(), fan_out.end());
+
+                out << "    port map (\n";
+                for (u32 i = 0; i < endpoints.size(); i++)
+                {
+                    out << "      " << endpoints.at(i)->get_pin()->get_name() << " => " << endpoints.at(i)->get_net()->get_name() << ((i + 1 < endpoints.size()) ? ",\n" : "\n");
+                }
+                out << "    );\n";
+            }
+            out << "end STRUCTURE;\n";
+
+            out.close();
+            if (out.fail())
+            {
+                return ERR("could not write VHDL file '" + file_path.string() + "': failed to write file");
+            }
+            return OK({});
+        }
+    }    // namespace netlist_generator
+}    // namespace hal
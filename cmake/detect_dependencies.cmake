@@ -209,4 +209,25 @@ if(Z3_FOUND)
 else()
     set(Missing_package "TRUE")
     message(STATUS "Could not find z3")
-endif(Z3_FOUND)
\ No newline at end of file
+endif(Z3_FOUND)
+
+################################
+#####   zlib / zstd
+################################
+
+find_package(ZLIB REQUIRED)
+message(VERBOSE "Found zlib ${ZLIB_VERSION_STRING}")
+
+# zstd is optional, compressed inputs in zstd format are rejected if it is missing
+pkg_check_modules(ZSTD IMPORTED_TARGET libzstd)
+if(ZSTD_FOUND)
+    message(STATUS "Found zstd ${ZSTD_VERSION}")
+    add_library(zstd::zstd INTERFACE IMPORTED)
+    set_target_properties(zstd::zstd PROPERTIES
+                          INTERFACE_LINK_LIBRARIES PkgConfig::ZSTD
+                          INTERFACE_COMPILE_DEFINITIONS HAL_HAS_ZSTD
+                          )
+else()
+    message(STATUS "zstd not found, support for zstd-compressed files is disabled")
+    add_library(zstd::zstd INTERFACE IMPORTED)
+endif()
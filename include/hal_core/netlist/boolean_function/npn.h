@@ -0,0 +1,211 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/netlist_utils.h"
+#include "hal_core/utilities/result.h"
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    namespace NPN
+    {
+        /**
+         * The truth table of a single-output Boolean function of up to 8 input variables.
+         * Bit `m` of the table holds the function value for input assignment `m`, where variable `i` corresponds to bit `i` of `m`.
+         * The 2^n bits are packed into 64-bit words starting at the least significant bit, unused bits are always zero.
+         */
+        struct CORE_API TruthTable
+        {
+            /// The number of input variables.
+            u32 num_variables = 0;
+            /// The packed truth table.
+            std::array<u64, 4> words = {0, 0, 0, 0};
+
+            /**
+             * Construct a truth table from a vector of 64-bit words as used by `netlist_utils::Cut`.
+             *
+             * @param[in] words - The packed truth table.
+             * @param[in] num_variables - The number of input variables.
+             * @returns The truth table on success, an error otherwise.
+             */
+            static Result<TruthTable> from_words(const std::vector<u64>& words, u32 num_variables);
+
+            /**
+             * Construct a truth table from the output of `BooleanFunction::compute_truth_table` for a single output bit.
+             *
+             * @param[in] values - The function values for all 2^n input assignments.
+             * @returns The truth table on success, an error otherwise.
+             */
+            static Result<TruthTable> from_values(const std::vector<BooleanFunction::Value>& values);
+
+            /**
+             * Get the packed truth table as a vector of 64-bit words.
+             *
+             * @returns A vector holding max(1, 2^n / 64) words.
+             */
+            std::vector<u64> to_words() const;
+
+            bool operator==(const TruthTable& other) const;
+            bool operator!=(const TruthTable& other) const;
+            bool operator<(const TruthTable& other) const;
+        };
+
+        /**
+         * An NPN transformation, i.e., a negation of inputs, followed by a permutation of inputs, followed by an optional negation of the output.
+         */
+        struct CORE_API Transform
+        {
+            /// Bit `i` is set if input variable `i` is negated.
+            u32 input_negations = 0;
+            /// Input variable `i` becomes variable `permutation[i]` of the transformed function.
+            std::vector<u32> permutation;
+            /// Whether the output is negated.
+            bool output_negation = false;
+        };
+
+        /**
+         * The NPN canonical form of a truth table together with the transformation that yields it.
+         */
+        struct CORE_API CanonicalForm
+        {
+            /// The canonical truth table, which is identical for all functions of the same NPN class.
+            TruthTable truth_table;
+            /// The transformation that turns the original truth table into the canonical one.
+            Transform transform;
+        };
+
+        /**
+         * Apply an NPN transformation to a truth table.
+         *
+         * @param[in] truth_table - The truth table.
+         * @param[in] transform - The transformation, whose permutation must cover all variables of the truth table.
+         * @returns The transformed truth table on success, an error otherwise.
+         */
+        CORE_API Result<TruthTable> apply_transform(const TruthTable& truth_table, const Transform& transform);
+
+        /**
+         * Compute the NPN canonical form of a truth table, which is identical for all functions of the same NPN class.<br>
+         * Output and input polarities are normalized by their number of ones and inputs are ordered by their cofactor weights, which are invariant under NPN transformations.
+         * The canonical form is the smallest truth table among the transformations that respect this normalization, which is not necessarily the smallest truth table of the whole NPN class.
+         * For example, `f = x0` is canonicalized to `0b10` rather than `0b01`.
+         * Only polarities that are not fixed by the number of ones and orders of inputs with equal cofactor weights are enumerated, while variables that are symmetric in the function are not permuted against each other.
+         * Since the number of enumerated transformations grows factorially with the size of these ties, canonicalization may take exponential time for functions with many inputs, e.g., 8-input functions with many ties.
+         * All transformations are applied using word-level bit-twiddling on the packed truth table.
+         *
+         * @param[in] truth_table - The truth table.
+         * @returns The canonical form.
+         */
+        CORE_API CanonicalForm canonicalize(const TruthTable& truth_table);
+
+        /**
+         * A function of a library that matched a cut of a net.
+         */
+        struct CORE_API Match
+        {
+            /// The net whose cut matched.
+            Net* net;
+            /// The matched cut.
+            netlist_utils::Cut cut;
+            /// The name of the matched library function.
+            std::string name;
+            /// The transformation that turns the function of the cut into the canonical form.
+            Transform cut_transform;
+            /// The transformation that turns the library function into the canonical form.
+            Transform library_transform;
+        };
+
+        /**
+         * A collection of named functions indexed by their NPN canonical form.
+         */
+        class CORE_API Library
+        {
+        public:
+            /**
+             * Add a function to the library.
+             *
+             * @param[in] name - The name of the function.
+             * @param[in] truth_table - The truth table of the function.
+             */
+            void add_function(const std::string& name, const TruthTable& truth_table);
+
+            /**
+             * Add a single-output Boolean function of at most 8 variables to the library.
+             *
+             * @param[in] name - The name of the function.
+             * @param[in] function - The Boolean function.
+             * @param[in] ordered_variables - The order of input variables used to compute the truth table, defaults to the alphabetical order.
+             * @returns Ok() on success, an error otherwise.
+             */
+            Result<std::monostate> add_function(const std::string& name, const BooleanFunction& function, const std::vector<std::string>& ordered_variables = {});
+
+            /**
+             * Get the number of functions within the library.
+             *
+             * @returns The number of functions.
+             */
+            u32 size() const;
+
+            /**
+             * Find all library functions that are NPN-equivalent to the given truth table.
+             *
+             * @param[in] truth_table - The truth table.
+             * @returns The names of the matching functions.
+             */
+            std::vector<std::string> find(const TruthTable& truth_table) const;
+
+            /**
+             * Match the cuts of all nets against the library in parallel.
+             * Trivial cuts and cuts without truth tables are skipped.
+             *
+             * @param[in] cuts - The enumerated cuts.
+             * @returns All matches ordered by net and cut.
+             */
+            std::vector<Match> match(const netlist_utils::CutEnumeration& cuts) const;
+
+        private:
+            struct Entry
+            {
+                std::string name;
+                Transform transform;
+            };
+
+            struct TruthTableHash
+            {
+                std::size_t operator()(const TruthTable& truth_table) const;
+            };
+
+            std::unordered_map<TruthTable, std::vector<Entry>, TruthTableHash> m_index;
+            u32 m_size = 0;
+        };
+    }    // namespace NPN
+}    // namespace hal
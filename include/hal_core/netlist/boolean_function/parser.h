@@ -231,5 +231,21 @@ namespace hal
          */
         Result<BooleanFunction> translate(std::vector<Token>&& tokens, const std::string& expression);
 
+        /**
+         * Parses a Boolean function from a string representation by means of a hand-written
+         * recursive-descent parser that directly emits the nodes of the Boolean function, i.e.,
+         * without an intermediate list of tokens and the translation to reverse-polish notation.
+         * 
+         * The resulting Boolean function is identical to the one obtained by tokenizing the 
+         * expression with the respective grammar, followed by `reverse_polish_notation` and 
+         * `translate`. In contrast to the token-based Liberty grammar, whitespace next to an 
+         * operator is ignored and only whitespace in between two operands denotes an `AND`.
+         * 
+         * @param[in] expression - Boolean function string.
+         * @param[in] parser - Parser identifier.
+         * @returns Ok() and the Boolean function on success, Err() otherwise.
+         */
+        Result<BooleanFunction> parse_expression(const std::string& expression, const ParserType& parser);
+
     }    // namespace BooleanFunctionParser
 }    // namespace hal
@@ -26,8 +26,11 @@
 #pragma once
 
 #include "hal_core/defines.h"
+#include "hal_core/netlist/lazy_data_source.h"
 
+#include <atomic>
 #include <map>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -119,7 +122,41 @@ namespace hal
          */
         void set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map);
 
+        /**
+         * Replace the existing data with entries that are decoded from the given source when they are accessed for the first time.<br>
+         * Used by deserializers to defer decoding, does not count as a modification of the data.
+         *
+         * @param[in] source - The source holding the encoded entries.
+         * @param[in] offset - The offset of the encoded entries within the source.
+         * @param[in] size - The size of the encoded entries within the source.
+         */
+        void set_lazy_data(std::shared_ptr<const LazyDataSource> source, u64 offset, u64 size);
+
+        /**
+         * Check whether the data entries have not been decoded yet.
+         *
+         * @returns True if decoding is still pending, false otherwise.
+         */
+        bool has_lazy_data() const;
+
     protected:
-        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> m_data;
+        // decoded on first access if loaded lazily
+        mutable std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> m_data;
+
+        /**
+         * Decode lazily loaded data entries if this has not happened yet.<br>
+         * Must be called before accessing the stored data.
+         */
+        void load_lazy_data() const;
+
+        /**
+         * Called whenever the stored data has been modified.<br>
+         * Entities override this to notify their event handler.
+         */
+        virtual void notify_updated();
+
+    private:
+        mutable std::atomic<bool> m_has_lazy_data{false};
+        mutable std::unique_ptr<LazyDataReference> m_lazy_data;
     };
 }    // namespace hal
@@ -70,8 +70,9 @@ namespace hal
             created,                    ///< no associated_data
             removed,                    ///< no associated_data
             name_changed,               ///< no associated_data
-            location_changed,           ///< no associated_data
-            boolean_function_changed    ///< no associated_data
+            location_changed,            ///< no associated_data
+            boolean_function_changed,    ///< no associated_data
+            data_changed                 ///< no associated_data
         };
     };
 
@@ -89,7 +90,8 @@ namespace hal
             src_added,       ///< associated_data = id of src gate
             src_removed,     ///< associated_data = id of src gate
             dst_added,       ///< associated_data = id of dst gate
-            dst_removed      ///< associated_data = id of dst gate
+            dst_removed,     ///< associated_data = id of dst gate
+            data_changed     ///< no associated_data
         };
     };
 
@@ -115,6 +117,7 @@ namespace hal
             gates_remove_end,      ///< associated_data = number of removed gates
             gate_removed,          ///< associated_data = id of removed gate
             pin_changed,           ///< no associated_data
+            data_changed,          ///< no associated_data
         };
     };
 
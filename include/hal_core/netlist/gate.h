@@ -32,6 +32,7 @@
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate_library/gate_type.h"
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -223,6 +224,16 @@ namespace hal
          */
         bool add_boolean_function(const std::string& name, const BooleanFunction& func);
 
+        /**
+         * Replace the custom Boolean functions of the gate with functions that are decoded from the given source when they are accessed for the first time.<br>
+         * Used by deserializers to defer parsing, does not count as a modification of the gate.
+         *
+         * @param[in] source - The source holding the encoded functions.
+         * @param[in] offset - The offset of the encoded functions within the source.
+         * @param[in] size - The size of the encoded functions within the source.
+         */
+        void set_lazy_boolean_functions(std::shared_ptr<const LazyDataSource> source, u64 offset, u64 size);
+
         /**
          * Mark this gate as a global vcc gate.
          *
@@ -471,6 +482,8 @@ namespace hal
 
         BooleanFunction get_lut_function(const GatePin* pin) const;
 
+        void notify_updated() override;
+
         /* pointer to corresponding netlist parent */
         NetlistInternalManager* m_internal_manager;
 
@@ -499,8 +512,12 @@ namespace hal
         std::vector<Net*> m_in_nets;
         std::vector<Net*> m_out_nets;
 
-        /* dedicated functions */
-        std::unordered_map<std::string, BooleanFunction> m_functions;
+        /* dedicated functions, decoded on first access if loaded lazily */
+        mutable std::unordered_map<std::string, BooleanFunction> m_functions;
+        mutable std::atomic<bool> m_has_lazy_functions{false};
+        mutable std::unique_ptr<LazyDataReference> m_lazy_functions;
+
+        void load_lazy_boolean_functions() const;
 
         EventHandler* m_event_handler;
     };
@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <memory>
+
+namespace hal
+{
+    class GateLibrary;
+
+    /**
+     * The gate library cache stores fully parsed gate libraries in a versioned binary format so that subsequent loads do not have to parse the original gate library file again.
+     * A cache file holds the gate types including their pins, pin groups, components, and Boolean functions, the latter being stored as pre-parsed node vectors.
+     * Each cache file is keyed by the absolute path, the modification time, the size, and a content hash of the original gate library file and is discarded as soon as any of them no longer matches.
+     *
+     * @ingroup gate_lib
+     */
+    namespace gate_library_cache
+    {
+        /**
+         * Get the default location of the cache file for the given gate library file within the user share directory.
+         *
+         * @param[in] file_path - The path to the gate library file.
+         * @returns The path to the cache file.
+         */
+        NETLIST_API std::filesystem::path get_cache_path(const std::filesystem::path& file_path);
+
+        /**
+         * Write the given gate library to a cache file.
+         * The gate library file is read to compute the key of the cache file.
+         * The cache file is first written to a temporary file that then replaces any existing cache file.
+         *
+         * @param[in] gate_lib - The gate library.
+         * @param[in] file_path - The path to the gate library file the gate library was parsed from.
+         * @param[in] cache_path - The path to the cache file.
+         * @returns Ok on success, an error otherwise.
+         */
+        NETLIST_API Result<std::monostate> write(const GateLibrary* gate_lib, const std::filesystem::path& file_path, const std::filesystem::path& cache_path);
+
+        /**
+         * Read a gate library from a cache file by memory-mapping it.
+         * Fails if the cache file does not exist, has been written by an incompatible version, or does not match the current state of the gate library file.
+         *
+         * @param[in] file_path - The path to the gate library file the cache file was created for.
+         * @param[in] cache_path - The path to the cache file.
+         * @returns The gate library on success, an error otherwise.
+         */
+        NETLIST_API Result<std::unique_ptr<GateLibrary>> read(const std::filesystem::path& file_path, const std::filesystem::path& cache_path);
+    }    // namespace gate_library_cache
+}    // namespace hal
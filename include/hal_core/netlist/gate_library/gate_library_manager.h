@@ -26,8 +26,12 @@
 #pragma once
 
 #include "hal_core/defines.h"
+#include "hal_core/netlist/gate_library/gate_library_manifest.h"
 
 #include <filesystem>
+#include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace hal
@@ -91,7 +95,7 @@ namespace hal
         NETLIST_API GateLibrary* get_gate_library(const std::string& file_path);
 
         /**
-         * Get a gate library by name. If no library with the given name is loaded, a nullptr will be returned.
+         * Get a gate library by name. If no library with the given name is loaded, the gate library manifest is consulted to load it from the standard gate library directories.
          *
          * @param[in] lib_name - The name of the gate library.
          * @returns The gate library on success, nullptr otherwise.
@@ -105,5 +109,34 @@ namespace hal
          */
         NETLIST_API std::vector<GateLibrary*> get_gate_libraries();
 
+        /**
+         * Get the gate library manifest describing all gate library files within the standard gate library directories.
+         * On first use, the manifest is read from the user share directory and only new or modified gate library files are loaded to update it.
+         * The manifest is persisted again whenever it changes.
+         *
+         * @param[in] rescan - If true, scans the gate library directories again even if the manifest has already been built.
+         * @returns The manifest entries.
+         */
+        NETLIST_API const std::vector<gate_library_manifest::Entry>& get_manifest(bool rescan = false);
+
+        /**
+         * Load all gate libraries from the standard gate library directories that may provide a gate type for each of the given gate type names according to the gate library manifest.
+         * Since the manifest is based on Bloom filters, some of the returned gate libraries may still lack a required gate type.
+         *
+         * @param[in] gate_type_names - The names of the required gate types.
+         * @returns The loaded gate libraries.
+         */
+        NETLIST_API std::vector<GateLibrary*> load_by_gate_types(const std::unordered_set<std::string>& gate_type_names);
+
+        /**
+         * Rank all loaded gate libraries by the fraction of the given gate type names they provide a gate type for.
+         * Names are compared case-insensitively, so the coverage may be overestimated for case-sensitive netlist formats.
+         * The lookup uses an index from gate type names to gate libraries that is rebuilt whenever a gate library is loaded or removed.
+         *
+         * @param[in] gate_type_names - The names of the required gate types.
+         * @returns Pairs of gate library and covered fraction in [0, 1], sorted by decreasing coverage.
+         */
+        NETLIST_API std::vector<std::pair<GateLibrary*, double>> get_gate_libraries_by_coverage(const std::unordered_set<std::string>& gate_type_names);
+
     }    // namespace gate_library_manager
 }    // namespace hal
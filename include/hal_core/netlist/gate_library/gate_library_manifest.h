@@ -0,0 +1,129 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace hal
+{
+    class GateLibrary;
+
+    /**
+     * The gate library manifest is a lightweight summary of all gate library files found in the gate library directories.
+     * It allows to decide which gate libraries may be required for a task without parsing every gate library file.
+     * The manifest is built when the gate library directories are scanned for the first time and persisted within the user share directory.
+     *
+     * @ingroup gate_lib
+     */
+    namespace gate_library_manifest
+    {
+        /**
+         * A manifest entry describing a single gate library file.
+         * The gate type names of the gate library are stored in a Bloom filter, i.e., a lookup may yield false positives but never false negatives.
+         * Names are compared case-insensitively.
+         */
+        struct NETLIST_API Entry
+        {
+            /// The absolute path to the gate library file.
+            std::filesystem::path path;
+
+            /// The name of the gate library, empty if the file could not be loaded as a gate library.
+            std::string name;
+
+            /// The modification time of the gate library file when the entry was created.
+            u64 mtime = 0;
+
+            /// The size of the gate library file in bytes when the entry was created.
+            u64 size = 0;
+
+            /// The number of gate types within the gate library.
+            u32 num_gate_types = 0;
+
+            /// The Bloom filter holding the lower case gate type names.
+            std::vector<u64> gate_type_filter;
+
+            /**
+             * Check whether the gate library may contain a gate type of the given name.
+             *
+             * @param[in] gate_type_name - The name of the gate type.
+             * @returns `true` if the gate library may contain the gate type, `false` if it definitely does not.
+             */
+            bool may_contain_gate_type(const std::string& gate_type_name) const;
+
+            /**
+             * Check whether the entry still matches the modification time and size of the gate library file.
+             *
+             * @returns `true` if the entry is up to date, `false` otherwise.
+             */
+            bool is_up_to_date() const;
+
+            /**
+             * Check whether the entry describes a loadable gate library.
+             *
+             * @returns `true` if the file could be loaded as a gate library, `false` otherwise.
+             */
+            bool is_valid() const;
+        };
+
+        /**
+         * Create a manifest entry for a gate library.
+         *
+         * @param[in] file_path - The path to the gate library file.
+         * @param[in] gate_lib - The gate library parsed from the file or a `nullptr` if the file could not be loaded.
+         * @returns The manifest entry.
+         */
+        NETLIST_API Entry create_entry(const std::filesystem::path& file_path, const GateLibrary* gate_lib);
+
+        /**
+         * Get the default location of the manifest file within the user share directory.
+         *
+         * @returns The path to the manifest file.
+         */
+        NETLIST_API std::filesystem::path get_manifest_path();
+
+        /**
+         * Write manifest entries to a file.
+         *
+         * @param[in] entries - The manifest entries.
+         * @param[in] manifest_path - The path to the manifest file.
+         * @returns Ok on success, an error otherwise.
+         */
+        NETLIST_API Result<std::monostate> write(const std::vector<Entry>& entries, const std::filesystem::path& manifest_path);
+
+        /**
+         * Read manifest entries from a file.
+         *
+         * @param[in] manifest_path - The path to the manifest file.
+         * @returns The manifest entries on success, an error otherwise.
+         */
+        NETLIST_API Result<std::vector<Entry>> read(const std::filesystem::path& manifest_path);
+    }    // namespace gate_library_manifest
+}    // namespace hal
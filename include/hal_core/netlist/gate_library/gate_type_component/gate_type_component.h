@@ -46,14 +46,15 @@ namespace hal
          */
         enum class ComponentType
         {
-            lut,     /**< LUT component type. */
-            ff,      /**< Flip-flop component type. */
-            latch,   /**< Latch component type. */
-            ram,     /**< RAM component type. */
-            mac,     /**< MAC component type. */
-            init,    /**< Initialization component type. */
-            state,   /**< State component type. */
-            ram_port /**< RAM port component type. */
+            lut,      /**< LUT component type. */
+            ff,       /**< Flip-flop component type. */
+            latch,    /**< Latch component type. */
+            ram,      /**< RAM component type. */
+            mac,      /**< MAC component type. */
+            init,     /**< Initialization component type. */
+            state,    /**< State component type. */
+            ram_port, /**< RAM port component type. */
+            timing    /**< Timing component type. */
         };
 
         /**
@@ -136,6 +137,15 @@ namespace hal
                                                                             const BooleanFunction& enable_bf,
                                                                             bool is_write);
 
+        /**
+         * Create a new TimingComponent with given child component.
+         * Timing arcs, pin capacitances, leakage power, and area have to be set afterwards.
+         * 
+         * @param[in] component - Another component to be added as a child component.
+         * @returns The TimingComponent.
+         */
+        static std::unique_ptr<GateTypeComponent> create_timing_component(std::unique_ptr<GateTypeComponent> component);
+
         /**
          * Get the type of the gate type component.
          * 
@@ -0,0 +1,255 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "hal_core/netlist/gate_library/gate_type_component/gate_type_component.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    class TimingComponent : public GateTypeComponent
+    {
+    public:
+        /**
+         * A non-linear delay model (NLDM) lookup table as used in Liberty files.
+         * The values are stored in row-major order, i.e., the value for the i-th entry of the first index and the j-th entry of the second index is located at position `i * index_2.size() + j`.
+         * One-dimensional tables do not have a second index, scalar tables do not have any index and hold a single value.
+         */
+        struct LookupTable
+        {
+            /**
+             * The variable described by the first index, e.g., 'input_net_transition'.
+             */
+            std::string variable_1;
+
+            /**
+             * The variable described by the second index, e.g., 'total_output_net_capacitance'.
+             */
+            std::string variable_2;
+
+            /**
+             * The breakpoints of the first index.
+             */
+            std::vector<double> index_1;
+
+            /**
+             * The breakpoints of the second index.
+             */
+            std::vector<double> index_2;
+
+            /**
+             * The table values in row-major order.
+             */
+            std::vector<double> values;
+
+            /**
+             * Check whether the table holds any values.
+             *
+             * @returns True if the table is empty, false otherwise.
+             */
+            bool is_empty() const;
+
+            /**
+             * Evaluate the table for the given values of the first and second variable using bilinear interpolation.
+             * Values outside of the range of an index are linearly extrapolated from the two closest breakpoints.
+             * Returns 0 for empty tables.
+             *
+             * @param[in] value_1 - The value of the first variable.
+             * @param[in] value_2 - The value of the second variable, ignored for tables with less than two dimensions.
+             * @returns The interpolated value.
+             */
+            double evaluate(double value_1, double value_2 = 0.0) const;
+
+            bool operator==(const LookupTable& other) const;
+            bool operator!=(const LookupTable& other) const;
+        };
+
+        /**
+         * A timing arc from a related (input) pin to a pin of the gate type.
+         */
+        struct TimingArc
+        {
+            /**
+             * The name of the pin the arc ends at.
+             */
+            std::string pin;
+
+            /**
+             * The name of the pin the arc starts at.
+             */
+            std::string related_pin;
+
+            /**
+             * The unateness of the arc, e.g., 'positive_unate'.
+             */
+            std::string timing_sense;
+
+            /**
+             * The type of the arc, e.g., 'combinational' or 'rising_edge'.
+             */
+            std::string timing_type;
+
+            /**
+             * The propagation delay for a rising transition at the pin.
+             */
+            LookupTable cell_rise;
+
+            /**
+             * The propagation delay for a falling transition at the pin.
+             */
+            LookupTable cell_fall;
+
+            /**
+             * The transition time for a rising transition at the pin.
+             */
+            LookupTable rise_transition;
+
+            /**
+             * The transition time for a falling transition at the pin.
+             */
+            LookupTable fall_transition;
+
+            bool operator==(const TimingArc& other) const;
+            bool operator!=(const TimingArc& other) const;
+        };
+
+        /**
+         * Construct a new TimingComponent with given child component.
+         *
+         * @param[in] component - Another component to be added as a child component.
+         */
+        TimingComponent(std::unique_ptr<GateTypeComponent> component);
+
+        /**
+         * Get the type of the gate type component.
+         *
+         * @returns The type of the gate type component.
+         */
+        ComponentType get_type() const override;
+
+        /**
+         * Check whether a component is a TimingComponent.
+         *
+         * @param[in] component - The component to check.
+         * @returns True if component is a TimingComponent, false otherwise.
+         */
+        static bool is_class_of(const GateTypeComponent* component);
+
+        /**
+         * Get the sub-components of the gate type component.
+         * A user-defined filter may be applied to the result vector, but is disabled by default.
+         *
+         * @param[in] filter - The user-defined filter function applied to all candidate components.
+         * @returns The sub-components of the gate type component.
+         */
+        std::vector<GateTypeComponent*> get_components(const std::function<bool(const GateTypeComponent*)>& filter = nullptr) const override;
+
+        /**
+         * Get all timing arcs of the gate type.
+         *
+         * @returns The timing arcs.
+         */
+        const std::vector<TimingArc>& get_timing_arcs() const;
+
+        /**
+         * Get all timing arcs ending at the given pin.
+         *
+         * @param[in] pin - The name of the pin.
+         * @returns The timing arcs ending at the pin.
+         */
+        std::vector<TimingArc> get_timing_arcs(const std::string& pin) const;
+
+        /**
+         * Add a timing arc to the gate type.
+         *
+         * @param[in] arc - The timing arc.
+         */
+        void add_timing_arc(const TimingArc& arc);
+
+        /**
+         * Get the input capacitances of all pins for which a capacitance is specified.
+         *
+         * @returns A map from pin name to capacitance.
+         */
+        const std::unordered_map<std::string, double>& get_pin_capacitances() const;
+
+        /**
+         * Get the input capacitance of the given pin.
+         * Returns 0 if no capacitance is specified for the pin.
+         *
+         * @param[in] pin - The name of the pin.
+         * @returns The capacitance of the pin.
+         */
+        double get_pin_capacitance(const std::string& pin) const;
+
+        /**
+         * Set the input capacitance of the given pin.
+         *
+         * @param[in] pin - The name of the pin.
+         * @param[in] capacitance - The capacitance of the pin.
+         */
+        void set_pin_capacitance(const std::string& pin, double capacitance);
+
+        /**
+         * Get the leakage power of the gate type.
+         *
+         * @returns The leakage power.
+         */
+        double get_leakage_power() const;
+
+        /**
+         * Set the leakage power of the gate type.
+         *
+         * @param[in] leakage_power - The leakage power.
+         */
+        void set_leakage_power(double leakage_power);
+
+        /**
+         * Get the area of the gate type.
+         *
+         * @returns The area.
+         */
+        double get_area() const;
+
+        /**
+         * Set the area of the gate type.
+         *
+         * @param[in] area - The area.
+         */
+        void set_area(double area);
+
+    private:
+        static constexpr ComponentType m_type          = ComponentType::timing;
+        std::unique_ptr<GateTypeComponent> m_component = nullptr;
+
+        std::vector<TimingArc> m_timing_arcs;
+        std::unordered_map<std::string, double> m_pin_capacitances;
+        double m_leakage_power = 0.0;
+        double m_area          = 0.0;
+    };
+}    // namespace hal
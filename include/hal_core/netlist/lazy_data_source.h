@@ -0,0 +1,94 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+namespace hal
+{
+    /* forward declaration */
+    class BooleanFunction;
+
+    /**
+     * Source of data entries and custom Boolean functions that are decoded only when they are accessed for the first time.<br>
+     * A source is shared by all objects of a netlist that have been loaded lazily and keeps the encoded representation (e.g., the mapped .hal file) alive until the last of them has been decoded or deleted.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API LazyDataSource
+    {
+    public:
+        virtual ~LazyDataSource() = default;
+
+        /**
+         * Decode the data entries of a single object.
+         *
+         * @param[in] offset - The offset of the encoded entries as assigned by the deserializer.
+         * @param[in] size - The size of the encoded entries as assigned by the deserializer.
+         * @returns A map from ((1) category, (2) key) to ((1) type, (2) value) on success, an error otherwise.
+         */
+        virtual Result<std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>> decode_data(u64 offset, u64 size) const = 0;
+
+        /**
+         * Decode the custom Boolean functions of a single gate.
+         *
+         * @param[in] offset - The offset of the encoded functions as assigned by the deserializer.
+         * @param[in] size - The size of the encoded functions as assigned by the deserializer.
+         * @returns A map from function name to Boolean function on success, an error otherwise.
+         */
+        virtual Result<std::unordered_map<std::string, BooleanFunction>> decode_functions(u64 offset, u64 size) const = 0;
+    };
+
+    /**
+     * Location of the encoded data entries or functions of a single object within a lazy data source.
+     *
+     * @ingroup netlist
+     */
+    struct LazyDataReference
+    {
+        /**
+         * The source holding the encoded representation.
+         */
+        std::shared_ptr<const LazyDataSource> source;
+
+        /**
+         * The offset within the source.
+         */
+        u64 offset;
+
+        /**
+         * The size within the source.
+         */
+        u64 size;
+    };
+}    // namespace hal
@@ -232,6 +232,15 @@ namespace hal
          */
         void update_nets();
 
+        /**
+         * Check the connectivity of a single net with respect to this module and all of its parent modules and update their nets, internal nets, input nets, output nets, and pins accordingly.
+         * Intended to re-synchronize the affected modules after a batch of edits that have been performed with automatic net checks disabled using `Netlist::enable_automatic_net_checks`.
+         *
+         * @param[in] net - The net to check.
+         * @returns Ok on success, an error otherwise.
+         */
+        Result<std::monostate> update_net(Net* net);
+
         /**
          * Check whether a net is contained in the module.<br>
          * If \p recursive is set to true, nets in submodules are considered as well.
@@ -547,6 +556,14 @@ namespace hal
          */
         Result<std::monostate> remove_pin_from_group(PinGroup<ModulePin>* pin_group, ModulePin* pin, bool delete_empty_groups = true);
 
+        /**
+         * Delete all pins and pin groups of the module, e.g., before restoring them from a saved state.
+         * \warning{\b WARNING: can only be used when automatic net checks have been disabled using `Netlist::enable_automatic_net_checks`.}
+         *
+         * @returns Ok on success, an error message otherwise.
+         */
+        Result<std::monostate> clear_pins();
+
         /*
          * ################################################################
          *      gate functions
@@ -627,6 +644,8 @@ namespace hal
         Module(const Module&) = delete;               //disable copy-constructor
         Module& operator=(const Module&) = delete;    //disable copy-assignment
 
+        void notify_updated() override;
+
         struct NetConnectivity
         {
             bool has_internal_source;
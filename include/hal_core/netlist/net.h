@@ -388,6 +388,8 @@ namespace hal
         Net& operator=(const Net&) = delete;
         Net& operator=(Net&&) = delete;
 
+        void notify_updated() override;
+
         NetlistInternalManager* m_internal_manager;
 
         /* stores the id of the net */
@@ -438,6 +438,21 @@ namespace hal
          */
         void enable_automatic_net_checks(bool enable_checks = true);
 
+        /**
+         * Pre-allocates memory for the given number of gates, nets, and modules, e.g., before deserializing a netlist of known size.
+         *
+         * @param[in] num_gates - The expected number of gates.
+         * @param[in] num_nets - The expected number of nets.
+         * @param[in] num_modules - The expected number of modules.
+         */
+        void reserve(u32 num_gates, u32 num_nets, u32 num_modules);
+
+        /**
+         * Recomputes the nets, input nets, output nets, and internal nets of all modules from scratch, processing the modules in parallel.<br>
+         * Meant to be called once after the netlist has been built with automatic net checks disabled.
+         */
+        void update_module_nets();
+
         /*
          * ################################################################
          *      module functions
@@ -846,9 +861,11 @@ namespace hal
         std::unordered_set<Grouping*> m_groupings_set;
         std::vector<Grouping*> m_groupings;
 
-        /* stores the set of global gates and nets */
+        /* stores the set of global gates and nets, the sets allow for constant-time lookups on large netlists */
         std::vector<Net*> m_global_input_nets;
+        std::unordered_set<const Net*> m_global_input_nets_set;
         std::vector<Net*> m_global_output_nets;
+        std::unordered_set<const Net*> m_global_output_nets_set;
         std::vector<Gate*> m_gnd_gates;
         std::vector<Gate*> m_vcc_gates;
     };
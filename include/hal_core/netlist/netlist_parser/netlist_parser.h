@@ -30,6 +30,9 @@
 #include "hal_core/utilities/result.h"
 
 #include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_set>
 
 namespace hal
 {
@@ -61,6 +64,17 @@ namespace hal
          */
         virtual Result<std::unique_ptr<Netlist>> instantiate(const GateLibrary* gate_library) = 0;
 
+        /**
+         * Get the names of all types instantiated within the parsed netlist that are not defined by the netlist itself and hence must be provided as gate types by the gate library.
+         * Used to quickly rank gate libraries by coverage before instantiating the netlist.
+         *
+         * @returns The names of the required gate types, or an empty optional if the parser cannot determine them.
+         */
+        virtual std::optional<std::unordered_set<std::string>> get_required_gate_types() const
+        {
+            return std::nullopt;
+        }
+
         /**
          * Parse and instantiate a netlist using the specified gate library.
          *
@@ -29,7 +29,9 @@
 #include "hal_core/netlist/boolean_function.h"
 #include "hal_core/netlist/netlist.h"
 
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace hal
 {
@@ -333,5 +335,216 @@ namespace hal
          * @return A vector of gates that connect the start with end gate (possibly in reverse order).
          */
         CORE_API std::vector<Gate*> get_shortest_path(Gate* start_gate, Gate* end_gate, bool search_both_directions = false);
+
+        /**
+         * Configuration of the netlist sweep that determines which optimizations are applied.
+         */
+        struct SweepConfig
+        {
+            /// Replace combinational gate outputs that evaluate to a constant given the GND and VCC nets at their inputs by the GND or VCC net.
+            bool propagate_constants = true;
+            /// Remove combinational gates that do not drive any destination or global output net.
+            bool remove_dangling_logic = true;
+            /// Bypass combinational gates that pass through one of their inputs.
+            bool collapse_buffers = true;
+            /// Bypass pairs of chained combinational gates that invert the same signal twice.
+            bool collapse_inverter_pairs = true;
+            /// Merge combinational gates of the same type that are driven by the same nets and implement the same functions.
+            bool merge_duplicate_gates = true;
+        };
+
+        /**
+         * Statistics on the changes a netlist sweep applied to the netlist.
+         */
+        struct SweepStatistics
+        {
+            /// The number of gate outputs that have been replaced by the GND or VCC net.
+            u32 propagated_constants = 0;
+            /// The number of buffers that have been bypassed.
+            u32 collapsed_buffers = 0;
+            /// The number of inverter pairs that have been bypassed.
+            u32 collapsed_inverter_pairs = 0;
+            /// The number of gates that have been merged into structurally identical gates.
+            u32 merged_gates = 0;
+            /// The number of gates that have been removed from the netlist.
+            u32 removed_gates = 0;
+            /// The number of nets that have been removed from the netlist.
+            u32 removed_nets = 0;
+        };
+
+        /**
+         * Sweep the combinational logic of the netlist until no further simplification is possible.
+         * Starting from all combinational gates, a worklist is processed that propagates constant GND and VCC inputs through the Boolean functions of the gates,
+         * bypasses buffers as well as inverter pairs, merges structurally identical gates, and removes logic that does not drive any destination or global output net.
+         * Whenever a gate is changed, only the gates in its direct neighborhood are revisited.
+         * The netlist is edited with automatic net checks disabled and the affected modules are updated once all edits have been applied.
+         * Sequential gates, global output nets, and gates without Boolean functions for their output pins are never altered beyond being rewired at their inputs.
+         *
+         * @param[in] netlist - The target netlist.
+         * @param[in] config - The sweep configuration, defaults to all optimizations being enabled.
+         * @returns Statistics on the applied changes on success, an error otherwise.
+         */
+        CORE_API Result<SweepStatistics> sweep(Netlist* netlist, const SweepConfig& config = SweepConfig());
+
+        /**
+         * Merge all structurally identical combinational gates of the netlist, i.e., gates of the same type that are driven by the same signals at each input pin and implement the same custom Boolean functions and INIT data.
+         * Gates are hashed bottom-up in topological order while signals driven by already merged gates are identified with the signals of their representatives.
+         * Hence, duplicated logic cones are merged in a single pass without iterating until a fixed point is reached. All gates of a topological level are hashed in parallel.
+         * Gates within combinational loops are never merged. Gates driving global output nets are kept, but their successors may still be merged.
+         *
+         * @param[in] netlist - The target netlist.
+         * @returns The number of merged and thereby removed gates on success, an error otherwise.
+         */
+        CORE_API Result<u32> merge_duplicate_gates(Netlist* netlist);
+
+        /**
+         * Compute a simulation signature for every net of the netlist by simulating its combinational logic on random input patterns.
+         * Nets that are not driven by exactly one combinational gate, e.g., global input nets or nets driven by sequential gates, are assigned pseudo-random patterns derived from the seed and their ID.
+         * Nets driven by GND and VCC gates are assigned constant patterns. Gates are simulated 64 patterns at a time in topological order and all gates of a topological level are simulated in parallel.
+         * Gates within combinational loops and gates with Boolean functions that cannot be simulated are treated like sequential gates.
+         * Functionally equivalent nets always receive identical signatures, while different signatures prove that two nets are not equivalent.
+         *
+         * @param[in] netlist - The netlist to simulate.
+         * @param[in] num_bits - The width of each signature in bits, must be a multiple of 64 between 64 and 1024.
+         * @param[in] seed - The seed for the generation of random input patterns.
+         * @returns A map from each net to its signature, given as a vector of 64-bit words, on success, an error otherwise.
+         */
+        CORE_API Result<std::unordered_map<Net*, std::vector<u64>>> compute_net_signatures(const Netlist* netlist, u32 num_bits = 256, u64 seed = 0);
+
+        /**
+         * Configuration of the detection of functionally equivalent nets.
+         */
+        struct NetEquivalenceConfig
+        {
+            /// The width of the simulation signatures in bits, must be a multiple of 64 between 64 and 1024.
+            u32 signature_width = 256;
+            /// The seed for the generation of random input patterns.
+            u64 seed = 0;
+            /// Controls whether nets carrying the complement of a signal are placed into the same class as nets carrying the signal itself.
+            bool consider_complements = true;
+            /// Controls whether candidate classes are confirmed or split using a SAT solver. If disabled, the resulting classes are candidates only.
+            bool sat_refinement = true;
+            /// The timeout for each SAT query in milliseconds. Nets whose equivalence cannot be decided in time are removed from their class.
+            u32 query_timeout_in_ms = 1000;
+        };
+
+        /**
+         * A class of nets that carry the same signal or its complement.
+         */
+        struct NetEquivalenceClass
+        {
+            /// The nets of the class, the first net being the representative of the class.
+            std::vector<Net*> nets;
+            /// For each net, whether it carries the complement of the signal of the representative.
+            std::vector<bool> complemented;
+        };
+
+        /**
+         * Find classes of functionally equivalent nets within the combinational logic of the netlist.
+         * Nets are first bucketed by their simulation signatures (see `compute_net_signatures`), optionally identifying signatures with their complement, to obtain candidate classes.
+         * If enabled, each candidate class is refined by proving equivalence of its members to the representative using a single persistent SAT solver.
+         * Counterexamples returned by the solver are used to split the remaining members of a class at once.
+         * Just like for the simulation, nets that are not driven by a combinational gate are treated as free inputs.
+         * Nets whose equivalence to the representative cannot be decided within the query timeout are left out of their class, hence the result may be incomplete if SAT refinement is enabled.
+         *
+         * @param[in] netlist - The target netlist.
+         * @param[in] config - The configuration of the equivalence detection.
+         * @returns All classes consisting of at least two nets on success, an error otherwise.
+         */
+        CORE_API Result<std::vector<NetEquivalenceClass>> get_equivalent_nets(const Netlist* netlist, const NetEquivalenceConfig& config = NetEquivalenceConfig());
+
+        /**
+         * Configuration of the enumeration of k-feasible cuts.
+         */
+        struct CutEnumerationConfig
+        {
+            /// The maximum number of leaves of a cut, must be between 1 and 8.
+            u32 max_cut_size = 6;
+            /// The maximum number of non-trivial cuts that is kept for each net. Cuts with fewer leaves are preferred.
+            u32 max_cuts_per_net = 8;
+            /// Controls whether a truth table is computed for every cut.
+            bool compute_truth_tables = true;
+        };
+
+        /**
+         * A cut of a net, i.e., a set of leaf nets such that every path from a global input or sequential gate to the net passes through at least one leaf.
+         */
+        struct Cut
+        {
+            /// The leaves of the cut sorted by their ID.
+            std::vector<Net*> leaves;
+            /// The function of the net in terms of the leaves, where leaf `i` is the `i`-th variable and bit `m` of the table holds the value for input assignment `m`. The 2^k bits are packed into 64-bit words starting at the least significant bit. Empty if truth tables have not been computed.
+            std::vector<u64> truth_table;
+        };
+
+        /**
+         * The cuts of all nets within the combinational logic of a netlist.
+         * Leaves and truth tables of all cuts are stored in contiguous arrays.
+         */
+        class CORE_API CutEnumeration
+        {
+        public:
+            /**
+             * Get all nets for which cuts have been enumerated in topological order.
+             *
+             * @returns A vector of nets.
+             */
+            const std::vector<Net*>& get_nets() const;
+
+            /**
+             * Get the number of cuts of a net, including the trivial cut that consists of the net itself.
+             *
+             * @param[in] net - The net.
+             * @returns The number of cuts, or 0 if no cuts have been enumerated for the net.
+             */
+            u32 get_num_cuts(const Net* net) const;
+
+            /**
+             * Get the total number of cuts of all nets.
+             *
+             * @returns The number of cuts.
+             */
+            u64 get_num_cuts() const;
+
+            /**
+             * Get all cuts of a net, the first one being the trivial cut that consists of the net itself.
+             *
+             * @param[in] net - The net.
+             * @returns A vector of cuts, empty if no cuts have been enumerated for the net.
+             */
+            std::vector<Cut> get_cuts(const Net* net) const;
+
+        private:
+            friend Result<CutEnumeration> enumerate_cuts(const Netlist* netlist, const CutEnumerationConfig& config);
+
+            struct CutEntry
+            {
+                u32 leaves_offset;
+                u32 truth_table_offset;
+                u32 num_leaves;
+                u32 num_truth_table_words;
+            };
+
+            std::vector<Net*> m_nets;
+            std::unordered_map<const Net*, std::pair<u32, u32>> m_cut_ranges;
+            std::vector<CutEntry> m_cuts;
+            std::vector<Net*> m_leaves;
+            std::vector<u64> m_truth_tables;
+        };
+
+        /**
+         * Enumerate the k-feasible cuts of all nets that are driven by a combinational gate.
+         * Cuts are computed bottom-up in topological order by merging the cuts of the fan-in nets of each gate, while only the best cuts of each net are kept (priority cuts).
+         * Cuts are ranked by their number of leaves and cuts whose leaves are a superset of the leaves of another cut are discarded.
+         * The truth table of each cut is computed bit-parallel from the Boolean function of the gate and the truth tables of the merged fan-in cuts.
+         * All nets of a topological level are processed in parallel.
+         * Nets that are not driven by exactly one combinational gate, e.g., global input nets or nets driven by sequential gates, only act as leaves.
+         * Nets driven by a combinational gate with a missing or unsupported Boolean function only have their trivial cut.
+         *
+         * @param[in] netlist - The target netlist.
+         * @param[in] config - The configuration of the cut enumeration.
+         * @returns The cuts of all nets on success, an error otherwise.
+         */
+        CORE_API Result<CutEnumeration> enumerate_cuts(const Netlist* netlist, const CutEnumerationConfig& config = CutEnumerationConfig());
     }    // namespace netlist_utils
 }    // namespace hal
\ No newline at end of file
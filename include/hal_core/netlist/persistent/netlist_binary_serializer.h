@@ -0,0 +1,112 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/compression.h"
+
+#include <memory>
+#include <string_view>
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+    class GateLibrary;
+    class MemoryMappedFile;
+
+    /**
+     * @file
+     *
+     * The binary .hal format stores a netlist in columnar sections that are laid out for memory mapping.<br>
+     * Gate IDs, names, and types, net endpoints, module membership, module pins, data entries, and custom Boolean functions each live in separate arrays that refer to each other by index and to a shared string table by string index.
+     * Deserialization constructs all objects section by section directly from the mapped file without building an intermediate document.
+     *
+     * \namespace netlist_binary_serializer
+     * @ingroup persistent
+     */
+
+    namespace netlist_binary_serializer
+    {
+        /**
+         * Serializes a netlist into a binary .hal file.
+         *
+         * @param[in] netlist - The netlist to serialize.
+         * @param[in] hal_file - The destination .hal file.
+         * @param[in] compression_format - The compression format of the written file, uncompressed by default so that the file can be memory-mapped.
+         * @returns True on success, false otherwise.
+         */
+        NETLIST_API bool serialize_to_file(const Netlist* netlist, const std::filesystem::path& hal_file, CompressionFormat compression_format = CompressionFormat::none);
+
+        /**
+         * Deserializes a netlist from a binary .hal file.<br>
+         * In lazy mode, data entries and custom Boolean functions are decoded from the mapped file when they are accessed for the first time, which keeps the file mapped until then.
+         *
+         * @param[in] hal_file - The source .hal file.
+         * @param[in] lazy - Set `true` to defer decoding data entries and custom Boolean functions, `false` to decode everything right away.
+         * @param[in] gate_library - The gate library of the netlist, or a nullptr to load the gate library referenced by the file via the gate library manager.
+         * @returns The deserialized netlist.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, bool lazy = false, const GateLibrary* gate_library = nullptr);
+
+        /**
+         * Deserializes a netlist from an already opened binary .hal file.
+         *
+         * @param[in] file - The opened .hal file.
+         * @param[in] lazy - Set `true` to defer decoding data entries and custom Boolean functions, `false` to decode everything right away.
+         * @param[in] gate_library - The gate library of the netlist, or a nullptr to load the gate library referenced by the file via the gate library manager.
+         * @returns The deserialized netlist.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_mapped_file(std::shared_ptr<const MemoryMappedFile> file, bool lazy = false, const GateLibrary* gate_library = nullptr);
+
+        /**
+         * Deserializes a netlist from a buffer holding the contents of a binary .hal file.<br>
+         * The buffer must be aligned to at least 8 bytes, which is guaranteed for memory-mapped files.
+         *
+         * @param[in] data - The contents of the binary .hal file.
+         * @returns The deserialized netlist.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_buffer(std::string_view data);
+
+        /**
+         * Checks whether the given data starts with the magic bytes of a binary .hal file.
+         *
+         * @param[in] data - The (beginning of the) file contents.
+         * @returns True if the data belongs to a binary .hal file, false otherwise.
+         */
+        NETLIST_API bool is_binary_hal(std::string_view data);
+
+        /**
+         * Converts a .hal file between the JSON and the binary format.<br>
+         * JSON files are converted into binary files and binary files into JSON files.
+         *
+         * @param[in] source_file - The .hal file to convert.
+         * @param[in] destination_file - The destination .hal file.
+         * @returns True on success, false otherwise.
+         */
+        NETLIST_API bool convert_file(const std::filesystem::path& source_file, const std::filesystem::path& destination_file);
+    }    // namespace netlist_binary_serializer
+}    // namespace hal
@@ -0,0 +1,149 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/compression.h"
+
+#include <filesystem>
+#include <memory>
+#include <set>
+#include <string>
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+    class GateLibrary;
+
+    /**
+     * A netlist journal tracks changes to a netlist through its event handler and appends them as delta records to a journal file.<br>
+     * Each record is a single line of JSON holding the complete state of every gate, net, and module that changed since the previous record.
+     * A netlist is restored by loading the last full snapshot and replaying the journal on top of it.
+     * Compaction merges the journal into a new snapshot and may run concurrently to further appends.
+     *
+     * @ingroup persistent
+     */
+    class NETLIST_API NetlistJournal
+    {
+    public:
+        /**
+         * Construct a journal that tracks all changes to the given netlist.<br>
+         * The journal may outlive the netlist, but stops tracking changes once the netlist has been destroyed.
+         *
+         * @param[in] netlist - The netlist to track.
+         */
+        NetlistJournal(Netlist* netlist);
+
+        ~NetlistJournal();
+
+        NetlistJournal(const NetlistJournal&) = delete;
+        NetlistJournal& operator=(const NetlistJournal&) = delete;
+
+        /**
+         * Get the tracked netlist.
+         *
+         * @returns The netlist, or a nullptr if the netlist has been destroyed.
+         */
+        Netlist* get_netlist() const;
+
+        /**
+         * Check whether the netlist has changed since the last record has been appended.
+         *
+         * @returns True if there are changes, false otherwise.
+         */
+        bool has_changes() const;
+
+        /**
+         * Discard all tracked changes, e.g., after a full snapshot of the netlist has been written.
+         */
+        void clear();
+
+        /**
+         * Append a delta record holding all tracked changes to the journal file and discard the tracked changes afterwards.<br>
+         * Nothing is written if there are no changes.
+         *
+         * @param[in] journal_file - The journal file.
+         * @returns True on success, false otherwise.
+         */
+        bool append_delta(const std::filesystem::path& journal_file);
+
+        /**
+         * Serialize all tracked changes into a delta record and discard the tracked changes.<br>
+         * Together with append_record(), this allows capturing the changes on the thread that modifies the netlist while writing the record on another thread.
+         *
+         * @returns The delta record without a trailing newline, or an empty string if there are no changes.
+         */
+        std::string take_delta();
+
+        /**
+         * Append a delta record to the journal file and flush it to the storage device.
+         *
+         * @param[in] journal_file - The journal file.
+         * @param[in] record - The delta record as returned by take_delta().
+         * @returns True on success, false otherwise.
+         */
+        static bool append_record(const std::filesystem::path& journal_file, const std::string& record);
+
+        /**
+         * Apply all complete records of a journal file to a netlist.<br>
+         * A missing journal file is treated as empty, an incomplete last record (e.g., after a crash while appending) is ignored.
+         *
+         * @param[in] netlist - The netlist loaded from the snapshot the journal belongs to.
+         * @param[in] journal_file - The journal file.
+         * @returns True on success, false otherwise.
+         */
+        static bool replay(Netlist* netlist, const std::filesystem::path& journal_file);
+
+        /**
+         * Merge a journal file into its snapshot.<br>
+         * The snapshot is replaced atomically and only the records that have been merged are removed from the journal, so records appended in the meantime are kept.
+         * Does not access any netlist in memory and can therefore run in a background thread, given that the gate library has been resolved beforehand.
+         *
+         * @param[in] hal_file - The snapshot .hal file.
+         * @param[in] journal_file - The journal file.
+         * @param[in] gate_library - The gate library of the snapshot, or a nullptr to load it via the gate library manager, which must not be done from a background thread.
+         * @param[in] binary_format - Set true to write the new snapshot in the binary .hal format.
+         * @param[in] compression_format - The compression format of the new snapshot.
+         * @returns True on success, false otherwise.
+         */
+        static bool compact(const std::filesystem::path& hal_file,
+                            const std::filesystem::path& journal_file,
+                            const GateLibrary* gate_library      = nullptr,
+                            bool binary_format                   = false,
+                            CompressionFormat compression_format = CompressionFormat::none);
+
+    private:
+        Netlist* m_netlist;
+        std::weak_ptr<bool> m_netlist_alive;
+        std::string m_callback_name;
+
+        bool m_netlist_changed = false;
+        std::set<u32> m_gate_ids;
+        std::set<u32> m_net_ids;
+        std::set<u32> m_module_ids;
+    };
+}    // namespace hal
@@ -26,11 +26,17 @@
 #pragma once
 
 #include "hal_core/defines.h"
+#include "hal_core/utilities/compression.h"
+
+#include <set>
+#include <string_view>
+#include <vector>
 
 namespace hal
 {
     /* forward declaration */
     class Netlist;
+    class GateLibrary;
 
     /**
      * @file
@@ -43,20 +49,51 @@ namespace hal
     {
 
         /**
-         * Serializes a netlist into a .hal file.
+         * Serializes a netlist into a .hal file.<br>
+         * The file may optionally be compressed, it can be deserialized regardless of the compression format used.
          *
          * @param[in] netlist - The netlist to serialize.
          * @param[in] hal_file - The destination .hal file.
+         * @param[in] compression_format - The compression format of the written file, uncompressed by default.
          * @returns True on success, false otherwise.
          */
-        NETLIST_API bool serialize_to_file(const Netlist* netlist, const std::filesystem::path& hal_file);
+        NETLIST_API bool serialize_to_file(const Netlist* netlist, const std::filesystem::path& hal_file, CompressionFormat compression_format = CompressionFormat::none);
 
         /**
-         * Deserializes a netlist from a .hal file.
+         * Deserializes a netlist from a .hal file.<br>
+         * Files compressed using gzip or zstd are detected by their magic bytes and decompressed chunk by chunk while being parsed.
+         * In lazy mode, data entries and custom Boolean functions are kept as undecoded ranges of the file and only decoded when they are accessed for the first time.
+         * Since these ranges refer to the decompressed contents, compressed files are decompressed into memory as a whole in lazy mode, as are compressed binary .hal files.
          *
          * @param[in] hal_file - The source .hal file.
+         * @param[in] lazy - Set `true` to defer decoding data entries and custom Boolean functions, `false` to decode everything right away.
+         * @param[in] gate_library - The gate library of the netlist, or a nullptr to load the gate library referenced by the file via the gate library manager.
          * @returns The deserialized netlist.
          */
-        NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file);
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, bool lazy = false, const GateLibrary* gate_library = nullptr);
+
+        /**
+         * Serializes the current state of the given netlist objects into a single-line delta record for the netlist journal.<br>
+         * IDs of objects that no longer exist in the netlist are recorded as removed.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] netlist_changed - Set true to include the properties and global gates and nets of the netlist.
+         * @param[in] gate_ids - The IDs of the changed gates.
+         * @param[in] net_ids - The IDs of the changed nets.
+         * @param[in] module_ids - The IDs of the changed modules.
+         * @returns The delta record without a trailing newline, or an empty string on error.
+         */
+        NETLIST_API std::string
+            serialize_delta(const Netlist* netlist, bool netlist_changed, const std::set<u32>& gate_ids, const std::set<u32>& net_ids, const std::set<u32>& module_ids);
+
+        /**
+         * Applies delta records created by serialize_delta() to a netlist in the given order.<br>
+         * References to gates that no longer exist are skipped, hence records may be applied to a snapshot that already contains them.
+         *
+         * @param[in] netlist - The netlist to update.
+         * @param[in] records - The delta records.
+         * @returns True on success, false otherwise.
+         */
+        NETLIST_API bool deserialize_deltas(Netlist* netlist, const std::vector<std::string_view>& records);
     }    // namespace netlist_serializer
 }    // namespace hal
@@ -0,0 +1,128 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+
+    /**
+     * A netlist snapshot store keeps several versions of a netlist within a single directory, usually inside the project directory.<br>
+     * Each snapshot is split into chunks: one chunk holding all modules, one chunk per range of CHUNK_SIZE gate IDs and net IDs each, and one chunk holding the netlist properties.
+     * Chunks are delta records as written to the netlist journal and are stored by the hash of their content, so chunks shared by several snapshots are only stored once.
+     * A snapshot itself is a small manifest listing its chunks.<br>
+     * Switching a netlist to another snapshot only reads and applies the chunks that differ from the current state of the netlist.
+     * Groupings are not part of snapshots.
+     *
+     * @ingroup persistent
+     */
+    class NETLIST_API NetlistSnapshotStore
+    {
+    public:
+        /**
+         * The number of consecutive gate or net IDs that share a chunk.
+         */
+        static const u32 CHUNK_SIZE = 4096;
+
+        /**
+         * Construct a snapshot store located in the given directory.<br>
+         * The directory is created when the first snapshot is stored.
+         *
+         * @param[in] directory - The directory of the snapshot store.
+         */
+        NetlistSnapshotStore(const std::filesystem::path& directory);
+
+        /**
+         * Get the directory of the snapshot store.
+         *
+         * @returns The directory.
+         */
+        const std::filesystem::path& get_directory() const;
+
+        /**
+         * Store the current state of the netlist as a snapshot. An existing snapshot of the same name is replaced.<br>
+         * Only chunks that are not yet part of the store are written.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] name - The name of the snapshot, consisting of letters, digits, '_', '-', and '.' only.
+         * @returns True on success, false otherwise.
+         */
+        bool create_snapshot(const Netlist* netlist, const std::string& name);
+
+        /**
+         * Switch the netlist to the state stored in a snapshot.<br>
+         * Only chunks that differ from the current state of the netlist are read and applied.
+         * The netlist must use the gate library of the snapshot.
+         *
+         * @param[in] netlist - The netlist to update.
+         * @param[in] name - The name of the snapshot.
+         * @returns True on success, false otherwise.
+         */
+        bool checkout_snapshot(Netlist* netlist, const std::string& name) const;
+
+        /**
+         * Load a snapshot into a new netlist using the gate library recorded in the snapshot.
+         *
+         * @param[in] name - The name of the snapshot.
+         * @returns The netlist on success, a nullptr otherwise.
+         */
+        std::unique_ptr<Netlist> load_snapshot(const std::string& name) const;
+
+        /**
+         * Check whether a snapshot of the given name exists.
+         *
+         * @param[in] name - The name of the snapshot.
+         * @returns True if the snapshot exists, false otherwise.
+         */
+        bool has_snapshot(const std::string& name) const;
+
+        /**
+         * Get the names of all snapshots in the store.
+         *
+         * @returns The names of the snapshots in alphabetical order.
+         */
+        std::vector<std::string> get_snapshot_names() const;
+
+        /**
+         * Remove a snapshot and delete all chunks that are no longer referenced by any other snapshot.
+         *
+         * @param[in] name - The name of the snapshot.
+         * @returns True on success, false otherwise.
+         */
+        bool remove_snapshot(const std::string& name);
+
+    private:
+        std::filesystem::path m_directory;
+    };
+}    // namespace hal
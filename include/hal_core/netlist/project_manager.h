@@ -30,7 +30,12 @@
 #include <string>
 #include <unordered_map>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
 
+#include "hal_core/utilities/compression.h"
 #include "hal_core/utilities/project_directory.h"
 #include "hal_core/utilities/json_write_document.h"
 #include "hal_core/netlist/netlist.h"
@@ -38,6 +43,7 @@
 namespace hal
 {
     class Netlist;
+    class NetlistJournal;
     class ProjectSerializer;
 
     class ProjectManager
@@ -56,11 +62,48 @@ namespace hal
         std::string m_proj_file;
         std::string m_netlist_file;
         std::string m_gatelib_path;
+        CompressionFormat m_compression_format;
+        bool m_binary_format;
+        bool m_lazy_loading;
         std::unordered_map<std::string,ProjectSerializer*> m_serializer;
         std::unordered_map<std::string,std::string> m_filename;
+        std::unique_ptr<NetlistJournal> m_journal;
+        std::string m_journal_source_netlist;
+        std::string m_journal_source_journal;
+        std::vector<std::string> m_unsaved_records;
+        std::future<bool> m_autosave;
+        bool m_shadow_valid;
 
         bool serialize_external(bool shadow);
 
+        /**
+         * Track changes of the netlist that has just been loaded from or saved to the given files.
+         * Autosave restores the netlist from these files and the journal instead of copying it.
+         *
+         * @param[in] netlist the netlist
+         * @param[in] netlistFile netlist file holding the state of the netlist
+         * @param[in] journalFile journal file to be replayed on top of the netlist file, empty if there is none
+         */
+        void attach_journal(Netlist* netlist, const std::string& netlistFile, const std::string& journalFile);
+
+        /**
+         * Capture the state of the netlist to be autosaved. Takes the changes since the last autosave
+         * from the journal if possible. Otherwise, the files the netlist has been loaded from or saved to
+         * are copied to the shadow directory by the returned task, and only if there are none the entire
+         * netlist gets copied.
+         *
+         * @return task writing the captured state to the shadow directory, empty on error
+         */
+        std::function<bool()> capture_shadow_netlist();
+
+        /**
+         * Render project file summary so that it can be written without accessing the project manager.
+         *
+         * @param[in] shadow true if called from autosave procedure
+         * @return task writing the project file
+         */
+        std::function<bool()> capture_projectfile(bool shadow) const;
+
         /**
          * Internal method to deserialize hal project, called by open_project()
          *
@@ -138,6 +181,51 @@ namespace hal
          */
         void set_gatelib_path(const std::string& glpath);
 
+        /**
+         * Set the compression format used when writing the .hal file of the project.
+         * Compressed .hal files are detected automatically when opening a project.
+         *
+         * @param[in] format the compression format, CompressionFormat::none to write uncompressed files
+         */
+        void set_compression_format(CompressionFormat format);
+
+        /**
+         * Returns the compression format used when writing the .hal file of the project.
+         *
+         * @return the compression format
+         */
+        CompressionFormat get_compression_format() const;
+
+        /**
+         * Set whether the .hal file of the project is written in the binary format instead of JSON.
+         * Binary .hal files are detected automatically when opening a project.
+         *
+         * @param[in] enable true to write binary .hal files, false to write JSON .hal files
+         */
+        void set_binary_format(bool enable);
+
+        /**
+         * Returns whether the .hal file of the project is written in the binary format.
+         *
+         * @return true if binary .hal files are written, false otherwise
+         */
+        bool get_binary_format() const;
+
+        /**
+         * Set whether data entries and custom Boolean functions are decoded from the .hal file only when they are accessed for the first time.
+         * Speeds up opening projects whose analyses do not touch most of these.
+         *
+         * @param[in] enable true to load data entries and custom Boolean functions lazily, false to load everything when opening a project
+         */
+        void set_lazy_loading(bool enable);
+
+        /**
+         * Returns whether data entries and custom Boolean functions are loaded lazily when opening a project.
+         *
+         * @return true if they are loaded lazily, false otherwise
+         */
+        bool get_lazy_loading() const;
+
         /**
          * Serialize netlist and dependend data to project directory
          *
@@ -147,6 +235,71 @@ namespace hal
          */
         bool serialize_project(Netlist* netlist, bool shadow = false);
 
+        /**
+         * Autosave netlist and dependend data to the shadow directory without blocking the calling thread.
+         * The netlist is captured on the calling thread and may be modified as soon as this function returns,
+         * encoding and writing the netlist file is done by a worker thread.
+         *
+         * @param[in] netlist Netlist to save
+         * @param[in] on_finished Optional callback invoked from the worker thread with the result once the autosave is complete
+         * @return true if the autosave has been started, false on error or if the previous autosave is still running
+         */
+        bool start_autosave(Netlist* netlist, std::function<void(bool)> on_finished = nullptr);
+
+        /**
+         * Returns whether an autosave started by start_autosave() is still running.
+         *
+         * @return true if an autosave is running, false otherwise
+         */
+        bool is_autosave_running() const;
+
+        /**
+         * Block until the last autosave has finished.
+         *
+         * @return true if the last autosave was successful or there was none, false otherwise
+         */
+        bool wait_for_autosave();
+
+        /**
+         * Stop tracking changes of the netlist for autosave. The next autosave writes the entire netlist.
+         */
+        void discard_journal();
+
+        /**
+         * Store the current state of the netlist as a snapshot in the project directory.
+         * Snapshots share unchanged parts of the netlist, hence they are cheap to create.
+         *
+         * @param[in] netlist Netlist to store
+         * @param[in] name name of the snapshot, consisting of letters, digits, '_', '-', and '.' only
+         * @return true on success, false on error
+         */
+        bool create_snapshot(const Netlist* netlist, const std::string& name);
+
+        /**
+         * Switch the netlist to the state stored in a snapshot of the project.
+         * Only the parts of the netlist that differ from the snapshot are loaded.
+         *
+         * @param[in] netlist Netlist to update
+         * @param[in] name name of the snapshot
+         * @return true on success, false on error
+         */
+        bool checkout_snapshot(Netlist* netlist, const std::string& name);
+
+        /**
+         * Returns the names of all snapshots stored in the project directory.
+         *
+         * @return snapshot names in alphabetical order
+         */
+        std::vector<std::string> get_snapshot_names() const;
+
+        /**
+         * Remove a snapshot from the project directory.
+         *
+         * @param[in] name name of the snapshot
+         * @return true on success, false on error
+         */
+        bool remove_snapshot(const std::string& name);
+
         /**
          * Open hal project in directory <path>
          *
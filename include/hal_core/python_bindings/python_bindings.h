@@ -27,6 +27,7 @@
 
 #include "hal_core/defines.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/npn.h"
 #include "hal_core/netlist/boolean_function/solver.h"
 #include "hal_core/netlist/boolean_function/symbolic_execution.h"
 #include "hal_core/netlist/boolean_function/symbolic_state.h"
@@ -45,6 +46,7 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/netlist/netlist_utils.h"
 #include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
 #include "hal_core/netlist/pins/base_pin.h"
 #include "hal_core/netlist/pins/gate_pin.h"
@@ -174,6 +176,13 @@ namespace hal
      */
     void netlist_serializer_init(py::module& m);
 
+    /**
+     * Initializes Python bindings for the HAL binary netlist serializer in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void netlist_binary_serializer_init(py::module& m);
+
     /**
      * Initializes Python bindings for the HAL netlist utils in a python module.
      *
@@ -279,6 +288,13 @@ namespace hal
      */
     void smt_init(py::module& m);
 
+    /**
+     * Initializes Python bindings for the HAL NPN canonicalization in a python module.
+     *
+     * @param[in] m - the python module
+     */
+    void npn_init(py::module& m);
+
     /**
      * @}
      */
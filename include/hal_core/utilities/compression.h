@@ -0,0 +1,139 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/enums.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace hal
+{
+    /**
+     * The compression formats that can be read and written transparently.
+     *
+     * @ingroup utilities
+     */
+    enum class CompressionFormat
+    {
+        none, /**< Uncompressed data. **/
+        gzip, /**< gzip (or zlib) compressed data. **/
+        zstd  /**< Zstandard compressed data. **/
+    };
+
+    template<>
+    std::map<CompressionFormat, std::string> EnumStrings<CompressionFormat>::data;
+
+    /**
+     * @ingroup utilities
+     */
+    namespace compression
+    {
+        /**
+         * Detect the compression format of the given data by inspecting its magic bytes.
+         *
+         * @param[in] data - The (possibly compressed) data.
+         * @returns The detected compression format, `CompressionFormat::none` if the data is not compressed.
+         */
+        CORE_API CompressionFormat detect_format(std::string_view data);
+
+        /**
+         * Check whether HAL has been built with support for the given compression format.
+         *
+         * @param[in] format - The compression format.
+         * @returns True if the format can be read and written, false otherwise.
+         */
+        CORE_API bool is_supported(CompressionFormat format);
+
+        /**
+         * Decompress the given data.<br>
+         * The format is detected from the magic bytes, uncompressed data is returned as is.
+         * Concatenated gzip members and zstd frames are decompressed in sequence.
+         *
+         * @param[in] data - The compressed data.
+         * @returns The decompressed data on success, an error otherwise.
+         */
+        CORE_API Result<std::string> decompress(std::string_view data);
+
+        /**
+         * Decompresses gzip or zstd data chunk by chunk, so that the decompressed data never has to be held in memory as a whole.
+         */
+        class CORE_API Decompressor
+        {
+        public:
+            /**
+             * Create a decompressor for the given data. The format is detected from the magic bytes.<br>
+             * The data must remain valid for the lifetime of the decompressor.
+             *
+             * @param[in] data - The compressed data.
+             * @returns The decompressor on success, an error if the data is not compressed or the format is not supported.
+             */
+            static Result<std::unique_ptr<Decompressor>> create(std::string_view data);
+
+            virtual ~Decompressor() = default;
+
+            /**
+             * Decompress the next chunk of data into the given buffer.
+             *
+             * @param[out] buffer - The buffer to write the decompressed data to.
+             * @param[in] size - The size of the buffer in bytes.
+             * @returns The number of bytes written on success, i.e., 0 once all data has been decompressed, an error otherwise.
+             */
+            virtual Result<u64> read(char* buffer, u64 size) = 0;
+        };
+
+        /**
+         * Write the given data to a file, compressing it on the fly using the given format.
+         *
+         * @param[in] file_path - The path to the file.
+         * @param[in] data - The data to write.
+         * @param[in] format - The compression format.
+         * @returns Ok on success, an error otherwise.
+         */
+        CORE_API Result<std::monostate> write_file(const std::filesystem::path& file_path, std::string_view data, CompressionFormat format);
+
+        /**
+         * Get the compression format indicated by the extension of a file name, i.e., `.gz` or `.zst`.
+         *
+         * @param[in] file_path - The path to the file.
+         * @returns The compression format indicated by the extension, `CompressionFormat::none` if there is none.
+         */
+        CORE_API CompressionFormat get_format_from_extension(const std::filesystem::path& file_path);
+
+        /**
+         * Remove a compression extension such as `.gz` or `.zst` from a file name, e.g., `design.v.gz` becomes `design.v`.<br>
+         * Used to select parsers based on the extension of the underlying uncompressed file.
+         *
+         * @param[in] file_path - The path to the file.
+         * @returns The path without the compression extension.
+         */
+        CORE_API std::filesystem::path strip_extension(const std::filesystem::path& file_path);
+    }    // namespace compression
+}    // namespace hal
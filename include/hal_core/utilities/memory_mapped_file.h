@@ -0,0 +1,105 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/compression.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace hal
+{
+    /**
+     * A read-only view on the contents of a file that is mapped into memory.<br>
+     * The contents remain valid for the lifetime of the object, hence string views into the contents may be handed out freely.
+     * On platforms without memory mapping support, the file is read into a buffer instead.<br>
+     * Files compressed using gzip or zstd are detected by their magic bytes and decompressed into a buffer transparently.
+     * This buffer holds the entire decompressed contents, so callers that consume a file front to back may keep the compressed contents mapped instead and decompress them chunk by chunk using compression::Decompressor.
+     *
+     * @ingroup utilities
+     */
+    class CORE_API MemoryMappedFile
+    {
+    public:
+        /**
+         * Map the given file into memory.
+         *
+         * @param[in] file_path - The path to the file.
+         * @param[in] decompress - Set `true` to decompress compressed files into a buffer, `false` to keep their compressed contents mapped.
+         * @returns The memory-mapped file on success, an error otherwise.
+         */
+        static Result<std::unique_ptr<MemoryMappedFile>> open(const std::filesystem::path& file_path, bool decompress = true);
+
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        /**
+         * Get the contents of the file.
+         *
+         * @returns A view on the contents of the file.
+         */
+        std::string_view get_data() const;
+
+        /**
+         * Get the size of the (decompressed) contents of the file in bytes.
+         *
+         * @returns The size of the contents.
+         */
+        u64 get_size() const;
+
+        /**
+         * Get the path of the file.
+         *
+         * @returns The path of the file.
+         */
+        const std::filesystem::path& get_path() const;
+
+        /**
+         * Get the compression format the file was stored in.<br>
+         * If the file has been opened without decompression, the contents are still compressed in this format.
+         *
+         * @returns The compression format, `CompressionFormat::none` for uncompressed files.
+         */
+        CompressionFormat get_compression_format() const;
+
+    private:
+        MemoryMappedFile(const std::filesystem::path& file_path);
+
+        std::filesystem::path m_path;
+        const char* m_data = nullptr;
+        u64 m_size         = 0;
+        bool m_mapped      = false;
+
+        CompressionFormat m_compression_format = CompressionFormat::none;
+        std::string m_buffer;
+    };
+}    // namespace hal
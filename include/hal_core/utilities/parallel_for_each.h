@@ -0,0 +1,152 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <algorithm>
+#include <set>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * @ingroup utilities
+     */
+    namespace utils
+    {
+        /**
+         * Execute a function for every index in the range `[begin, end)` using all available hardware threads.
+         * The range is split into contiguous chunks, one per thread, and the calling thread processes the first chunk itself.
+         * No more threads are used than there are chunks of at least `min_items_per_thread` indices, hence small ranges are processed by the calling thread alone without spawning any threads.
+         * The function must be safe to be executed concurrently for different indices.
+         *
+         * @param[in] begin - The first index.
+         * @param[in] end - The index one past the last index.
+         * @param[in] func - The function to execute, taking the index as its only argument.
+         * @param[in] min_items_per_thread - The minimum number of indices processed by each thread, which should be increased for cheap functions.
+         */
+        template<typename R>
+        void parallel_for_each(u32 begin, u32 end, R func, u32 min_items_per_thread = 1)
+        {
+            if (end <= begin)
+            {
+                return;
+            }
+
+            const u32 max_threads = (end - begin + std::max(1u, min_items_per_thread) - 1) / std::max(1u, min_items_per_thread);
+            const u32 num_threads = std::max(1u, std::min(max_threads, std::thread::hardware_concurrency()));
+            if (num_threads == 1)
+            {
+                for (u32 i = begin; i < end; ++i)
+                {
+                    func(i);
+                }
+                return;
+            }
+
+            const u32 steps_per_thread = (end - begin + num_threads - 1) / num_threads;
+
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads - 1);
+
+            // spawn threads, start at index 1 since index 0 is the main thread
+            for (u32 thread_idx = 1; thread_idx < num_threads; ++thread_idx)
+            {
+                threads.emplace_back([&func, begin, end, thread_idx, steps_per_thread]() {
+                    const u32 local_end = std::min(end, begin + steps_per_thread * (thread_idx + 1));
+                    for (u32 i = begin + steps_per_thread * thread_idx; i < local_end; ++i)
+                    {
+                        func(i);
+                    }
+                });
+            }
+
+            // also do work on main thread
+            {
+                const u32 local_end = std::min(end, begin + steps_per_thread);
+                for (u32 i = begin; i < local_end; ++i)
+                {
+                    func(i);
+                }
+            }
+
+            // wait until all threads are done
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+        }
+
+        /**
+         * Execute a function for every element of a vector using all available hardware threads.
+         * The function must be safe to be executed concurrently for different elements.
+         *
+         * @param[in] elements - The elements.
+         * @param[in] func - The function to execute, taking a single element as its only argument.
+         * @param[in] min_items_per_thread - The minimum number of elements processed by each thread.
+         */
+        template<typename T, typename R>
+        void parallel_for_each(const std::vector<T>& elements, R func, u32 min_items_per_thread = 1)
+        {
+            parallel_for_each(0, elements.size(), [&elements, &func](u32 i) { func(elements[i]); }, min_items_per_thread);
+        }
+
+        /**
+         * Execute a function for every element of a set using all available hardware threads.
+         * The function must be safe to be executed concurrently for different elements.
+         *
+         * @param[in] elements - The elements.
+         * @param[in] func - The function to execute, taking a single element as its only argument.
+         * @param[in] min_items_per_thread - The minimum number of elements processed by each thread.
+         */
+        template<typename T, typename R>
+        void parallel_for_each(const std::set<T>& elements, R func, u32 min_items_per_thread = 1)
+        {
+            parallel_for_each(std::vector<T>(elements.begin(), elements.end()), func, min_items_per_thread);
+        }
+
+        /**
+         * Execute a function for every element of an unordered set using all available hardware threads.
+         * The function must be safe to be executed concurrently for different elements.
+         *
+         * @param[in] elements - The elements.
+         * @param[in] func - The function to execute, taking a single element as its only argument.
+         * @param[in] min_items_per_thread - The minimum number of elements processed by each thread.
+         */
+        template<typename T, typename R>
+        void parallel_for_each(const std::unordered_set<T>& elements, R func, u32 min_items_per_thread = 1)
+        {
+            parallel_for_each(std::vector<T>(elements.begin(), elements.end()), func, min_items_per_thread);
+        }
+    }    // namespace utils
+}    // namespace hal
@@ -29,10 +29,34 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace hal
 {
+    /**
+     * Maps a string type to a string type that owns its characters.<br>
+     * Owning string types map to themselves, string views map to the corresponding string type.
+     *
+     * @ingroup utilities
+     */
+    template<typename T>
+    struct OwnedString
+    {
+        using type = T;
+    };
+
+    /**
+     * @copydoc OwnedString
+     */
+    template<typename C, typename Traits>
+    struct OwnedString<std::basic_string_view<C, Traits>>
+    {
+        using type = std::basic_string<C, Traits>;
+    };
+
     /**
      * A token holds a string and a line number and may, for example, be used during parsing of input files.
      * 
@@ -117,7 +141,9 @@ namespace hal
     };
 
     /**
-     * A token stream comprises a sequence of tokens that may, for example, have been read from a file.
+     * A token stream comprises a sequence of tokens that may, for example, have been read from a file.<br>
+     * The tokens are shared between a stream and all streams extracted from or copied from it, i.e., extracting a sub-stream does not copy any tokens.<br>
+     * The token type may be a string view (e.g., into a memory-mapped file), in which case the caller must keep the referenced characters alive.
      * 
      * @ingroup utilities
      */
@@ -125,6 +151,11 @@ namespace hal
     class NETLIST_API TokenStream
     {
     public:
+        /**
+         * The string type that owns its characters, e.g., `std::string` for `std::string_view` tokens.
+         */
+        using owned_string_t = typename OwnedString<T>::type;
+
         /**
          * The exception that is raised on any kind of error that occurs while working on the tokens of the stream.
          */
@@ -133,7 +164,7 @@ namespace hal
             /**
              * The message that is displayed to the user.
              */
-            T message;
+            owned_string_t message;
 
             /**
              * The affected line number.
@@ -156,9 +187,11 @@ namespace hal
          */
         TokenStream(const std::vector<T>& increase_level_tokens = {"("}, const std::vector<T>& decrease_level_tokens = {")"})
         {
-            m_pos                   = 0;
-            m_increase_level_tokens = increase_level_tokens;
-            m_decrease_level_tokens = decrease_level_tokens;
+            m_pos          = 0;
+            m_begin        = 0;
+            m_end          = 0;
+            m_data         = std::make_shared<std::vector<Token<T>>>();
+            m_level_tokens = std::make_shared<const LevelTokens>(LevelTokens{increase_level_tokens, decrease_level_tokens});
         }
 
         /**
@@ -173,36 +206,42 @@ namespace hal
         TokenStream(const std::vector<Token<T>>& init, const std::vector<T>& increase_level_tokens = {"("}, const std::vector<T>& decrease_level_tokens = {")"})
             : TokenStream(increase_level_tokens, decrease_level_tokens)
         {
-            m_data = init;
+            *m_data = init;
+            m_end   = m_data->size();
         }
 
         /**
-         * Construct a token stream from another one (i.e., copy constructor).
+         * Construct a token stream by taking ownership of a vector of tokens.<br>
+         * The increase-level and decrease-level tokens are used for level-aware iteration. If active, all operations are only executed on tokens on level 0.<br>
+         * Example: consuming until "b" in 'a,(,b,),b,c' would consume 'a,(,b,)', if "(" and ")" are level increase/decrease tokens.
          *
-         * @param[in] other - The token stream to copy.
+         * @param[in] init - The vector of tokens.
+         * @param[in] decrease_level_tokens - A vector of tokens that mark the start of a new level, i.e., increase the level.
+         * @param[in] increase_level_tokens - A vector of tokens that mark the end of a level, i.e., decrease the level.
          */
-        TokenStream(const TokenStream<T>& other)
+        TokenStream(std::vector<Token<T>>&& init, const std::vector<T>& increase_level_tokens = {"("}, const std::vector<T>& decrease_level_tokens = {")"})
+            : TokenStream(increase_level_tokens, decrease_level_tokens)
         {
-            m_pos                   = other.m_pos;
-            m_data                  = other.m_data;
-            m_increase_level_tokens = other.m_increase_level_tokens;
-            m_decrease_level_tokens = other.m_decrease_level_tokens;
+            *m_data = std::move(init);
+            m_end   = m_data->size();
         }
 
         /**
-         * Assign a token stream.
+         * Construct a token stream from another one (i.e., copy constructor).<br>
+         * Both streams share the underlying tokens.
+         *
+         * @param[in] other - The token stream to copy.
+         */
+        TokenStream(const TokenStream<T>& other) = default;
+
+        /**
+         * Assign a token stream.<br>
+         * Both streams share the underlying tokens.
          *
          * @param[in] other - The token stream.
          * @returns A reference to the token stream.
          */
-        TokenStream<T>& operator=(const TokenStream<T>& other)
-        {
-            m_pos                   = other.m_pos;
-            m_data                  = other.m_data;
-            m_increase_level_tokens = other.m_increase_level_tokens;
-            m_decrease_level_tokens = other.m_decrease_level_tokens;
-            return *this;
-        }
+        TokenStream<T>& operator=(const TokenStream<T>& other) = default;
 
         /**
          * Consume the next token(s) in the stream.<br>
@@ -233,7 +272,7 @@ namespace hal
             {
                 if (throw_on_error)
                 {
-                    throw TokenStreamException({"expected Token '" + expected + "' but reached the end of the stream", get_current_line_number()});
+                    throw TokenStreamException({"expected Token '" + owned_string_t(expected) + "' but reached the end of the stream", get_current_line_number()});
                 }
                 return false;
             }
@@ -242,7 +281,7 @@ namespace hal
             {
                 if (throw_on_error)
                 {
-                    throw TokenStreamException({"expected Token '" + expected + "' but got '" + at(m_pos).string + "'", get_current_line_number()});
+                    throw TokenStreamException({"expected Token '" + owned_string_t(expected) + "' but got '" + owned_string_t(at(m_pos).string) + "'", get_current_line_number()});
                 }
                 return false;
             }
@@ -268,7 +307,7 @@ namespace hal
             auto found = find_next(expected, end, level_aware);
             if (found > size() && throw_on_error)
             {
-                throw TokenStreamException({"expected Token '" + expected + "' not found", get_current_line_number()});
+                throw TokenStreamException({"expected Token '" + owned_string_t(expected) + "' not found", get_current_line_number()});
             }
             m_pos = std::min(size(), found);
             return at(m_pos - 1);
@@ -295,7 +334,7 @@ namespace hal
         /**
          * Consume the next tokens in the stream until a token matches the given \p expected string.<br>
          * This final token is not consumed, i.e., it is now the next token in the stream.<br>
-         * All consumed tokens are returned as a new token stream.<br>
+         * All consumed tokens are returned as a new token stream that shares the tokens of this stream, i.e., no tokens are copied.<br>
          * Consumes tokens until reaching the given end position, if no token matches the given string.<br>
          * Can be set to be level-aware with respect to the configured increase and decrease level tokens.
          *
@@ -310,13 +349,14 @@ namespace hal
             auto found = find_next(expected, end, level_aware);
             if (found > size() && throw_on_error)
             {
-                throw TokenStreamException({"expected Token '" + expected + "' not found", get_current_line_number()});
+                throw TokenStreamException({"expected Token '" + owned_string_t(expected) + "' not found", get_current_line_number()});
             }
             auto end_pos = std::min(size(), found);
-            TokenStream res(m_increase_level_tokens, m_decrease_level_tokens);
-            res.m_data.reserve(res.m_data.size() + (end_pos - m_pos));
-            res.m_data.insert(res.m_data.begin(), m_data.begin() + m_pos, m_data.begin() + end_pos);
-            m_pos = end_pos;
+            TokenStream res(*this);
+            res.m_pos   = 0;
+            res.m_begin = m_begin + m_pos;
+            res.m_end   = m_begin + end_pos;
+            m_pos       = end_pos;
             return res;
         }
 
@@ -335,23 +375,23 @@ namespace hal
          * @param[in] throw_on_error - If true, throws an TokenStreamException instead of returning false on error.
          * @returns The joined token.
          */
-        Token<T> join_until(const T& match, const T& joiner, u32 end = END_OF_STREAM, bool level_aware = true, bool throw_on_error = false)
+        Token<owned_string_t> join_until(const T& match, const T& joiner, u32 end = END_OF_STREAM, bool level_aware = true, bool throw_on_error = false)
         {
             u32 start_line = get_current_line_number();
             auto found     = find_next(match, end, level_aware);
             if (found > size() && throw_on_error)
             {
-                throw TokenStreamException({"match Token '" + match + "' not found", start_line});
+                throw TokenStreamException({"match Token '" + owned_string_t(match) + "' not found", start_line});
             }
             auto end_pos = std::min(size(), found);
-            T result;
+            owned_string_t result;
             while (m_pos < end_pos && remaining() > 0)
             {
                 if (!result.empty())
                 {
                     result += joiner;
                 }
-                result += consume();
+                result += consume().string;
             }
             return {start_line, result};
         }
@@ -364,17 +404,17 @@ namespace hal
          * @param[in] joiner - The string used to join consumed tokens.
          * @returns The joined token.
          */
-        Token<T> join(const T& joiner)
+        Token<owned_string_t> join(const T& joiner)
         {
             u32 start_line = get_current_line_number();
-            T result;
+            owned_string_t result;
             while (remaining() > 0)
             {
                 if (!result.empty())
                 {
                     result += joiner;
                 }
-                result += consume();
+                result += consume().string;
             }
             return {start_line, result};
         }
@@ -414,11 +454,11 @@ namespace hal
          */
         Token<T>& at(u32 position)
         {
-            if (position >= m_data.size())
+            if (position >= size())
             {
                 throw TokenStreamException({"reached the end of the stream", get_current_line_number()});
             }
-            return m_data[position];
+            return (*m_data)[m_begin + position];
         }
 
         /**
@@ -426,11 +466,11 @@ namespace hal
          */
         const Token<T>& at(u32 position) const
         {
-            if (position >= m_data.size())
+            if (position >= size())
             {
                 throw TokenStreamException({"reached the end of the stream", get_current_line_number()});
             }
-            return m_data[position];
+            return (*m_data)[m_begin + position];
         }
 
         /**
@@ -445,6 +485,9 @@ namespace hal
          */
         u32 find_next(const T& match, u32 end = END_OF_STREAM, bool level_aware = true) const
         {
+            const auto& increase_level_tokens = m_level_tokens->increase;
+            const auto& decrease_level_tokens = m_level_tokens->decrease;
+
             u32 level = 0;
             for (u32 i = m_pos; i < size() && i < end; ++i)
             {
@@ -453,12 +496,12 @@ namespace hal
                 {
                     return i;
                 }
-                else if (level_aware && std::find_if(m_increase_level_tokens.begin(), m_increase_level_tokens.end(), [&Token](const auto& x) { return Token == x; }) != m_increase_level_tokens.end())
+                else if (level_aware && std::find_if(increase_level_tokens.begin(), increase_level_tokens.end(), [&Token](const auto& x) { return Token == x; }) != increase_level_tokens.end())
                 {
                     level++;
                 }
                 else if (level_aware && level > 0
-                         && std::find_if(m_decrease_level_tokens.begin(), m_decrease_level_tokens.end(), [&Token](const auto& x) { return Token == x; }) != m_decrease_level_tokens.end())
+                         && std::find_if(decrease_level_tokens.begin(), decrease_level_tokens.end(), [&Token](const auto& x) { return Token == x; }) != decrease_level_tokens.end())
                 {
                     level--;
                 }
@@ -473,7 +516,7 @@ namespace hal
          */
         u32 size() const
         {
-            return m_data.size();
+            return m_end - m_begin;
         }
 
         /**
@@ -517,20 +560,30 @@ namespace hal
         }
 
     private:
-        std::vector<T> m_increase_level_tokens;
-        std::vector<T> m_decrease_level_tokens;
-        std::vector<Token<T>> m_data;
+        struct LevelTokens
+        {
+            std::vector<T> increase;
+            std::vector<T> decrease;
+        };
+
+        // tokens and level tokens are shared with all streams extracted from this one
+        std::shared_ptr<std::vector<Token<T>>> m_data;
+        std::shared_ptr<const LevelTokens> m_level_tokens;
+
+        // the stream covers the tokens [m_begin, m_end) of m_data, m_pos is relative to m_begin
+        u32 m_begin;
+        u32 m_end;
         u32 m_pos;
 
         u32 get_current_line_number() const
         {
-            if (m_pos < m_data.size())
+            if (m_pos < size())
             {
-                return m_data[m_pos].number;
+                return (*m_data)[m_begin + m_pos].number;
             }
-            else if (!m_data.empty())
+            else if (size() != 0)
             {
-                return m_data.back().number;
+                return (*m_data)[m_end - 1].number;
             }
             return END_OF_STREAM;
         }
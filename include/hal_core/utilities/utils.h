@@ -508,6 +508,14 @@ namespace hal
          */
         CORE_API bool folder_exists_and_is_accessible(const std::filesystem::path& path);
 
+        /**
+         * Flush the contents of a file that has been written and closed to the storage device.
+         *
+         * @param[in] path - The file to flush.
+         * @returns True on success, false otherwise.
+         */
+        CORE_API bool sync_file(const std::filesystem::path& path);
+
         /**
          * Locate an executable in the given path environment.
          *
@@ -612,6 +620,13 @@ namespace hal
          */
         CORE_API std::filesystem::path get_file(std::string file_name, std::vector<std::filesystem::path> path_hints);
 
+        /**
+         * Get the peak resident set size of the current process, i.e., the maximum amount of physical memory used so far.
+         *
+         * @returns The peak resident set size in bytes or 0 if it cannot be determined on the current platform.
+         */
+        CORE_API u64 get_peak_memory_usage();
+
         /**
          * Get the licenses of all embedded OpenSource Projects.
          *
@@ -0,0 +1,92 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/netlist_parser/netlist_parser.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Parser for And-Inverter Graphs (AIGs) in the binary AIGER format.
+     *
+     * The file is parsed into compact literal arrays without building an intermediate syntax tree.
+     * During instantiation, every AND is mapped to a two-input AND gate, every latch to a flip-flop clocked by a global 'clk' input, and every inverted literal to a shared inverter.
+     * The reset value of each latch is stored as gate data of its flip-flop in category 'generic' with key 'INIT' and type 'bit_value', using 'X' for uninitialized latches.
+     * The required primitives are selected from the gate library based on their gate type properties.
+     *
+     * @ingroup netlist_parser
+     */
+    class NETLIST_API AigerParser : public NetlistParser
+    {
+    public:
+        AigerParser()  = default;
+        ~AigerParser() = default;
+
+        /**
+         * Parse a binary AIGER file.
+         *
+         * @param[in] file_path - Path to the AIGER file.
+         * @returns Ok on success, an error otherwise.
+         */
+        Result<std::monostate> parse(const std::filesystem::path& file_path) override;
+
+        /**
+         * Instantiate the parsed AIG using the specified gate library.
+         *
+         * @param[in] gate_library - The gate library.
+         * @returns A pointer to the resulting netlist on success, an error otherwise.
+         */
+        Result<std::unique_ptr<Netlist>> instantiate(const GateLibrary* gate_library) override;
+
+    private:
+        std::filesystem::path m_path;
+
+        u32 m_max_variable_index = 0;
+        u32 m_num_inputs         = 0;
+
+        // next state literal of each latch
+        std::vector<u32> m_latches;
+
+        // reset value of each latch, i.e., 0, 1, or the latch literal itself if the latch is uninitialized
+        std::vector<u32> m_latch_resets;
+
+        // literal of each output
+        std::vector<u32> m_outputs;
+
+        // right-hand side literals of each AND, the left-hand side is implicitly given by its position
+        std::vector<std::pair<u32, u32>> m_ands;
+
+        // names from the symbol table, empty if not specified
+        std::vector<std::string> m_input_names;
+        std::vector<std::string> m_latch_names;
+        std::vector<std::string> m_output_names;
+    };
+}    // namespace hal
@@ -0,0 +1,57 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/netlist_writer/netlist_writer.h"
+
+namespace hal
+{
+    /**
+     * Writer for netlists in the binary AIGER format.
+     *
+     * The combinational logic is translated into an And-Inverter Graph by decomposing the Boolean functions of all gates, applying structural hashing and constant propagation on the fly.
+     * Flip-flops are written as latches using their next-state function; clock, asynchronous set/reset, and enable behavior beyond the next-state function are not represented in AIGER.
+     * The reset value of a latch is taken from the 'generic' gate data with key 'INIT' as set by the AigerParser, where '1' and 'X' are written as reset to 1 and uninitialized, respectively, and latches are reset to 0 otherwise.
+     *
+     * @ingroup netlist_writer
+     */
+    class NETLIST_API AigerWriter : public NetlistWriter
+    {
+    public:
+        AigerWriter()  = default;
+        ~AigerWriter() = default;
+
+        /**
+         * Write the netlist to a binary AIGER file at the provided location.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] file_path - The output path.
+         * @returns Ok on success, an error otherwise.
+         */
+        Result<std::monostate> write(Netlist* netlist, const std::filesystem::path& file_path) override;
+    };
+}    // namespace hal
@@ -0,0 +1,489 @@
+#include "aiger/aiger_parser.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+
+#include <charconv>
+
+namespace hal
+{
+    namespace
+    {
+        std::string_view read_line(const std::string_view& data, size_t& pos)
+        {
+            size_t end = data.find('\n', pos);
+            if (end == std::string_view::npos)
+            {
+                end = data.size();
+            }
+
+            std::string_view line = data.substr(pos, end - pos);
+            pos                   = std::min(end + 1, data.size());
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.remove_suffix(1);
+            }
+            return line;
+        }
+
+        std::vector<std::string_view> split_line(const std::string_view& line)
+        {
+            std::vector<std::string_view> tokens;
+            size_t pos = 0;
+            while (pos < line.size())
+            {
+                size_t end = line.find(' ', pos);
+                if (end == std::string_view::npos)
+                {
+                    end = line.size();
+                }
+                if (end != pos)
+                {
+                    tokens.push_back(line.substr(pos, end - pos));
+                }
+                pos = end + 1;
+            }
+            return tokens;
+        }
+
+        bool parse_u32(const std::string_view& token, u32& value)
+        {
+            const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+            return ec == std::errc() && ptr == token.data() + token.size();
+        }
+
+        // unsigned LEB128 encoding of the AND deltas as specified by the binary AIGER format
+        bool decode_delta(const std::string_view& data, size_t& pos, u32& value)
+        {
+            value     = 0;
+            u32 shift = 0;
+            while (pos < data.size() && shift < 32)
+            {
+                const u8 c = (u8)data[pos++];
+                value |= (u32)(c & 0x7f) << shift;
+                if ((c & 0x80) == 0)
+                {
+                    return true;
+                }
+                shift += 7;
+            }
+            return false;
+        }
+
+        // selects the matching gate type with the fewest input pins, ties are broken by name to be deterministic
+        GateType* find_primitive(const GateLibrary* gate_library, const std::function<bool(const GateType*)>& filter)
+        {
+            GateType* res = nullptr;
+            for (const auto& [name, type] : gate_library->get_gate_types(filter))
+            {
+                if (res == nullptr || type->get_input_pins().size() < res->get_input_pins().size()
+                    || (type->get_input_pins().size() == res->get_input_pins().size() && name < res->get_name()))
+                {
+                    res = type;
+                }
+            }
+            return res;
+        }
+
+        GatePin* find_pin(const GateType* type, PinDirection direction, PinType pin_type)
+        {
+            auto pins = type->get_pins([direction, pin_type](const GatePin* pin) { return pin->get_direction() == direction && pin->get_type() == pin_type; });
+            return pins.empty() ? nullptr : pins.front();
+        }
+
+        bool is_simple_gate(const GateType* type, GateTypeProperty property, u32 num_inputs)
+        {
+            return type->has_property(property) && type->get_input_pins().size() == num_inputs && type->get_output_pins().size() == 1;
+        }
+    }    // namespace
+
+    Result<std::monostate> AigerParser::parse(const std::filesystem::path& file_path)
+    {
+        m_path = file_path;
+        m_latches.clear();
+        m_latch_resets.clear();
+        m_outputs.clear();
+        m_ands.clear();
+        m_input_names.clear();
+        m_latch_names.clear();
+        m_output_names.clear();
+
+        std::unique_ptr<MemoryMappedFile> file;
+        if (auto res = MemoryMappedFile::open(file_path); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not parse AIGER file '" + m_path.string() + "': unable to open file");
+        }
+        else
+        {
+            file = res.get();
+        }
+
+        const std::string_view data = file->get_data();
+        size_t pos                  = 0;
+
+        // header 'aig M I L O A [B C J F]'
+        const std::vector<std::string_view> header = split_line(read_line(data, pos));
+        if (header.empty() || header.front() != "aig")
+        {
+            if (!header.empty() && header.front() == "aag")
+            {
+                return ERR("could not parse AIGER file '" + m_path.string() + "': ASCII AIGER files are not supported, convert them to the binary format using 'aigtoaig'");
+            }
+            return ERR("could not parse AIGER file '" + m_path.string() + "': invalid header");
+        }
+
+        std::vector<u32> header_values(header.size() - 1);
+        for (u32 i = 0; i < header_values.size(); i++)
+        {
+            if (!parse_u32(header.at(i + 1), header_values.at(i)))
+            {
+                return ERR("could not parse AIGER file '" + m_path.string() + "': invalid header value '" + std::string(header.at(i + 1)) + "'");
+            }
+        }
+        if (header_values.size() < 5 || header_values.size() > 9)
+        {
+            return ERR("could not parse AIGER file '" + m_path.string() + "': header must specify between five and nine values");
+        }
+        for (u32 i = 5; i < header_values.size(); i++)
+        {
+            if (header_values.at(i) != 0)
+            {
+                return ERR("could not parse AIGER file '" + m_path.string() + "': bad state properties, invariant constraints, justice properties, and fairness constraints are not supported");
+            }
+        }
+
+        m_max_variable_index  = header_values.at(0);
+        m_num_inputs          = header_values.at(1);
+        const u32 num_latches = header_values.at(2);
+        const u32 num_outputs = header_values.at(3);
+        const u32 num_ands    = header_values.at(4);
+
+        if ((u64)m_num_inputs + num_latches + num_ands != m_max_variable_index || m_max_variable_index >= (1u << 31))
+        {
+            return ERR("could not parse AIGER file '" + m_path.string() + "': maximum variable index does not match the number of inputs, latches, and ANDs");
+        }
+
+        const u32 max_literal = 2 * m_max_variable_index + 1;
+
+        // latches 'next [reset]'
+        m_latches.reserve(num_latches);
+        m_latch_resets.reserve(num_latches);
+        for (u32 i = 0; i < num_latches; i++)
+        {
+            const std::vector<std::string_view> tokens = split_line(read_line(data, pos));
+            const u32 literal                          = 2 * (m_num_inputs + i + 1);
+            u32 next                                   = 0;
+            u32 reset                                  = 0;
+            if (tokens.empty() || tokens.size() > 2 || !parse_u32(tokens.at(0), next) || next > max_literal)
+            {
+                return ERR("could not parse AIGER file '" + m_path.string() + "': invalid definition of latch " + std::to_string(i));
+            }
+            if (tokens.size() == 2 && (!parse_u32(tokens.at(1), reset) || (reset > 1 && reset != literal)))
+            {
+                return ERR("could not parse AIGER file '" + m_path.string() + "': invalid reset value of latch " + std::to_string(i) + ", must be 0, 1, or the latch literal " + std::to_string(literal));
+            }
+            m_latches.push_back(next);
+            m_latch_resets.push_back(reset);
+        }
+
+        // outputs
+        m_outputs.reserve(num_outputs);
+        for (u32 i = 0; i < num_outputs; i++)
+        {
+            u32 literal = 0;
+            if (!parse_u32(read_line(data, pos), literal) || literal > max_literal)
+            {
+                return ERR("could not parse AIGER file '" + m_path.string() + "': invalid definition of output " + std::to_string(i));
+            }
+            m_outputs.push_back(literal);
+        }
+
+        // delta-encoded ANDs
+        m_ands.reserve(num_ands);
+        for (u32 i = 0; i < num_ands; i++)
+        {
+            const u32 lhs = 2 * (m_num_inputs + num_latches + i + 1);
+            u32 delta0    = 0;
+            u32 delta1    = 0;
+            if (!decode_delta(data, pos, delta0) || !decode_delta(data, pos, delta1) || delta0 == 0 || delta0 > lhs || delta1 > lhs - delta0)
+            {
+                return ERR("could not parse AIGER file '" + m_path.string() + "': invalid encoding of AND " + std::to_string(i));
+            }
+            const u32 rhs0 = lhs - delta0;
+            m_ands.push_back({rhs0, rhs0 - delta1});
+        }
+
+        // optional symbol table, terminated by an optional comment section
+        m_input_names.resize(m_num_inputs);
+        m_latch_names.resize(num_latches);
+        m_output_names.resize(num_outputs);
+        while (pos < data.size())
+        {
+            const std::string_view line = read_line(data, pos);
+            if (line.empty())
+            {
+                continue;
+            }
+            if (line.front() == 'c')
+            {
+                break;
+            }
+
+            const size_t space = line.find(' ');
+            u32 index          = 0;
+            if (space == std::string_view::npos || !parse_u32(line.substr(1, space - 1), index))
+            {
+                return ERR("could not parse AIGER file '" + m_path.string() + "': invalid symbol table entry '" + std::string(line) + "'");
+            }
+
+            std::vector<std::string>* names = nullptr;
+            switch (line.front())
+            {
+                case 'i':
+                    names = &m_input_names;
+                    break;
+                case 'l':
+                    names = &m_latch_names;
+                    break;
+                case 'o':
+                    names = &m_output_names;
+                    break;
+                default:
+                    return ERR("could not parse AIGER file '" + m_path.string() + "': invalid symbol table entry '" + std::string(line) + "'");
+            }
+            if (index >= names->size())
+            {
+                return ERR("could not parse AIGER file '" + m_path.string() + "': symbol table entry '" + std::string(line) + "' is out of range");
+            }
+            names->at(index) = std::string(line.substr(space + 1));
+        }
+
+        return OK({});
+    }
+
+    Result<std::unique_ptr<Netlist>> AigerParser::instantiate(const GateLibrary* gate_library)
+    {
+        const std::string error_prefix = "could not instantiate AIGER netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "': ";
+
+        // select the primitives from the gate library
+        GateType* and_type = find_primitive(gate_library, [](const GateType* type) { return is_simple_gate(type, GateTypeProperty::c_and, 2); });
+        GateType* inv_type = find_primitive(gate_library, [](const GateType* type) { return is_simple_gate(type, GateTypeProperty::c_inverter, 1); });
+        GateType* buf_type = find_primitive(gate_library, [](const GateType* type) { return is_simple_gate(type, GateTypeProperty::c_buffer, 1); });
+        GateType* gnd_type = find_primitive(gate_library, [](const GateType* type) { return is_simple_gate(type, GateTypeProperty::ground, 0); });
+        GateType* vcc_type = find_primitive(gate_library, [](const GateType* type) { return is_simple_gate(type, GateTypeProperty::power, 0); });
+        GateType* ff_type  = find_primitive(gate_library, [](const GateType* type) {
+            return type->has_property(GateTypeProperty::ff) && find_pin(type, PinDirection::input, PinType::clock) != nullptr && find_pin(type, PinDirection::input, PinType::data) != nullptr
+                   && find_pin(type, PinDirection::output, PinType::state) != nullptr;
+        });
+
+        if (and_type == nullptr || inv_type == nullptr || buf_type == nullptr || gnd_type == nullptr || vcc_type == nullptr)
+        {
+            return ERR(error_prefix + "gate library must provide a two-input AND gate, an inverter, a buffer, and GND and VCC gates");
+        }
+        if (!m_latches.empty() && ff_type == nullptr)
+        {
+            return ERR(error_prefix + "gate library does not provide a flip-flop with clock, data, and state pins");
+        }
+
+        std::unique_ptr<Netlist> result = netlist_factory::create_netlist(gate_library);
+        Netlist* netlist                = result.get();
+        if (netlist == nullptr)
+        {
+            return ERR(error_prefix + "failed to create empty netlist");
+        }
+        netlist->set_design_name(m_path.stem().string());
+        netlist->enable_automatic_net_checks(false);
+
+        GatePin* and_in0 = and_type->get_input_pins().at(0);
+        GatePin* and_in1 = and_type->get_input_pins().at(1);
+        GatePin* and_out = and_type->get_output_pins().front();
+        GatePin* inv_in  = inv_type->get_input_pins().front();
+        GatePin* inv_out = inv_type->get_output_pins().front();
+
+        // nets driving the positive and negative literals of each variable, created on demand for constants and negations
+        std::vector<Net*> positive_nets(m_max_variable_index + 1, nullptr);
+        std::vector<Net*> negative_nets(m_max_variable_index + 1, nullptr);
+
+        const auto create_constant = [netlist](GateType* type, const std::string& name, bool is_vcc) -> Net* {
+            Gate* gate = netlist->create_gate(type, name);
+            Net* net   = netlist->create_net(name);
+            if (gate == nullptr || net == nullptr || !(is_vcc ? netlist->mark_vcc_gate(gate) : netlist->mark_gnd_gate(gate)) || net->add_source(gate, type->get_output_pins().front()) == nullptr)
+            {
+                return nullptr;
+            }
+            return net;
+        };
+
+        const auto get_net = [&](u32 literal) -> Net* {
+            const u32 variable = literal >> 1;
+            if (variable == 0)
+            {
+                Net*& constant = (literal & 1) ? negative_nets.at(0) : positive_nets.at(0);
+                if (constant == nullptr)
+                {
+                    constant = (literal & 1) ? create_constant(vcc_type, "global_vcc", true) : create_constant(gnd_type, "global_gnd", false);
+                }
+                return constant;
+            }
+            if ((literal & 1) == 0)
+            {
+                return positive_nets.at(variable);
+            }
+
+            Net*& negated = negative_nets.at(variable);
+            if (negated == nullptr)
+            {
+                Net* net               = positive_nets.at(variable);
+                const std::string name = net->get_name() + "_inv";
+                Gate* gate             = netlist->create_gate(inv_type, name);
+                negated                = netlist->create_net(name);
+                if (gate == nullptr || negated == nullptr || negated->add_source(gate, inv_out) == nullptr || net->add_destination(gate, inv_in) == nullptr)
+                {
+                    return nullptr;
+                }
+            }
+            return negated;
+        };
+
+        // inputs
+        for (u32 i = 0; i < m_num_inputs; i++)
+        {
+            const std::string name = m_input_names.at(i).empty() ? "i" + std::to_string(i) : m_input_names.at(i);
+            Net* net               = netlist->create_net(name);
+            if (net == nullptr || !net->mark_global_input_net())
+            {
+                return ERR(error_prefix + "failed to create input net '" + name + "'");
+            }
+            positive_nets.at(i + 1) = net;
+        }
+
+        // latches, connected once all nets exist
+        std::vector<Gate*> latch_gates;
+        latch_gates.reserve(m_latches.size());
+        GatePin* ff_out = (ff_type != nullptr) ? find_pin(ff_type, PinDirection::output, PinType::state) : nullptr;
+        for (u32 i = 0; i < m_latches.size(); i++)
+        {
+            const std::string name = m_latch_names.at(i).empty() ? "l" + std::to_string(i) : m_latch_names.at(i);
+            Gate* gate             = netlist->create_gate(ff_type, name);
+            Net* net               = netlist->create_net(name);
+            if (gate == nullptr || net == nullptr || net->add_source(gate, ff_out) == nullptr)
+            {
+                return ERR(error_prefix + "failed to create latch '" + name + "'");
+            }
+
+            const u32 reset = m_latch_resets.at(i);
+            if (!gate->set_data("generic", "INIT", "bit_value", (reset > 1) ? "X" : std::to_string(reset)))
+            {
+                return ERR(error_prefix + "failed to set reset value of latch '" + name + "'");
+            }
+            positive_nets.at(m_num_inputs + i + 1) = net;
+            latch_gates.push_back(gate);
+        }
+
+        // ANDs, which are ordered such that both inputs of an AND are defined before the AND itself
+        const u32 first_and_variable = m_num_inputs + (u32)m_latches.size() + 1;
+        for (u32 i = 0; i < m_ands.size(); i++)
+        {
+            const u32 variable     = first_and_variable + i;
+            const std::string name = "n" + std::to_string(variable);
+            Gate* gate             = netlist->create_gate(and_type, name);
+            Net* net               = netlist->create_net(name);
+            if (gate == nullptr || net == nullptr || net->add_source(gate, and_out) == nullptr)
+            {
+                return ERR(error_prefix + "failed to create AND '" + name + "'");
+            }
+            positive_nets.at(variable) = net;
+
+            const auto& [rhs0, rhs1] = m_ands.at(i);
+            Net* in0                 = get_net(rhs0);
+            Net* in1                 = get_net(rhs1);
+            if (in0 == nullptr || in1 == nullptr || in0->add_destination(gate, and_in0) == nullptr || in1->add_destination(gate, and_in1) == nullptr)
+            {
+                return ERR(error_prefix + "failed to connect AND '" + name + "'");
+            }
+        }
+
+        // connect latches to the global clock and tie off all remaining control inputs
+        if (!latch_gates.empty())
+        {
+            Net* clock = netlist->create_net("clk");
+            if (clock == nullptr || !clock->mark_global_input_net())
+            {
+                return ERR(error_prefix + "failed to create clock net");
+            }
+
+            for (u32 i = 0; i < latch_gates.size(); i++)
+            {
+                Gate* gate = latch_gates.at(i);
+                for (GatePin* pin : ff_type->get_input_pins())
+                {
+                    Net* net = nullptr;
+                    switch (pin->get_type())
+                    {
+                        case PinType::clock:
+                            net = clock;
+                            break;
+                        case PinType::data:
+                            net = get_net(m_latches.at(i));
+                            break;
+                        case PinType::enable:
+                            net = get_net(1);
+                            break;
+                        default:
+                            net = get_net(0);
+                            break;
+                    }
+                    if (net == nullptr || net->add_destination(gate, pin) == nullptr)
+                    {
+                        return ERR(error_prefix + "failed to connect pin '" + pin->get_name() + "' of latch '" + gate->get_name() + "'");
+                    }
+                }
+            }
+        }
+
+        // outputs, which rename the driving net if possible or are driven by a buffer otherwise
+        for (u32 i = 0; i < m_outputs.size(); i++)
+        {
+            const std::string name = m_output_names.at(i).empty() ? "o" + std::to_string(i) : m_output_names.at(i);
+            Net* net               = get_net(m_outputs.at(i));
+            if (net == nullptr)
+            {
+                return ERR(error_prefix + "failed to create output '" + name + "'");
+            }
+
+            const std::vector<Endpoint*> sources = net->get_sources();
+            const bool is_renamable              = !net->is_global_input_net() && !net->is_global_output_net() && !sources.empty()
+                                      && (sources.front()->get_gate()->get_type() == and_type || sources.front()->get_gate()->get_type() == inv_type);
+            if (!is_renamable)
+            {
+                Gate* gate = netlist->create_gate(buf_type, name + "_buf");
+                Net* out   = netlist->create_net(name);
+                if (gate == nullptr || out == nullptr || net->add_destination(gate, buf_type->get_input_pins().front()) == nullptr
+                    || out->add_source(gate, buf_type->get_output_pins().front()) == nullptr)
+                {
+                    return ERR(error_prefix + "failed to create output '" + name + "'");
+                }
+                net = out;
+            }
+            else
+            {
+                net->set_name(name);
+            }
+
+            if (!net->mark_global_output_net())
+            {
+                return ERR(error_prefix + "failed to mark output '" + name + "'");
+            }
+        }
+
+        netlist->enable_automatic_net_checks(true);
+
+        return OK(std::move(result));
+    }
+}    // namespace hal
@@ -0,0 +1,489 @@
+#include "aiger/aiger_writer.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/utilities/log.h"
+
+#include <algorithm>
+#include <fstream>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace hal
+{
+    namespace
+    {
+        /**
+         * And-Inverter Graph that is built bottom-up, applying constant propagation and structural hashing to every new AND.
+         * Variables are numbered in the order required by the binary AIGER format, i.e., inputs first, followed by latches, followed by ANDs in topological order.
+         */
+        class AigBuilder
+        {
+        public:
+            AigBuilder(u32 num_inputs, u32 num_latches) : m_first_and_variable(num_inputs + num_latches + 1)
+            {
+            }
+
+            u32 create_and(u32 a, u32 b)
+            {
+                if (a < b)
+                {
+                    std::swap(a, b);
+                }
+
+                if (b == 0 || a == (b ^ 1))
+                {
+                    return 0;
+                }
+                if (b == 1 || a == b)
+                {
+                    return a;
+                }
+
+                const u64 key = ((u64)a << 32) | b;
+                if (const auto it = m_and_lookup.find(key); it != m_and_lookup.end())
+                {
+                    return it->second;
+                }
+
+                const u32 literal = 2 * (m_first_and_variable + (u32)m_ands.size());
+                m_ands.push_back({a, b});
+                m_and_lookup.emplace(key, literal);
+                return literal;
+            }
+
+            u32 create_or(u32 a, u32 b)
+            {
+                return create_and(a ^ 1, b ^ 1) ^ 1;
+            }
+
+            u32 create_xor(u32 a, u32 b)
+            {
+                return create_or(create_and(a, b ^ 1), create_and(a ^ 1, b));
+            }
+
+            const std::vector<std::pair<u32, u32>>& get_ands() const
+            {
+                return m_ands;
+            }
+
+        private:
+            const u32 m_first_and_variable;
+            std::vector<std::pair<u32, u32>> m_ands;
+            std::unordered_map<u64, u32> m_and_lookup;
+        };
+
+        void encode_delta(std::string& out, u32 value)
+        {
+            while (value & ~0x7fu)
+            {
+                out.push_back((char)((value & 0x7f) | 0x80));
+                value >>= 7;
+            }
+            out.push_back((char)value);
+        }
+
+        bool is_clock_only_net(const Net* net)
+        {
+            const std::vector<Endpoint*> destinations = net->get_destinations();
+            return !destinations.empty() && std::all_of(destinations.begin(), destinations.end(), [](const Endpoint* ep) {
+                return ep->get_pin()->get_type() == PinType::clock && ep->get_gate()->get_type()->has_property(GateTypeProperty::ff);
+            });
+        }
+
+        class AigTranslator
+        {
+        public:
+            AigTranslator(AigBuilder& aig, std::unordered_map<const Net*, u32>& net_literals, std::unordered_map<const Gate*, u32>& latch_literals)
+                : m_aig(aig), m_net_literals(net_literals), m_latch_literals(latch_literals)
+            {
+            }
+
+            /**
+             * Compute the literal of a net by translating its combinational fan-in cone.
+             * The cone is traversed iteratively to support arbitrarily deep logic.
+             */
+            Result<u32> translate_net(const Net* root)
+            {
+                std::vector<const Net*> stack = {root};
+                while (!stack.empty())
+                {
+                    const Net* net = stack.back();
+                    if (m_net_literals.find(net) != m_net_literals.end())
+                    {
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    const auto sources = net->get_sources();
+                    if (sources.size() > 1)
+                    {
+                        return ERR("net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " has multiple sources");
+                    }
+                    if (sources.empty())
+                    {
+                        log_warning("aiger", "net '{}' with ID {} has no source and is assumed to be constant 0.", net->get_name(), net->get_id());
+                        m_net_literals[net] = 0;
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    const Gate* gate   = sources.front()->get_gate();
+                    const GatePin* pin = sources.front()->get_pin();
+                    if (auto res = translate_source(gate, pin); res.is_error())
+                    {
+                        return ERR(res.get_error());
+                    }
+                    else if (res.get().has_value())
+                    {
+                        m_net_literals[net] = res.get().value();
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    // combinational gate, the inputs of which are translated first when the net is visited for the first time
+                    const BooleanFunction& function = get_function(gate, pin);
+                    if (m_in_progress.insert(net).second)
+                    {
+                        for (const std::string& variable : function.get_variable_names())
+                        {
+                            const Net* input = get_input_net(gate, variable);
+                            if (input != nullptr && m_net_literals.find(input) == m_net_literals.end())
+                            {
+                                if (m_in_progress.find(input) != m_in_progress.end())
+                                {
+                                    return ERR("combinational loop through net '" + input->get_name() + "' with ID " + std::to_string(input->get_id()));
+                                }
+                                stack.push_back(input);
+                            }
+                        }
+                    }
+
+                    if (stack.back() == net)
+                    {
+                        if (auto res = translate_function(gate, function); res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(), "could not translate function of pin '" + pin->get_name() + "' of gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()));
+                        }
+                        else
+                        {
+                            m_net_literals[net] = res.get();
+                        }
+                        m_in_progress.erase(net);
+                        m_functions.erase(net);
+                        stack.pop_back();
+                    }
+                }
+
+                return OK(m_net_literals.at(root));
+            }
+
+            /**
+             * Translate a single-bit Boolean function of the given gate, all fan-in nets of which must have been translated already.
+             */
+            Result<u32> translate_function(const Gate* gate, const BooleanFunction& function)
+            {
+                std::vector<u32> stack;
+                for (const auto& node : function.get_nodes())
+                {
+                    if (node.size != 1)
+                    {
+                        return ERR("multi-bit functions are not supported");
+                    }
+
+                    switch (node.type)
+                    {
+                        case BooleanFunction::NodeType::Constant:
+                            if (node.constant.front() != BooleanFunction::Value::ZERO && node.constant.front() != BooleanFunction::Value::ONE)
+                            {
+                                return ERR("undefined constants are not supported");
+                            }
+                            stack.push_back((node.constant.front() == BooleanFunction::Value::ONE) ? 1 : 0);
+                            break;
+                        case BooleanFunction::NodeType::Variable: {
+                            if (gate->get_type()->get_pin_by_name(node.variable) == nullptr)
+                            {
+                                return ERR("variable '" + node.variable + "' does not correspond to a pin");
+                            }
+                            const Net* input = get_input_net(gate, node.variable);
+                            if (input == nullptr)
+                            {
+                                log_warning("aiger", "pin '{}' of gate '{}' with ID {} is unconnected and assumed to be constant 0.", node.variable, gate->get_name(), gate->get_id());
+                                stack.push_back(0);
+                            }
+                            else
+                            {
+                                stack.push_back(m_net_literals.at(input));
+                            }
+                            break;
+                        }
+                        case BooleanFunction::NodeType::Not:
+                            stack.back() ^= 1;
+                            break;
+                        case BooleanFunction::NodeType::And:
+                        case BooleanFunction::NodeType::Or:
+                        case BooleanFunction::NodeType::Xor: {
+                            const u32 b = stack.back();
+                            stack.pop_back();
+                            const u32 a = stack.back();
+                            stack.back() = (node.type == BooleanFunction::NodeType::And) ? m_aig.create_and(a, b)
+                                           : (node.type == BooleanFunction::NodeType::Or) ? m_aig.create_or(a, b)
+                                                                                           : m_aig.create_xor(a, b);
+                            break;
+                        }
+                        default:
+                            return ERR("operation '" + node.to_string() + "' is not supported");
+                    }
+                }
+
+                if (stack.size() != 1)
+                {
+                    return ERR("invalid function");
+                }
+                return OK(stack.back());
+            }
+
+            /**
+             * Translate all fan-in nets of the given function before translating the function itself.
+             */
+            Result<u32> translate_gate_function(const Gate* gate, const BooleanFunction& function)
+            {
+                for (const std::string& variable : function.get_variable_names())
+                {
+                    if (const Net* input = get_input_net(gate, variable); input != nullptr)
+                    {
+                        if (auto res = translate_net(input); res.is_error())
+                        {
+                            return ERR(res.get_error());
+                        }
+                    }
+                }
+                return translate_function(gate, function);
+            }
+
+        private:
+            AigBuilder& m_aig;
+            std::unordered_map<const Net*, u32>& m_net_literals;
+            std::unordered_map<const Gate*, u32>& m_latch_literals;
+            std::unordered_set<const Net*> m_in_progress;
+            std::unordered_map<const Net*, BooleanFunction> m_functions;
+
+            const Net* get_input_net(const Gate* gate, const std::string& pin_name) const
+            {
+                const GatePin* pin = gate->get_type()->get_pin_by_name(pin_name);
+                return (pin != nullptr && pin->get_direction() == PinDirection::input) ? gate->get_fan_in_net(pin) : nullptr;
+            }
+
+            const BooleanFunction& get_function(const Gate* gate, const GatePin* pin)
+            {
+                const Net* net = gate->get_fan_out_net(pin);
+                if (auto it = m_functions.find(net); it != m_functions.end())
+                {
+                    return it->second;
+                }
+                return m_functions.emplace(net, gate->get_boolean_function(pin)).first->second;
+            }
+
+            // returns the literal for sources that do not depend on other nets, or an empty optional for combinational gates
+            Result<std::optional<u32>> translate_source(const Gate* gate, const GatePin* pin) const
+            {
+                const GateType* type = gate->get_type();
+                if (type->has_property(GateTypeProperty::ground))
+                {
+                    return OK(std::optional<u32>(0));
+                }
+                if (type->has_property(GateTypeProperty::power))
+                {
+                    return OK(std::optional<u32>(1));
+                }
+                if (const auto it = m_latch_literals.find(gate); it != m_latch_literals.end())
+                {
+                    if (pin->get_type() == PinType::state)
+                    {
+                        return OK(std::optional<u32>(it->second));
+                    }
+                    if (pin->get_type() == PinType::neg_state)
+                    {
+                        return OK(std::optional<u32>(it->second ^ 1));
+                    }
+                    return ERR("output pin '" + pin->get_name() + "' of flip-flop '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + " is neither a state nor a negated state pin");
+                }
+                if (type->has_property(GateTypeProperty::sequential))
+                {
+                    return ERR("sequential gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + " of type '" + type->get_name() + "' is not a flip-flop");
+                }
+                return OK(std::optional<u32>());
+            }
+        };
+    }    // namespace
+
+    Result<std::monostate> AigerWriter::write(Netlist* netlist, const std::filesystem::path& file_path)
+    {
+        const std::string error_prefix = "could not write netlist with ID " + std::to_string(netlist->get_id()) + " to AIGER file '" + file_path.string() + "': ";
+
+        // inputs, excluding pure clock signals that are implicit in AIGER
+        std::vector<Net*> inputs;
+        for (Net* net : netlist->get_global_input_nets())
+        {
+            if (!is_clock_only_net(net))
+            {
+                inputs.push_back(net);
+            }
+        }
+
+        std::vector<Gate*> latches = netlist->get_gates([](const Gate* gate) { return gate->get_type()->has_property(GateTypeProperty::ff); });
+
+        AigBuilder aig(inputs.size(), latches.size());
+        std::unordered_map<const Net*, u32> net_literals;
+        std::unordered_map<const Gate*, u32> latch_literals;
+        for (u32 i = 0; i < inputs.size(); i++)
+        {
+            net_literals[inputs.at(i)] = 2 * (i + 1);
+        }
+        for (u32 i = 0; i < latches.size(); i++)
+        {
+            latch_literals[latches.at(i)] = 2 * (inputs.size() + i + 1);
+        }
+        for (Net* net : netlist->get_global_input_nets())
+        {
+            net_literals.emplace(net, 0);
+        }
+
+        AigTranslator translator(aig, net_literals, latch_literals);
+
+        // outputs
+        std::vector<u32> output_literals;
+        for (const Net* net : netlist->get_global_output_nets())
+        {
+            if (auto res = translator.translate_net(net); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), error_prefix + "unable to translate output net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()));
+            }
+            else
+            {
+                output_literals.push_back(res.get());
+            }
+        }
+
+        // next-state functions and reset values of latches
+        std::vector<u32> next_literals;
+        std::vector<u32> reset_literals;
+        bool warned_async = false;
+        bool warned_reset = false;
+        for (const Gate* gate : latches)
+        {
+            // uninitialized latches are reset to their own literal
+            const std::string reset_value = std::get<1>(gate->get_data("generic", "INIT"));
+            if (reset_value == "1")
+            {
+                reset_literals.push_back(1);
+            }
+            else if (reset_value == "X" || reset_value == "x")
+            {
+                reset_literals.push_back(latch_literals.at(gate));
+            }
+            else
+            {
+                if (!reset_value.empty() && reset_value != "0" && !warned_reset)
+                {
+                    log_warning("aiger", "reset value '{}' of flip-flop '{}' with ID {} is not a single bit, assuming reset to 0.", reset_value, gate->get_name(), gate->get_id());
+                    warned_reset = true;
+                }
+                reset_literals.push_back(0);
+            }
+
+            const FFComponent* ff_component = gate->get_type()->get_component_as<FFComponent>([](const GateTypeComponent* c) { return c->get_type() == GateTypeComponent::ComponentType::ff; });
+            if (ff_component == nullptr)
+            {
+                return ERR(error_prefix + "flip-flop '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + " has no next-state function");
+            }
+
+            if (auto res = translator.translate_gate_function(gate, ff_component->get_next_state_function()); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), error_prefix + "unable to translate next-state function of flip-flop '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()));
+            }
+            else
+            {
+                next_literals.push_back(res.get());
+            }
+
+            for (const BooleanFunction& async_function : {ff_component->get_async_set_function(), ff_component->get_async_reset_function()})
+            {
+                if (async_function.is_empty() || warned_async)
+                {
+                    continue;
+                }
+                if (auto res = translator.translate_gate_function(gate, async_function); res.is_error() || res.get() != 0)
+                {
+                    log_warning("aiger", "asynchronous set and reset behavior of flip-flops such as '{}' with ID {} cannot be represented in AIGER and is ignored.", gate->get_name(), gate->get_id());
+                    warned_async = true;
+                }
+            }
+        }
+
+        // serialize in binary format
+        const auto& ands = aig.get_ands();
+        std::string out;
+        out.reserve(64 + 8 * (latches.size() + output_literals.size()) + 4 * ands.size());
+
+        const u32 max_variable_index = inputs.size() + latches.size() + ands.size();
+        out += "aig " + std::to_string(max_variable_index) + " " + std::to_string(inputs.size()) + " " + std::to_string(latches.size()) + " " + std::to_string(output_literals.size()) + " "
+               + std::to_string(ands.size()) + "\n";
+        for (u32 i = 0; i < next_literals.size(); i++)
+        {
+            out += std::to_string(next_literals.at(i));
+            if (reset_literals.at(i) != 0)
+            {
+                out += " " + std::to_string(reset_literals.at(i));
+            }
+            out += "\n";
+        }
+        for (u32 literal : output_literals)
+        {
+            out += std::to_string(literal) + "\n";
+        }
+
+        const u32 first_and_variable = inputs.size() + latches.size() + 1;
+        for (u32 i = 0; i < ands.size(); i++)
+        {
+            const u32 lhs            = 2 * (first_and_variable + i);
+            const auto& [rhs0, rhs1] = ands.at(i);
+            encode_delta(out, lhs - rhs0);
+            encode_delta(out, rhs0 - rhs1);
+        }
+
+        // symbol table
+        for (u32 i = 0; i < inputs.size(); i++)
+        {
+            out += "i" + std::to_string(i) + " " + inputs.at(i)->get_name() + "\n";
+        }
+        for (u32 i = 0; i < latches.size(); i++)
+        {
+            out += "l" + std::to_string(i) + " " + latches.at(i)->get_name() + "\n";
+        }
+        u32 output_index = 0;
+        for (const Net* net : netlist->get_global_output_nets())
+        {
+            out += "o" + std::to_string(output_index++) + " " + net->get_name() + "\n";
+        }
+
+        std::ofstream ofs(file_path, std::ofstream::out | std::ofstream::binary);
+        if (!ofs.is_open())
+        {
+            return ERR(error_prefix + "unable to open file");
+        }
+        ofs.write(out.data(), out.size());
+        ofs.close();
+        if (ofs.fail())
+        {
+            return ERR(error_prefix + "unable to write file");
+        }
+
+        return OK({});
+    }
+}    // namespace hal
@@ -0,0 +1,36 @@
+#include "aiger/plugin_aiger.h"
+
+#include "aiger/aiger_parser.h"
+#include "aiger/aiger_writer.h"
+#include "hal_core/netlist/netlist_parser/netlist_parser_manager.h"
+#include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
+
+namespace hal
+{
+    extern std::unique_ptr<BasePluginInterface> create_plugin_instance()
+    {
+        return std::make_unique<AigerPlugin>();
+    }
+
+    std::string AigerPlugin::get_name() const
+    {
+        return std::string("aiger");
+    }
+
+    std::string AigerPlugin::get_version() const
+    {
+        return std::string("0.1");
+    }
+
+    void AigerPlugin::on_load()
+    {
+        netlist_parser_manager::register_parser("Default AIGER Parser", []() { return std::make_unique<AigerParser>(); }, {".aig"});
+        netlist_writer_manager::register_writer("Default AIGER Writer", []() { return std::make_unique<AigerWriter>(); }, {".aig"});
+    }
+
+    void AigerPlugin::on_unload()
+    {
+        netlist_parser_manager::unregister_parser("Default AIGER Parser");
+        netlist_writer_manager::unregister_writer("Default AIGER Writer");
+    }
+}    // namespace hal
@@ -0,0 +1,297 @@
+#include "aiger/aiger_parser.h"
+#include "aiger/aiger_writer.h"
+
+#include "gate_library_test_utils.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "netlist_test_utils.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace hal
+{
+    class AigerTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+            test_utils::create_sandbox_directory();
+        }
+
+        virtual void TearDown()
+        {
+            test_utils::remove_sandbox_directory();
+        }
+
+        std::string read_file(const std::filesystem::path& path)
+        {
+            std::ifstream ifs(path, std::ios::binary);
+            std::stringstream ss;
+            ss << ifs.rdbuf();
+            return ss.str();
+        }
+
+        Gate* get_source(const Net* net)
+        {
+            return net->get_sources().empty() ? nullptr : net->get_sources().front()->get_gate();
+        }
+    };
+
+    /*
+     *   a --.                        .-= INV =-- y
+     *       AND (n4) --.             |
+     *   b --'          AND (n5) -----+-= DFF (state) =--+-= BUF =-- q
+     *             .----=                                |
+     *             '-= INV =---------------------------'
+     */
+    /**
+     * Testing the parsing of a binary AIGER file with latches and a symbol table.
+     *
+     * Functions: parse, instantiate
+     */
+    TEST_F(AigerTest, check_parse)
+    {
+        TEST_START
+        {
+            // aig M I L O A, latches, outputs, ANDs 8 = 4 & 2 and 10 = 8 & 7, symbols
+            std::string aig = "aig 5 2 1 2 2\n10\n11\n6\n";
+            aig += std::string({4, 2, 2, 1});
+            aig += "i0 a\ni1 b\nl0 state\no0 y\no1 q\nc\nsome comment\n";
+            std::filesystem::path path = test_utils::create_sandbox_file("test.aig", aig);
+
+            AigerParser parser;
+            auto nl_res = parser.parse_and_instantiate(path, test_utils::get_gate_library());
+            ASSERT_TRUE(nl_res.is_ok()) << nl_res.get_error().get();
+            std::unique_ptr<Netlist> nl = nl_res.get();
+
+            EXPECT_EQ(nl->get_design_name(), "test");
+            EXPECT_EQ(nl->get_gates([](const Gate* g) { return g->get_type()->get_name() == "AND2"; }).size(), 2);
+            EXPECT_EQ(nl->get_gates([](const Gate* g) { return g->get_type()->get_name() == "INV"; }).size(), 2);
+            EXPECT_EQ(nl->get_gates([](const Gate* g) { return g->get_type()->get_name() == "BUF"; }).size(), 1);
+            EXPECT_EQ(nl->get_gates([](const Gate* g) { return g->get_type()->get_name() == "DFF"; }).size(), 1);
+            EXPECT_EQ(nl->get_gates().size(), 6);
+
+            ASSERT_EQ(nl->get_global_input_nets().size(), 3);
+            EXPECT_EQ(nl->get_global_input_nets().at(0)->get_name(), "a");
+            EXPECT_EQ(nl->get_global_input_nets().at(1)->get_name(), "b");
+            EXPECT_EQ(nl->get_global_input_nets().at(2)->get_name(), "clk");
+            ASSERT_EQ(nl->get_global_output_nets().size(), 2);
+            EXPECT_EQ(nl->get_global_output_nets().at(0)->get_name(), "y");
+            EXPECT_EQ(nl->get_global_output_nets().at(1)->get_name(), "q");
+
+            // output 'y' is the negated AND 'n5'
+            Gate* y_inv = get_source(nl->get_global_output_nets().at(0));
+            ASSERT_NE(y_inv, nullptr);
+            EXPECT_EQ(y_inv->get_type()->get_name(), "INV");
+            Gate* n5 = get_source(y_inv->get_fan_in_net("I"));
+            ASSERT_NE(n5, nullptr);
+            EXPECT_EQ(n5->get_name(), "n5");
+
+            // latch 'state' is clocked by the global clock and its next state is 'n5'
+            std::vector<Gate*> ffs = nl->get_gates([](const Gate* g) { return g->get_type()->get_name() == "DFF"; });
+            Gate* ff               = ffs.front();
+            EXPECT_EQ(ff->get_name(), "state");
+            EXPECT_EQ(ff->get_fan_in_net("CLK")->get_name(), "clk");
+            EXPECT_EQ(get_source(ff->get_fan_in_net("D")), n5);
+
+            // output 'q' is driven by a buffer since the latch net keeps its name
+            Gate* q_buf = get_source(nl->get_global_output_nets().at(1));
+            ASSERT_NE(q_buf, nullptr);
+            EXPECT_EQ(q_buf->get_type()->get_name(), "BUF");
+            EXPECT_EQ(get_source(q_buf->get_fan_in_net("I")), ff);
+
+            // inputs of 'n5' are 'n4' and the negated latch
+            std::vector<Gate*> n5_preds = {get_source(n5->get_fan_in_net("I0")), get_source(n5->get_fan_in_net("I1"))};
+            EXPECT_EQ(n5_preds.at(0)->get_name(), "n4");
+            EXPECT_EQ(n5_preds.at(1)->get_type()->get_name(), "INV");
+            EXPECT_EQ(get_source(n5_preds.at(1)->get_fan_in_net("I")), ff);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that the reset values of latches are stored as gate data and written back.
+     *
+     * Functions: parse, instantiate, write
+     */
+    TEST_F(AigerTest, check_latch_reset)
+    {
+        TEST_START
+        {
+            // three latches holding their state, reset to 0 (implicit), 1, and uninitialized
+            const std::string latches = "2\n4 1\n6 6\n";
+            std::filesystem::path path = test_utils::create_sandbox_file("reset.aig", "aig 3 0 3 0 0\n" + latches);
+
+            AigerParser parser;
+            auto nl_res = parser.parse_and_instantiate(path, test_utils::get_gate_library());
+            ASSERT_TRUE(nl_res.is_ok()) << nl_res.get_error().get();
+            std::unique_ptr<Netlist> nl = nl_res.get();
+
+            const std::vector<std::pair<std::string, std::string>> expected = {{"l0", "0"}, {"l1", "1"}, {"l2", "X"}};
+            for (const auto& [name, value] : expected)
+            {
+                std::vector<Gate*> ffs = nl->get_gates([&name](const Gate* g) { return g->get_name() == name; });
+                ASSERT_EQ(ffs.size(), 1);
+                EXPECT_EQ(ffs.front()->get_data("generic", "INIT"), std::make_tuple(std::string("bit_value"), value));
+            }
+
+            std::filesystem::path written_path = test_utils::create_sandbox_path("reset_written.aig");
+            AigerWriter writer;
+            auto res = writer.write(nl.get(), written_path);
+            ASSERT_TRUE(res.is_ok()) << res.get_error().get();
+            EXPECT_EQ(read_file(written_path).substr(0, 14 + latches.size()), "aig 3 0 3 0 0\n" + latches);
+
+            // reset values other than 0, 1, and the latch literal are rejected
+            path = test_utils::create_sandbox_file("invalid_reset.aig", "aig 2 0 2 0 0\n2\n4 2\n");
+            EXPECT_TRUE(parser.parse(path).is_error());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that invalid or unsupported AIGER files are rejected.
+     *
+     * Functions: parse, instantiate
+     */
+    TEST_F(AigerTest, check_invalid)
+    {
+        TEST_START
+        {
+            const std::vector<std::string> files = {
+                "aag 1 1 0 1 0\n2\n2\n",                                // ASCII format
+                "aig 3 1 0 1 1\n2\n",                                   // wrong maximum variable index
+                "aig 2 1 0 1 1\n4\n",                                   // missing ANDs
+                "aig 2 1 0 1 1\n4\n" + std::string(1, (char)0x82),      // truncated delta
+                "aig 2 1 0 1 1\n4\n" + std::string(2, (char)0),         // AND with delta 0
+                "aig 2 1 0 1 1\n6\n" + std::string("\x02\0", 2),        // output literal out of range
+                "aig 1 1 0 0 0 1\n",                                    // bad state property
+                "aig 1 1 0 0 0\ni5 a\n",                                // symbol out of range
+            };
+
+            for (const auto& content : files)
+            {
+                std::filesystem::path path = test_utils::create_sandbox_file("invalid.aig", content);
+                AigerParser parser;
+                EXPECT_TRUE(parser.parse(path).is_error()) << content;
+            }
+
+            // gate library without a flip-flop
+            std::filesystem::path path = test_utils::create_sandbox_file("latch.aig", "aig 1 0 1 0 0\n2\n");
+            GateLibrary gl("no_ff.hgl", "no_ff");
+            AigerParser parser;
+            ASSERT_TRUE(parser.parse(path).is_ok());
+            EXPECT_TRUE(parser.instantiate(&gl).is_error());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing writing netlists to binary AIGER files, including structural hashing and the translation of XOR and OR gates.
+     *
+     * Functions: write
+     */
+    TEST_F(AigerTest, check_write)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            const GateLibrary* gl       = nl->get_gate_library();
+
+            Gate* xor_gate = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor");
+            Gate* or_gate  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or");
+            Gate* ff       = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff");
+            Gate* vcc      = nl->create_gate(gl->get_gate_type_by_name("VCC"), "vcc");
+            Gate* and_gate = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and");
+            vcc->mark_vcc_gate();
+
+            Net* a   = test_utils::connect_global_in(nl.get(), xor_gate, "I0", "a");
+            Net* b   = test_utils::connect_global_in(nl.get(), xor_gate, "I1", "b");
+            Net* clk = test_utils::connect_global_in(nl.get(), ff, "CLK", "clk");
+            a->add_destination(or_gate, "I0");
+            test_utils::connect(nl.get(), ff, "Q", or_gate, "I1");
+            test_utils::connect(nl.get(), xor_gate, "O", ff, "D");
+            test_utils::connect(nl.get(), vcc, "O", and_gate, "I0");
+            b->add_destination(and_gate, "I1");
+            test_utils::connect_global_out(nl.get(), or_gate, "O", "y");
+            test_utils::connect_global_out(nl.get(), and_gate, "O", "z");
+            ASSERT_NE(clk, nullptr);
+
+            std::filesystem::path path = test_utils::create_sandbox_path("written.aig");
+            AigerWriter writer;
+            auto res = writer.write(nl.get(), path);
+            ASSERT_TRUE(res.is_ok()) << res.get_error().get();
+
+            // clock is implicit, XOR requires three ANDs, OR one AND, and the AND with VCC is folded into 'b'
+            const std::string content = read_file(path);
+            ASSERT_EQ(content.substr(0, content.find('\n')), "aig 7 2 1 2 4");
+
+            AigerParser parser;
+            auto nl_res = parser.parse_and_instantiate(path, test_utils::get_gate_library());
+            ASSERT_TRUE(nl_res.is_ok()) << nl_res.get_error().get();
+            std::unique_ptr<Netlist> parsed_nl = nl_res.get();
+
+            ASSERT_EQ(parsed_nl->get_global_output_nets().size(), 2);
+            EXPECT_EQ(parsed_nl->get_global_output_nets().at(0)->get_name(), "y");
+            EXPECT_EQ(parsed_nl->get_global_output_nets().at(1)->get_name(), "z");
+            EXPECT_EQ(get_source(parsed_nl->get_global_output_nets().at(1))->get_type()->get_name(), "BUF");
+            EXPECT_EQ(get_source(parsed_nl->get_global_output_nets().at(1))->get_fan_in_net("I")->get_name(), "b");
+            EXPECT_EQ(parsed_nl->get_gates([](const Gate* g) { return g->get_type()->get_name() == "DFF"; }).front()->get_name(), "ff");
+
+            // writing the parsed netlist results in the same file
+            std::filesystem::path path_2 = test_utils::create_sandbox_path("written_2.aig");
+            ASSERT_TRUE(writer.write(parsed_nl.get(), path_2).is_ok());
+            EXPECT_EQ(read_file(path_2), content);
+
+            // combinational loops are rejected
+            Gate* inv = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv");
+            Net* loop = test_utils::connect(nl.get(), inv, "O", inv, "I");
+            loop->mark_global_output_net();
+            EXPECT_TRUE(writer.write(nl.get(), path).is_error());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the parsing of a large AIG.
+     *
+     * Functions: parse, instantiate
+     */
+    TEST_F(AigerTest, check_large)
+    {
+        TEST_START
+        {
+            const u32 num_inputs = 64;
+            const u32 num_ands   = 200000;
+
+            std::string aig = "aig " + std::to_string(num_inputs + num_ands) + " " + std::to_string(num_inputs) + " 0 1 " + std::to_string(num_ands) + "\n"
+                              + std::to_string(2 * (num_inputs + num_ands)) + "\n";
+            for (u32 i = 0; i < num_ands; i++)
+            {
+                const u32 lhs  = 2 * (num_inputs + i + 1);
+                const u32 rhs0 = lhs - 2 - (i % 2);
+                const u32 rhs1 = 2 + 2 * ((i * 7) % num_inputs);
+                for (u32 delta : {lhs - rhs0, rhs0 - rhs1})
+                {
+                    while (delta & ~0x7fu)
+                    {
+                        aig.push_back((char)((delta & 0x7f) | 0x80));
+                        delta >>= 7;
+                    }
+                    aig.push_back((char)delta);
+                }
+            }
+            std::filesystem::path path = test_utils::create_sandbox_file("large.aig", aig);
+
+            AigerParser parser;
+            auto nl_res = parser.parse_and_instantiate(path, test_utils::get_gate_library());
+            ASSERT_TRUE(nl_res.is_ok()) << nl_res.get_error().get();
+
+            std::unique_ptr<Netlist> nl = nl_res.get();
+            EXPECT_EQ(nl->get_gates([](const Gate* g) { return g->get_type()->get_name() == "AND2"; }).size(), num_ands);
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -0,0 +1,94 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/netlist_parser/netlist_parser.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Parser for flat netlists in the Berkeley Logic Interchange Format (BLIF).
+     *
+     * The file is memory-mapped and split into commands that reference the mapped data directly, no intermediate syntax tree is built.
+     * During instantiation, logic functions given as '.names' covers are mapped to a gate of the gate library implementing exactly that function or to a LUT,
+     * '.latch' statements are mapped to flip-flops, and '.subckt' and '.gate' statements instantiate the gate type of the same name.
+     *
+     * @ingroup netlist_parser
+     */
+    class NETLIST_API BlifParser : public NetlistParser
+    {
+    public:
+        BlifParser()  = default;
+        ~BlifParser() = default;
+
+        /**
+         * Parse a BLIF file.
+         *
+         * @param[in] file_path - Path to the BLIF file.
+         * @returns Ok on success, an error otherwise.
+         */
+        Result<std::monostate> parse(const std::filesystem::path& file_path) override;
+
+        /**
+         * Instantiate the parsed netlist using the specified gate library.
+         *
+         * @param[in] gate_library - The gate library.
+         * @returns A pointer to the resulting netlist on success, an error otherwise.
+         */
+        Result<std::unique_ptr<Netlist>> instantiate(const GateLibrary* gate_library) override;
+
+        /**
+         * Get the names of all gate types instantiated via '.subckt' or '.gate' statements.
+         * If the netlist contains '.names' or '.latch' statements, which may be mapped to arbitrary gate types, no gate types are returned.
+         *
+         * @returns The names of the required gate types, or an empty optional if they cannot be determined.
+         */
+        std::optional<std::unordered_set<std::string>> get_required_gate_types() const override;
+
+    private:
+        struct Command
+        {
+            // tokens of the command line including the command itself
+            std::vector<std::string_view> tokens;
+
+            // rows of the cover of a '.names' command, split into input pattern and output value
+            std::vector<std::pair<std::string_view, std::string_view>> cover;
+
+            u32 line_number;
+        };
+
+        std::filesystem::path m_path;
+        std::unique_ptr<MemoryMappedFile> m_file;
+        std::string m_design_name;
+        std::vector<Command> m_commands;
+    };
+}    // namespace hal
@@ -0,0 +1,56 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/netlist_writer/netlist_writer.h"
+
+namespace hal
+{
+    /**
+     * Writer for netlists in the Berkeley Logic Interchange Format (BLIF).
+     *
+     * LUTs and constant gates are written as '.names' covers, flip-flops with only a clock and a data input as '.latch' statements,
+     * and all other gates as '.subckt' statements using the gate type and pin names of the gate library, as done by Yosys.
+     *
+     * @ingroup netlist_writer
+     */
+    class NETLIST_API BlifWriter : public NetlistWriter
+    {
+    public:
+        BlifWriter()  = default;
+        ~BlifWriter() = default;
+
+        /**
+         * Write the netlist to a BLIF file at the provided location.
+         *
+         * @param[in] netlist - The netlist.
+         * @param[in] file_path - The output path.
+         * @returns Ok on success, an error otherwise.
+         */
+        Result<std::monostate> write(Netlist* netlist, const std::filesystem::path& file_path) override;
+    };
+}    // namespace hal
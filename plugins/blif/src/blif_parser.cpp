@@ -0,0 +1,706 @@
+#include "blif/blif_parser.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_type_component/lut_component.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/utilities/log.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+namespace hal
+{
+    namespace
+    {
+        bool is_whitespace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        void split_line(const std::string_view& line, std::vector<std::string_view>& tokens)
+        {
+            size_t pos = 0;
+            while (pos < line.size())
+            {
+                while (pos < line.size() && is_whitespace(line[pos]))
+                {
+                    pos++;
+                }
+                size_t end = pos;
+                while (end < line.size() && !is_whitespace(line[end]))
+                {
+                    end++;
+                }
+                if (end != pos)
+                {
+                    tokens.push_back(line.substr(pos, end - pos));
+                }
+                pos = end;
+            }
+        }
+
+        // selects the matching gate type with the fewest input pins, ties are broken by name to be deterministic
+        GateType* find_primitive(const GateLibrary* gate_library, const std::function<bool(const GateType*)>& filter)
+        {
+            GateType* res = nullptr;
+            for (const auto& [name, type] : gate_library->get_gate_types(filter))
+            {
+                if (res == nullptr || type->get_input_pins().size() < res->get_input_pins().size()
+                    || (type->get_input_pins().size() == res->get_input_pins().size() && name < res->get_name()))
+                {
+                    res = type;
+                }
+            }
+            return res;
+        }
+
+        GatePin* find_pin(const GateType* type, PinDirection direction, PinType pin_type)
+        {
+            auto pins = type->get_pins([direction, pin_type](const GatePin* pin) { return pin->get_direction() == direction && pin->get_type() == pin_type; });
+            return pins.empty() ? nullptr : pins.front();
+        }
+
+        std::string to_hex(u64 value, u32 num_bits)
+        {
+            static const char* digits = "0123456789ABCDEF";
+            std::string res;
+            for (i32 i = (i32)((num_bits + 3) / 4) - 1; i >= 0; i--)
+            {
+                res += digits[(value >> (4 * i)) & 0xf];
+            }
+            return res;
+        }
+
+        // converts a binary string as written by Yosys to a hexadecimal one
+        std::string binary_to_hex(const std::string_view& binary)
+        {
+            static const char* digits = "0123456789ABCDEF";
+            std::string res;
+            const size_t offset = (4 - binary.size() % 4) % 4;
+            u32 digit           = 0;
+            for (size_t i = 0; i < binary.size(); i++)
+            {
+                digit = (digit << 1) | (binary[i] == '1' ? 1 : 0);
+                if ((i + offset) % 4 == 3)
+                {
+                    res += digits[digit];
+                    digit = 0;
+                }
+            }
+            return res;
+        }
+
+        /**
+         * Compute the truth table of a '.names' cover, where bit i of the result is the output for the input assignment i with the first input being the least significant bit.
+         */
+        Result<u64> compute_cover_table(const std::vector<std::pair<std::string_view, std::string_view>>& cover, u32 num_inputs)
+        {
+            const u64 mask = (num_inputs == 6) ? ~0ull : ((1ull << (1u << num_inputs)) - 1);
+            u64 table      = 0;
+            char polarity  = '\0';
+            for (const auto& [pattern, value] : cover)
+            {
+                if (value.size() != 1 || (value.front() != '0' && value.front() != '1') || (polarity != '\0' && value.front() != polarity))
+                {
+                    return ERR("invalid output value '" + std::string(value) + "' of cover, all rows must either specify the ON-set or the OFF-set");
+                }
+                if (pattern.size() != num_inputs)
+                {
+                    return ERR("cover row '" + std::string(pattern) + "' does not match the number of inputs");
+                }
+                polarity = value.front();
+
+                for (u32 assignment = 0; assignment < (1u << num_inputs); assignment++)
+                {
+                    bool matches = true;
+                    for (u32 i = 0; i < num_inputs && matches; i++)
+                    {
+                        const char c = pattern[i];
+                        if (c != '-' && c != '0' && c != '1')
+                        {
+                            return ERR("invalid character '" + std::string(1, c) + "' in cover row '" + std::string(pattern) + "'");
+                        }
+                        matches = (c == '-') || ((u32)(c - '0') == ((assignment >> i) & 1));
+                    }
+                    if (matches)
+                    {
+                        table |= 1ull << assignment;
+                    }
+                }
+            }
+
+            return OK((polarity == '0') ? (~table & mask) : table);
+        }
+    }    // namespace
+
+    Result<std::monostate> BlifParser::parse(const std::filesystem::path& file_path)
+    {
+        m_path = file_path;
+        m_design_name.clear();
+        m_commands.clear();
+
+        if (auto res = MemoryMappedFile::open(file_path); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not parse BLIF file '" + m_path.string() + "': unable to open file");
+        }
+        else
+        {
+            m_file = res.get();
+        }
+
+        const std::string error_prefix = "could not parse BLIF file '" + m_path.string() + "': ";
+        const std::string_view data    = m_file->get_data();
+        size_t pos                     = 0;
+        u32 line_number                = 0;
+        u32 command_line_number        = 0;
+        bool has_model                 = false;
+        bool has_ended                 = false;
+        std::vector<std::string_view> tokens;
+
+        while (pos < data.size())
+        {
+            size_t end = data.find('\n', pos);
+            if (end == std::string_view::npos)
+            {
+                end = data.size();
+            }
+            std::string_view line = data.substr(pos, end - pos);
+            pos                   = end + 1;
+            line_number++;
+
+            if (const size_t comment = line.find('#'); comment != std::string_view::npos)
+            {
+                line = line.substr(0, comment);
+            }
+            while (!line.empty() && is_whitespace(line.back()))
+            {
+                line.remove_suffix(1);
+            }
+
+            if (tokens.empty())
+            {
+                command_line_number = line_number;
+            }
+
+            // a backslash at the end of a line continues the logical line on the next one
+            const bool continued = !line.empty() && line.back() == '\\';
+            if (continued)
+            {
+                line.remove_suffix(1);
+            }
+            split_line(line, tokens);
+            if (continued || tokens.empty())
+            {
+                continue;
+            }
+
+            if (has_ended)
+            {
+                if (tokens.front() == ".model")
+                {
+                    return ERR(error_prefix + "hierarchical netlists with more than one model are not supported (line " + std::to_string(command_line_number) + ")");
+                }
+                tokens.clear();
+                continue;
+            }
+
+            if (tokens.front().front() != '.')
+            {
+                // row of the cover of the preceding '.names' command
+                if (m_commands.empty() || m_commands.back().tokens.front() != ".names" || tokens.size() > 2)
+                {
+                    return ERR(error_prefix + "unexpected '" + std::string(tokens.front()) + "' (line " + std::to_string(command_line_number) + ")");
+                }
+                m_commands.back().cover.push_back((tokens.size() == 2) ? std::make_pair(tokens.at(0), tokens.at(1)) : std::make_pair(std::string_view(), tokens.at(0)));
+            }
+            else if (tokens.front() == ".model")
+            {
+                if (has_model)
+                {
+                    return ERR(error_prefix + "hierarchical netlists with more than one model are not supported (line " + std::to_string(command_line_number) + ")");
+                }
+                has_model = true;
+                if (tokens.size() > 1)
+                {
+                    m_design_name = std::string(tokens.at(1));
+                }
+            }
+            else if (tokens.front() == ".end")
+            {
+                has_ended = true;
+            }
+            else
+            {
+                if ((tokens.front() == ".names" && tokens.size() < 2) || (tokens.front() == ".latch" && (tokens.size() < 3 || tokens.size() > 6))
+                    || ((tokens.front() == ".subckt" || tokens.front() == ".gate") && tokens.size() < 2) || ((tokens.front() == ".param" || tokens.front() == ".attr") && tokens.size() != 3)
+                    || (tokens.front() == ".cname" && tokens.size() != 2))
+                {
+                    return ERR(error_prefix + "invalid number of arguments for '" + std::string(tokens.front()) + "' (line " + std::to_string(command_line_number) + ")");
+                }
+                m_commands.push_back({tokens, {}, command_line_number});
+            }
+
+            tokens.clear();
+        }
+
+        return OK({});
+    }
+
+    std::optional<std::unordered_set<std::string>> BlifParser::get_required_gate_types() const
+    {
+        std::unordered_set<std::string> gate_types;
+        for (const auto& command : m_commands)
+        {
+            if (command.tokens.front() == ".names" || command.tokens.front() == ".latch")
+            {
+                return std::nullopt;
+            }
+            if (command.tokens.front() == ".subckt" || command.tokens.front() == ".gate")
+            {
+                gate_types.insert(std::string(command.tokens.at(1)));
+            }
+        }
+        return gate_types;
+    }
+
+    Result<std::unique_ptr<Netlist>> BlifParser::instantiate(const GateLibrary* gate_library)
+    {
+        const std::string error_prefix = "could not instantiate BLIF netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "': ";
+
+        std::unique_ptr<Netlist> result = netlist_factory::create_netlist(gate_library);
+        Netlist* netlist                = result.get();
+        if (netlist == nullptr)
+        {
+            return ERR(error_prefix + "failed to create empty netlist");
+        }
+        netlist->set_design_name(m_design_name.empty() ? m_path.stem().string() : m_design_name);
+        netlist->enable_automatic_net_checks(false);
+
+        // primitives, selected on first use
+        GateType* gnd_type = find_primitive(gate_library, [](const GateType* type) { return type->has_property(GateTypeProperty::ground) && type->get_output_pins().size() == 1; });
+        GateType* vcc_type = find_primitive(gate_library, [](const GateType* type) { return type->has_property(GateTypeProperty::power) && type->get_output_pins().size() == 1; });
+        GateType* inv_type = find_primitive(gate_library, [](const GateType* type) {
+            return type->has_property(GateTypeProperty::c_inverter) && type->get_input_pins().size() == 1 && type->get_output_pins().size() == 1;
+        });
+        GateType* ff_type = nullptr;
+        std::map<u32, GateType*> lut_types;
+        std::map<std::pair<u32, u64>, GateType*> function_types;
+        bool primitives_initialized = false;
+
+        const auto initialize_primitives = [&]() {
+            ff_type = find_primitive(gate_library, [](const GateType* type) {
+                return type->has_property(GateTypeProperty::ff) && find_pin(type, PinDirection::input, PinType::clock) != nullptr && find_pin(type, PinDirection::input, PinType::data) != nullptr
+                       && find_pin(type, PinDirection::output, PinType::state) != nullptr;
+            });
+
+            for (const auto& [name, type] : gate_library->get_gate_types([](const GateType* type) { return type->has_property(GateTypeProperty::combinational) && type->get_output_pins().size() == 1; }))
+            {
+                const u32 num_inputs = type->get_input_pins().size();
+                if (type->has_property(GateTypeProperty::c_lut) && type->has_component_of_type(GateTypeComponent::ComponentType::lut))
+                {
+                    if (num_inputs <= 6 && (lut_types.find(num_inputs) == lut_types.end() || name < lut_types.at(num_inputs)->get_name()))
+                    {
+                        lut_types[num_inputs] = type;
+                    }
+                    continue;
+                }
+                if (num_inputs == 0 || num_inputs > 6)
+                {
+                    continue;
+                }
+
+                // gate types implementing a single-output function of their inputs
+                auto table = type->get_boolean_function(type->get_output_pins().front()).compute_truth_table(type->get_input_pin_names());
+                if (table.is_error() || table.get().size() != 1)
+                {
+                    continue;
+                }
+                u64 value  = 0;
+                bool valid = true;
+                for (u32 i = 0; i < table.get().front().size(); i++)
+                {
+                    const BooleanFunction::Value v = table.get().front().at(i);
+                    valid &= (v == BooleanFunction::Value::ZERO || v == BooleanFunction::Value::ONE);
+                    value |= (v == BooleanFunction::Value::ONE) ? (1ull << i) : 0;
+                }
+                if (valid && table.get().front().size() == (1u << num_inputs))
+                {
+                    const auto key = std::make_pair(num_inputs, value);
+                    if (function_types.find(key) == function_types.end() || name < function_types.at(key)->get_name())
+                    {
+                        function_types[key] = type;
+                    }
+                }
+            }
+            primitives_initialized = true;
+        };
+
+        std::unordered_map<std::string_view, Net*> nets;
+        const auto get_net = [&nets, netlist](const std::string_view& name) -> Net* {
+            if (auto it = nets.find(name); it != nets.end())
+            {
+                return it->second;
+            }
+            Net* net = netlist->create_net(std::string(name));
+            nets.emplace(name, net);
+            return net;
+        };
+
+        const auto create_constant_gate = [&](bool value, const std::string& name, Net* out) -> Result<std::monostate> {
+            GateType* type = value ? vcc_type : gnd_type;
+            if (type == nullptr)
+            {
+                return ERR("gate library does not provide GND and VCC gates");
+            }
+            Gate* gate = netlist->create_gate(type, name);
+            if (gate == nullptr || !(value ? netlist->mark_vcc_gate(gate) : netlist->mark_gnd_gate(gate)) || out->add_source(gate, type->get_output_pins().front()) == nullptr)
+            {
+                return ERR("failed to create constant gate '" + name + "'");
+            }
+            return OK({});
+        };
+
+        std::array<Net*, 2> constant_nets = {nullptr, nullptr};
+        const auto get_constant_net       = [&](bool value) -> Result<Net*> {
+            if (constant_nets.at(value) == nullptr)
+            {
+                const std::string name = value ? "global_vcc" : "global_gnd";
+                Net* net               = netlist->create_net(name);
+                if (auto res = create_constant_gate(value, name, net); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+                constant_nets.at(value) = net;
+            }
+            return OK(constant_nets.at(value));
+        };
+
+        Net* clock_net = nullptr;
+        std::unordered_map<Net*, Net*> inverted_clock_nets;
+        std::vector<std::string_view> output_names;
+        std::set<std::string_view> unsupported_commands;
+        Gate* last_subckt = nullptr;
+
+        for (u32 command_index = 0; command_index < m_commands.size(); command_index++)
+        {
+            const Command& command          = m_commands.at(command_index);
+            const std::string_view& keyword = command.tokens.front();
+            const auto line_info            = [&command]() { return " (line " + std::to_string(command.line_number) + ")"; };
+
+            if (keyword == ".inputs" || keyword == ".clock")
+            {
+                for (u32 i = 1; i < command.tokens.size(); i++)
+                {
+                    Net* net = get_net(command.tokens.at(i));
+                    if (net == nullptr || (!net->is_global_input_net() && !net->mark_global_input_net()))
+                    {
+                        return ERR(error_prefix + "failed to create input net '" + std::string(command.tokens.at(i)) + "'" + line_info());
+                    }
+                }
+            }
+            else if (keyword == ".outputs")
+            {
+                output_names.insert(output_names.end(), command.tokens.begin() + 1, command.tokens.end());
+            }
+            else if (keyword == ".names")
+            {
+                if (!primitives_initialized)
+                {
+                    initialize_primitives();
+                }
+
+                const u32 num_inputs = command.tokens.size() - 2;
+                Net* out             = get_net(command.tokens.back());
+                const std::string name(command.tokens.back());
+                if (out == nullptr)
+                {
+                    return ERR(error_prefix + "failed to create net '" + name + "'" + line_info());
+                }
+                if (num_inputs > 6)
+                {
+                    return ERR(error_prefix + "logic functions with more than six inputs are not supported" + line_info());
+                }
+
+                u64 table = 0;
+                if (auto res = compute_cover_table(command.cover, num_inputs); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), error_prefix + "invalid cover for '" + name + "'" + line_info());
+                }
+                else
+                {
+                    table = res.get();
+                }
+
+                if (num_inputs == 0)
+                {
+                    if (auto res = create_constant_gate(table != 0, name, out); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), error_prefix + "unable to create constant '" + name + "'" + line_info());
+                    }
+                    continue;
+                }
+
+                // prefer a gate type implementing exactly the given function over a LUT
+                GateType* type = nullptr;
+                std::string init;
+                if (const auto it = function_types.find({num_inputs, table}); it != function_types.end())
+                {
+                    type = it->second;
+                }
+                else if (const auto lut_it = lut_types.lower_bound(num_inputs); lut_it != lut_types.end())
+                {
+                    type = lut_it->second;
+
+                    // replicate the table for unused LUT inputs, which are tied to GND
+                    const u32 lut_size = lut_it->first;
+                    for (u32 i = num_inputs; i < lut_size; i++)
+                    {
+                        table |= table << (1u << i);
+                    }
+                    if (type->get_component_as<LUTComponent>([](const GateTypeComponent* c) { return c->get_type() == GateTypeComponent::ComponentType::lut; })->is_init_ascending())
+                    {
+                        u64 reversed = 0;
+                        for (u32 i = 0; i < (1u << lut_size); i++)
+                        {
+                            reversed |= ((table >> i) & 1) << ((1u << lut_size) - 1 - i);
+                        }
+                        table = reversed;
+                    }
+                    init = to_hex(table, 1u << lut_size);
+                }
+                else
+                {
+                    return ERR(error_prefix + "gate library provides neither a LUT nor a gate type implementing the function of '" + name + "'" + line_info());
+                }
+
+                Gate* gate = netlist->create_gate(type, name);
+                if (gate == nullptr || out->add_source(gate, type->get_output_pins().front()) == nullptr)
+                {
+                    return ERR(error_prefix + "failed to create gate '" + name + "'" + line_info());
+                }
+                const std::vector<GatePin*> input_pins = type->get_input_pins();
+                for (u32 i = 0; i < input_pins.size(); i++)
+                {
+                    Net* in = nullptr;
+                    if (i < num_inputs)
+                    {
+                        in = get_net(command.tokens.at(i + 1));
+                    }
+                    else if (auto res = get_constant_net(false); res.is_ok())
+                    {
+                        in = res.get();
+                    }
+                    if (in == nullptr || in->add_destination(gate, input_pins.at(i)) == nullptr)
+                    {
+                        return ERR(error_prefix + "failed to connect pin '" + input_pins.at(i)->get_name() + "' of gate '" + name + "'" + line_info());
+                    }
+                }
+                if (!init.empty())
+                {
+                    if (auto res = gate->set_init_data({init}); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), error_prefix + "unable to set LUT configuration of gate '" + name + "'" + line_info());
+                    }
+                }
+            }
+            else if (keyword == ".latch")
+            {
+                if (!primitives_initialized)
+                {
+                    initialize_primitives();
+                }
+                if (ff_type == nullptr)
+                {
+                    return ERR(error_prefix + "gate library does not provide a flip-flop with clock, data, and state pins" + line_info());
+                }
+
+                // '.latch input output [type control] [init]'
+                const std::string_view latch_type = (command.tokens.size() >= 5) ? command.tokens.at(3) : "re";
+                const std::string_view control    = (command.tokens.size() >= 5) ? command.tokens.at(4) : "NIL";
+                const std::string_view init       = (command.tokens.size() == 4 || command.tokens.size() == 6) ? command.tokens.back() : "0";
+                if (latch_type != "re" && latch_type != "fe" && latch_type != "as")
+                {
+                    return ERR(error_prefix + "latch type '" + std::string(latch_type) + "' is not supported" + line_info());
+                }
+                if (init == "1")
+                {
+                    log_warning("blif", "initial value of latch '{}' in BLIF file '{}' is not preserved.", command.tokens.at(2), m_path.string());
+                }
+
+                Net* clock = nullptr;
+                if (control == "NIL" || latch_type == "as")
+                {
+                    if (clock_net == nullptr)
+                    {
+                        clock_net = get_net("clk");
+                        if (clock_net == nullptr || (!clock_net->is_global_input_net() && !clock_net->mark_global_input_net()))
+                        {
+                            return ERR(error_prefix + "failed to create clock net" + line_info());
+                        }
+                    }
+                    clock = clock_net;
+                }
+                else
+                {
+                    clock = get_net(control);
+                }
+
+                if (latch_type == "fe")
+                {
+                    Net*& inverted = inverted_clock_nets[clock];
+                    if (inverted == nullptr)
+                    {
+                        const std::string name = clock->get_name() + "_inv";
+                        Gate* inv              = (inv_type != nullptr) ? netlist->create_gate(inv_type, name) : nullptr;
+                        inverted               = netlist->create_net(name);
+                        if (inv == nullptr || inverted == nullptr || inverted->add_source(inv, inv_type->get_output_pins().front()) == nullptr
+                            || clock->add_destination(inv, inv_type->get_input_pins().front()) == nullptr)
+                        {
+                            return ERR(error_prefix + "failed to create inverter for falling-edge clock '" + clock->get_name() + "'" + line_info());
+                        }
+                    }
+                    clock = inverted;
+                }
+
+                const std::string name(command.tokens.at(2));
+                Gate* gate = netlist->create_gate(ff_type, name);
+                Net* out   = get_net(command.tokens.at(2));
+                if (gate == nullptr || out == nullptr || out->add_source(gate, find_pin(ff_type, PinDirection::output, PinType::state)) == nullptr)
+                {
+                    return ERR(error_prefix + "failed to create latch '" + name + "'" + line_info());
+                }
+                for (GatePin* pin : ff_type->get_input_pins())
+                {
+                    Net* net = nullptr;
+                    if (pin->get_type() == PinType::clock)
+                    {
+                        net = clock;
+                    }
+                    else if (pin->get_type() == PinType::data)
+                    {
+                        net = get_net(command.tokens.at(1));
+                    }
+                    else if (auto res = get_constant_net(pin->get_type() == PinType::enable); res.is_ok())
+                    {
+                        net = res.get();
+                    }
+                    if (net == nullptr || net->add_destination(gate, pin) == nullptr)
+                    {
+                        return ERR(error_prefix + "failed to connect pin '" + pin->get_name() + "' of latch '" + name + "'" + line_info());
+                    }
+                }
+            }
+            else if (keyword == ".subckt" || keyword == ".gate")
+            {
+                // '.subckt type formal=actual ...'
+                GateType* type = gate_library->get_gate_type_by_name(std::string(command.tokens.at(1)));
+                if (type == nullptr)
+                {
+                    return ERR(error_prefix + "gate type '" + std::string(command.tokens.at(1)) + "' does not exist in gate library" + line_info());
+                }
+
+                std::vector<std::pair<GatePin*, std::string_view>> assignments;
+                for (u32 i = 2; i < command.tokens.size(); i++)
+                {
+                    const std::string_view& assignment = command.tokens.at(i);
+                    const size_t separator             = assignment.find('=');
+                    GatePin* pin                       = (separator != std::string_view::npos) ? type->get_pin_by_name(std::string(assignment.substr(0, separator))) : nullptr;
+                    if (pin == nullptr)
+                    {
+                        return ERR(error_prefix + "invalid pin assignment '" + std::string(assignment) + "' for gate type '" + type->get_name() + "'" + line_info());
+                    }
+                    assignments.push_back({pin, assignment.substr(separator + 1)});
+                }
+
+                // gates are named by a subsequent '.cname' statement or after the net connected to their first output
+                std::string name = type->get_name();
+                if (command_index + 1 < m_commands.size() && m_commands.at(command_index + 1).tokens.front() == ".cname")
+                {
+                    name = std::string(m_commands.at(command_index + 1).tokens.at(1));
+                }
+                else if (const auto it = std::find_if(assignments.begin(), assignments.end(), [](const auto& a) { return a.first->get_direction() == PinDirection::output; });
+                         it != assignments.end())
+                {
+                    name = std::string(it->second);
+                }
+
+                Gate* gate = netlist->create_gate(type, name);
+                if (gate == nullptr)
+                {
+                    return ERR(error_prefix + "failed to create gate of type '" + type->get_name() + "'" + line_info());
+                }
+                for (const auto& [pin, net_name] : assignments)
+                {
+                    Net* net = get_net(net_name);
+                    if (net == nullptr || ((pin->get_direction() == PinDirection::output) ? net->add_source(gate, pin) : net->add_destination(gate, pin)) == nullptr)
+                    {
+                        return ERR(error_prefix + "failed to connect pin '" + pin->get_name() + "' of gate '" + name + "'" + line_info());
+                    }
+                }
+                last_subckt = gate;
+                continue;
+            }
+            else if (keyword == ".param" || keyword == ".attr" || keyword == ".cname")
+            {
+                if (last_subckt == nullptr)
+                {
+                    return ERR(error_prefix + "'" + std::string(keyword) + "' does not follow a '.subckt' or '.gate' statement" + line_info());
+                }
+                if (keyword == ".cname")
+                {
+                    if (last_subckt->get_name() != command.tokens.at(1))
+                    {
+                        last_subckt->set_name(std::string(command.tokens.at(1)));
+                    }
+                }
+                else
+                {
+                    // Yosys writes bit vectors as binary strings and all other values as quoted strings
+                    std::string_view value = command.tokens.at(2);
+                    std::string type       = "string";
+                    std::string data;
+                    if (value.size() >= 2 && value.front() == '"' && value.back() == '"')
+                    {
+                        data = std::string(value.substr(1, value.size() - 2));
+                    }
+                    else if (value.find_first_not_of("01") == std::string_view::npos)
+                    {
+                        type = "bit_vector";
+                        data = binary_to_hex(value);
+                    }
+                    else
+                    {
+                        data = std::string(value);
+                    }
+                    last_subckt->set_data((keyword == ".param") ? "generic" : "attribute", std::string(command.tokens.at(1)), type, data);
+                }
+                continue;
+            }
+            else if (unsupported_commands.insert(keyword).second)
+            {
+                log_warning("blif", "ignoring unsupported command '{}' in BLIF file '{}'.", keyword, m_path.string());
+            }
+
+            last_subckt = nullptr;
+        }
+
+        for (const std::string_view& name : output_names)
+        {
+            Net* net = get_net(name);
+            if (net == nullptr || (!net->is_global_output_net() && !net->mark_global_output_net()))
+            {
+                return ERR(error_prefix + "failed to create output net '" + std::string(name) + "'");
+            }
+        }
+
+        netlist->enable_automatic_net_checks(true);
+
+        return OK(std::move(result));
+    }
+}    // namespace hal
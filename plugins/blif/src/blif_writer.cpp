@@ -0,0 +1,226 @@
+#include "blif/blif_writer.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace hal
+{
+    namespace
+    {
+        std::string escape(const std::string& name)
+        {
+            std::string res = name;
+            for (char& c : res)
+            {
+                if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '#' || c == '=' || c == '\\')
+                {
+                    c = '_';
+                }
+            }
+            return res;
+        }
+
+        std::string hex_to_binary(const std::string& hex)
+        {
+            std::string res;
+            for (char c : hex)
+            {
+                const u32 digit = (c >= '0' && c <= '9') ? (c - '0') : ((c >= 'a' && c <= 'f') ? (c - 'a' + 10) : ((c >= 'A' && c <= 'F') ? (c - 'A' + 10) : 0));
+                for (i32 i = 3; i >= 0; i--)
+                {
+                    res += ((digit >> i) & 1) ? '1' : '0';
+                }
+            }
+            return res;
+        }
+
+        GatePin* find_pin(const GateType* type, PinDirection direction, PinType pin_type)
+        {
+            auto pins = type->get_pins([direction, pin_type](const GatePin* pin) { return pin->get_direction() == direction && pin->get_type() == pin_type; });
+            return pins.empty() ? nullptr : pins.front();
+        }
+
+        // flip-flops that can be represented by a '.latch' statement, i.e., that only have a clock and a data input
+        bool is_simple_latch(const Gate* gate)
+        {
+            const GateType* type = gate->get_type();
+            if (!type->has_property(GateTypeProperty::ff))
+            {
+                return false;
+            }
+
+            const std::vector<GatePin*> inputs = type->get_input_pins();
+            GatePin* state                     = find_pin(type, PinDirection::output, PinType::state);
+            return inputs.size() == 2 && find_pin(type, PinDirection::input, PinType::clock) != nullptr && find_pin(type, PinDirection::input, PinType::data) != nullptr && state != nullptr
+                   && gate->get_fan_out_net(state) != nullptr && gate->get_fan_in_net(inputs.at(0)) != nullptr && gate->get_fan_in_net(inputs.at(1)) != nullptr;
+        }
+    }    // namespace
+
+    Result<std::monostate> BlifWriter::write(Netlist* netlist, const std::filesystem::path& file_path)
+    {
+        const std::string error_prefix = "could not write netlist with ID " + std::to_string(netlist->get_id()) + " to BLIF file '" + file_path.string() + "': ";
+
+        std::ofstream ofs(file_path, std::ofstream::out);
+        if (!ofs.is_open())
+        {
+            return ERR(error_prefix + "unable to open file");
+        }
+
+        // assign unique names without whitespace to all nets, global inputs and outputs keep their names if possible
+        std::vector<Net*> nets = netlist->get_nets();
+        std::sort(nets.begin(), nets.end(), [](const Net* a, const Net* b) {
+            const bool a_global = a->is_global_input_net() || a->is_global_output_net();
+            const bool b_global = b->is_global_input_net() || b->is_global_output_net();
+            return (a_global != b_global) ? a_global : a->get_id() < b->get_id();
+        });
+
+        std::unordered_map<const Net*, std::string> aliases;
+        std::unordered_set<std::string> used_aliases = {"$false"};
+        for (const Net* net : nets)
+        {
+            std::string alias = escape(net->get_name());
+            if (alias.empty() || used_aliases.find(alias) != used_aliases.end())
+            {
+                alias += "_" + std::to_string(net->get_id());
+            }
+            used_aliases.insert(alias);
+            aliases.emplace(net, std::move(alias));
+        }
+
+        bool uses_false      = false;
+        const auto get_alias = [&aliases, &uses_false](const Net* net) -> const std::string& {
+            static const std::string false_alias = "$false";
+            if (net == nullptr)
+            {
+                uses_false = true;
+                return false_alias;
+            }
+            return aliases.at(net);
+        };
+
+        ofs << ".model " << escape(netlist->get_design_name().empty() ? "top" : netlist->get_design_name()) << "\n";
+
+        ofs << ".inputs";
+        for (const Net* net : netlist->get_global_input_nets())
+        {
+            ofs << " " << get_alias(net);
+        }
+        ofs << "\n";
+
+        ofs << ".outputs";
+        for (const Net* net : netlist->get_global_output_nets())
+        {
+            ofs << " " << get_alias(net);
+        }
+        ofs << "\n";
+
+        std::vector<Gate*> gates = netlist->get_gates();
+        std::sort(gates.begin(), gates.end(), [](const Gate* a, const Gate* b) { return a->get_id() < b->get_id(); });
+
+        for (const Gate* gate : gates)
+        {
+            const GateType* type = gate->get_type();
+
+            if (type->has_property(GateTypeProperty::ground) || type->has_property(GateTypeProperty::power))
+            {
+                for (const Net* net : gate->get_fan_out_nets())
+                {
+                    ofs << ".names " << get_alias(net) << "\n" << (type->has_property(GateTypeProperty::power) ? "1\n" : "");
+                }
+            }
+            else if (is_simple_latch(gate))
+            {
+                const Net* state = gate->get_fan_out_net(find_pin(type, PinDirection::output, PinType::state));
+                ofs << ".latch " << get_alias(gate->get_fan_in_net(find_pin(type, PinDirection::input, PinType::data))) << " " << get_alias(state) << " re "
+                    << get_alias(gate->get_fan_in_net(find_pin(type, PinDirection::input, PinType::clock))) << " 0\n";
+
+                if (GatePin* neg_state = find_pin(type, PinDirection::output, PinType::neg_state); neg_state != nullptr && gate->get_fan_out_net(neg_state) != nullptr)
+                {
+                    ofs << ".names " << get_alias(state) << " " << get_alias(gate->get_fan_out_net(neg_state)) << "\n0 1\n";
+                }
+            }
+            else if (type->has_property(GateTypeProperty::c_lut) && type->get_output_pins().size() == 1 && type->get_input_pins().size() <= 6)
+            {
+                const GatePin* out_pin             = type->get_output_pins().front();
+                const std::vector<GatePin*> inputs = type->get_input_pins();
+                if (gate->get_fan_out_net(out_pin) == nullptr)
+                {
+                    continue;
+                }
+
+                auto table = gate->get_boolean_function(out_pin).compute_truth_table(type->get_input_pin_names());
+                if (table.is_error() || table.get().size() != 1)
+                {
+                    return ERR(error_prefix + "unable to compute truth table of LUT '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()));
+                }
+
+                ofs << ".names";
+                for (const GatePin* pin : inputs)
+                {
+                    ofs << " " << get_alias(gate->get_fan_in_net(pin));
+                }
+                ofs << " " << get_alias(gate->get_fan_out_net(out_pin)) << "\n";
+
+                // ON-set with the first input being the least significant bit of the assignment
+                const std::vector<BooleanFunction::Value>& values = table.get().front();
+                for (u32 assignment = 0; assignment < values.size(); assignment++)
+                {
+                    if (values.at(assignment) != BooleanFunction::Value::ONE)
+                    {
+                        continue;
+                    }
+                    for (u32 i = 0; i < inputs.size(); i++)
+                    {
+                        ofs << (((assignment >> i) & 1) ? '1' : '0');
+                    }
+                    ofs << (inputs.empty() ? "1\n" : " 1\n");
+                }
+            }
+            else
+            {
+                ofs << ".subckt " << type->get_name();
+                for (const GatePin* pin : type->get_pins())
+                {
+                    const Net* net = (pin->get_direction() == PinDirection::output) ? gate->get_fan_out_net(pin) : gate->get_fan_in_net(pin);
+                    if (net != nullptr)
+                    {
+                        ofs << " " << pin->get_name() << "=" << get_alias(net);
+                    }
+                }
+                ofs << "\n.cname " << escape(gate->get_name()) << "\n";
+
+                for (const auto& [key, entry] : gate->get_data_map())
+                {
+                    const auto& [category, name]   = key;
+                    const auto& [data_type, value] = entry;
+                    if (category != "generic")
+                    {
+                        continue;
+                    }
+                    ofs << ".param " << escape(name) << " " << ((data_type == "bit_vector") ? hex_to_binary(value) : "\"" + value + "\"") << "\n";
+                }
+            }
+        }
+
+        if (uses_false)
+        {
+            ofs << ".names $false\n";
+        }
+        ofs << ".end\n";
+
+        ofs.close();
+        if (ofs.fail())
+        {
+            return ERR(error_prefix + "unable to write file");
+        }
+
+        return OK({});
+    }
+}    // namespace hal
@@ -0,0 +1,36 @@
+#include "blif/plugin_blif.h"
+
+#include "blif/blif_parser.h"
+#include "blif/blif_writer.h"
+#include "hal_core/netlist/netlist_parser/netlist_parser_manager.h"
+#include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
+
+namespace hal
+{
+    extern std::unique_ptr<BasePluginInterface> create_plugin_instance()
+    {
+        return std::make_unique<BlifPlugin>();
+    }
+
+    std::string BlifPlugin::get_name() const
+    {
+        return std::string("blif");
+    }
+
+    std::string BlifPlugin::get_version() const
+    {
+        return std::string("0.1");
+    }
+
+    void BlifPlugin::on_load()
+    {
+        netlist_parser_manager::register_parser("Default BLIF Parser", []() { return std::make_unique<BlifParser>(); }, {".blif"});
+        netlist_writer_manager::register_writer("Default BLIF Writer", []() { return std::make_unique<BlifWriter>(); }, {".blif"});
+    }
+
+    void BlifPlugin::on_unload()
+    {
+        netlist_parser_manager::unregister_parser("Default BLIF Parser");
+        netlist_writer_manager::unregister_writer("Default BLIF Writer");
+    }
+}    // namespace hal
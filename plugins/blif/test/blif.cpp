@@ -0,0 +1,263 @@
+#include "blif/blif_parser.h"
+#include "blif/blif_writer.h"
+
+#include "gate_library_test_utils.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "netlist_test_utils.h"
+
+namespace hal
+{
+    class BlifTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+            test_utils::create_sandbox_directory();
+        }
+
+        virtual void TearDown()
+        {
+            test_utils::remove_sandbox_directory();
+        }
+
+        Gate* get_source(const Net* net)
+        {
+            return (net == nullptr || net->get_sources().empty()) ? nullptr : net->get_sources().front()->get_gate();
+        }
+
+        Net* get_net_by_name(const Netlist* nl, const std::string& name)
+        {
+            auto nets = nl->get_nets([&name](const Net* net) { return net->get_name() == name; });
+            return nets.empty() ? nullptr : nets.front();
+        }
+    };
+
+    /**
+     * Testing the parsing of '.names' covers, latches, and gate instances.
+     *
+     * Functions: parse, instantiate
+     */
+    TEST_F(BlifTest, check_parse)
+    {
+        TEST_START
+        {
+            const std::string blif = "# generated for testing\n"
+                                     ".model top\n"
+                                     ".inputs a b \\\n"
+                                     "  c clock\n"
+                                     ".outputs and_out xor_out mux_out lut_out nand_out q q_fe one\n"
+                                     ".names a b and_out\n"
+                                     "11 1\n"
+                                     ".names a b xor_out    # exclusive or\n"
+                                     "10 1\n"
+                                     "01 1\n"
+                                     ".names a b c mux_out\n"
+                                     "1-0 1\n"
+                                     "-11 1\n"
+                                     ".names a b c lut_out\n"
+                                     "101 1\n"
+                                     ".names a b nand_out\n"
+                                     "11 0\n"
+                                     ".names one\n"
+                                     "1\n"
+                                     ".latch and_out q re clock 0\n"
+                                     ".latch xor_out q_fe fe clock 2\n"
+                                     ".latch mux_out q_nil\n"
+                                     ".subckt AND3 I0=a I1=b I2=c O=and3_out\n"
+                                     ".cname my_and3\n"
+                                     ".end\n";
+            std::filesystem::path path = test_utils::create_sandbox_file("test.blif", blif);
+
+            BlifParser parser;
+            ASSERT_TRUE(parser.parse(path).is_ok());
+            EXPECT_FALSE(parser.get_required_gate_types().has_value());
+
+            auto nl_res = parser.instantiate(test_utils::get_gate_library());
+            ASSERT_TRUE(nl_res.is_ok()) << nl_res.get_error().get();
+            std::unique_ptr<Netlist> nl = nl_res.get();
+
+            EXPECT_EQ(nl->get_design_name(), "top");
+            EXPECT_EQ(nl->get_global_input_nets().size(), 5);
+            EXPECT_EQ(nl->get_global_output_nets().size(), 8);
+
+            // covers are mapped to gate types implementing the same function if possible, LUTs otherwise
+            Gate* and_gate = get_source(get_net_by_name(nl.get(), "and_out"));
+            ASSERT_NE(and_gate, nullptr);
+            EXPECT_EQ(and_gate->get_type()->get_name(), "AND2");
+            EXPECT_EQ(and_gate->get_fan_in_net("I0")->get_name(), "a");
+
+            Gate* xor_gate = get_source(get_net_by_name(nl.get(), "xor_out"));
+            ASSERT_NE(xor_gate, nullptr);
+            EXPECT_EQ(xor_gate->get_type()->get_name(), "XOR2");
+
+            Gate* mux_gate = get_source(get_net_by_name(nl.get(), "mux_out"));
+            ASSERT_NE(mux_gate, nullptr);
+            EXPECT_EQ(mux_gate->get_type()->get_name(), "MUX");
+            EXPECT_EQ(mux_gate->get_fan_in_net("S")->get_name(), "c");
+
+            Gate* lut_gate = get_source(get_net_by_name(nl.get(), "lut_out"));
+            ASSERT_NE(lut_gate, nullptr);
+            EXPECT_EQ(lut_gate->get_type()->get_name(), "LUT3");
+            const BooleanFunction a = BooleanFunction::Var("I0"), b = BooleanFunction::Var("I1"), c = BooleanFunction::Var("I2");
+            EXPECT_EQ(lut_gate->get_boolean_function().compute_truth_table({"I0", "I1", "I2"}).get(), (a & ~b & c).compute_truth_table({"I0", "I1", "I2"}).get());
+
+            Gate* nand_gate = get_source(get_net_by_name(nl.get(), "nand_out"));
+            ASSERT_NE(nand_gate, nullptr);
+            EXPECT_EQ(nand_gate->get_type()->get_name(), "LUT2");
+            EXPECT_EQ(nand_gate->get_boolean_function().compute_truth_table({"I0", "I1"}).get(), (~(a & b)).compute_truth_table({"I0", "I1"}).get());
+
+            Gate* one = get_source(get_net_by_name(nl.get(), "one"));
+            ASSERT_NE(one, nullptr);
+            EXPECT_TRUE(one->is_vcc_gate());
+
+            // latches
+            Gate* q = get_source(get_net_by_name(nl.get(), "q"));
+            ASSERT_NE(q, nullptr);
+            EXPECT_EQ(q->get_type()->get_name(), "DFF");
+            EXPECT_EQ(q->get_fan_in_net("CLK")->get_name(), "clock");
+            EXPECT_EQ(q->get_fan_in_net("D")->get_name(), "and_out");
+
+            Gate* q_fe = get_source(get_net_by_name(nl.get(), "q_fe"));
+            ASSERT_NE(q_fe, nullptr);
+            EXPECT_EQ(get_source(q_fe->get_fan_in_net("CLK"))->get_type()->get_name(), "INV");
+
+            Gate* q_nil = get_source(get_net_by_name(nl.get(), "q_nil"));
+            ASSERT_NE(q_nil, nullptr);
+            EXPECT_EQ(q_nil->get_fan_in_net("CLK")->get_name(), "clk");
+            EXPECT_TRUE(q_nil->get_fan_in_net("CLK")->is_global_input_net());
+
+            // gate instances
+            Gate* and3 = get_source(get_net_by_name(nl.get(), "and3_out"));
+            ASSERT_NE(and3, nullptr);
+            EXPECT_EQ(and3->get_type()->get_name(), "AND3");
+            EXPECT_EQ(and3->get_name(), "my_and3");
+            EXPECT_EQ(and3->get_fan_in_net("I2")->get_name(), "c");
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that invalid or unsupported BLIF files are rejected.
+     *
+     * Functions: parse, instantiate
+     */
+    TEST_F(BlifTest, check_invalid)
+    {
+        TEST_START
+        {
+            const std::vector<std::string> parse_errors = {
+                ".model a\n.end\n.model b\n.end\n",    // multiple models
+                ".model a\n11 1\n.end\n",              // cover without '.names'
+                ".model a\n.latch x\n.end\n",          // missing latch output
+            };
+            for (const auto& content : parse_errors)
+            {
+                std::filesystem::path path = test_utils::create_sandbox_file("invalid.blif", content);
+                BlifParser parser;
+                EXPECT_TRUE(parser.parse(path).is_error()) << content;
+            }
+
+            const std::vector<std::string> instantiation_errors = {
+                ".model a\n.names x y z\n11 1\n00 0\n.end\n",            // mixed ON-set and OFF-set
+                ".model a\n.names x y z\n1 1\n.end\n",                   // wrong row width
+                ".model a\n.subckt UNKNOWN A=x\n.end\n",                 // unknown gate type
+                ".model a\n.subckt AND2 I0=x Q=y\n.end\n",               // unknown pin
+                ".model a\n.latch x y ah c\n.end\n",                     // level-sensitive latch
+                ".model a\n.inputs x\n.param INIT 1\n.end\n",            // parameter without gate
+            };
+            for (const auto& content : instantiation_errors)
+            {
+                std::filesystem::path path = test_utils::create_sandbox_file("invalid.blif", content);
+                BlifParser parser;
+                ASSERT_TRUE(parser.parse(path).is_ok()) << content;
+                EXPECT_TRUE(parser.instantiate(test_utils::get_gate_library()).is_error()) << content;
+            }
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing writing a netlist to a BLIF file and parsing it again.
+     *
+     * Functions: write, parse, instantiate
+     */
+    TEST_F(BlifTest, check_write)
+    {
+        TEST_START
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            const GateLibrary* gl       = nl->get_gate_library();
+            nl->set_design_name("written");
+
+            Gate* lut  = nl->create_gate(gl->get_gate_type_by_name("LUT4"), "lut");
+            Gate* ff   = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff");
+            Gate* ffe  = nl->create_gate(gl->get_gate_type_by_name("DFFE"), "ffe");
+            Gate* gnd  = nl->create_gate(gl->get_gate_type_by_name("GND"), "gnd");
+            Gate* and3 = nl->create_gate(gl->get_gate_type_by_name("AND3"), "and3");
+            gnd->mark_gnd_gate();
+            ASSERT_TRUE(lut->set_init_data({"6A5C"}).is_ok());
+            and3->set_data("generic", "WIDTH", "bit_vector", "A");
+
+            Net* a   = test_utils::connect_global_in(nl.get(), lut, "I0", "a");
+            Net* b   = test_utils::connect_global_in(nl.get(), lut, "I1", "b with space");
+            Net* clk = test_utils::connect_global_in(nl.get(), ff, "CLK", "clk");
+            test_utils::connect(nl.get(), gnd, "O", lut, "I2", "zero");
+            a->add_destination(lut, "I3");
+            test_utils::connect(nl.get(), lut, "O", ff, "D", "lut_out");
+            clk->add_destination(ffe, "CLK");
+            b->add_destination(ffe, "EN");
+            a->add_destination(ffe, "D");
+            test_utils::connect(nl.get(), ff, "Q", and3, "I0", "q");
+            test_utils::connect(nl.get(), ffe, "Q", and3, "I1", "qe");
+            b->add_destination(and3, "I2");
+            test_utils::connect_global_out(nl.get(), and3, "O", "y");
+            test_utils::connect_global_out(nl.get(), ff, "QN", "qn");
+
+            std::filesystem::path path = test_utils::create_sandbox_path("written.blif");
+            BlifWriter writer;
+            auto res = writer.write(nl.get(), path);
+            ASSERT_TRUE(res.is_ok()) << res.get_error().get();
+
+            BlifParser parser;
+            auto nl_res = parser.parse_and_instantiate(path, gl);
+            ASSERT_TRUE(nl_res.is_ok()) << nl_res.get_error().get();
+            std::unique_ptr<Netlist> parsed_nl = nl_res.get();
+
+            EXPECT_EQ(parsed_nl->get_design_name(), "written");
+            ASSERT_EQ(parsed_nl->get_global_input_nets().size(), 3);
+            EXPECT_EQ(parsed_nl->get_global_input_nets().at(1)->get_name(), "b_with_space");
+            ASSERT_EQ(parsed_nl->get_global_output_nets().size(), 2);
+
+            // the LUT function is preserved
+            Gate* parsed_lut = get_source(get_net_by_name(parsed_nl.get(), "lut_out"));
+            ASSERT_NE(parsed_lut, nullptr);
+            EXPECT_EQ(parsed_lut->get_type()->get_name(), "LUT4");
+            std::vector<std::string> inputs = {"I0", "I1", "I2", "I3"};
+            EXPECT_EQ(parsed_lut->get_boolean_function().compute_truth_table(inputs).get(), lut->get_boolean_function().compute_truth_table(inputs).get());
+            EXPECT_EQ(parsed_lut->get_fan_in_net("I2")->get_name(), "zero");
+            EXPECT_TRUE(get_source(parsed_lut->get_fan_in_net("I2"))->is_gnd_gate());
+
+            // simple flip-flops are written as latches, all others as gate instances
+            Gate* parsed_ff = get_source(get_net_by_name(parsed_nl.get(), "q"));
+            ASSERT_NE(parsed_ff, nullptr);
+            EXPECT_EQ(parsed_ff->get_type()->get_name(), "DFF");
+            EXPECT_EQ(parsed_ff->get_fan_in_net("CLK")->get_name(), "clk");
+            EXPECT_EQ(get_source(get_net_by_name(parsed_nl.get(), "qn"))->get_type()->get_name(), "INV");
+
+            Gate* parsed_ffe = get_source(get_net_by_name(parsed_nl.get(), "qe"));
+            ASSERT_NE(parsed_ffe, nullptr);
+            EXPECT_EQ(parsed_ffe->get_type()->get_name(), "DFFE");
+            EXPECT_EQ(parsed_ffe->get_name(), "ffe");
+            EXPECT_EQ(parsed_ffe->get_fan_in_net("EN")->get_name(), "b_with_space");
+
+            Gate* parsed_and3 = get_source(get_net_by_name(parsed_nl.get(), "y"));
+            ASSERT_NE(parsed_and3, nullptr);
+            EXPECT_EQ(parsed_and3->get_name(), "and3");
+            EXPECT_EQ(std::get<1>(parsed_and3->get_data("generic", "WIDTH")), "A");
+        }
+        TEST_END
+    }
+}    // namespace hal
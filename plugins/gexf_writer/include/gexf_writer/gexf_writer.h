@@ -28,11 +28,13 @@
 #include "hal_core/defines.h"
 #include "hal_core/netlist/netlist_writer/netlist_writer.h"
 
-#include <QString>
-#include <QXmlStreamWriter>
-#include <functional>
 #include <map>
-#include <sstream>
+#include <ostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace hal
 {
@@ -40,6 +42,7 @@ namespace hal
     class Netlist;
     class Net;
     class Gate;
+    class Endpoint;
 
     /**
      * @ingroup netlist_writer
@@ -47,30 +50,94 @@ namespace hal
     class NETLIST_API GexfWriter : public NetlistWriter
     {
     public:
+        /**
+         * The output format produced by the writer.
+         */
+        enum class OutputFormat
+        {
+            gexf,     /**< GEXF XML graph file. */
+            edge_list /**< Raw little-endian u32 edge list accompanied by node and net side tables. */
+        };
+
         GexfWriter();
         ~GexfWriter() = default;
 
         /**
          * Write the netlist to a Gefx file at the provided location.
+         * If a selection has been configured, only the selected gates and the edges between them are written.
+         *
+         * For the edge list format, the file at `file_path` contains one pair of u32 node indices (source, destination) per edge.
+         * The side table `<file_path>.nodes` contains the u32 gate ID of every node index and `<file_path>.nets` contains the u32 net ID of every edge.
+         * All three files can be loaded using `numpy.fromfile(path, dtype=numpy.uint32)`.
          *
          * @param[in] netlist - The netlist.
          * @param[in] file_path - The output path.
-         * @returns True on success, false otherwise.
+         * @returns Ok() on success, an error otherwise.
          */
         Result<std::monostate> write(Netlist* netlist, const std::filesystem::path& file_path) override;
 
+        /**
+         * Set the output format of the writer.
+         *
+         * @param[in] format - The output format.
+         */
+        void set_output_format(OutputFormat format);
+
+        /**
+         * Restrict the export to the gates of the module with the given ID and all of its submodules.
+         *
+         * @param[in] module_id - The ID of the root module of the subtree.
+         */
+        void select_module(u32 module_id);
+
+        /**
+         * Restrict the export to gates of the given gate types.
+         *
+         * @param[in] gate_types - The names of the gate types to export.
+         */
+        void select_gate_types(const std::set<std::string>& gate_types);
+
+        /**
+         * Restrict the export to gates that are reachable from the given seed gates by traversing at most `hops` nets in either direction.
+         *
+         * @param[in] gate_ids - The IDs of the seed gates.
+         * @param[in] hops - The maximum distance from the seed gates.
+         */
+        void select_neighborhood(const std::vector<u32>& gate_ids, u32 hops);
+
+        /**
+         * Remove all selection criteria, i.e., export the entire netlist.
+         */
+        void clear_selection();
+
     private:
         Netlist* mNetlist;
-        int mEdgeId;
         bool mGuiLoaded;
+        OutputFormat mFormat;
+
+        bool mModuleSelected;
+        u32 mModuleId;
+        std::set<std::string> mGateTypes;
+        std::vector<u32> mSeedGateIds;
+        u32 mHops;
+
+        /** Gates selected for export, only valid during a call to write() with an active selection. */
+        std::unordered_set<const Gate*> mSelectedGates;
+        bool mSelectAll;
+
+        bool hasSelection() const;
+        Result<std::monostate> computeSelection();
+        bool isSelected(const Gate* g) const;
+
+        Result<std::monostate> writeGexf(const std::filesystem::path& file_path);
+        Result<std::monostate> writeEdgeList(const std::filesystem::path& file_path);
 
-        void writeMeta(QXmlStreamWriter& xmlOut) const;
-        void writeGraph(QXmlStreamWriter& xmlOut);
-        void writeNode(QXmlStreamWriter& xmlOut, const Gate* g) const;
-        void writeColor(QXmlStreamWriter& xmlOut, const Gate* g) const;
-        void writeEdge(QXmlStreamWriter& xmlOut, const Net* n);
-        void writeAttribute(QXmlStreamWriter& xmlOut, int id, const QString& title, const QString& type) const;
-        void writeNodeAttribute(QXmlStreamWriter& xmlOut, const Gate* g, int inx) const;
-        void writeEdgeAttribute(QXmlStreamWriter& xmlOut, const Net* n, int inx, const std::string pin = std::string()) const;
+        void writeMeta(std::ostream& xmlOut) const;
+        void writeGraph(std::ostream& xmlOut) const;
+        void writeNode(std::ostream& xmlOut, const Gate* g) const;
+        void writeColor(std::ostream& xmlOut, const Gate* g) const;
+        void writeEdges(std::ostream& xmlOut, const Net* n, u64& edgeId) const;
+        void writeAttribute(std::ostream& xmlOut, int id, const std::string& title, const std::string& type) const;
+        void writeAttributeValue(std::ostream& xmlOut, int inx, const std::string& value) const;
     };
 }    // namespace hal
@@ -25,11 +25,12 @@
 
 #pragma once
 
-#include "hal_core/plugin_system/plugin_interface_base.h"
+#include "gexf_writer/gexf_writer.h"
+#include "hal_core/plugin_system/plugin_interface_cli.h"
 
 namespace hal
 {
-    class PLUGIN_API GexfWriterPlugin : public BasePluginInterface
+    class PLUGIN_API GexfWriterPlugin : virtual public CLIPluginInterface
     {
     public:
         std::string get_name() const override;
@@ -37,5 +38,22 @@ namespace hal
 
         void on_load() override;
         void on_unload() override;
+
+        /** interface implementation: i_cli */
+        ProgramOptions get_cli_options() const override;
+
+        /** interface implementation: i_cli */
+        bool handle_cli_call(Netlist* netlist, ProgramArguments& args) override;
+
+        /**
+         * Get the writer that is copied whenever the netlist writer manager writes a '.gexf' or '.edges' file.
+         * Selection criteria configured on this writer therefore apply to the next write through the netlist writer manager, e.g., using '--write-hdl', and are reset afterwards.
+         *
+         * @returns The default writer.
+         */
+        GexfWriter* get_default_writer();
+
+    private:
+        GexfWriter m_default_writer;
     };
 }    // namespace hal
@@ -0,0 +1,116 @@
+#include "hal_core/python_bindings/python_bindings.h"
+
+#include "gexf_writer/gexf_writer.h"
+#include "gexf_writer/plugin_gexf_writer.h"
+#include "hal_core/utilities/log.h"
+#include "pybind11/operators.h"
+#include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
+#include "pybind11/stl_bind.h"
+
+namespace py = pybind11;
+
+namespace hal
+{
+
+    // the name in PYBIND11_MODULE/PYBIND11_PLUGIN *MUST* match the filename of the output library (without extension),
+    // otherwise you will get "ImportError: dynamic module does not define module export function" when importing the module
+
+#ifdef PYBIND11_MODULE
+    PYBIND11_MODULE(gexf_writer, m)
+    {
+        m.doc() = "hal GexfWriterPlugin python bindings";
+#else
+    PYBIND11_PLUGIN(gexf_writer)
+    {
+        py::module m("gexf_writer", "hal GexfWriterPlugin python bindings");
+#endif    // ifdef PYBIND11_MODULE
+
+        py::class_<GexfWriter> py_gexf_writer(m, "GexfWriter", R"(
+            Writer for netlists as GEXF graph files or as binary edge lists, optionally restricted to a selection of gates.
+        )");
+
+        py::enum_<GexfWriter::OutputFormat>(py_gexf_writer, "OutputFormat", R"(
+            The output format produced by the writer.
+        )")
+            .value("gexf", GexfWriter::OutputFormat::gexf, R"(GEXF XML graph file.)")
+            .value("edge_list", GexfWriter::OutputFormat::edge_list, R"(Raw little-endian u32 edge list accompanied by node and net side tables.)")
+            .export_values();
+
+        py_gexf_writer.def(py::init<>(), R"(
+            Construct a writer that writes the entire netlist as a GEXF file.
+        )");
+
+        py_gexf_writer.def(
+            "write",
+            [](GexfWriter& self, Netlist* netlist, const std::string& file_path) -> bool {
+                auto res = self.write(netlist, file_path);
+                if (res.is_ok())
+                {
+                    return true;
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while writing netlist:\n{}", res.get_error().get());
+                    return false;
+                }
+            },
+            py::arg("netlist"),
+            py::arg("file_path"),
+            R"(
+            Write the netlist to the given file, restricted to the configured selection.
+            For the edge list format, the side tables are written to '<file_path>.nodes' and '<file_path>.nets'.
+
+            :param hal_py.Netlist netlist: The netlist.
+            :param str file_path: The output path.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_gexf_writer.def("set_output_format", &GexfWriter::set_output_format, py::arg("format"), R"(
+            Set the output format of the writer.
+
+            :param gexf_writer.GexfWriter.OutputFormat format: The output format.
+        )");
+
+        py_gexf_writer.def("select_module", &GexfWriter::select_module, py::arg("module_id"), R"(
+            Restrict the export to the gates of the module with the given ID and all of its submodules.
+
+            :param int module_id: The ID of the root module of the subtree.
+        )");
+
+        py_gexf_writer.def("select_gate_types", &GexfWriter::select_gate_types, py::arg("gate_types"), R"(
+            Restrict the export to gates of the given gate types.
+
+            :param set[str] gate_types: The names of the gate types to export.
+        )");
+
+        py_gexf_writer.def("select_neighborhood", &GexfWriter::select_neighborhood, py::arg("gate_ids"), py::arg("hops"), R"(
+            Restrict the export to gates that are reachable from the given seed gates by traversing at most the given number of nets in either direction.
+
+            :param list[int] gate_ids: The IDs of the seed gates.
+            :param int hops: The maximum distance from the seed gates.
+        )");
+
+        py_gexf_writer.def("clear_selection", &GexfWriter::clear_selection, R"(
+            Remove all selection criteria, i.e., export the entire netlist.
+        )");
+
+        py::class_<GexfWriterPlugin, RawPtrWrapper<GexfWriterPlugin>, BasePluginInterface>(m, "GexfWriterPlugin")
+            .def_property_readonly("name", &GexfWriterPlugin::get_name)
+            .def("get_name", &GexfWriterPlugin::get_name)
+            .def_property_readonly("version", &GexfWriterPlugin::get_version)
+            .def("get_version", &GexfWriterPlugin::get_version)
+            .def("get_default_writer", &GexfWriterPlugin::get_default_writer, py::return_value_policy::reference, R"(
+                Get the writer that is copied whenever the netlist writer manager writes a '.gexf' or '.edges' file.
+                Selection criteria configured on this writer therefore apply to the next write through the netlist writer manager and are reset afterwards.
+
+                :returns: The default writer.
+                :rtype: gexf_writer.GexfWriter
+            )");
+
+#ifndef PYBIND11_MODULE
+        return m.ptr();
+#endif    // PYBIND11_MODULE
+    }
+}    // namespace hal
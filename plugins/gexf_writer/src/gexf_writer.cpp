@@ -10,19 +10,122 @@
 #include "hal_version.h"
 
 #include <QColor>
-#include <QDate>
-#include <QDebug>
-#include <QFile>
+#include <ctime>
+#include <fstream>
 
 namespace hal
 {
     // needed for module color
     extern NetlistRelay* gNetlistRelay;
 
-    GexfWriter::GexfWriter() : mEdgeId(0)
+    namespace
     {
-        std::set<std::string> plugins = plugin_manager::get_plugin_names();
-        mGuiLoaded                    = (plugins.find(std::string("hal_gui")) != plugins.end());
+        const size_t WRITE_BUFFER_SIZE = 1 << 20;
+
+        void write_escaped(std::ostream& out, const std::string& text)
+        {
+            for (char c : text)
+            {
+                switch (c)
+                {
+                    case '&':
+                        out << "&amp;";
+                        break;
+                    case '<':
+                        out << "&lt;";
+                        break;
+                    case '>':
+                        out << "&gt;";
+                        break;
+                    case '"':
+                        out << "&quot;";
+                        break;
+                    default:
+                        out.put(c);
+                }
+            }
+        }
+
+        /**
+         * Buffers u32 values and writes them to a binary file in little-endian byte order.
+         */
+        class U32FileWriter
+        {
+        public:
+            explicit U32FileWriter(const std::filesystem::path& file_path) : m_stream(file_path, std::ios::binary | std::ios::trunc)
+            {
+                m_buffer.reserve(WRITE_BUFFER_SIZE);
+            }
+
+            bool is_open() const
+            {
+                return m_stream.is_open();
+            }
+
+            void push(u32 value)
+            {
+                m_buffer.push_back((char)(value & 0xFF));
+                m_buffer.push_back((char)((value >> 8) & 0xFF));
+                m_buffer.push_back((char)((value >> 16) & 0xFF));
+                m_buffer.push_back((char)((value >> 24) & 0xFF));
+                if (m_buffer.size() >= WRITE_BUFFER_SIZE)
+                {
+                    flush();
+                }
+            }
+
+            bool close()
+            {
+                flush();
+                m_stream.close();
+                return !m_stream.fail();
+            }
+
+        private:
+            void flush()
+            {
+                m_stream.write(m_buffer.data(), m_buffer.size());
+                m_buffer.clear();
+            }
+
+            std::ofstream m_stream;
+            std::vector<char> m_buffer;
+        };
+    }    // namespace
+
+    GexfWriter::GexfWriter() : mNetlist(nullptr), mGuiLoaded(false), mFormat(OutputFormat::gexf), mModuleSelected(false), mModuleId(0), mHops(0), mSelectAll(true)
+    {
+    }
+
+    void GexfWriter::set_output_format(OutputFormat format)
+    {
+        mFormat = format;
+    }
+
+    void GexfWriter::select_module(u32 module_id)
+    {
+        mModuleSelected = true;
+        mModuleId       = module_id;
+    }
+
+    void GexfWriter::select_gate_types(const std::set<std::string>& gate_types)
+    {
+        mGateTypes = gate_types;
+    }
+
+    void GexfWriter::select_neighborhood(const std::vector<u32>& gate_ids, u32 hops)
+    {
+        mSeedGateIds = gate_ids;
+        mHops        = hops;
+    }
+
+    void GexfWriter::clear_selection()
+    {
+        mModuleSelected = false;
+        mModuleId       = 0;
+        mGateTypes.clear();
+        mSeedGateIds.clear();
+        mHops = 0;
     }
 
     Result<std::monostate> GexfWriter::write(Netlist* netlist, const std::filesystem::path& file_path)
@@ -33,109 +136,331 @@ namespace hal
         }
         mNetlist = netlist;
 
+        // writers may be created before the GUI plugin is loaded, so its presence is checked when writing
+        std::set<std::string> plugins = plugin_manager::get_plugin_names();
+        mGuiLoaded                    = (plugins.find(std::string("hal_gui")) != plugins.end());
+
         if (file_path.empty())
         {
             return ERR("could not write netlist to GEXF file '" + file_path.string() + "': file path is empty");
         }
-        QString filename = QString::fromStdString(file_path);
 
-        if (!filename.endsWith(".gexf"))
+        if (auto res = computeSelection(); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not write netlist to GEXF file '" + file_path.string() + "': failed to compute gate selection");
+        }
+
+        Result<std::monostate> res = (mFormat == OutputFormat::edge_list) ? writeEdgeList(file_path) : writeGexf(file_path);
+
+        mSelectedGates.clear();
+        mNetlist = nullptr;
+        return res;
+    }
+
+    bool GexfWriter::hasSelection() const
+    {
+        return mModuleSelected || !mGateTypes.empty() || !mSeedGateIds.empty();
+    }
+
+    Result<std::monostate> GexfWriter::computeSelection()
+    {
+        mSelectedGates.clear();
+        mSelectAll = !hasSelection();
+        if (mSelectAll)
+        {
+            return OK({});
+        }
+
+        Module* module = nullptr;
+        if (mModuleSelected)
+        {
+            module = mNetlist->get_module_by_id(mModuleId);
+            if (module == nullptr)
+            {
+                return ERR("no module with ID " + std::to_string(mModuleId) + " exists in netlist with ID " + std::to_string(mNetlist->get_id()));
+            }
+        }
+
+        auto matches = [this, module](Gate* g) {
+            if (!mGateTypes.empty() && mGateTypes.find(g->get_type()->get_name()) == mGateTypes.end())
+            {
+                return false;
+            }
+            return module == nullptr || module->contains_gate(g, true);
+        };
+
+        if (mSeedGateIds.empty())
+        {
+            std::vector<Gate*> candidates = (module != nullptr) ? module->get_gates(nullptr, true) : mNetlist->get_gates();
+            for (Gate* g : candidates)
+            {
+                if (matches(g))
+                {
+                    mSelectedGates.insert(g);
+                }
+            }
+            return OK({});
+        }
+
+        // breadth-first search over nets in both directions, starting from the seed gates
+        std::unordered_set<Gate*> visited;
+        std::vector<Gate*> frontier;
+        for (u32 id : mSeedGateIds)
+        {
+            Gate* g = mNetlist->get_gate_by_id(id);
+            if (g == nullptr)
+            {
+                return ERR("no gate with ID " + std::to_string(id) + " exists in netlist with ID " + std::to_string(mNetlist->get_id()));
+            }
+            if (visited.insert(g).second)
+            {
+                frontier.push_back(g);
+            }
+        }
+
+        for (u32 hop = 0; hop < mHops && !frontier.empty(); hop++)
+        {
+            std::vector<Gate*> next;
+            auto visit = [&visited, &next](const std::vector<Endpoint*>& endpoints) {
+                for (const Endpoint* ep : endpoints)
+                {
+                    Gate* neighbor = ep->get_gate();
+                    if (neighbor != nullptr && visited.insert(neighbor).second)
+                    {
+                        next.push_back(neighbor);
+                    }
+                }
+            };
+
+            for (const Gate* g : frontier)
+            {
+                for (const Net* n : g->get_fan_in_nets())
+                {
+                    visit(n->get_sources());
+                }
+                for (const Net* n : g->get_fan_out_nets())
+                {
+                    visit(n->get_destinations());
+                }
+            }
+            frontier = std::move(next);
+        }
+
+        for (Gate* g : visited)
+        {
+            if (matches(g))
+            {
+                mSelectedGates.insert(g);
+            }
+        }
+        return OK({});
+    }
+
+    bool GexfWriter::isSelected(const Gate* g) const
+    {
+        return g != nullptr && (mSelectAll || mSelectedGates.find(g) != mSelectedGates.end());
+    }
+
+    Result<std::monostate> GexfWriter::writeGexf(const std::filesystem::path& file_path)
+    {
+        std::filesystem::path out_path = file_path;
+        if (out_path.extension() != ".gexf")
         {
-            int pos = filename.lastIndexOf('.');
-            if (pos > 0)
-                filename.remove(pos, filename.size());
-            // TODO : handle dot in directory name
-            filename += ".gexf";
+            out_path.replace_extension(".gexf");
         }
-        QFile of(filename);
-        if (!of.open(QIODevice::WriteOnly))
+
+        std::vector<char> buffer(WRITE_BUFFER_SIZE);
+        std::ofstream xmlOut;
+        xmlOut.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+        xmlOut.open(out_path, std::ios::trunc);
+        if (!xmlOut.is_open())
         {
-            return ERR("could not write netlist to GEXF file '" + file_path.string() + "': failed to open file");
+            return ERR("could not write netlist to GEXF file '" + out_path.string() + "': failed to open file");
         }
-        QXmlStreamWriter xmlOut(&of);
-        xmlOut.setAutoFormatting(true);
-        xmlOut.writeStartDocument();
-        xmlOut.writeStartElement("gexf");
-        xmlOut.writeAttribute("xmlns", "http://www.gexf.net/1.2draft");
-        //       xmlOut.writeNamespace("http://www.gexf.net/1.2draft/viz");  // visualisation attributes
-        xmlOut.writeNamespace("http://www.w3.org/2001/XMLSchema-instance", "xsi");
-        xmlOut.writeAttribute("http://www.w3.org/2001/XMLSchema-instance", "schemaLocation", "http://www.gexf.net/1.2draft http://www.gexf.net/1.2draft/gexf.xsd");
-        xmlOut.writeAttribute("version", "1.2");
+
+        xmlOut << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+        xmlOut << "<gexf xmlns=\"http://www.gexf.net/1.2draft\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+                  "xsi:schemaLocation=\"http://www.gexf.net/1.2draft http://www.gexf.net/1.2draft/gexf.xsd\" version=\"1.2\">\n";
         writeMeta(xmlOut);
         writeGraph(xmlOut);
-        xmlOut.writeEndElement();
-        xmlOut.writeEndDocument();
+        xmlOut << "</gexf>\n";
+        xmlOut.close();
+
+        if (xmlOut.fail())
+        {
+            std::error_code ec;
+            std::filesystem::remove(out_path, ec);
+            return ERR("could not write netlist to GEXF file '" + out_path.string() + "': failed to write file");
+        }
+        return OK({});
+    }
+
+    Result<std::monostate> GexfWriter::writeEdgeList(const std::filesystem::path& file_path)
+    {
+        std::filesystem::path nodes_path = file_path.string() + ".nodes";
+        std::filesystem::path nets_path  = file_path.string() + ".nets";
+
+        U32FileWriter edges(file_path);
+        U32FileWriter nodes(nodes_path);
+        U32FileWriter nets(nets_path);
+        if (!edges.is_open() || !nodes.is_open() || !nets.is_open())
+        {
+            // remove the files that have been created already
+            std::error_code ec;
+            if (edges.is_open())
+            {
+                edges.close();
+                std::filesystem::remove(file_path, ec);
+            }
+            if (nodes.is_open())
+            {
+                nodes.close();
+                std::filesystem::remove(nodes_path, ec);
+            }
+            if (nets.is_open())
+            {
+                nets.close();
+                std::filesystem::remove(nets_path, ec);
+            }
+            return ERR("could not write netlist to edge list file '" + file_path.string() + "': failed to open file");
+        }
+
+        // node indices are dense and follow the order of the gates in the netlist
+        std::unordered_map<const Gate*, u32> node_index;
+        node_index.reserve(mSelectAll ? mNetlist->get_gates().size() : mSelectedGates.size());
+        for (const Gate* g : mNetlist->get_gates())
+        {
+            if (isSelected(g))
+            {
+                u32 index = (u32)node_index.size();
+                node_index.emplace(g, index);
+                nodes.push(g->get_id());
+            }
+        }
+
+        std::vector<u32> dst_indices;
+        for (const Net* n : mNetlist->get_nets())
+        {
+            dst_indices.clear();
+            for (const Endpoint* ep : n->get_destinations())
+            {
+                if (auto it = node_index.find(ep->get_gate()); it != node_index.end())
+                {
+                    dst_indices.push_back(it->second);
+                }
+            }
+            if (dst_indices.empty())
+            {
+                continue;
+            }
+
+            for (const Endpoint* ep : n->get_sources())
+            {
+                auto it = node_index.find(ep->get_gate());
+                if (it == node_index.end())
+                {
+                    continue;
+                }
+                for (u32 dst : dst_indices)
+                {
+                    edges.push(it->second);
+                    edges.push(dst);
+                    nets.push(n->get_id());
+                }
+            }
+        }
+
+        bool success = edges.close();
+        success      = nodes.close() && success;
+        success      = nets.close() && success;
+        if (!success)
+        {
+            std::error_code ec;
+            std::filesystem::remove(file_path, ec);
+            std::filesystem::remove(nodes_path, ec);
+            std::filesystem::remove(nets_path, ec);
+            return ERR("could not write netlist to edge list file '" + file_path.string() + "': failed to write file");
+        }
         return OK({});
     }
 
-    void GexfWriter::writeMeta(QXmlStreamWriter& xmlOut) const
+    void GexfWriter::writeMeta(std::ostream& xmlOut) const
     {
-        xmlOut.writeStartElement("meta");
-        xmlOut.writeAttribute("lastmodifieddate", QDate::currentDate().toString("yyyy-MM-dd"));
-        xmlOut.writeTextElement("creator", QString("hal %1.%2.%3").arg(hal_version::major).arg(hal_version::minor).arg(hal_version::patch));
-        xmlOut.writeEndElement();
+        char date[16];
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%d", std::localtime(&now));
+
+        xmlOut << "    <meta lastmodifieddate=\"" << date << "\">\n";
+        xmlOut << "        <creator>hal " << hal_version::major << "." << hal_version::minor << "." << hal_version::patch << "</creator>\n";
+        xmlOut << "    </meta>\n";
     }
 
-    void GexfWriter::writeGraph(QXmlStreamWriter& xmlOut)
+    void GexfWriter::writeGraph(std::ostream& xmlOut) const
     {
-        xmlOut.writeStartElement("graph");
-        xmlOut.writeAttribute("defaultedgetype", "directed");
-        xmlOut.writeAttribute("mode", "static");
+        xmlOut << "    <graph defaultedgetype=\"directed\" mode=\"static\">\n";
         // Edge attributes
-        xmlOut.writeStartElement("attributes");
-        xmlOut.writeAttribute("mode", "static");
-        xmlOut.writeAttribute("class", "edge");
+        xmlOut << "        <attributes mode=\"static\" class=\"edge\">\n";
         writeAttribute(xmlOut, 3, "label", "string");
         writeAttribute(xmlOut, 4, "hal_id", "long");
         writeAttribute(xmlOut, 5, "source_pin", "string");
         writeAttribute(xmlOut, 6, "destination_pin", "string");
         writeAttribute(xmlOut, 7, "networkx_key", "long");
-        xmlOut.writeEndElement();
+        xmlOut << "        </attributes>\n";
         // Node attributes
-        xmlOut.writeStartElement("attributes");
-        xmlOut.writeAttribute("mode", "static");
-        xmlOut.writeAttribute("class", "node");
+        xmlOut << "        <attributes mode=\"static\" class=\"node\">\n";
         writeAttribute(xmlOut, 0, "type", "string");
         writeAttribute(xmlOut, 1, "module", "string");
         writeAttribute(xmlOut, 2, "INIT", "string");
-        xmlOut.writeEndElement();
+        xmlOut << "        </attributes>\n";
         // end attributes
 
-        xmlOut.writeStartElement("nodes");
+        xmlOut << "        <nodes>\n";
         for (const Gate* g : mNetlist->get_gates())
-            writeNode(xmlOut, g);
-        xmlOut.writeEndElement();
+        {
+            if (isSelected(g))
+            {
+                writeNode(xmlOut, g);
+            }
+        }
+        xmlOut << "        </nodes>\n";
 
-        xmlOut.writeStartElement("edges");
+        u64 edgeId = 0;
+        xmlOut << "        <edges>\n";
         for (const Net* n : mNetlist->get_nets())
-            writeEdge(xmlOut, n);
-        xmlOut.writeEndElement();
+        {
+            writeEdges(xmlOut, n, edgeId);
+        }
+        xmlOut << "        </edges>\n";
+        xmlOut << "    </graph>\n";
     }
 
-    void GexfWriter::writeAttribute(QXmlStreamWriter& xmlOut, int id, const QString& title, const QString& type) const
+    void GexfWriter::writeAttribute(std::ostream& xmlOut, int id, const std::string& title, const std::string& type) const
     {
-        xmlOut.writeStartElement("attribute");
-        xmlOut.writeAttribute("id", QString::number(id));
-        xmlOut.writeAttribute("title", title);
-        xmlOut.writeAttribute("type", type);
-        xmlOut.writeEndElement();
+        xmlOut << "            <attribute id=\"" << id << "\" title=\"" << title << "\" type=\"" << type << "\"/>\n";
     }
 
-    void GexfWriter::writeNode(QXmlStreamWriter& xmlOut, const Gate* g) const
+    void GexfWriter::writeNode(std::ostream& xmlOut, const Gate* g) const
     {
-        xmlOut.writeStartElement("node");
-        xmlOut.writeAttribute("id", QString::number(g->get_id()));
-        xmlOut.writeAttribute("label", QString::fromStdString(g->get_name()));
+        xmlOut << "            <node id=\"" << g->get_id() << "\" label=\"";
+        write_escaped(xmlOut, g->get_name());
+        xmlOut << "\">\n";
         writeColor(xmlOut, g);
-        xmlOut.writeStartElement("attvalues");
-        writeNodeAttribute(xmlOut, g, 0);
-        writeNodeAttribute(xmlOut, g, 1);
-        writeNodeAttribute(xmlOut, g, 2);
-        xmlOut.writeEndElement();
-        xmlOut.writeEndElement();
+        xmlOut << "                <attvalues>\n";
+        writeAttributeValue(xmlOut, 0, g->get_type()->get_name());
+        writeAttributeValue(xmlOut, 1, g->get_module()->get_name());
+        for (const auto& [key, val] : g->get_data_map())
+        {
+            if (std::get<1>(key) == "INIT")
+            {
+                writeAttributeValue(xmlOut, 2, std::get<1>(val));
+                break;
+            }
+        }
+        xmlOut << "                </attvalues>\n";
+        xmlOut << "            </node>\n";
     }
 
-    void GexfWriter::writeColor(QXmlStreamWriter& xmlOut, const Gate* g) const
+    void GexfWriter::writeColor(std::ostream& xmlOut, const Gate* g) const
     {
         if (!mGuiLoaded)
             return;
@@ -146,104 +471,44 @@ namespace hal
         QColor col = gNetlistRelay->getModuleColor(g->get_module()->get_id());
         if (!col.isValid())
             return;
-        //        xmlOut.writeStartElement("http://www.gexf.net/1.2draft/viz","color");
-        xmlOut.writeStartElement("color");
-        xmlOut.writeAttribute("r", QString::number(col.red()));
-        xmlOut.writeAttribute("g", QString::number(col.green()));
-        xmlOut.writeAttribute("b", QString::number(col.blue()));
-        xmlOut.writeEndElement();
+        xmlOut << "                <color r=\"" << col.red() << "\" g=\"" << col.green() << "\" b=\"" << col.blue() << "\"/>\n";
     }
 
-    void GexfWriter::writeNodeAttribute(QXmlStreamWriter& xmlOut, const Gate* g, int inx) const
+    void GexfWriter::writeEdges(std::ostream& xmlOut, const Net* n, u64& edgeId) const
     {
-        QString value;
-        switch (inx)
-        {
-            case 0:
-                value = QString::fromStdString(g->get_type()->get_name());
-                break;
-            case 1:
-                value = QString::fromStdString(g->get_module()->get_name());
-                break;
-            case 2:
-                for (const auto& [key, val] : g->get_data_map())
-                {
-                    QString keyTxt = QString::fromStdString(std::get<1>(key));
-                    if (keyTxt == "INIT")
-                    {
-                        value = QString::fromStdString(std::get<1>(val));
-                        break;
-                    }
-                }
-                break;
-        }
-
-        if (value.isEmpty())
+        std::vector<Endpoint*> destinations = n->get_destinations([this](Endpoint* ep) { return isSelected(ep->get_gate()); });
+        if (destinations.empty())
             return;
 
-        xmlOut.writeStartElement("attvalue");
-        xmlOut.writeAttribute("for", QString::number(inx));
-        xmlOut.writeAttribute("value", value);
-        xmlOut.writeEndElement();
-    }
-
-    void GexfWriter::writeEdge(QXmlStreamWriter& xmlOut, const Net* n)
-    {
         for (const Endpoint* epSrc : n->get_sources())
         {
             Gate* gSrc = epSrc->get_gate();
-            if (!gSrc)
+            if (!isSelected(gSrc))
                 continue;
 
-            for (const Endpoint* epDst : n->get_destinations())
+            for (const Endpoint* epDst : destinations)
             {
-                Gate* gDst = epDst->get_gate();
-                if (!gDst)
-                    continue;
-
-                xmlOut.writeStartElement("edge");
-                xmlOut.writeAttribute("source", QString::number(gSrc->get_id()));
-                xmlOut.writeAttribute("target", QString::number(gDst->get_id()));
-                xmlOut.writeAttribute("id", QString::number(mEdgeId++));
-                xmlOut.writeStartElement("attvalues");
-                writeEdgeAttribute(xmlOut, n, 3);
-                writeEdgeAttribute(xmlOut, n, 4);
-                writeEdgeAttribute(xmlOut, n, 5, epSrc->get_pin()->get_name());
-                writeEdgeAttribute(xmlOut, n, 6, epDst->get_pin()->get_name());
-                writeEdgeAttribute(xmlOut, n, 7);
-                xmlOut.writeEndElement();
-                xmlOut.writeEndElement();
+                xmlOut << "            <edge source=\"" << gSrc->get_id() << "\" target=\"" << epDst->get_gate()->get_id() << "\" id=\"" << edgeId++ << "\">\n";
+                xmlOut << "                <attvalues>\n";
+                writeAttributeValue(xmlOut, 3, n->get_name());
+                writeAttributeValue(xmlOut, 4, std::to_string(n->get_id()));
+                writeAttributeValue(xmlOut, 5, epSrc->get_pin()->get_name());
+                writeAttributeValue(xmlOut, 6, epDst->get_pin()->get_name());
+                writeAttributeValue(xmlOut, 7, "0");    // networkx_key
+                xmlOut << "                </attvalues>\n";
+                xmlOut << "            </edge>\n";
             }
         }
     }
 
-    void GexfWriter::writeEdgeAttribute(QXmlStreamWriter& xmlOut, const Net* n, int inx, const std::string pin) const
+    void GexfWriter::writeAttributeValue(std::ostream& xmlOut, int inx, const std::string& value) const
     {
-        QString value;
-        switch (inx)
-        {
-            case 3:
-                value = QString::fromStdString(n->get_name());
-                break;
-            case 4:
-                value = QString::number(n->get_id());
-                break;
-            case 5:
-            case 6:
-                value = QString::fromStdString(pin);
-                break;
-            case 7:
-                value = "0";
-                break;    // networkx_key
-        }
-
-        if (value.isEmpty())
+        if (value.empty())
             return;
 
-        xmlOut.writeStartElement("attvalue");
-        xmlOut.writeAttribute("for", QString::number(inx));
-        xmlOut.writeAttribute("value", value);
-        xmlOut.writeEndElement();
+        xmlOut << "                    <attvalue for=\"" << inx << "\" value=\"";
+        write_escaped(xmlOut, value);
+        xmlOut << "\"/>\n";
     }
 
 }    // namespace hal
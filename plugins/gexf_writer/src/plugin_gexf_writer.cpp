@@ -1,10 +1,33 @@
 #include "gexf_writer/plugin_gexf_writer.h"
 
 #include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
-#include "gexf_writer/gexf_writer.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/utils.h"
 
 namespace hal
 {
+    namespace
+    {
+        bool parse_u32(const std::string& s, u32& value)
+        {
+            try
+            {
+                size_t pos              = 0;
+                const unsigned long res = std::stoul(s, &pos);
+                if (pos != s.size() || res > 0xFFFFFFFFul)
+                {
+                    return false;
+                }
+                value = (u32)res;
+                return true;
+            }
+            catch (const std::exception&)
+            {
+                return false;
+            }
+        }
+    }    // namespace
+
     extern std::unique_ptr<BasePluginInterface> create_plugin_instance()
     {
         return std::make_unique<GexfWriterPlugin>();
@@ -22,11 +45,107 @@ namespace hal
 
     void GexfWriterPlugin::on_load()
     {
-        netlist_writer_manager::register_writer("Default GEXF Writer", []() { return std::make_unique<GexfWriter>(); }, {".gexf"});
+        netlist_writer_manager::register_writer(
+            "Default GEXF Writer",
+            [this]() {
+                auto writer = std::make_unique<GexfWriter>(m_default_writer);
+                writer->set_output_format(GexfWriter::OutputFormat::gexf);
+                // the selection only applies to the next write
+                m_default_writer.clear_selection();
+                return writer;
+            },
+            {".gexf"});
+        netlist_writer_manager::register_writer(
+            "Binary Edge List Writer",
+            [this]() {
+                auto writer = std::make_unique<GexfWriter>(m_default_writer);
+                writer->set_output_format(GexfWriter::OutputFormat::edge_list);
+                // the selection only applies to the next write
+                m_default_writer.clear_selection();
+                return writer;
+            },
+            {".edges"});
     }
 
     void GexfWriterPlugin::on_unload()
     {
         netlist_writer_manager::unregister_writer("Default GEXF Writer");
+        netlist_writer_manager::unregister_writer("Binary Edge List Writer");
+    }
+
+    ProgramOptions GexfWriterPlugin::get_cli_options() const
+    {
+        ProgramOptions description;
+
+        description.add("--gexf-module", "restrict '.gexf' and '.edges' output to the gates of the module with the given ID and its submodules", {ProgramOptions::A_REQUIRED_PARAMETER});
+
+        description.add("--gexf-gate-types", "restrict '.gexf' and '.edges' output to gates of the given comma-separated gate types", {ProgramOptions::A_REQUIRED_PARAMETER});
+
+        description.add("--gexf-neighborhood",
+                        "restrict '.gexf' and '.edges' output to gates within the given number of hops from the given comma-separated gate IDs",
+                        {ProgramOptions::A_REQUIRED_PARAMETER, ProgramOptions::A_REQUIRED_PARAMETER});
+
+        return description;
+    }
+
+    bool GexfWriterPlugin::handle_cli_call(Netlist* netlist, ProgramArguments& args)
+    {
+        UNUSED(netlist);
+
+        m_default_writer.clear_selection();
+
+        if (args.is_option_set("--gexf-module"))
+        {
+            u32 module_id = 0;
+            if (!parse_u32(args.get_parameter("--gexf-module"), module_id))
+            {
+                log_error("gexf_writer", "invalid module ID '{}' for option '--gexf-module'.", args.get_parameter("--gexf-module"));
+                return false;
+            }
+            m_default_writer.select_module(module_id);
+        }
+
+        if (args.is_option_set("--gexf-gate-types"))
+        {
+            std::set<std::string> gate_types;
+            for (const std::string& gate_type : utils::split(args.get_parameter("--gexf-gate-types"), ','))
+            {
+                if (const std::string trimmed = utils::trim(gate_type); !trimmed.empty())
+                {
+                    gate_types.insert(trimmed);
+                }
+            }
+            m_default_writer.select_gate_types(gate_types);
+        }
+
+        if (args.is_option_set("--gexf-neighborhood"))
+        {
+            const std::vector<std::string> params = args.get_parameters("--gexf-neighborhood");
+            std::vector<u32> gate_ids;
+            u32 hops = 0;
+            for (const std::string& gate_id : utils::split(params.at(0), ','))
+            {
+                u32 id = 0;
+                if (!parse_u32(utils::trim(gate_id), id))
+                {
+                    log_error("gexf_writer", "invalid gate ID '{}' for option '--gexf-neighborhood'.", gate_id);
+                    return false;
+                }
+                gate_ids.push_back(id);
+            }
+            if (params.size() < 2 || !parse_u32(params.at(1), hops))
+            {
+                log_error("gexf_writer", "invalid number of hops for option '--gexf-neighborhood'.");
+                return false;
+            }
+            m_default_writer.select_neighborhood(gate_ids, hops);
+        }
+
+        return true;
+    }
+
+    GexfWriter* GexfWriterPlugin::get_default_writer()
+    {
+        return &m_default_writer;
     }
 }    // namespace hal
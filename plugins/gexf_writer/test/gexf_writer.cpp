@@ -0,0 +1,324 @@
+#include "gexf_writer/gexf_writer.h"
+#include "gexf_writer/plugin_gexf_writer.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist_writer/netlist_writer_manager.h"
+#include "hal_core/utilities/program_arguments.h"
+#include "netlist_test_utils.h"
+
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <tuple>
+
+namespace hal
+{
+    class GexfWriterTest : public ::testing::Test
+    {
+    protected:
+        // (source gate ID, destination gate ID, net ID)
+        using Edge = std::tuple<u32, u32, u32>;
+
+        std::unique_ptr<Netlist> m_nl;
+        std::vector<Gate*> m_gates;
+        Module* m_sub_module;
+
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+            test_utils::create_sandbox_directory();
+
+            /*
+             *  a --= BUF (0) =-- n1 --.                     .--= BUF (3) =-- y
+             *                         AND2 (1) =-- n3 --+
+             *  b --= INV (2) =-- n2 --'                     '--= INV (4) =-- z
+             *
+             *  module 'sub' contains gates 1 and 3, its submodule 'inner' contains gate 3
+             */
+            m_nl                  = test_utils::create_empty_netlist();
+            const GateLibrary* gl = m_nl->get_gate_library();
+
+            m_gates.push_back(m_nl->create_gate(gl->get_gate_type_by_name("BUF"), "buf_0"));
+            m_gates.push_back(m_nl->create_gate(gl->get_gate_type_by_name("AND2"), "and_1"));
+            m_gates.push_back(m_nl->create_gate(gl->get_gate_type_by_name("INV"), "inv_2"));
+            m_gates.push_back(m_nl->create_gate(gl->get_gate_type_by_name("BUF"), "buf_3"));
+            // an ID with four distinct bytes to check the byte order of the binary output
+            m_gates.push_back(m_nl->create_gate(0x01020304, gl->get_gate_type_by_name("INV"), "inv_4"));
+
+            test_utils::connect_global_in(m_nl.get(), m_gates.at(0), "I", "a");
+            test_utils::connect_global_in(m_nl.get(), m_gates.at(2), "I", "b");
+            test_utils::connect(m_nl.get(), m_gates.at(0), "O", m_gates.at(1), "I0", "n1");
+            test_utils::connect(m_nl.get(), m_gates.at(2), "O", m_gates.at(1), "I1", "n2");
+            Net* n3 = test_utils::connect(m_nl.get(), m_gates.at(1), "O", m_gates.at(3), "I", "n3");
+            n3->add_destination(m_gates.at(4), "I");
+            test_utils::connect_global_out(m_nl.get(), m_gates.at(3), "O", "y");
+            test_utils::connect_global_out(m_nl.get(), m_gates.at(4), "O", "z");
+
+            m_sub_module = m_nl->create_module("sub", m_nl->get_top_module(), {m_gates.at(1), m_gates.at(3)});
+            m_nl->create_module("inner", m_sub_module, {m_gates.at(3)});
+        }
+
+        virtual void TearDown()
+        {
+            test_utils::remove_sandbox_directory();
+        }
+
+        std::string read_file(const std::filesystem::path& path)
+        {
+            std::ifstream ifs(path, std::ios::binary);
+            std::stringstream ss;
+            ss << ifs.rdbuf();
+            return ss.str();
+        }
+
+        std::vector<u32> read_u32s(const std::filesystem::path& path)
+        {
+            const std::string content = read_file(path);
+            EXPECT_EQ(content.size() % 4, 0);
+
+            std::vector<u32> values;
+            for (u32 i = 0; i + 4 <= content.size(); i += 4)
+            {
+                values.push_back((u32)(u8)content[i] | ((u32)(u8)content[i + 1] << 8) | ((u32)(u8)content[i + 2] << 16) | ((u32)(u8)content[i + 3] << 24));
+            }
+            return values;
+        }
+
+        // all edges of an edge list file
+        std::set<Edge> read_edge_list(const std::filesystem::path& path)
+        {
+            const std::vector<u32> edges = read_u32s(path);
+            const std::vector<u32> nodes = read_u32s(path.string() + ".nodes");
+            const std::vector<u32> nets  = read_u32s(path.string() + ".nets");
+            EXPECT_EQ(edges.size(), 2 * nets.size());
+
+            std::set<Edge> res;
+            for (u32 i = 0; i < nets.size() && 2 * i + 1 < edges.size(); i++)
+            {
+                res.insert({nodes.at(edges.at(2 * i)), nodes.at(edges.at(2 * i + 1)), nets.at(i)});
+            }
+            return res;
+        }
+
+        // IDs of all nodes in an edge list file
+        std::set<u32> read_nodes(const std::filesystem::path& path)
+        {
+            const std::vector<u32> nodes = read_u32s(path.string() + ".nodes");
+            return std::set<u32>(nodes.begin(), nodes.end());
+        }
+
+        std::set<u32> get_ids(const std::vector<u32>& indices)
+        {
+            std::set<u32> res;
+            for (u32 i : indices)
+            {
+                res.insert(m_gates.at(i)->get_id());
+            }
+            return res;
+        }
+
+        Edge get_edge(u32 src, u32 dst, const std::string& net_name)
+        {
+            return {m_gates.at(src)->get_id(), m_gates.at(dst)->get_id(), m_nl->get_nets([&net_name](const Net* n) { return n->get_name() == net_name; }).front()->get_id()};
+        }
+    };
+
+    /**
+     * Testing the byte layout of the binary edge list and reading it back.
+     *
+     * Functions: write, set_output_format
+     */
+    TEST_F(GexfWriterTest, check_edge_list)
+    {
+        TEST_START
+        {
+            std::filesystem::path path = test_utils::create_sandbox_path("netlist.edges");
+            GexfWriter writer;
+            writer.set_output_format(GexfWriter::OutputFormat::edge_list);
+            auto res = writer.write(m_nl.get(), path);
+            ASSERT_TRUE(res.is_ok()) << res.get_error().get();
+
+            // node indices follow the order of the gates in the netlist, every value is a little-endian u32
+            const std::string nodes = read_file(path.string() + ".nodes");
+            ASSERT_EQ(nodes.size(), 4 * m_gates.size());
+            for (u32 i = 0; i < m_gates.size(); i++)
+            {
+                EXPECT_EQ(read_u32s(path.string() + ".nodes").at(i), m_gates.at(i)->get_id());
+            }
+            EXPECT_EQ(nodes.substr(16, 4), std::string("\x04\x03\x02\x01", 4));
+
+            // one pair of node indices per edge and one net ID per edge, nets without selected sources or destinations are left out
+            EXPECT_EQ(read_file(path).size(), 2 * 4 * 4);
+            EXPECT_EQ(read_file(path.string() + ".nets").size(), 4 * 4);
+
+            const std::set<Edge> expected = {get_edge(0, 1, "n1"), get_edge(2, 1, "n2"), get_edge(1, 3, "n3"), get_edge(1, 4, "n3")};
+            EXPECT_EQ(read_edge_list(path), expected);
+        }
+        {
+            // no files are left behind if any of them cannot be opened
+            std::filesystem::path path = test_utils::create_sandbox_path("blocked.edges");
+            std::filesystem::create_directory(path.string() + ".nets");
+            GexfWriter writer;
+            writer.set_output_format(GexfWriter::OutputFormat::edge_list);
+            EXPECT_TRUE(writer.write(m_nl.get(), path).is_error());
+            EXPECT_FALSE(std::filesystem::exists(path));
+            EXPECT_FALSE(std::filesystem::exists(path.string() + ".nodes"));
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the restriction of the output to a module and its submodules.
+     *
+     * Functions: select_module, clear_selection
+     */
+    TEST_F(GexfWriterTest, check_select_module)
+    {
+        TEST_START
+        {
+            std::filesystem::path path = test_utils::create_sandbox_path("module.edges");
+            GexfWriter writer;
+            writer.set_output_format(GexfWriter::OutputFormat::edge_list);
+            writer.select_module(m_sub_module->get_id());
+            ASSERT_TRUE(writer.write(m_nl.get(), path).is_ok());
+
+            EXPECT_EQ(read_nodes(path), get_ids({1, 3}));
+            EXPECT_EQ(read_edge_list(path), std::set<Edge>{get_edge(1, 3, "n3")});
+
+            // the same selection applies to GEXF files
+            std::filesystem::path gexf_path = test_utils::create_sandbox_path("module.gexf");
+            writer.set_output_format(GexfWriter::OutputFormat::gexf);
+            ASSERT_TRUE(writer.write(m_nl.get(), gexf_path).is_ok());
+            const std::string gexf = read_file(gexf_path);
+            EXPECT_NE(gexf.find("<node id=\"" + std::to_string(m_gates.at(1)->get_id()) + "\""), std::string::npos);
+            EXPECT_EQ(gexf.find("<node id=\"" + std::to_string(m_gates.at(0)->get_id()) + "\""), std::string::npos);
+            EXPECT_NE(gexf.find("<edge source=\"" + std::to_string(m_gates.at(1)->get_id()) + "\" target=\"" + std::to_string(m_gates.at(3)->get_id()) + "\""), std::string::npos);
+            EXPECT_EQ(gexf.find("<edge source=\"" + std::to_string(m_gates.at(0)->get_id())), std::string::npos);
+
+            // unknown modules are rejected
+            writer.select_module(1000);
+            EXPECT_TRUE(writer.write(m_nl.get(), gexf_path).is_error());
+
+            // without a selection, the entire netlist is written
+            writer.clear_selection();
+            writer.set_output_format(GexfWriter::OutputFormat::edge_list);
+            ASSERT_TRUE(writer.write(m_nl.get(), path).is_ok());
+            EXPECT_EQ(read_nodes(path), get_ids({0, 1, 2, 3, 4}));
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the restriction of the output to gate types, also in combination with a module.
+     *
+     * Functions: select_gate_types, select_module
+     */
+    TEST_F(GexfWriterTest, check_select_gate_types)
+    {
+        TEST_START
+        {
+            std::filesystem::path path = test_utils::create_sandbox_path("types.edges");
+            GexfWriter writer;
+            writer.set_output_format(GexfWriter::OutputFormat::edge_list);
+
+            writer.select_gate_types({"INV", "AND2"});
+            ASSERT_TRUE(writer.write(m_nl.get(), path).is_ok());
+            EXPECT_EQ(read_nodes(path), get_ids({1, 2, 4}));
+            const std::set<Edge> expected = {get_edge(2, 1, "n2"), get_edge(1, 4, "n3")};
+            EXPECT_EQ(read_edge_list(path), expected);
+
+            writer.select_gate_types({"BUF"});
+            writer.select_module(m_sub_module->get_id());
+            ASSERT_TRUE(writer.write(m_nl.get(), path).is_ok());
+            EXPECT_EQ(read_nodes(path), get_ids({3}));
+            EXPECT_TRUE(read_edge_list(path).empty());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the restriction of the output to the neighborhood of seed gates.
+     *
+     * Functions: select_neighborhood, select_gate_types
+     */
+    TEST_F(GexfWriterTest, check_select_neighborhood)
+    {
+        TEST_START
+        {
+            std::filesystem::path path = test_utils::create_sandbox_path("neighborhood.edges");
+            GexfWriter writer;
+            writer.set_output_format(GexfWriter::OutputFormat::edge_list);
+
+            writer.select_neighborhood({m_gates.at(0)->get_id()}, 0);
+            ASSERT_TRUE(writer.write(m_nl.get(), path).is_ok());
+            EXPECT_EQ(read_nodes(path), get_ids({0}));
+
+            // nets are traversed in both directions
+            writer.select_neighborhood({m_gates.at(0)->get_id()}, 1);
+            ASSERT_TRUE(writer.write(m_nl.get(), path).is_ok());
+            EXPECT_EQ(read_nodes(path), get_ids({0, 1}));
+
+            writer.select_neighborhood({m_gates.at(0)->get_id()}, 2);
+            ASSERT_TRUE(writer.write(m_nl.get(), path).is_ok());
+            EXPECT_EQ(read_nodes(path), get_ids({0, 1, 2, 3, 4}));
+
+            writer.select_neighborhood({m_gates.at(3)->get_id(), m_gates.at(2)->get_id()}, 1);
+            writer.select_gate_types({"AND2", "BUF"});
+            ASSERT_TRUE(writer.write(m_nl.get(), path).is_ok());
+            EXPECT_EQ(read_nodes(path), get_ids({1, 3}));
+
+            // unknown seed gates are rejected
+            writer.select_neighborhood({1000}, 1);
+            EXPECT_TRUE(writer.write(m_nl.get(), path).is_error());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that the command line options of the plugin configure the writers created by the netlist writer manager.
+     *
+     * Functions: handle_cli_call, get_default_writer
+     */
+    TEST_F(GexfWriterTest, check_plugin_options)
+    {
+        TEST_START
+        {
+            GexfWriterPlugin plugin;
+            plugin.on_load();
+
+            std::filesystem::path path = test_utils::create_sandbox_path("cli.edges");
+            ProgramArguments args;
+            args.set_option("--gexf-gate-types", "INV, BUF");
+            args.set_option("--gexf-neighborhood", std::vector<std::string>({std::to_string(m_gates.at(2)->get_id()), "2"}));
+            ASSERT_TRUE(plugin.handle_cli_call(m_nl.get(), args));
+            ASSERT_TRUE(netlist_writer_manager::write(m_nl.get(), path));
+            EXPECT_EQ(read_nodes(path), get_ids({0, 2, 3, 4}));
+
+            // every call replaces the previous selection
+            ProgramArguments module_args;
+            module_args.set_option("--gexf-module", std::to_string(m_sub_module->get_id()));
+            ASSERT_TRUE(plugin.handle_cli_call(m_nl.get(), module_args));
+            ASSERT_TRUE(netlist_writer_manager::write(m_nl.get(), path));
+            EXPECT_EQ(read_nodes(path), get_ids({1, 3}));
+
+            // the selection is reset after each write
+            ASSERT_TRUE(netlist_writer_manager::write(m_nl.get(), path));
+            EXPECT_EQ(read_nodes(path), get_ids({0, 1, 2, 3, 4}));
+
+            // the default writer can also be configured directly
+            plugin.get_default_writer()->select_gate_types({"INV"});
+            ASSERT_TRUE(netlist_writer_manager::write(m_nl.get(), path));
+            EXPECT_EQ(read_nodes(path), get_ids({2, 4}));
+
+            ProgramArguments invalid_args;
+            invalid_args.set_option("--gexf-module", "sub");
+            EXPECT_FALSE(plugin.handle_cli_call(m_nl.get(), invalid_args));
+
+            plugin.on_unload();
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -148,6 +148,18 @@ namespace hal
          */
         void fileAboutToClose(const QString& fileName);
 
+        /**
+         * Q_SIGNAL that is emitted when an autosave has been started in the background.
+         */
+        void autosaveStarted();
+
+        /**
+         * Q_SIGNAL that is emitted when the background autosave has finished.
+         *
+         * @param success - True if the autosave was successful, false otherwise.
+         */
+        void autosaveFinished(bool success);
+
     public Q_SLOTS:
 
         /**
@@ -36,6 +36,7 @@
 #include <QLayout>
 #include <QMenuBar>
 #include <QObject>
+#include <QProgressBar>
 #include <QSplitter>
 #include <QStackedWidget>
 #include <QToolBar>
@@ -374,6 +375,18 @@ namespace hal
          */
         void handleProjectOpened(const QString& projDir, const QString& fileName);
 
+        /**
+         * Q_SLOT to show the autosave indicator while an autosave is running in the background.
+         */
+        void handleAutosaveStarted();
+
+        /**
+         * Q_SLOT to hide the autosave indicator once the background autosave has finished.
+         *
+         * @param success - True if the autosave was successful, false otherwise.
+         */
+        void handleAutosaveFinished(bool success);
+
         /**
          * Q_SLOT to save the current project as a .hal file.
          * call to FileManager::emitSaveTriggered().
@@ -483,6 +496,8 @@ namespace hal
         QHBoxLayout* mToolBarLayout;
         QToolBar* mLeftToolBar;
         QToolBar* mRightToolBar;
+        QProgressBar* mAutosaveIndicator;
+        QAction* mAutosaveIndicatorAction;
         ContentLayoutArea* mLayoutArea;
 
         Action* mActionNew;
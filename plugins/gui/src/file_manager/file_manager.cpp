@@ -90,7 +90,12 @@ namespace hal
         if (pm->get_project_status() != ProjectManager::None && mAutosaveEnabled)
         {
             log_info("gui", "saving a backup in case something goes wrong...");
-            ProjectManager::instance()->serialize_project(gNetlist, true);
+            // netlist gets encoded and written by a worker thread, result is passed back to the UI thread
+            bool started = pm->start_autosave(gNetlist, [this](bool success) {
+                QMetaObject::invokeMethod(this, [this, success]() { Q_EMIT autosaveFinished(success); }, Qt::QueuedConnection);
+            });
+            if (started)
+                Q_EMIT autosaveStarted();
         }
     }
 
@@ -562,6 +567,7 @@ namespace hal
         mFileName = "";
         mFileOpen = false;
 
+        ProjectManager::instance()->discard_journal();
         removeShadowDirectory();
 
         gNetlistOwner.reset();
@@ -56,6 +56,8 @@ namespace hal
         ensurePolished();    // ADD REPOLISH METHOD
         connect(FileManager::get_instance(), &FileManager::fileOpened, this, &MainWindow::handleFileOpened);
         connect(FileManager::get_instance(), &FileManager::projectOpened, this, &MainWindow::handleProjectOpened);
+        connect(FileManager::get_instance(), &FileManager::autosaveStarted, this, &MainWindow::handleAutosaveStarted);
+        connect(FileManager::get_instance(), &FileManager::autosaveFinished, this, &MainWindow::handleAutosaveFinished);
 
         mLayout = new QVBoxLayout(this);
         mLayout->setContentsMargins(0, 0, 0, 0);
@@ -239,6 +241,13 @@ namespace hal
         mLeftToolBar->addAction(mActionSave);
         mLeftToolBar->addAction(mActionSaveAs);
         mLeftToolBar->addAction(mActionUndo);
+        mAutosaveIndicator = new QProgressBar();
+        mAutosaveIndicator->setRange(0, 0);
+        mAutosaveIndicator->setTextVisible(false);
+        mAutosaveIndicator->setFixedWidth(60);
+        mAutosaveIndicator->setToolTip("Autosave in progress");
+        mAutosaveIndicatorAction = mRightToolBar->addWidget(mAutosaveIndicator);
+        mAutosaveIndicatorAction->setVisible(false);
         mRightToolBar->addAction(mActionSettings);
 
         mActionStartRecording->setText("Start recording");
@@ -657,6 +666,18 @@ namespace hal
         handleFileOpened(fileName);
     }
 
+    void MainWindow::handleAutosaveStarted()
+    {
+        mAutosaveIndicatorAction->setVisible(true);
+    }
+
+    void MainWindow::handleAutosaveFinished(bool success)
+    {
+        mAutosaveIndicatorAction->setVisible(false);
+        if (!success)
+            log_warning("gui", "autosave failed, next autosave will write the entire netlist.");
+    }
+
     void MainWindow::handleFileOpened(const QString& fileName)
     {
         Q_UNUSED(fileName)
@@ -472,6 +472,8 @@ namespace hal
                 Q_EMIT moduleGatesRemoveEnd(mod, associated_data);
                 break;
             }
+            default:
+                break;
         }
     }
 
@@ -622,6 +624,8 @@ namespace hal
                 Q_EMIT netDestinationRemoved(net, associated_data);
                 break;
             }
+            default:
+                break;
         }
     }
 
@@ -8,8 +8,8 @@
 #include "hal_core/netlist/gate_library/gate_type_component/lut_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #include "hal_core/utilities/result.h"
-#include "rapidjson/filereadstream.h"
 #include "rapidjson/stringbuffer.h"
 
 namespace hal
@@ -18,17 +18,15 @@ namespace hal
     {
         m_path = file_path;
 
-        FILE* fp = fopen(file_path.string().c_str(), "r");
-        if (fp == NULL)
+        // compressed files are detected by their magic bytes and decompressed transparently
+        auto file = MemoryMappedFile::open(file_path);
+        if (file.is_error())
         {
-            return ERR("could not parse HGL file '" + m_path.string() + "' : unable to open file");
+            return ERR_APPEND(file.get_error(), "could not parse HGL file '" + m_path.string() + "' : unable to open file");
         }
 
-        char buffer[65536];
-        rapidjson::FileReadStream is(fp, buffer, sizeof(buffer));
         rapidjson::Document document;
-        document.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(is);
-        fclose(fp);
+        document.Parse(file.get()->get_data().data(), file.get()->get_data().size());
 
         if (document.HasParseError())
         {
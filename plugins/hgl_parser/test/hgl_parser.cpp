@@ -1,5 +1,6 @@
 #include "hgl_parser/hgl_parser.h"
 
+#include "hal_core/utilities/compression.h"
 #include "gate_library_test_utils.h"
 #include "netlist_test_utils.h"
 
@@ -11,10 +12,12 @@ namespace hal
         virtual void SetUp()
         {
             test_utils::init_log_channels();
+            test_utils::create_sandbox_directory();
         }
 
         virtual void TearDown()
         {
+            test_utils::remove_sandbox_directory();
         }
     };
 
@@ -41,4 +44,40 @@ namespace hal
         }
         TEST_END
     }
+
+    /**
+     * Testing parsing a gzip- or zstd-compressed HGL file.
+     *
+     * Functions: parse
+     */
+    TEST_F(HGLParserTest, check_compressed_library)
+    {
+        TEST_START
+        {
+            std::string path_lib = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/test.hgl";
+            std::ifstream ifs(path_lib, std::ios::binary);
+            std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+            ASSERT_FALSE(contents.empty());
+
+            for (const auto& [format, file_name] : std::vector<std::pair<CompressionFormat, std::string>>{{CompressionFormat::gzip, "test.hgl.gz"}, {CompressionFormat::zstd, "test.hgl.zst"}})
+            {
+                if (!compression::is_supported(format))
+                {
+                    continue;
+                }
+
+                std::filesystem::path compressed_lib = test_utils::create_sandbox_path(file_name);
+                ASSERT_TRUE(compression::write_file(compressed_lib, contents, format).is_ok());
+
+                HGLParser parser;
+                auto gl_res = parser.parse(compressed_lib);
+                ASSERT_TRUE(gl_res.is_ok());
+                std::unique_ptr<GateLibrary> gl_parsed = gl_res.get();
+                ASSERT_NE(gl_parsed.get(), nullptr);
+
+                EXPECT_TRUE(test_utils::gate_libraries_are_equal(gl_parsed.get(), test_utils::get_gate_library()));
+            }
+        }
+        TEST_END
+    }
 }    //namespace hal
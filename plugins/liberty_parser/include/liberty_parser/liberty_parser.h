@@ -31,11 +31,15 @@
 #include "hal_core/netlist/gate_library/enums/pin_direction.h"
 #include "hal_core/netlist/gate_library/gate_library_parser/gate_library_parser.h"
 #include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/gate_library/gate_type_component/timing_component.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #include "hal_core/utilities/token_stream.h"
 
+#include <deque>
 #include <filesystem>
 #include <map>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
 
 namespace hal
@@ -46,7 +50,13 @@ namespace hal
     class NETLIST_API LibertyParser : public GateLibraryParser
     {
     public:
-        LibertyParser()  = default;
+        /**
+         * Construct a Liberty parser.
+         * Timing information is only captured on request since most gate libraries contain a large number of lookup tables that are not required for netlist analysis.
+         *
+         * @param[in] capture_timing - Set true to capture timing arcs, NLDM lookup tables, pin capacitances, leakage power, and area in a TimingComponent of every gate type, false otherwise.
+         */
+        LibertyParser(bool capture_timing = false);
         ~LibertyParser() = default;
 
         /**
@@ -62,6 +72,10 @@ namespace hal
          * <category> and <identifier> refer to the location where the LUT configuration string is stored, for example "generic" and "init".
          * direction describes whether the least significant bit of the configuration is the output for inputs 000... (ascending) or 111... (descending).
          *
+         * Cells are parsed concurrently, the resulting gate types are created in the order of the file.
+         * If timing capture is enabled, the 'cell_rise', 'cell_fall', 'rise_transition', and 'fall_transition' tables of all 'timing' groups are stored together with the 'related_pin', 'timing_sense', and 'timing_type' attributes.
+         * Values are stored in the units of the library.
+         *
          * @param[in] file_path - Path to the file containing the gate library definition.
          * @returns The gate library on success, an error otherwise.
          */
@@ -89,6 +103,8 @@ namespace hal
             bool clock  = false;
             bool power  = false;
             bool ground = false;
+            std::optional<double> capacitance;
+            std::vector<TimingComponent::TimingArc> timing_arcs;
         };
 
         struct bus_group
@@ -147,32 +163,51 @@ namespace hal
             std::vector<pin_group> pins;
             std::map<std::string, bus_group> buses;
             std::set<std::string> pin_names;
+            std::optional<double> area;
+            std::optional<double> leakage_power;
+        };
+
+        // everything required to create a gate type that can be computed independently of the gate library
+        struct prepared_cell
+        {
+            cell_group cell;
+            std::unique_ptr<GateTypeComponent> component;
+            std::unordered_map<std::string, BooleanFunction> functions;
         };
 
         std::unique_ptr<GateLibrary> m_gate_lib;
-        std::stringstream m_fs;
+        std::unique_ptr<MemoryMappedFile> m_file;
         std::filesystem::path m_path;
+        bool m_capture_timing;
+
+        // tokens reference the memory-mapped file or m_token_storage
+        TokenStream<std::string_view> m_token_stream;
+        std::deque<std::string> m_token_storage;
 
-        TokenStream<std::string> m_token_stream;
+        // library-level definitions, read-only while cells are parsed
         std::map<std::string, type_group> m_bus_types;
-        std::set<std::string> m_cell_names;
+        std::map<std::string, TimingComponent::LookupTable> m_table_templates;
 
-        void tokenize();
+        void tokenize(std::string_view data);
         Result<std::monostate> parse_tokens();
 
-        Result<cell_group> parse_cell(TokenStream<std::string>& library_stream);
-        Result<type_group> parse_type(TokenStream<std::string>& str);
-        Result<pin_group> parse_pin(TokenStream<std::string>& str, cell_group& cell, PinDirection direction = PinDirection::none, const std::string& external_pin_name = "");
-        Result<pin_group> parse_pg_pin(TokenStream<std::string>& str, cell_group& cell);
-        Result<bus_group> parse_bus(TokenStream<std::string>& str, cell_group& cell);
-        Result<ff_group> parse_ff(TokenStream<std::string>& str);
-        Result<latch_group> parse_latch(TokenStream<std::string>& str);
-        Result<std::monostate> construct_gate_type(cell_group&& cell);
-
-        void remove_comments(std::string& line, bool& multi_line_comment);
-        std::vector<std::string> tokenize_function(const std::string& function);
-        std::map<std::string, std::string> expand_bus_function(const std::map<std::string, bus_group>& buses, const std::vector<std::string>& pin_names, const std::string& function);
-        std::string prepare_pin_function(const std::map<std::string, bus_group>& buses, const std::string& function);
-        Result<std::unordered_map<std::string, BooleanFunction>> construct_bus_functions(const cell_group& cell);
+        Result<cell_group> parse_cell(TokenStream<std::string_view>& str) const;
+        Result<type_group> parse_type(TokenStream<std::string_view>& str) const;
+        Result<std::pair<std::string, TimingComponent::LookupTable>> parse_table_template(TokenStream<std::string_view>& str) const;
+        Result<pin_group> parse_pin(TokenStream<std::string_view>& str, cell_group& cell, PinDirection direction = PinDirection::none, const std::string& external_pin_name = "") const;
+        Result<pin_group> parse_pg_pin(TokenStream<std::string_view>& str, cell_group& cell) const;
+        Result<bus_group> parse_bus(TokenStream<std::string_view>& str, cell_group& cell) const;
+        Result<ff_group> parse_ff(TokenStream<std::string_view>& str) const;
+        Result<latch_group> parse_latch(TokenStream<std::string_view>& str) const;
+        Result<std::vector<TimingComponent::TimingArc>> parse_timing(TokenStream<std::string_view>& str) const;
+        Result<TimingComponent::LookupTable> parse_lookup_table(TokenStream<std::string_view>& str) const;
+        Result<std::monostate> parse_table_attributes(TokenStream<std::string_view>& table_str, TimingComponent::LookupTable& table) const;
+        Result<prepared_cell> prepare_gate_type(cell_group&& cell) const;
+        Result<std::monostate> construct_gate_type(prepared_cell&& prepared);
+
+        std::vector<std::string> tokenize_function(const std::string& function) const;
+        std::map<std::string, std::string> expand_bus_function(const std::map<std::string, bus_group>& buses, const std::vector<std::string>& pin_names, const std::string& function) const;
+        std::string prepare_pin_function(const std::map<std::string, bus_group>& buses, const std::string& function) const;
+        Result<std::unordered_map<std::string, BooleanFunction>> construct_bus_functions(const cell_group& cell) const;
     };
 }    // namespace hal
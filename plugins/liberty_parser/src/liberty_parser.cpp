@@ -4,30 +4,120 @@
 #include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel_for_each.h"
 
-#include <fstream>
+#include <cstdlib>
 
 // TODO remove LUT parsing
 
 namespace hal
 {
-    Result<std::unique_ptr<GateLibrary>> LibertyParser::parse(const std::filesystem::path& file_path)
+    namespace
     {
-        m_path = file_path;
+        std::optional<double> to_double(std::string_view str)
+        {
+            const std::string tmp(str);
+            char* end         = nullptr;
+            const double res  = std::strtod(tmp.c_str(), &end);
+            if (tmp.empty() || end != tmp.c_str() + tmp.size())
+            {
+                return std::nullopt;
+            }
+            return res;
+        }
+
+        // parse a simple attribute holding a number, i.e., ': <number>;'
+        Result<double> parse_number_attribute(TokenStream<std::string_view>& str)
+        {
+            str.consume(":", true);
+            const Token<std::string_view> value_str = str.consume();
+            str.consume(";", true);
+
+            if (const auto value = to_double(value_str.string); value.has_value())
+            {
+                return OK(value.value());
+            }
+            return ERR("invalid number '" + std::string(value_str.string) + "' (line " + std::to_string(value_str.number) + ")");
+        }
+
+        // parse a complex attribute holding a list of numbers, i.e., '("<number>, <number>, ...", ...);'
+        Result<std::vector<double>> parse_number_list(TokenStream<std::string_view>& str)
+        {
+            str.consume("(", true);
+            TokenStream<std::string_view> list_str = str.extract_until(")", TokenStream<std::string_view>::END_OF_STREAM, true, true);
+            str.consume(")", true);
+            str.consume(";");
+
+            std::vector<double> res;
+            while (list_str.remaining() > 0)
+            {
+                const Token<std::string_view> next_token = list_str.consume();
+                if (next_token == ",")
+                {
+                    continue;
+                }
+
+                std::string_view remaining = next_token.string;
+                while (!remaining.empty())
+                {
+                    const u64 begin = remaining.find_first_not_of(", \t\r\n");
+                    if (begin == std::string_view::npos)
+                    {
+                        break;
+                    }
+                    remaining.remove_prefix(begin);
+                    const u64 end = std::min(remaining.find_first_of(", \t\r\n"), remaining.size());
+                    if (const auto value = to_double(remaining.substr(0, end)); value.has_value())
+                    {
+                        res.push_back(value.value());
+                    }
+                    else
+                    {
+                        return ERR("invalid number '" + std::string(remaining.substr(0, end)) + "' (line " + std::to_string(next_token.number) + ")");
+                    }
+                    remaining.remove_prefix(end);
+                }
+            }
+            return OK(res);
+        }
 
+        // skip a group or complex attribute, i.e., '(...) {...}' or '(...);'
+        void skip_group(TokenStream<std::string_view>& str)
         {
-            std::ifstream ifs;
-            ifs.open(m_path.string(), std::ifstream::in);
-            if (!ifs.is_open())
+            str.consume("(", true);
+            str.consume_until(")");
+            str.consume(")", true);
+            if (str.consume("{"))
+            {
+                str.consume_until("}");
+                str.consume("}", true);
+            }
+            else
             {
-                return ERR("could not parse Liberty file '" + m_path.string() + "' : unable to open file");
+                str.consume(";");
             }
-            m_fs << ifs.rdbuf();
-            ifs.close();
+        }
+    }    // namespace
+
+    LibertyParser::LibertyParser(bool capture_timing) : m_capture_timing(capture_timing)
+    {
+    }
+
+    Result<std::unique_ptr<GateLibrary>> LibertyParser::parse(const std::filesystem::path& file_path)
+    {
+        m_path = file_path;
+
+        if (auto res = MemoryMappedFile::open(m_path); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not parse Liberty file '" + m_path.string() + "' : unable to open file");
+        }
+        else
+        {
+            m_file = res.get();
         }
 
         // tokenize file
-        tokenize();
+        tokenize(m_file->get_data());
 
         // parse tokens into intermediate format
         try
@@ -37,7 +127,7 @@ namespace hal
                 return ERR_APPEND(res.get_error(), "could not parse Liberty file '" + file_path.string() + "': unable to parse tokens");
             }
         }
-        catch (TokenStream<std::string>::TokenStreamException& e)
+        catch (TokenStream<std::string_view>::TokenStreamException& e)
         {
             if (e.line_number != (u32)-1)
             {
@@ -49,68 +139,153 @@ namespace hal
             }
         }
 
+        // the gate library owns all of its strings, so the tokens and the mapped file are no longer needed
+        m_token_stream = TokenStream<std::string_view>();
+        m_token_storage.clear();
+        m_file.reset();
+
         return OK(std::move(m_gate_lib));
     }
 
-    void LibertyParser::tokenize()
+    void LibertyParser::tokenize(std::string_view data)
     {
-        std::string delimiters = "{}()[];:\",";
-        std::string current_token;
-        u32 line_number = 0;
+        const std::string_view delimiters = "{}()[];:\",";
 
-        std::string line;
-        bool in_string          = false;
-        bool was_in_string      = false;
-        bool multi_line_comment = false;
+        // the current token references the input directly unless its characters are not contiguous within the input (e.g., due to whitespace or comments within the token)
+        const char* token_begin = nullptr;
+        u32 token_size          = 0;
+        u32 token_line          = 0;
+        bool token_buffered     = false;
+        std::string token_buffer;
 
-        std::vector<Token<std::string>> parsed_tokens;
+        u32 line_number = 1;
+
+        const auto append_to_token = [&](const char* c) {
+            if (token_buffered)
+            {
+                token_buffer += *c;
+            }
+            else if (token_begin == nullptr)
+            {
+                token_begin = c;
+                token_size  = 1;
+                token_line  = line_number;
+            }
+            else if (token_begin + token_size == c)
+            {
+                token_size++;
+            }
+            else
+            {
+                token_buffer.assign(token_begin, token_size);
+                token_buffer += *c;
+                token_buffered = true;
+            }
+        };
+
+        const auto take_token = [&]() -> std::string_view {
+            std::string_view res;
+            if (token_buffered)
+            {
+                res = m_token_storage.emplace_back(std::move(token_buffer));
+                token_buffer.clear();
+                token_buffered = false;
+            }
+            else if (token_begin != nullptr)
+            {
+                res = std::string_view(token_begin, token_size);
+            }
+            token_begin = nullptr;
+            token_size  = 0;
+            return res;
+        };
+
+        bool in_string     = false;
+        bool was_in_string = false;
+        bool in_comment    = false;
+
+        std::vector<Token<std::string_view>> parsed_tokens;
+
+        const auto flush_token = [&]() {
+            if (token_begin != nullptr || was_in_string)
+            {
+                const u32 number = (token_begin != nullptr) ? token_line : line_number;
+                parsed_tokens.emplace_back(number, take_token());
+                was_in_string = false;
+            }
+        };
 
-        while (std::getline(m_fs, line))
+        const char* const end = data.data() + data.size();
+        for (const char* it = data.data(); it != end; it++)
         {
-            line_number++;
-            this->remove_comments(line, multi_line_comment);
+            const char c = *it;
 
-            for (char c : line)
+            if (in_comment)
             {
-                if (c == '\"')
+                if (c == '\n')
                 {
-                    was_in_string = true;
-                    in_string     = !in_string;
-                    continue;
+                    line_number++;
                 }
-
-                if (std::isspace(c) && !in_string)
+                else if (c == '*' && it + 1 != end && *(it + 1) == '/')
                 {
-                    continue;
+                    in_comment = false;
+                    it++;
                 }
+                continue;
+            }
 
-                if (delimiters.find(c) == std::string::npos || in_string)
+            if (in_string)
+            {
+                if (c == '\"')
                 {
-                    current_token += c;
+                    in_string = false;
+                    continue;
                 }
-                else
+                else if (c == '\n')
                 {
-                    if (was_in_string || !current_token.empty())
-                    {
-                        parsed_tokens.emplace_back(line_number, current_token);
-                        current_token.clear();
-                        was_in_string = false;
-                    }
+                    line_number++;
+                }
+                append_to_token(it);
+                continue;
+            }
 
-                    if (!std::isspace(c))
-                    {
-                        parsed_tokens.emplace_back(line_number, std::string(1, c));
-                    }
+            if (c == '/' && it + 1 != end && *(it + 1) == '*')
+            {
+                in_comment = true;
+                it++;
+                continue;
+            }
+
+            if (c == '\"')
+            {
+                in_string     = true;
+                was_in_string = true;
+                if (token_begin == nullptr)
+                {
+                    token_line = line_number;
                 }
+                continue;
+            }
+
+            // tokens end at delimiters and line breaks, other whitespace and line continuations are dropped
+            if (c == '\n')
+            {
+                flush_token();
+                line_number++;
+            }
+            else if (delimiters.find(c) != std::string_view::npos)
+            {
+                flush_token();
+                parsed_tokens.emplace_back(line_number, std::string_view(it, 1));
             }
-            if (!current_token.empty())
+            else if (!std::isspace(static_cast<unsigned char>(c)) && c != '\\')
             {
-                parsed_tokens.emplace_back(line_number, current_token);
-                current_token.clear();
+                append_to_token(it);
             }
         }
+        flush_token();
 
-        m_token_stream = TokenStream<std::string>(parsed_tokens, {"(", "{"}, {")", "}"});
+        m_token_stream = TokenStream<std::string_view>(std::move(parsed_tokens), {"(", "{"}, {")", "}"});
     }
 
     Result<std::monostate> LibertyParser::parse_tokens()
@@ -120,10 +295,14 @@ namespace hal
         auto lib_name = m_token_stream.consume();
         m_token_stream.consume(")", true);
         m_token_stream.consume("{", true);
-        m_gate_lib       = std::make_unique<GateLibrary>(m_path, lib_name.string);
-        auto library_str = m_token_stream.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, false);
+        m_gate_lib       = std::make_unique<GateLibrary>(m_path, std::string(lib_name.string));
+        auto library_str = m_token_stream.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, false);
         m_token_stream.consume("}", false);
 
+        // collect the token streams of all cells, they are parsed once all library-level definitions are known
+        std::vector<TokenStream<std::string_view>> cell_streams;
+        std::vector<u32> cell_line_numbers;
+
         do
         {
             auto next_token = library_str.consume();
@@ -134,17 +313,9 @@ namespace hal
             }
             else if (next_token == "cell" && library_str.peek() == "(")
             {
-                if (auto cell = parse_cell(library_str); cell.is_error())
-                {
-                    return ERR_APPEND(cell.get_error(), "could not parse tokens: unable to parse cell (line " + std::to_string(next_token.number) + ")");
-                }
-                else
-                {
-                    if (auto res = construct_gate_type(cell.get()); res.is_error())
-                    {
-                        return ERR_APPEND(res.get_error(), "could not parse tokens: unable to construct gate type (line " + std::to_string(next_token.number) + ")");
-                    }
-                }
+                cell_streams.push_back(library_str);
+                cell_line_numbers.push_back(next_token.number);
+                skip_group(library_str);
             }
             else if (next_token == "type" && library_str.peek() == "(")
             {
@@ -158,19 +329,91 @@ namespace hal
                     m_bus_types[type.name] = std::move(type);
                 }
             }
+            else if (m_capture_timing && next_token == "lu_table_template" && library_str.peek() == "(")
+            {
+                if (auto res = parse_table_template(library_str); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not parse tokens: unable to parse table template (line " + std::to_string(next_token.number) + ")");
+                }
+                else
+                {
+                    auto [name, table]      = res.get();
+                    m_table_templates[name] = std::move(table);
+                }
+            }
         } while (library_str.remaining() > 0);
 
-        if (const u32 unparsed = m_token_stream.remaining(); unparsed == 0)
+        if (const u32 unparsed = m_token_stream.remaining(); unparsed != 0)
         {
-            return OK({});
+            return ERR("could not parse tokens: " + std::to_string(unparsed) + " unparsed tokens remaining");
         }
-        else
+
+        // parse cells and build their components and Boolean functions concurrently
+        std::vector<prepared_cell> prepared_cells(cell_streams.size());
+        std::vector<Result<std::monostate>> cell_results;
+        for (u32 i = 0; i < cell_streams.size(); i++)
         {
-            return ERR("could not parse tokens: " + std::to_string(unparsed) + " unparsed tokens remaining");
+            cell_results.push_back(OK({}));
         }
+
+        utils::parallel_for_each(0, cell_streams.size(), [&](u32 i) {
+            const std::string line_str = " (line " + std::to_string(cell_line_numbers.at(i)) + ")";
+            try
+            {
+                auto cell = parse_cell(cell_streams.at(i));
+                if (cell.is_error())
+                {
+                    cell_results.at(i) = ERR_APPEND(cell.get_error(), "could not parse tokens: unable to parse cell" + line_str);
+                    return;
+                }
+
+                auto prepared = prepare_gate_type(cell.get());
+                if (prepared.is_error())
+                {
+                    cell_results.at(i) = ERR_APPEND(prepared.get_error(), "could not parse tokens: unable to construct gate type" + line_str);
+                    return;
+                }
+                prepared_cells.at(i) = prepared.get();
+            }
+            catch (TokenStream<std::string_view>::TokenStreamException& e)
+            {
+                if (e.line_number != (u32)-1)
+                {
+                    cell_results.at(i) = ERR("could not parse tokens: unable to parse cell" + line_str + ": " + e.message + " (line " + std::to_string(e.line_number) + ")");
+                }
+                else
+                {
+                    cell_results.at(i) = ERR("could not parse tokens: unable to parse cell" + line_str + ": " + e.message);
+                }
+            }
+        });
+
+        // create gate types in the order of the file
+        std::set<std::string> cell_names;
+        for (u32 i = 0; i < prepared_cells.size(); i++)
+        {
+            if (cell_results.at(i).is_error())
+            {
+                return std::move(cell_results.at(i));
+            }
+
+            const std::string& cell_name = prepared_cells.at(i).cell.name;
+            if (const auto cell_it = cell_names.find(cell_name); cell_it != cell_names.end())
+            {
+                return ERR("could not parse tokens: unable to parse cell (line " + std::to_string(cell_line_numbers.at(i)) + "): a cell with name '" + cell_name + "' already exists");
+            }
+            cell_names.insert(cell_name);
+
+            if (auto res = construct_gate_type(std::move(prepared_cells.at(i))); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not parse tokens: unable to construct gate type (line " + std::to_string(cell_line_numbers.at(i)) + ")");
+            }
+        }
+
+        return OK({});
     }
 
-    Result<LibertyParser::type_group> LibertyParser::parse_type(TokenStream<std::string>& str)
+    Result<LibertyParser::type_group> LibertyParser::parse_type(TokenStream<std::string_view>& str) const
     {
         type_group type;
         type.line_number = str.peek().number;
@@ -178,7 +421,7 @@ namespace hal
         type.name = str.consume().string;
         str.consume(")", true);
         str.consume("{", true);
-        auto type_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto type_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         type.start_index = 0;
@@ -205,12 +448,12 @@ namespace hal
             else if (next_token == "bit_width")
             {
                 type_str.consume(":", true);
-                type.width = std::stol(type_str.consume().string);
+                type.width = std::stol(std::string(type_str.consume().string));
             }
             else if (next_token == "bit_from")
             {
                 type_str.consume(":", true);
-                type.start_index = std::stol(type_str.consume().string);
+                type.start_index = std::stol(std::string(type_str.consume().string));
             }
             else if (next_token == "bit_to")
             {
@@ -230,36 +473,47 @@ namespace hal
                 }
                 else
                 {
-                    return ERR("could not parse type '" + type.name + "': invalid Boolean value '" + bval.string + "' (line " + std::to_string(bval.number) + ")");
+                    return ERR("could not parse type '" + type.name + "': invalid Boolean value '" + std::string(bval.string) + "' (line " + std::to_string(bval.number) + ")");
                 }
             }
             else
             {
-                return ERR("could not parse type '" + type.name + "': invalid token '" + next_token.string + "' (line " + std::to_string(next_token.number) + ")");
+                return ERR("could not parse type '" + type.name + "': invalid token '" + std::string(next_token.string) + "' (line " + std::to_string(next_token.number) + ")");
             }
             type_str.consume(";", true);
         }
         return OK(type);
     }
 
-    Result<LibertyParser::cell_group> LibertyParser::parse_cell(TokenStream<std::string>& str)
+    Result<std::pair<std::string, TimingComponent::LookupTable>> LibertyParser::parse_table_template(TokenStream<std::string_view>& str) const
     {
-        cell_group cell;
-
-        cell.line_number = str.peek().number;
         str.consume("(", true);
-        cell.name = str.consume().string;
+        std::string name = std::string(str.consume().string);
         str.consume(")", true);
         str.consume("{", true);
-        auto cell_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto template_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
-        if (const auto cell_it = m_cell_names.find(cell.name); cell_it != m_cell_names.end())
+        TimingComponent::LookupTable table;
+        if (auto res = parse_table_attributes(template_str, table); res.is_error())
         {
-            return ERR("could not parse cell '" + cell.name + "': a cell with that name already exists");
+            return ERR_APPEND(res.get_error(), "could not parse table template '" + name + "'");
         }
 
-        m_cell_names.insert(cell.name);
+        return OK(std::make_pair(std::move(name), std::move(table)));
+    }
+
+    Result<LibertyParser::cell_group> LibertyParser::parse_cell(TokenStream<std::string_view>& str) const
+    {
+        cell_group cell;
+
+        cell.line_number = str.peek().number;
+        str.consume("(", true);
+        cell.name = str.consume().string;
+        str.consume(")", true);
+        str.consume("{", true);
+        auto cell_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
+        str.consume("}", true);
 
         while (cell_str.remaining() > 0)
         {
@@ -325,21 +579,36 @@ namespace hal
                     cell.latch = latch.get();
                 }
             }
+            else if (m_capture_timing && (next_token == "area" || next_token == "cell_leakage_power") && cell_str.peek() == ":")
+            {
+                if (auto res = parse_number_attribute(cell_str); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not parse cell '" + cell.name + "': failed to parse '" + std::string(next_token.string) + "' attribute");
+                }
+                else if (next_token == "area")
+                {
+                    cell.area = res.get();
+                }
+                else
+                {
+                    cell.leakage_power = res.get();
+                }
+            }
         }
 
         return OK(cell);
     }
 
-    Result<LibertyParser::pin_group> LibertyParser::parse_pin(TokenStream<std::string>& str, cell_group& cell, PinDirection direction, const std::string& external_pin_name)
+    Result<LibertyParser::pin_group> LibertyParser::parse_pin(TokenStream<std::string_view>& str, cell_group& cell, PinDirection direction, const std::string& external_pin_name) const
     {
         pin_group pin;
 
         pin.line_number = str.peek().number;
         str.consume("(", true);
-        auto pin_names_str = str.extract_until(")", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto pin_names_str = str.extract_until(")", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume(")", true);
         str.consume("{", true);
-        auto pin_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto pin_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         if (pin_names_str.size() == 0)
@@ -349,7 +618,7 @@ namespace hal
 
         do
         {
-            std::string name = pin_names_str.consume().string;
+            std::string name = std::string(pin_names_str.consume().string);
             if (!external_pin_name.empty() && name != external_pin_name)
             {
                 return ERR("could not parse pin '" + name + "': pin name does not match external pin name '" + external_pin_name + "' (line " + std::to_string(pin.line_number) + ")");
@@ -359,9 +628,9 @@ namespace hal
             {
                 if (pin_names_str.peek(1) == ":")
                 {
-                    i32 start = std::stol(pin_names_str.consume().string);
+                    i32 start = std::stol(std::string(pin_names_str.consume().string));
                     pin_names_str.consume(":", true);
-                    i32 end = std::stol(pin_names_str.consume().string);
+                    i32 end = std::stol(std::string(pin_names_str.consume().string));
                     i32 dir = (start <= end) ? 1 : -1;
 
                     for (int i = start; i != (end + dir); i += dir)
@@ -379,7 +648,7 @@ namespace hal
                 }
                 else
                 {
-                    u32 index     = std::stoul(pin_names_str.consume().string);
+                    u32 index     = std::stoul(std::string(pin_names_str.consume().string));
                     auto new_name = name + "(" + std::to_string(index) + ")";
 
                     if (const auto pin_it = cell.pin_names.find(new_name); pin_it != cell.pin_names.end())
@@ -415,7 +684,7 @@ namespace hal
             if (next_token == "direction")
             {
                 pin_str.consume(":", true);
-                auto direction_str = pin_str.consume().string;
+                auto direction_str = std::string(pin_str.consume().string);
                 try
                 {
                     pin.direction = enum_from_string<PinDirection>(direction_str);
@@ -453,6 +722,33 @@ namespace hal
                 }
                 pin_str.consume(";", true);
             }
+            else if (m_capture_timing && next_token == "capacitance" && pin_str.peek() == ":")
+            {
+                if (auto res = parse_number_attribute(pin_str); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not parse pin: failed to parse 'capacitance' attribute (line " + std::to_string(pin.line_number) + ")");
+                }
+                else
+                {
+                    pin.capacitance = res.get();
+                }
+            }
+            else if (next_token == "timing" && pin_str.peek() == "(")
+            {
+                if (!m_capture_timing)
+                {
+                    skip_group(pin_str);
+                }
+                else if (auto res = parse_timing(pin_str); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not parse pin: failed to parse 'timing' group (line " + std::to_string(next_token.number) + ")");
+                }
+                else
+                {
+                    auto arcs = res.get();
+                    pin.timing_arcs.insert(pin.timing_arcs.end(), std::make_move_iterator(arcs.begin()), std::make_move_iterator(arcs.end()));
+                }
+            }
         }
 
         if (pin.direction == PinDirection::none)
@@ -463,16 +759,16 @@ namespace hal
         return OK(pin);
     }
 
-    Result<LibertyParser::pin_group> LibertyParser::parse_pg_pin(TokenStream<std::string>& str, cell_group& cell)
+    Result<LibertyParser::pin_group> LibertyParser::parse_pg_pin(TokenStream<std::string_view>& str, cell_group& cell) const
     {
         pin_group pin;
 
         pin.line_number = str.peek().number;
         str.consume("(", true);
-        TokenStream<std::string> pin_names_str = str.extract_until(")", TokenStream<std::string>::END_OF_STREAM, true, true);
+        TokenStream<std::string_view> pin_names_str = str.extract_until(")", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume(")", true);
         str.consume("{", true);
-        TokenStream<std::string> pin_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        TokenStream<std::string_view> pin_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         if (pin_names_str.size() == 0)
@@ -484,7 +780,7 @@ namespace hal
             return ERR("could not parse power/ground pins '" + pin_names_str.join("").string + "': more than one pin name given (line " + std::to_string(pin.line_number) + ")");
         }
 
-        std::string name = pin_names_str.consume().string;
+        std::string name = std::string(pin_names_str.consume().string);
         if (const auto pin_it = cell.pin_names.find(name); pin_it != cell.pin_names.end())
         {
             return ERR("could not parse power/ground pin '" + name + "': a pin with that name already exists (line " + std::to_string(pin.line_number) + ")");
@@ -496,7 +792,7 @@ namespace hal
             if (next_token == "pg_type")
             {
                 pin_str.consume(":", true);
-                std::string type = pin_str.consume().string;
+                std::string type = std::string(pin_str.consume().string);
                 if (type == "primary_power")
                 {
                     pin.power = true;
@@ -520,7 +816,7 @@ namespace hal
         return OK(pin);
     }
 
-    Result<LibertyParser::bus_group> LibertyParser::parse_bus(TokenStream<std::string>& str, cell_group& cell)
+    Result<LibertyParser::bus_group> LibertyParser::parse_bus(TokenStream<std::string_view>& str, cell_group& cell) const
     {
         bus_group bus;
         std::vector<u32> range;
@@ -530,7 +826,7 @@ namespace hal
         bus.name = str.consume().string;
         str.consume(")", true);
         str.consume("{", true);
-        auto bus_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto bus_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         do
@@ -539,7 +835,7 @@ namespace hal
             if (next_token == "bus_type")
             {
                 bus_str.consume(":", true);
-                auto bus_type_str = bus_str.consume().string;
+                auto bus_type_str = std::string(bus_str.consume().string);
                 if (const auto& it = m_bus_types.find(bus_type_str); it == m_bus_types.end())
                 {
                     return ERR("could not parse bus '" + bus.name + "': invalid bus type '" + bus_type_str + "' (line " + std::to_string(bus.line_number) + ")");
@@ -560,7 +856,7 @@ namespace hal
             else if (next_token == "direction")
             {
                 bus_str.consume(":", true);
-                auto direction_str = bus_str.consume().string;
+                auto direction_str = std::string(bus_str.consume().string);
                 if (direction_str == "input")
                 {
                     bus.direction = PinDirection::input;
@@ -613,7 +909,7 @@ namespace hal
         return OK(bus);
     }
 
-    Result<LibertyParser::ff_group> LibertyParser::parse_ff(TokenStream<std::string>& str)
+    Result<LibertyParser::ff_group> LibertyParser::parse_ff(TokenStream<std::string_view>& str) const
     {
         ff_group ff;
 
@@ -624,7 +920,7 @@ namespace hal
         ff.state2 = str.consume().string;
         str.consume(")", true);
         str.consume("{", true);
-        auto ff_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto ff_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         do
@@ -633,34 +929,34 @@ namespace hal
             if (next_token == "clocked_on")
             {
                 ff_str.consume(":", true);
-                ff.clocked_on = ff_str.consume();
+                ff.clocked_on = ff_str.consume().string;
                 ff_str.consume(";", true);
             }
             else if (next_token == "next_state")
             {
                 ff_str.consume(":", true);
-                ff.next_state = ff_str.consume();
+                ff.next_state = ff_str.consume().string;
                 ff_str.consume(";", true);
             }
             else if (next_token == "clear")
             {
                 ff_str.consume(":", true);
-                ff.clear = ff_str.consume();
+                ff.clear = ff_str.consume().string;
                 ff_str.consume(";", true);
             }
             else if (next_token == "preset")
             {
                 ff_str.consume(":", true);
-                ff.preset = ff_str.consume();
+                ff.preset = ff_str.consume().string;
                 ff_str.consume(";", true);
             }
             else if (next_token == "clear_preset_var1" || next_token == "clear_preset_var2")
             {
                 ff_str.consume(":", true);
-                Token<std::string> behav_str = ff_str.consume();
+                Token<std::string_view> behav_str = ff_str.consume();
                 ff_str.consume(";", true);
 
-                if (auto behav = enum_from_string<AsyncSetResetBehavior>(behav_str, AsyncSetResetBehavior::undef); behav != AsyncSetResetBehavior::undef)
+                if (auto behav = enum_from_string<AsyncSetResetBehavior>(std::string(behav_str.string), AsyncSetResetBehavior::undef); behav != AsyncSetResetBehavior::undef)
                 {
                     if (next_token == "clear_preset_var1")
                     {
@@ -673,7 +969,7 @@ namespace hal
                 }
                 else
                 {
-                    return ERR("could not parse 'ff' group: invalid clear_preset behavior '" + behav_str.string + "' (line " + std::to_string(behav_str.number) + ")");
+                    return ERR("could not parse 'ff' group: invalid clear_preset behavior '" + std::string(behav_str.string) + "' (line " + std::to_string(behav_str.number) + ")");
                 }
             }
         } while (ff_str.remaining() > 0);
@@ -681,7 +977,7 @@ namespace hal
         return OK(ff);
     }
 
-    Result<LibertyParser::latch_group> LibertyParser::parse_latch(TokenStream<std::string>& str)
+    Result<LibertyParser::latch_group> LibertyParser::parse_latch(TokenStream<std::string_view>& str) const
     {
         latch_group latch;
 
@@ -692,7 +988,7 @@ namespace hal
         latch.state2 = str.consume().string;
         str.consume(")", true);
         str.consume("{", true);
-        auto latch_str = str.extract_until("}", TokenStream<std::string>::END_OF_STREAM, true, true);
+        auto latch_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
         str.consume("}", true);
 
         do
@@ -701,34 +997,34 @@ namespace hal
             if (next_token == "enable")
             {
                 latch_str.consume(":", true);
-                latch.enable = latch_str.consume();
+                latch.enable = latch_str.consume().string;
                 latch_str.consume(";", true);
             }
             else if (next_token == "data_in")
             {
                 latch_str.consume(":", true);
-                latch.data_in = latch_str.consume();
+                latch.data_in = latch_str.consume().string;
                 latch_str.consume(";", true);
             }
             else if (next_token == "clear")
             {
                 latch_str.consume(":", true);
-                latch.clear = latch_str.consume();
+                latch.clear = latch_str.consume().string;
                 latch_str.consume(";", true);
             }
             else if (next_token == "preset")
             {
                 latch_str.consume(":", true);
-                latch.preset = latch_str.consume();
+                latch.preset = latch_str.consume().string;
                 latch_str.consume(";", true);
             }
             else if (next_token == "clear_preset_var1" || next_token == "clear_preset_var2")
             {
                 latch_str.consume(":", true);
-                Token<std::string> behav_str = latch_str.consume();
+                Token<std::string_view> behav_str = latch_str.consume();
                 latch_str.consume(";", true);
 
-                if (auto behav = enum_from_string<AsyncSetResetBehavior>(behav_str, AsyncSetResetBehavior::undef); behav != AsyncSetResetBehavior::undef)
+                if (auto behav = enum_from_string<AsyncSetResetBehavior>(std::string(behav_str.string), AsyncSetResetBehavior::undef); behav != AsyncSetResetBehavior::undef)
                 {
                     if (next_token == "clear_preset_var1")
                     {
@@ -741,7 +1037,7 @@ namespace hal
                 }
                 else
                 {
-                    return ERR("could not parse 'latch' group: invalid clear_preset behavior '" + behav_str.string + "' (line " + std::to_string(behav_str.number) + ")");
+                    return ERR("could not parse 'latch' group: invalid clear_preset behavior '" + std::string(behav_str.string) + "' (line " + std::to_string(behav_str.number) + ")");
                 }
             }
         } while (latch_str.remaining() > 0);
@@ -749,7 +1045,190 @@ namespace hal
         return OK(latch);
     }
 
-    Result<std::monostate> LibertyParser::construct_gate_type(cell_group&& cell)
+    Result<std::vector<TimingComponent::TimingArc>> LibertyParser::parse_timing(TokenStream<std::string_view>& str) const
+    {
+        str.consume("(", true);
+        str.consume_until(")");
+        str.consume(")", true);
+        str.consume("{", true);
+        auto timing_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
+        str.consume("}", true);
+
+        TimingComponent::TimingArc arc;
+        std::vector<std::string> related_pins;
+        while (timing_str.remaining() > 0)
+        {
+            auto next_token = timing_str.consume();
+            if (timing_str.remaining() == 0)
+            {
+                break;
+            }
+
+            if (timing_str.peek() == ":")
+            {
+                timing_str.consume(":", true);
+                const std::string value = std::string(timing_str.consume().string);
+                timing_str.consume(";");
+
+                if (next_token == "related_pin")
+                {
+                    // multiple related pins are separated by whitespace
+                    for (const auto& related_pin : utils::split(value, ' '))
+                    {
+                        if (!related_pin.empty())
+                        {
+                            related_pins.push_back(related_pin);
+                        }
+                    }
+                }
+                else if (next_token == "timing_sense")
+                {
+                    arc.timing_sense = value;
+                }
+                else if (next_token == "timing_type")
+                {
+                    arc.timing_type = value;
+                }
+            }
+            else if (timing_str.peek() == "(")
+            {
+                TimingComponent::LookupTable* table = nullptr;
+                if (next_token == "cell_rise")
+                {
+                    table = &arc.cell_rise;
+                }
+                else if (next_token == "cell_fall")
+                {
+                    table = &arc.cell_fall;
+                }
+                else if (next_token == "rise_transition")
+                {
+                    table = &arc.rise_transition;
+                }
+                else if (next_token == "fall_transition")
+                {
+                    table = &arc.fall_transition;
+                }
+
+                if (table == nullptr)
+                {
+                    skip_group(timing_str);
+                }
+                else if (auto res = parse_lookup_table(timing_str); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not parse 'timing' group: failed to parse '" + std::string(next_token.string) + "' table (line " + std::to_string(next_token.number) + ")");
+                }
+                else
+                {
+                    *table = res.get();
+                }
+            }
+        }
+
+        if (related_pins.empty())
+        {
+            related_pins.push_back("");
+        }
+
+        std::vector<TimingComponent::TimingArc> arcs;
+        for (const auto& related_pin : related_pins)
+        {
+            arc.related_pin = related_pin;
+            arcs.push_back(arc);
+        }
+        return OK(arcs);
+    }
+
+    Result<TimingComponent::LookupTable> LibertyParser::parse_lookup_table(TokenStream<std::string_view>& str) const
+    {
+        const u32 line_number = str.peek().number;
+        str.consume("(", true);
+        const std::string template_name = str.join_until(")", "").string;
+        str.consume(")", true);
+        str.consume("{", true);
+        auto table_str = str.extract_until("}", TokenStream<std::string_view>::END_OF_STREAM, true, true);
+        str.consume("}", true);
+
+        // indices may be omitted if they are given by the template
+        TimingComponent::LookupTable table;
+        if (const auto it = m_table_templates.find(template_name); it != m_table_templates.end())
+        {
+            table = it->second;
+        }
+        else if (template_name != "scalar")
+        {
+            return ERR("could not parse lookup table: unknown table template '" + template_name + "' (line " + std::to_string(line_number) + ")");
+        }
+
+        if (auto res = parse_table_attributes(table_str, table); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not parse lookup table (line " + std::to_string(line_number) + ")");
+        }
+
+        const u64 expected_size = std::max<u64>(1, table.index_1.size()) * std::max<u64>(1, table.index_2.size());
+        if (table.values.size() != expected_size)
+        {
+            return ERR("could not parse lookup table: expected " + std::to_string(expected_size) + " values but got " + std::to_string(table.values.size()) + " (line "
+                       + std::to_string(line_number) + ")");
+        }
+
+        return OK(table);
+    }
+
+    Result<std::monostate> LibertyParser::parse_table_attributes(TokenStream<std::string_view>& table_str, TimingComponent::LookupTable& table) const
+    {
+        while (table_str.remaining() > 0)
+        {
+            auto next_token = table_str.consume();
+            if (table_str.remaining() == 0)
+            {
+                break;
+            }
+
+            if (table_str.peek() == ":")
+            {
+                table_str.consume(":", true);
+                const auto value = table_str.consume();
+                table_str.consume(";");
+
+                if (next_token == "variable_1")
+                {
+                    table.variable_1 = value.string;
+                }
+                else if (next_token == "variable_2")
+                {
+                    table.variable_2 = value.string;
+                }
+            }
+            else if (table_str.peek() == "(")
+            {
+                if (next_token != "index_1" && next_token != "index_2" && next_token != "values")
+                {
+                    skip_group(table_str);
+                }
+                else if (auto res = parse_number_list(table_str); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not parse '" + std::string(next_token.string) + "' attribute");
+                }
+                else if (next_token == "index_1")
+                {
+                    table.index_1 = res.get();
+                }
+                else if (next_token == "index_2")
+                {
+                    table.index_2 = res.get();
+                }
+                else
+                {
+                    table.values = res.get();
+                }
+            }
+        }
+
+        return OK({});
+    }
+
+    Result<LibertyParser::prepared_cell> LibertyParser::prepare_gate_type(cell_group&& cell) const
     {
         // get input and from pin groups
         bool has_inputs = false;
@@ -908,63 +1387,44 @@ namespace hal
             }
         }
 
-        if (cell.properties.empty())
+        if (m_capture_timing)
         {
-            cell.properties.insert(GateTypeProperty::combinational);
-        }
-
-        GateType* gt = m_gate_lib->create_gate_type(cell.name, cell.properties, std::move(parent_component));
+            parent_component                  = GateTypeComponent::create_timing_component(std::move(parent_component));
+            TimingComponent* timing_component = parent_component->convert_to<TimingComponent>();
+            timing_component->set_area(cell.area.value_or(0.0));
+            timing_component->set_leakage_power(cell.leakage_power.value_or(0.0));
 
-        // get input and output pins from pin groups
-        for (auto& pin : cell.pins)
-        {
-            if (pin.power == true)
-            {
-                pin.type = PinType::power;
-            }
-
-            if (pin.ground == true)
-            {
-                pin.type = PinType::ground;
-            }
-
-            for (const auto& pin_name : pin.pin_names)
+            for (const auto& pin : cell.pins)
             {
-                if (auto res = gt->create_pin(pin_name, pin.direction, pin.type); res.is_error())
+                for (const auto& pin_name : pin.pin_names)
                 {
-                    return ERR_APPEND(res.get_error(), "could not construct gate type '" + cell.name + "': failed to create pin '" + pin_name + "'");
+                    if (pin.capacitance.has_value())
+                    {
+                        timing_component->set_pin_capacitance(pin_name, pin.capacitance.value());
+                    }
+                    for (auto arc : pin.timing_arcs)
+                    {
+                        arc.pin = pin_name;
+                        timing_component->add_timing_arc(arc);
+                    }
                 }
             }
         }
 
-        for (const auto& [bus_name, bus_info] : cell.buses)
+        if (cell.properties.empty())
         {
-            std::vector<GatePin*> pins;
-            for (const auto& pin_name : bus_info.pin_names)
-            {
-                if (auto res = gt->get_pin_by_name(pin_name); res == nullptr)
-                {
-                    return ERR("could not construct gate type '" + cell.name + "': failed to get pin by name '" + pin_name + "'");
-                }
-                else
-                {
-                    pins.push_back(res);
-                }
-            }
-            if (auto res = gt->create_pin_group(bus_name, pins, bus_info.direction, PinType::none, bus_info.ascending, bus_info.start_index); res.is_error())
-            {
-                return ERR_APPEND(res.get_error(), "could not construct gate type '" + cell.name + "': failed to create pin group '" + bus_name + "'");
-            }
+            cell.properties.insert(GateTypeProperty::combinational);
         }
 
+        std::unordered_map<std::string, BooleanFunction> functions;
         if (!cell.buses.empty())
         {
-            auto functions = construct_bus_functions(cell);
-            if (functions.is_error())
+            auto bus_functions = construct_bus_functions(cell);
+            if (bus_functions.is_error())
             {
-                return ERR_APPEND(functions.get_error(), "could not construct gate type '" + cell.name + "': failed to construct bus functions");
+                return ERR_APPEND(bus_functions.get_error(), "could not construct gate type '" + cell.name + "': failed to construct bus functions");
             }
-            gt->add_boolean_functions(functions.get());
+            functions = bus_functions.get();
         }
         else
         {
@@ -979,7 +1439,7 @@ namespace hal
                         {
                             return ERR_APPEND(function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing output function from string");
                         }
-                        gt->add_boolean_function(name, function.get());
+                        functions.emplace(name, function.get());
                     }
                 }
 
@@ -992,7 +1452,7 @@ namespace hal
                         {
                             return ERR_APPEND(function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing undefined function from string");
                         }
-                        gt->add_boolean_function(name + "_undefined", function.get());
+                        functions.emplace(name + "_undefined", function.get());
                     }
                 }
 
@@ -1005,69 +1465,72 @@ namespace hal
                         {
                             return ERR_APPEND(function.get_error(), "could not construct gate type '" + cell.name + "': failed parsing tristate function from string");
                         }
-                        gt->add_boolean_function(name + "_tristate", function.get());
+                        functions.emplace(name + "_tristate", function.get());
                     }
                 }
             }
         }
 
-        return OK({});
+        prepared_cell res;
+        res.cell      = std::move(cell);
+        res.component = std::move(parent_component);
+        res.functions = std::move(functions);
+        return OK(std::move(res));
     }
 
-    void LibertyParser::remove_comments(std::string& line, bool& multi_line_comment)
+    Result<std::monostate> LibertyParser::construct_gate_type(prepared_cell&& prepared)
     {
-        bool repeat = true;
+        cell_group& cell = prepared.cell;
+        GateType* gt     = m_gate_lib->create_gate_type(cell.name, cell.properties, std::move(prepared.component));
 
-        while (repeat)
+        // get input and output pins from pin groups
+        for (auto& pin : cell.pins)
         {
-            repeat = false;
-
-            // skip empty lines
-            if (line.empty())
+            if (pin.power == true)
             {
-                break;
+                pin.type = PinType::power;
             }
-            auto multi_line_comment_begin = line.find("/*");
-            auto multi_line_comment_end   = line.find("*/");
 
-            std::string begin = "";
-            std::string end   = "";
+            if (pin.ground == true)
+            {
+                pin.type = PinType::ground;
+            }
 
-            if (multi_line_comment == true)
+            for (const auto& pin_name : pin.pin_names)
             {
-                if (multi_line_comment_end != std::string::npos)
-                {
-                    // multi-line comment ends in current line
-                    multi_line_comment = false;
-                    line               = line.substr(multi_line_comment_end + 2);
-                    repeat             = true;
-                }
-                else
+                if (auto res = gt->create_pin(pin_name, pin.direction, pin.type); res.is_error())
                 {
-                    // current line entirely within multi-line comment
-                    line = "";
-                    break;
+                    return ERR_APPEND(res.get_error(), "could not construct gate type '" + cell.name + "': failed to create pin '" + pin_name + "'");
                 }
             }
-            else if (multi_line_comment_begin != std::string::npos)
+        }
+
+        for (const auto& [bus_name, bus_info] : cell.buses)
+        {
+            std::vector<GatePin*> pins;
+            for (const auto& pin_name : bus_info.pin_names)
             {
-                if (multi_line_comment_end != std::string::npos)
+                if (auto res = gt->get_pin_by_name(pin_name); res == nullptr)
                 {
-                    // multi-line comment entirely in current line
-                    line   = line.substr(0, multi_line_comment_begin) + line.substr(multi_line_comment_end + 2);
-                    repeat = true;
+                    return ERR("could not construct gate type '" + cell.name + "': failed to get pin by name '" + pin_name + "'");
                 }
                 else
                 {
-                    // multi-line comment starts in current line
-                    multi_line_comment = true;
-                    line               = line.substr(0, multi_line_comment_begin);
+                    pins.push_back(res);
                 }
             }
+            if (auto res = gt->create_pin_group(bus_name, pins, bus_info.direction, PinType::none, bus_info.ascending, bus_info.start_index); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not construct gate type '" + cell.name + "': failed to create pin group '" + bus_name + "'");
+            }
         }
+
+        gt->add_boolean_functions(prepared.functions);
+
+        return OK({});
     }
 
-    std::vector<std::string> LibertyParser::tokenize_function(const std::string& function)
+    std::vector<std::string> LibertyParser::tokenize_function(const std::string& function) const
     {
         std::string delimiters = "()[]:!'^+|&* ";
         std::string current_token;
@@ -1098,7 +1561,7 @@ namespace hal
         return res;
     }
 
-    std::map<std::string, std::string> LibertyParser::expand_bus_function(const std::map<std::string, bus_group>& buses, const std::vector<std::string>& pin_names, const std::string& function)
+    std::map<std::string, std::string> LibertyParser::expand_bus_function(const std::map<std::string, bus_group>& buses, const std::vector<std::string>& pin_names, const std::string& function) const
     {
         auto tokenized_funtion = tokenize_function(function);
         std::map<std::string, std::string> res;
@@ -1173,7 +1636,7 @@ namespace hal
         return res;
     }
 
-    std::string LibertyParser::prepare_pin_function(const std::map<std::string, bus_group>& buses, const std::string& function)
+    std::string LibertyParser::prepare_pin_function(const std::map<std::string, bus_group>& buses, const std::string& function) const
     {
         auto tokenized_funtion = tokenize_function(function);
         std::string res        = "";
@@ -1205,7 +1668,7 @@ namespace hal
         return res;
     }
 
-    Result<std::unordered_map<std::string, BooleanFunction>> LibertyParser::construct_bus_functions(const cell_group& cell)
+    Result<std::unordered_map<std::string, BooleanFunction>> LibertyParser::construct_bus_functions(const cell_group& cell) const
     {
         std::unordered_map<std::string, BooleanFunction> res;
 
@@ -4,6 +4,7 @@
 #include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/timing_component.h"
 #include <experimental/filesystem>
 
 namespace hal {
@@ -351,6 +352,91 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the optional capture of timing data (pin capacitances, area, leakage power, and timing arcs)
+     *
+     * Functions: parse
+     */
+    TEST_F(LibertyParserTest, check_timing) {
+        TEST_START
+            {
+                std::string path_lib = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/liberty_parser/test6.lib";
+                LibertyParser liberty_parser(true);
+                auto gl_res = liberty_parser.parse(path_lib);
+                ASSERT_TRUE(gl_res.is_ok());
+                std::unique_ptr<GateLibrary> gl = gl_res.get();
+
+                ASSERT_NE(gl, nullptr);
+                auto gate_types = gl->get_gate_types();
+                ASSERT_EQ(gate_types.size(), 2);
+                auto gt_it = gate_types.find("TEST_NAND");
+                ASSERT_TRUE(gt_it != gate_types.end());
+                GateType* gt = gt_it->second;
+
+                EXPECT_EQ(gt->get_properties(), std::set<GateTypeProperty>({GateTypeProperty::combinational}));
+                EXPECT_EQ(gt->get_boolean_function("O"), BooleanFunction::from_string("!(A & B)").get());
+
+                TimingComponent* timing_component = gt->get_component_as<TimingComponent>([](const GateTypeComponent* c) { return TimingComponent::is_class_of(c); });
+                ASSERT_NE(timing_component, nullptr);
+                EXPECT_DOUBLE_EQ(timing_component->get_area(), 2.5);
+                EXPECT_DOUBLE_EQ(timing_component->get_leakage_power(), 0.125);
+                EXPECT_DOUBLE_EQ(timing_component->get_pin_capacitance("A"), 0.002);
+                EXPECT_DOUBLE_EQ(timing_component->get_pin_capacitance("B"), 0.003);
+                EXPECT_DOUBLE_EQ(timing_component->get_pin_capacitance("O"), 0.0);
+
+                // one arc per related pin
+                const auto arcs = timing_component->get_timing_arcs("O");
+                ASSERT_EQ(arcs.size(), 2);
+                EXPECT_EQ(arcs.at(0).related_pin, "A");
+                EXPECT_EQ(arcs.at(1).related_pin, "B");
+                EXPECT_EQ(arcs.at(0).cell_rise, arcs.at(1).cell_rise);
+
+                const auto& arc = arcs.at(0);
+                EXPECT_EQ(arc.pin, "O");
+                EXPECT_EQ(arc.timing_sense, "negative_unate");
+
+                // indices taken from the template
+                EXPECT_EQ(arc.cell_rise.variable_1, "input_net_transition");
+                EXPECT_EQ(arc.cell_rise.variable_2, "total_output_net_capacitance");
+                EXPECT_EQ(arc.cell_rise.index_1, std::vector<double>({0.1, 1.0}));
+                EXPECT_EQ(arc.cell_rise.index_2, std::vector<double>({0.01, 0.1}));
+                EXPECT_EQ(arc.cell_rise.values, std::vector<double>({0.1, 0.2, 0.3, 0.4}));
+                EXPECT_DOUBLE_EQ(arc.cell_rise.evaluate(1.0, 0.1), 0.4);
+
+                // indices overridden by the table
+                EXPECT_EQ(arc.cell_fall.index_1, std::vector<double>({0.2, 2.0}));
+                EXPECT_EQ(arc.cell_fall.values, std::vector<double>({0.5, 0.6, 0.7, 0.8}));
+
+                // scalar table and missing table
+                EXPECT_TRUE(arc.rise_transition.index_1.empty());
+                EXPECT_DOUBLE_EQ(arc.rise_transition.evaluate(0.5, 0.5), 0.05);
+                EXPECT_TRUE(arc.fall_transition.is_empty());
+
+                auto buf_it = gate_types.find("TEST_BUF");
+                ASSERT_TRUE(buf_it != gate_types.end());
+                TimingComponent* buf_timing_component = buf_it->second->get_component_as<TimingComponent>([](const GateTypeComponent* c) { return TimingComponent::is_class_of(c); });
+                ASSERT_NE(buf_timing_component, nullptr);
+                EXPECT_DOUBLE_EQ(buf_timing_component->get_area(), 1.0);
+                EXPECT_TRUE(buf_timing_component->get_timing_arcs().empty());
+            }
+            {
+                // timing data is not captured by default
+                std::string path_lib = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/liberty_parser/test6.lib";
+                LibertyParser liberty_parser;
+                auto gl_res = liberty_parser.parse(path_lib);
+                ASSERT_TRUE(gl_res.is_ok());
+                std::unique_ptr<GateLibrary> gl = gl_res.get();
+
+                ASSERT_NE(gl, nullptr);
+                auto gate_types = gl->get_gate_types();
+                ASSERT_EQ(gate_types.size(), 2);
+                GateType* gt = gate_types.at("TEST_NAND");
+                EXPECT_EQ(gt->get_component(), nullptr);
+                EXPECT_EQ(gt->get_pins().size(), 3);
+            }
+        TEST_END
+    }
+
     /**
      * Testing the correct handling of invalid input and other uncommon inputs
      *
@@ -29,6 +29,7 @@
 #include "hal_core/netlist/gate_library/gate_type.h"
 
 #include <optional>
+#include <string_view>
 #include <variant>
 
 namespace hal
@@ -39,6 +40,8 @@ namespace hal
     using empty_t             = std::monostate;
     using assignment_t        = std::variant<identifier_t, ranged_identifier_t, numeral_t, empty_t>;
 
+    struct VerilogModule;
+
     struct VerilogDataEntry
     {
         std::string m_name;
@@ -85,6 +88,13 @@ namespace hal
         std::vector<VerilogDataEntry> m_parameters;
         std::vector<VerilogDataEntry> m_attributes;
         std::vector<std::pair<std::string, std::string>> m_expanded_port_assignments;
+
+        // resolved during instantiation, signals are referenced by their index within the instantiating module
+        VerilogModule* m_module = nullptr;
+        GateType* m_gate_type   = nullptr;
+        u32 m_name_id           = 0;
+        std::vector<std::pair<u32, u32>> m_module_port_signals;    // (signal index within instantiated module, signal index within this module)
+        std::vector<std::pair<GatePin*, u32>> m_gate_pin_signals;
     };
 
     struct VerilogModule
@@ -125,5 +135,14 @@ namespace hal
         // instances
         std::vector<std::unique_ptr<VerilogInstance>> m_instances;
         std::map<std::string, VerilogInstance*> m_instances_by_name;
+
+        // resolved during instantiation and released after the last instance of the module has been created
+        // every expanded port identifier and signal name is assigned a dense signal index, starting with the ports
+        u32 m_num_remaining_instances = 0;
+        std::vector<std::string_view> m_signal_index_names;
+        std::vector<u32> m_port_signal_indices;    // one per expanded port identifier
+        std::vector<u32> m_signal_indices;         // one per expanded signal name
+        std::vector<u32> m_signal_name_ids;        // one per expanded signal name
+        std::vector<std::pair<u32, u32>> m_assignment_signal_indices;
     };
 }    // namespace hal
\ No newline at end of file
@@ -30,12 +30,14 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #include "hal_core/utilities/special_strings.h"
 #include "hal_core/utilities/token_stream.h"
 #include "verilog_parser/verilog_module.h"
 
+#include <deque>
 #include <optional>
-#include <sstream>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -67,8 +69,15 @@ namespace hal
          */
         Result<std::unique_ptr<Netlist>> instantiate(const GateLibrary* gate_library) override;
 
+        /**
+         * Get the names of all types instantiated within the parsed Verilog netlist that are not defined as modules and hence must be provided by the gate library.
+         *
+         * @returns The names of the required gate types.
+         */
+        std::optional<std::unordered_set<std::string>> get_required_gate_types() const override;
+
     private:
-        std::stringstream m_fs;
+        std::unique_ptr<MemoryMappedFile> m_file;
         std::filesystem::path m_path;
 
         // temporary netlist
@@ -79,8 +88,9 @@ namespace hal
         std::unordered_map<std::string, VerilogModule*> m_modules_by_name;
         std::string m_last_module;
 
-        // token stream of entire input file
-        TokenStream<std::string> m_token_stream;
+        // token stream of the input parsed by this parser, tokens reference the memory-mapped file or m_token_storage
+        TokenStream<std::string_view> m_token_stream;
+        std::deque<std::string> m_token_storage;
 
         // some caching
         std::unordered_map<std::string, GateType*> m_gate_types;
@@ -88,18 +98,21 @@ namespace hal
         std::unordered_map<std::string, GateType*> m_gnd_gate_types;
         std::unordered_map<Net*, std::vector<std::tuple<PinDirection, std::string, Module*>>> m_module_ports;
 
-        // unique aliases
-        std::unordered_map<std::string, u32> m_signal_name_occurrences;
-        std::unordered_map<std::string, u32> m_instance_name_occurrences;
+        // unique aliases, names are interned and their occurrences are counted by name ID
+        std::unordered_map<std::string_view, u32> m_signal_name_ids;
+        std::unordered_map<std::string_view, u32> m_instance_name_ids;
+        std::vector<u32> m_signal_name_occurrences;
+        std::vector<u32> m_instance_name_occurrences;
 
-        // nets
+        // nets indexed by net ID, the IDs 0 and 1 are reserved for the constant nets
         Net* m_zero_net;
         Net* m_one_net;
-        std::unordered_map<std::string, Net*> m_net_by_name;
-        std::unordered_map<std::string, std::vector<std::string>> m_nets_to_merge;
+        std::vector<Net*> m_nets;
+        std::unordered_map<u32, std::vector<u32>> m_nets_to_merge;
 
         // parse HDL into intermediate format
-        void tokenize();
+        bool parse_module_groups(const std::vector<std::string_view>& groups, std::vector<std::unique_ptr<VerilogParser>>& group_parsers, std::vector<Result<std::monostate>>& group_results) const;
+        bool tokenize(std::string_view data, u32 line_number);
         Result<std::monostate> parse_tokens();
         Result<std::monostate> parse_module(std::vector<VerilogDataEntry>& attributes);
         void parse_port_list(VerilogModule* module);
@@ -114,10 +127,12 @@ namespace hal
 
         // construct netlist from intermediate format
         Result<std::monostate> construct_netlist(VerilogModule* top_module);
-        Result<Module*>
-            instantiate_module(const std::string& instance_name, VerilogModule* verilog_module, Module* parent, const std::unordered_map<std::string, std::string>& parent_module_assignments);
+        Result<std::vector<VerilogModule*>> get_instantiated_modules(VerilogModule* top_module) const;
+        Result<std::monostate> resolve_signals(const std::vector<VerilogModule*>& instantiated_modules);
+        Result<Module*> instantiate_module(const std::string& instance_identifier, const u32 instance_name_id, VerilogModule* verilog_module, Module* parent, std::vector<u32> signal_nets);
 
         // helper functions
-        std::string get_unique_alias(std::unordered_map<std::string, u32>& name_occurrences, const std::string& name) const;
+        u32 intern_name(std::unordered_map<std::string_view, u32>& name_ids, std::vector<u32>& name_occurrences, std::string_view name) const;
+        std::string get_unique_alias(std::vector<u32>& name_occurrences, const u32 name_id, const std::string& name) const;
     };
 }    // namespace hal
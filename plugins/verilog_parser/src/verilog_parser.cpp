@@ -6,27 +6,29 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/utilities/enums.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel_for_each.h"
 #include "hal_core/utilities/utils.h"
 
 #include <fstream>
 #include <iomanip>
-#include <queue>
+#include <limits>
+#include <thread>
 
 namespace hal
 {
     namespace
     {
-        std::vector<u32> parse_range(TokenStream<std::string>& stream)
+        std::vector<u32> parse_range(TokenStream<std::string_view>& stream)
         {
             if (stream.remaining() == 1)
             {
-                return {(u32)std::stoi(stream.consume().string)};
+                return {(u32)std::stoi(std::string(stream.consume().string))};
             }
 
             // MSB to LSB
-            const int end = std::stoi(stream.consume().string);
+            const int end = std::stoi(std::string(stream.consume().string));
             stream.consume(":", true);
-            const int start = std::stoi(stream.consume().string);
+            const int start = std::stoi(std::string(stream.consume().string));
 
             const int direction = (start <= end) ? 1 : -1;
 
@@ -325,9 +327,9 @@ namespace hal
             return OK(ss.str());
         }
 
-        Result<std::vector<assignment_t>> parse_assignment_expression(TokenStream<std::string>&& stream)
+        Result<std::vector<assignment_t>> parse_assignment_expression(TokenStream<std::string_view>&& stream)
         {
-            std::vector<TokenStream<std::string>> parts;
+            std::vector<TokenStream<std::string_view>> parts;
 
             if (stream.size() == 0)
             {
@@ -338,7 +340,7 @@ namespace hal
             {
                 stream.consume("{", true);
 
-                TokenStream<std::string> assignment_list_str = stream.extract_until("}");
+                TokenStream<std::string_view> assignment_list_str = stream.extract_until("}");
                 stream.consume("}", true);
 
                 do
@@ -356,15 +358,15 @@ namespace hal
 
             for (auto it = parts.rbegin(); it != parts.rend(); it++)
             {
-                TokenStream<std::string>& part_stream = *it;
+                TokenStream<std::string_view>& part_stream = *it;
 
-                const Token<std::string> signal_name_token = part_stream.consume();
-                std::string signal_name                    = signal_name_token.string;
+                const Token<std::string_view> signal_name_token = part_stream.consume();
+                std::string signal_name                         = std::string(signal_name_token.string);
 
                 // (3) NUMBER
                 if (isdigit(signal_name[0]) || signal_name[0] == '\'')
                 {
-                    if (auto res = get_binary_vector(signal_name_token); res.is_error())
+                    if (auto res = get_binary_vector(signal_name); res.is_error())
                     {
                         return ERR_APPEND(res.get_error(), "could not parse assignment expression: unable to convert token to binary vector");
                     }
@@ -384,7 +386,7 @@ namespace hal
                         std::vector<std::vector<u32>> ranges;
                         do
                         {
-                            TokenStream<std::string> range_str = part_stream.extract_until("]");
+                            TokenStream<std::string_view> range_str = part_stream.extract_until("]");
                             ranges.emplace_back(parse_range(range_str));
                             part_stream.consume("]", true);
                         } while (part_stream.consume("[", false));
@@ -403,6 +405,66 @@ namespace hal
             return OK(result);
         }
 
+        /**
+         * Split the input into consecutive ranges of complete modules with roughly equal sizes that can be lexed independently.
+         * Ranges end right after an 'endmodule' keyword at the beginning of a line. As the keyword is searched for without lexing, a range may still end
+         * within a comment or string, which the lexer must detect afterwards.
+         */
+        std::vector<std::string_view> split_into_module_groups(std::string_view data, u32 max_num_groups)
+        {
+            const std::string_view keyword    = "endmodule";
+            const std::string_view delimiters = "`,()[]{}#*: ;=./";
+
+            const auto starts_line = [&data](u64 pos) {
+                const u64 line_begin = data.find_last_not_of(" \t", pos - 1);
+                return line_begin == std::string_view::npos || data[line_begin] == '\n';
+            };
+            const auto ends_token = [&data, &delimiters](u64 pos) {
+                return pos == data.size() || std::isspace(static_cast<unsigned char>(data[pos])) || delimiters.find(data[pos]) != std::string_view::npos;
+            };
+
+            const u64 target_size = data.size() / max_num_groups + 1;
+
+            std::vector<std::string_view> groups;
+            u64 group_begin = 0;
+            for (u64 pos = data.find(keyword); pos != std::string_view::npos; pos = data.find(keyword, pos + keyword.size()))
+            {
+                const u64 end = pos + keyword.size();
+                if (end - group_begin >= target_size && (pos == 0 || starts_line(pos)) && ends_token(end))
+                {
+                    groups.push_back(data.substr(group_begin, end - group_begin));
+                    group_begin = end;
+                }
+            }
+            groups.push_back(data.substr(group_begin));
+
+            return groups;
+        }
+
+        // special signal indices referring to constants or unconnected signals
+        constexpr u32 SIGNAL_ZERO        = std::numeric_limits<u32>::max() - 2;
+        constexpr u32 SIGNAL_ONE         = std::numeric_limits<u32>::max() - 1;
+        constexpr u32 SIGNAL_UNCONNECTED = std::numeric_limits<u32>::max();
+
+        // reserved net IDs of the constant nets and the ID of a signal that is not connected to any net
+        constexpr u32 NET_ZERO = 0;
+        constexpr u32 NET_ONE  = 1;
+        constexpr u32 NO_NET   = std::numeric_limits<u32>::max();
+
+        void release_signal_indices(VerilogModule* verilog_module)
+        {
+            verilog_module->m_signal_index_names        = std::vector<std::string_view>();
+            verilog_module->m_port_signal_indices       = std::vector<u32>();
+            verilog_module->m_signal_indices            = std::vector<u32>();
+            verilog_module->m_signal_name_ids           = std::vector<u32>();
+            verilog_module->m_assignment_signal_indices = std::vector<std::pair<u32, u32>>();
+            for (const auto& instance : verilog_module->m_instances)
+            {
+                instance->m_module_port_signals = std::vector<std::pair<u32, u32>>();
+                instance->m_gate_pin_signals    = std::vector<std::pair<GatePin*, u32>>();
+            }
+        }
+
         std::vector<std::string> expand_assignment_expression(VerilogModule* verilog_module, const std::vector<assignment_t>& vars)
         {
             std::vector<std::string> result;
@@ -447,41 +509,51 @@ namespace hal
         m_path = file_path;
         m_modules.clear();
         m_modules_by_name.clear();
+        m_token_storage.clear();
 
+        if (auto res = MemoryMappedFile::open(file_path); res.is_error())
         {
-            std::ifstream ifs;
-            ifs.open(file_path.string(), std::ifstream::in);
-            if (!ifs.is_open())
-            {
-                return ERR("could not parse Verilog file '" + m_path.string() + "' : unable to open file");
-            }
-            m_fs << ifs.rdbuf();
-            ifs.close();
+            return ERR_APPEND(res.get_error(), "could not parse Verilog file '" + m_path.string() + "' : unable to open file");
+        }
+        else
+        {
+            m_file = res.get();
         }
 
-        // tokenize file
-        tokenize();
-
-        // parse tokens into intermediate format
-        try
+        // lex and parse groups of modules concurrently, fall back to a single group if the pre-scan split the file within a comment or string
+        const std::string_view data = m_file->get_data();
+        std::vector<std::unique_ptr<VerilogParser>> group_parsers;
+        std::vector<Result<std::monostate>> group_results;
+        if (!parse_module_groups(split_into_module_groups(data, std::max(1u, std::thread::hardware_concurrency())), group_parsers, group_results))
         {
-            if (auto res = parse_tokens(); res.is_error())
-            {
-                return ERR_APPEND(res.get_error(), "could not parse Verilog file '" + file_path.string() + "': unable to parse tokens");
-            }
+            parse_module_groups({data}, group_parsers, group_results);
         }
-        catch (TokenStream<std::string>::TokenStreamException& e)
+
+        // merge modules in the order of the file
+        for (u32 i = 0; i < group_parsers.size(); i++)
         {
-            if (e.line_number != (u32)-1)
+            if (group_results.at(i).is_error())
             {
-                return ERR("could not parse Verilog file '" + m_path.string() + "': " + e.message + " (line " + std::to_string(e.line_number) + ")");
+                return std::move(group_results.at(i));
             }
-            else
+
+            for (auto& verilog_module : group_parsers.at(i)->m_modules)
             {
-                return ERR("could not parse Verilog file '" + m_path.string() + "': " + e.message);
+                if (const auto it = m_modules_by_name.find(verilog_module->m_name); it != m_modules_by_name.end())
+                {
+                    return ERR("could not parse Verilog file '" + m_path.string() + "': could not parse module '" + verilog_module->m_name + "' (line "
+                               + std::to_string(verilog_module->m_line_number) + "): a module with the same name already exists (line " + std::to_string(it->second->m_line_number) + ")");
+                }
+                m_modules_by_name[verilog_module->m_name] = verilog_module.get();
+                m_last_module                             = verilog_module->m_name;
+                m_modules.push_back(std::move(verilog_module));
             }
         }
 
+        // the intermediate format owns all of its strings, so the tokens and the mapped file are no longer needed
+        group_parsers.clear();
+        m_file.reset();
+
         if (m_modules.empty())
         {
             return ERR("could not parse Verilog file '" + m_path.string() + "': does not contain any modules");
@@ -644,21 +716,13 @@ namespace hal
         m_gate_types.clear();
         m_gnd_gate_types.clear();
         m_vcc_gate_types.clear();
-        m_instance_name_occurrences.clear();
+        m_signal_name_ids.clear();
+        m_instance_name_ids.clear();
         m_signal_name_occurrences.clear();
-        m_net_by_name.clear();
+        m_instance_name_occurrences.clear();
+        m_nets.clear();
         m_nets_to_merge.clear();
         m_module_ports.clear();
-        for (const auto& module : m_modules)
-        {
-            for (const auto& instance : module->m_instances)
-            {
-                if (!instance->m_is_module)
-                {
-                    instance->m_expanded_port_assignments.clear();
-                }
-            }
-        }
 
         // buffer gate types
         m_gate_types     = gate_library->get_gate_types();
@@ -671,14 +735,14 @@ namespace hal
         {
             return ERR("could not instantiate Verilog netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "': failed to create zero net");
         }
-        m_net_by_name[m_zero_net->get_name()] = m_zero_net;
+        m_nets.push_back(m_zero_net);
 
         m_one_net = m_netlist->create_net("'1'");
         if (m_one_net == nullptr)
         {
             return ERR("could not instantiate Verilog netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "': failed to create one net");
         }
-        m_net_by_name[m_one_net->get_name()] = m_one_net;
+        m_nets.push_back(m_one_net);
 
         // TODO: This tries to find the topmodule by searching for a module that is not referenced by any other module. This fails when there are multiple of those modules (for example with unused modules). There is also a top=1 flag that is set bz yosys for example that we could check first, before using this approach.
         std::map<std::string, u32> module_name_to_refereneces;
@@ -788,126 +852,274 @@ namespace hal
         return OK(std::move(result));
     }
 
+    std::optional<std::unordered_set<std::string>> VerilogParser::get_required_gate_types() const
+    {
+        std::unordered_set<std::string> gate_types;
+        for (const auto& verilog_module : m_modules)
+        {
+            for (const auto& instance : verilog_module->m_instances)
+            {
+                if (m_modules_by_name.find(instance->m_type) == m_modules_by_name.end())
+                {
+                    gate_types.insert(instance->m_type);
+                }
+            }
+        }
+        return gate_types;
+    }
+
     // ###########################################################################
     // ###########          Parse HDL into Intermediate Format          ##########
     // ###########################################################################
 
-    void VerilogParser::tokenize()
+    bool VerilogParser::parse_module_groups(const std::vector<std::string_view>& groups,
+                                            std::vector<std::unique_ptr<VerilogParser>>& group_parsers,
+                                            std::vector<Result<std::monostate>>& group_results) const
     {
-        const std::string delimiters = "`,()[]{}\\#*: ;=./";
-        std::string current_token;
-        u32 line_number = 0;
-
-        std::string line;
-        char prev_char  = 0;
-        bool in_string  = false;
-        bool escaped    = false;
-        bool in_comment = false;
+        // line number of the first line of every group
+        std::vector<u32> first_lines;
+        first_lines.reserve(groups.size());
+        u32 line_number = 1;
+        for (const auto& group : groups)
+        {
+            first_lines.push_back(line_number);
+            line_number += std::count(group.begin(), group.end(), '\n');
+        }
 
-        std::vector<Token<std::string>> parsed_tokens;
-        while (std::getline(m_fs, line))
+        group_parsers.clear();
+        group_results.clear();
+        for (u32 i = 0; i < groups.size(); i++)
         {
-            line_number++;
-            // this->remove_comments(line, multi_line_comment);
+            group_parsers.push_back(std::make_unique<VerilogParser>());
+            group_results.push_back(OK({}));
+        }
 
-            for (char c : line)
+        std::vector<u8> valid_splits(groups.size(), 1);
+        utils::parallel_for_each(0, groups.size(), [&](u32 i) {
+            VerilogParser* parser   = group_parsers.at(i).get();
+            const bool clean_end    = parser->tokenize(groups.at(i), first_lines.at(i));
+            const auto& last_tokens = parser->m_token_stream;
+
+            // every group but the last one must end with the 'endmodule' keyword found by the pre-scan
+            if (i + 1 < groups.size())
             {
-                // deal with comments
-                if (in_comment)
+                if (!clean_end || last_tokens.size() == 0 || last_tokens.at(last_tokens.size() - 1) != "endmodule"
+                    || last_tokens.at(last_tokens.size() - 1).string.end() != groups.at(i).end())
                 {
-                    if (c == '/' && prev_char == '*')
-                    {
-                        in_comment = false;
-                    }
-
-                    prev_char = c;
-                    continue;
+                    valid_splits.at(i) = 0;
+                    return;
                 }
+            }
 
-                // deal with escaping and strings
-                if (!in_string && c == '\\')
+            try
+            {
+                if (auto res = parser->parse_tokens(); res.is_error())
                 {
-                    escaped = true;
-                    continue;
+                    group_results.at(i) = ERR_APPEND(res.get_error(), "could not parse Verilog file '" + m_path.string() + "': unable to parse tokens");
                 }
-                else if (escaped && std::isspace(c))
+            }
+            catch (TokenStream<std::string_view>::TokenStreamException& e)
+            {
+                if (e.line_number != (u32)-1)
                 {
-                    escaped = false;
-                    continue;
+                    group_results.at(i) = ERR("could not parse Verilog file '" + m_path.string() + "': " + e.message + " (line " + std::to_string(e.line_number) + ")");
                 }
-                else if (!escaped && c == '"')
+                else
                 {
-                    in_string = !in_string;
+                    group_results.at(i) = ERR("could not parse Verilog file '" + m_path.string() + "': " + e.message);
                 }
+            }
+
+            // the tokens are not needed anymore
+            parser->m_token_stream = TokenStream<std::string_view>();
+            parser->m_token_storage.clear();
+        });
+
+        return std::all_of(valid_splits.begin(), valid_splits.end(), [](u8 valid) { return valid != 0; });
+    }
+
+    bool VerilogParser::tokenize(std::string_view data, u32 line_number)
+    {
+        const std::string_view delimiters = "`,()[]{}\\#*: ;=./";
+
+        // the current token references the input directly unless its characters are not contiguous within the input (e.g., due to escape characters)
+        const char* token_begin = nullptr;
+        u32 token_size          = 0;
+        bool token_buffered     = false;
+        std::string token_buffer;
+
+        const auto append_to_token = [&](const char* c) {
+            if (token_buffered)
+            {
+                token_buffer += *c;
+            }
+            else if (token_begin == nullptr)
+            {
+                token_begin = c;
+                token_size  = 1;
+            }
+            else if (token_begin + token_size == c)
+            {
+                token_size++;
+            }
+            else
+            {
+                token_buffer.assign(token_begin, token_size);
+                token_buffer += *c;
+                token_buffered = true;
+            }
+        };
+
+        const auto take_token = [&]() -> std::string_view {
+            std::string_view res;
+            if (token_buffered)
+            {
+                res = m_token_storage.emplace_back(std::move(token_buffer));
+                token_buffer.clear();
+                token_buffered = false;
+            }
+            else
+            {
+                res = std::string_view(token_begin, token_size);
+            }
+            token_begin = nullptr;
+            token_size  = 0;
+            return res;
+        };
 
-                if (!in_comment && ((!std::isspace(c) && delimiters.find(c) == std::string::npos) || escaped || in_string))
+        char prev_char  = 0;
+        bool in_string  = false;
+        bool escaped    = false;
+        bool in_comment = false;
+        bool skip_line  = false;
+
+        std::vector<Token<std::string_view>> parsed_tokens;
+        for (const char* it = data.data(); it != data.data() + data.size(); it++)
+        {
+            const char c = *it;
+
+            // end of line
+            if (c == '\n')
+            {
+                if (token_begin != nullptr)
                 {
-                    current_token += c;
+                    parsed_tokens.emplace_back(line_number, take_token());
                 }
-                else
+                line_number++;
+                skip_line = false;
+                continue;
+            }
+            else if (skip_line)
+            {
+                continue;
+            }
+
+            // deal with comments
+            if (in_comment)
+            {
+                if (c == '/' && prev_char == '*')
+                {
+                    in_comment = false;
+                }
+
+                prev_char = c;
+                continue;
+            }
+
+            // deal with escaping and strings
+            if (!in_string && c == '\\')
+            {
+                escaped = true;
+                continue;
+            }
+            else if (escaped && std::isspace(c))
+            {
+                escaped = false;
+                continue;
+            }
+            else if (!escaped && c == '"')
+            {
+                in_string = !in_string;
+            }
+
+            if ((!std::isspace(c) && delimiters.find(c) == std::string_view::npos) || escaped || in_string)
+            {
+                append_to_token(it);
+            }
+            else
+            {
+                // deal with floats
+                if (token_begin != nullptr)
                 {
-                    // deal with floats
-                    if (!current_token.empty())
+                    const std::string_view current_token = take_token();
+                    if (parsed_tokens.size() > 1 && utils::is_digits(parsed_tokens.at(parsed_tokens.size() - 2).string) && parsed_tokens.at(parsed_tokens.size() - 1) == "."
+                        && utils::is_digits(current_token))
                     {
-                        if (parsed_tokens.size() > 1 && utils::is_digits(parsed_tokens.at(parsed_tokens.size() - 2).string) && parsed_tokens.at(parsed_tokens.size() - 1) == "."
-                            && utils::is_digits(current_token))
+                        const std::string_view dot = parsed_tokens.back().string;
+                        parsed_tokens.pop_back();
+                        const std::string_view integral = parsed_tokens.back().string;
+                        if (integral.data() + integral.size() == dot.data() && dot.data() + 1 == current_token.data())
                         {
-                            parsed_tokens.pop_back();
-                            parsed_tokens.back() += "." + current_token;
+                            parsed_tokens.back() = std::string_view(integral.data(), integral.size() + 1 + current_token.size());
                         }
                         else
                         {
-                            parsed_tokens.emplace_back(line_number, current_token);
+                            parsed_tokens.back() = m_token_storage.emplace_back(std::string(integral) + "." + std::string(current_token));
                         }
-                        current_token.clear();
                     }
-
-                    if (!parsed_tokens.empty())
+                    else
                     {
-                        // deal with multi-character tokens
-                        if (c == '(' && parsed_tokens.back() == "#")
-                        {
-                            parsed_tokens.back() = "#(";
-                            continue;
-                        }
-                        else if (c == '*' && parsed_tokens.back() == "(")
-                        {
-                            parsed_tokens.back() = "(*";
-                            continue;
-                        }
-                        else if (c == ')' && parsed_tokens.back() == "*")
-                        {
-                            parsed_tokens.back() = "*)";
-                            continue;
-                        }
-                        // start a comment
-                        else if (c == '/' && parsed_tokens.back() == "/")
-                        {
-                            parsed_tokens.pop_back();
-                            break;
-                        }
-                        else if (c == '*' && parsed_tokens.back() == "/")
-                        {
-                            in_comment = true;
-                            parsed_tokens.pop_back();
-                            continue;
-                        }
+                        parsed_tokens.emplace_back(line_number, current_token);
                     }
+                }
 
-                    if (!std::isspace(c))
+                if (!parsed_tokens.empty())
+                {
+                    // deal with multi-character tokens
+                    if (c == '(' && parsed_tokens.back() == "#")
                     {
-                        parsed_tokens.emplace_back(line_number, std::string(1, c));
+                        parsed_tokens.back() = "#(";
+                        continue;
+                    }
+                    else if (c == '*' && parsed_tokens.back() == "(")
+                    {
+                        parsed_tokens.back() = "(*";
+                        continue;
+                    }
+                    else if (c == ')' && parsed_tokens.back() == "*")
+                    {
+                        parsed_tokens.back() = "*)";
+                        continue;
+                    }
+                    // start a comment
+                    else if (c == '/' && parsed_tokens.back() == "/")
+                    {
+                        parsed_tokens.pop_back();
+                        skip_line = true;
+                        continue;
+                    }
+                    else if (c == '*' && parsed_tokens.back() == "/")
+                    {
+                        in_comment = true;
+                        parsed_tokens.pop_back();
+                        continue;
                     }
                 }
+
+                if (!std::isspace(c))
+                {
+                    parsed_tokens.emplace_back(line_number, std::string_view(it, 1));
+                }
             }
-            if (!current_token.empty())
-            {
-                parsed_tokens.emplace_back(line_number, current_token);
-                current_token.clear();
-            }
+        }
+        if (token_begin != nullptr)
+        {
+            parsed_tokens.emplace_back(line_number, take_token());
         }
 
-        m_token_stream = TokenStream(parsed_tokens, {"(", "["}, {")", "]"});
+        m_token_stream = TokenStream<std::string_view>(std::move(parsed_tokens), {"(", "["}, {")", "]"});
+
+        return !in_comment && !in_string && !escaped && !skip_line;
     }
 
     Result<std::monostate> VerilogParser::parse_tokens()
@@ -946,7 +1158,7 @@ namespace hal
 
         m_token_stream.consume("module", true);
         const u32 line_number         = m_token_stream.peek().number;
-        const std::string module_name = m_token_stream.consume();
+        const std::string module_name = std::string(m_token_stream.consume().string);
 
         // verify entity name
         if (const auto it = m_modules_by_name.find(module_name); it != m_modules_by_name.end())
@@ -971,7 +1183,7 @@ namespace hal
 
         // parse port (declaration) list
         m_token_stream.consume("(", true);
-        Token<std::string> next_token = m_token_stream.peek();
+        Token<std::string_view> next_token = m_token_stream.peek();
         if (next_token == "input" || next_token == "output" || next_token == "inout")
         {
             if (auto res = parse_port_declaration_list(verilog_module_raw); res.is_error())
@@ -1051,12 +1263,12 @@ namespace hal
 
     void VerilogParser::parse_port_list(VerilogModule* verilog_module)
     {
-        TokenStream<std::string> ports_stream = m_token_stream.extract_until(")");
+        TokenStream<std::string_view> ports_stream = m_token_stream.extract_until(")");
         m_token_stream.consume(")", true);
 
         while (ports_stream.remaining() > 0)
         {
-            Token<std::string> next_token = ports_stream.consume();
+            Token<std::string_view> next_token = ports_stream.consume();
             auto port                     = std::make_unique<VerilogPort>();
 
             if (next_token == ".")
@@ -1082,17 +1294,17 @@ namespace hal
 
     Result<std::monostate> VerilogParser::parse_port_declaration_list(VerilogModule* verilog_module)
     {
-        TokenStream<std::string> ports_stream = m_token_stream.extract_until(")");
+        TokenStream<std::string_view> ports_stream = m_token_stream.extract_until(")");
         m_token_stream.consume(")", true);
 
         while (ports_stream.remaining() > 0)
         {
             // direction
-            const Token<std::string> direction_token = ports_stream.consume();
-            PinDirection direction                   = enum_from_string<PinDirection>(direction_token.string, PinDirection::none);
+            const Token<std::string_view> direction_token = ports_stream.consume();
+            PinDirection direction                        = enum_from_string<PinDirection>(std::string(direction_token.string), PinDirection::none);
             if (direction == PinDirection::none || direction == PinDirection::internal)
             {
-                return ERR("could not parse port declaration list: invalid direction '" + direction_token.string + "' (line " + std::to_string(direction_token.number) + ")");
+                return ERR("could not parse port declaration list: invalid direction '" + std::string(direction_token.string) + "' (line " + std::to_string(direction_token.number) + ")");
             }
 
             // ranges
@@ -1108,7 +1320,7 @@ namespace hal
             // port expressions
             do
             {
-                const Token<std::string> next_token = ports_stream.peek();
+                const Token<std::string_view> next_token = ports_stream.peek();
                 if (next_token == "input" || next_token == "output" || next_token == "inout")
                 {
                     break;
@@ -1136,11 +1348,11 @@ namespace hal
     Result<std::monostate> VerilogParser::parse_port_definition(VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
     {
         // port direction
-        const Token<std::string> direction_token = m_token_stream.consume();
-        PinDirection direction                   = enum_from_string<PinDirection>(direction_token.string, PinDirection::none);
+        const Token<std::string_view> direction_token = m_token_stream.consume();
+        PinDirection direction                        = enum_from_string<PinDirection>(std::string(direction_token.string), PinDirection::none);
         if (direction == PinDirection::none || direction == PinDirection::internal)
         {
-            return ERR("could not parse port definition: invalid direction '" + direction_token.string + "' (line " + std::to_string(direction_token.number) + ")");
+            return ERR("could not parse port definition: invalid direction '" + std::string(direction_token.string) + "' (line " + std::to_string(direction_token.number) + ")");
         }
 
         // ranges
@@ -1156,8 +1368,8 @@ namespace hal
         // port expressions
         do
         {
-            Token<std::string> port_expression_token = m_token_stream.consume();
-            std::string port_expression              = port_expression_token.string;
+            Token<std::string_view> port_expression_token = m_token_stream.consume();
+            std::string port_expression                   = std::string(port_expression_token.string);
 
             VerilogPort* port;
             if (const auto it = verilog_module->m_ports_by_expression.find(port_expression); it == verilog_module->m_ports_by_expression.end())
@@ -1189,7 +1401,7 @@ namespace hal
         // consume "wire" or "tri"
         u32 line_number = m_token_stream.consume().number;
 
-        TokenStream<std::string> signal_stream = m_token_stream.extract_until(";");
+        TokenStream<std::string_view> signal_stream = m_token_stream.extract_until(";");
         m_token_stream.consume(";", true);
 
         // extract bounds
@@ -1205,11 +1417,11 @@ namespace hal
         // extract names
         do
         {
-            Token<std::string> signal_name = signal_stream.consume();
+            Token<std::string_view> signal_name = signal_stream.consume();
             if (signal_stream.remaining() > 0 && signal_stream.peek() == "=")
             {
                 VerilogAssignment assignment;
-                assignment.m_variable.push_back(signal_name);
+                assignment.m_variable.push_back(identifier_t(signal_name.string));
                 signal_stream.consume("=", true);
                 if (auto res = parse_assignment_expression(signal_stream.extract_until(",")); res.is_error())
                 {
@@ -1229,7 +1441,7 @@ namespace hal
                 signal->m_ranges = ranges;
             }
             signal->m_attributes.insert(signal->m_attributes.end(), attributes.begin(), attributes.end());
-            verilog_module->m_signals_by_name[signal_name.string] = signal.get();
+            verilog_module->m_signals_by_name[signal->m_name] = signal.get();
             verilog_module->m_signals.push_back(std::move(signal));
 
         } while (signal_stream.consume(",", false));
@@ -1282,7 +1494,7 @@ namespace hal
             // attribute value specified?
             if (m_token_stream.consume("="))
             {
-                attribute.m_value = m_token_stream.consume();
+                attribute.m_value = m_token_stream.consume().string;
 
                 // remove "
                 if (attribute.m_value[0] == '\"' && attribute.m_value.back() == '\"')
@@ -1347,7 +1559,7 @@ namespace hal
             if (m_token_stream.consume(".", false))
             {
                 VerilogPortAssignment port_assignment;
-                port_assignment.m_port_name = m_token_stream.consume().string;
+                port_assignment.m_port_name = std::string(m_token_stream.consume().string);
                 m_token_stream.consume("(", true);
                 if (auto res = parse_assignment_expression(m_token_stream.extract_until(")")); res.is_error())
                 {
@@ -1450,118 +1662,79 @@ namespace hal
         m_netlist->set_design_name(top_module->m_name);
         m_netlist->enable_automatic_net_checks(false);
 
-        std::unordered_map<std::string, u32> instantiation_count;
-
-        // preparations for alias: count the occurences of all names
-        std::queue<VerilogModule*> q;
-        q.push(top_module);
-
-        // top entity instance will be named after its entity, so take into account for aliases
-        m_instance_name_occurrences["top_module"]++;
-
-        // global input/output signals will be named after ports, so take into account for aliases
-        for (const auto& port : top_module->m_ports)
+        // determine all modules instantiated by the top module, parents before their children
+        std::vector<VerilogModule*> instantiated_modules;
+        if (auto res = get_instantiated_modules(top_module); res.is_error())
         {
-            for (const std::string& expanded_port_identifier : port->m_expanded_identifiers)
-            {
-                m_signal_name_occurrences[expanded_port_identifier]++;
-            }
+            return ERR_APPEND(res.get_error(), "could not construct netlist: unable to determine instantiated modules");
         }
-
-        while (!q.empty())
+        else
         {
-            VerilogModule* module = q.front();
-            q.pop();
-
-            instantiation_count[module->m_name]++;
-
-            for (const auto& signal : module->m_signals)
-            {
-                for (const auto& expanded_name : signal->m_expanded_names)
-                {
-                    m_signal_name_occurrences[expanded_name]++;
-                }
-            }
+            instantiated_modules = res.get();
+        }
 
-            for (const auto& instance : module->m_instances)
+        // count the instances of every module
+        for (const auto& verilog_module : m_modules)
+        {
+            verilog_module->m_num_remaining_instances = 0;
+        }
+        top_module->m_num_remaining_instances = 1;
+        for (VerilogModule* verilog_module : instantiated_modules)
+        {
+            for (const auto& instance : verilog_module->m_instances)
             {
-                m_instance_name_occurrences[instance->m_name]++;
-
                 if (const auto it = m_modules_by_name.find(instance->m_type); it != m_modules_by_name.end())
                 {
-                    q.push(it->second);
+                    it->second->m_num_remaining_instances += verilog_module->m_num_remaining_instances;
                 }
             }
         }
 
-        for (auto& [module_name, verilog_module] : m_modules_by_name)
+        for (const auto& [module_name, verilog_module] : m_modules_by_name)
         {
             // detect unused modules
-            if (instantiation_count[module_name] == 0)
+            if (verilog_module->m_num_remaining_instances == 0)
             {
                 log_warning("verilog_parser", "module '{}' has been defined in the netlist but is not instantiated.", module_name);
-                continue;
             }
+        }
 
-            // expand gate pin assignments
-            for (const auto& instance : verilog_module->m_instances)
-            {
-                if (const auto gate_type_it = m_gate_types.find(instance->m_type); gate_type_it != m_gate_types.end())
-                {
-                    // cache pin groups
-                    std::unordered_map<std::string, std::vector<std::string>> pin_groups;
-                    for (const auto pin_group : gate_type_it->second->get_pin_groups())
-                    {
-                        for (const auto pin : pin_group->get_pins())
-                        {
-                            pin_groups[pin_group->get_name()].push_back(pin->get_name());
-                        }
-                    }
-
-                    for (const auto& port_assignment : instance->m_port_assignments)
-                    {
-                        std::vector<std::string> left_port;
-                        if (!port_assignment.m_port_name.has_value())
-                        {
-                            return ERR("could not construct netlist: parsing of unnamed ports is not yet supported");
-                        }
+        // assign dense signal indices and resolve all instances and assignments once per module
+        if (auto res = resolve_signals(instantiated_modules); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not construct netlist: unable to resolve signals");
+        }
 
-                        const auto& port_name = port_assignment.m_port_name.value();
+        // preparations for alias: count the occurences of all names
+        // top entity instance will be named after its entity, so take into account for aliases
+        const u32 top_name_id = intern_name(m_instance_name_ids, m_instance_name_occurrences, "top_module");
+        m_instance_name_occurrences.at(top_name_id)++;
 
-                        if (const auto group_it = pin_groups.find(port_name); group_it != pin_groups.end())
-                        {
-                            left_port = group_it->second;
-                        }
-                        else
-                        {
-                            left_port.push_back(port_name);
-                        }
-                        std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+        // global input/output signals will be named after ports, so take into account for aliases
+        for (const auto& port : top_module->m_ports)
+        {
+            for (const std::string& expanded_port_identifier : port->m_expanded_identifiers)
+            {
+                m_signal_name_occurrences.at(intern_name(m_signal_name_ids, m_signal_name_occurrences, expanded_port_identifier))++;
+            }
+        }
 
-                        if (!right_port.empty())
-                        {
-                            u32 max_size;
-                            if (right_port.size() <= left_port.size())
-                            {
-                                max_size = right_port.size();
-                            }
-                            else
-                            {
-                                max_size = left_port.size();
-                            }
+        for (VerilogModule* verilog_module : instantiated_modules)
+        {
+            for (const u32 name_id : verilog_module->m_signal_name_ids)
+            {
+                m_signal_name_occurrences.at(name_id) += verilog_module->m_num_remaining_instances;
+            }
 
-                            for (u32 i = 0; i < max_size; i++)
-                            {
-                                instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                            }
-                        }
-                    }
-                }
+            for (const auto& instance : verilog_module->m_instances)
+            {
+                m_instance_name_occurrences.at(instance->m_name_id) += verilog_module->m_num_remaining_instances;
             }
         }
 
         // for the top module, generate global i/o signals for all ports
-        std::unordered_map<std::string, std::string> top_assignments;
+        std::vector<u32> top_signal_nets(top_module->m_signal_index_names.size(), NO_NET);
+        u32 top_port_index = 0;
         for (const auto& port : top_module->m_ports)
         {
             for (const std::string& expanded_port_identifier : port->m_expanded_identifiers)
@@ -1572,10 +1745,9 @@ namespace hal
                     return ERR("could not construct netlist: failed to create global I/O net '" + expanded_port_identifier + "'");
                 }
 
-                m_net_by_name[expanded_port_identifier] = global_port_net;
-
                 // assign global port nets to ports of top module
-                top_assignments[expanded_port_identifier] = expanded_port_identifier;
+                top_signal_nets.at(top_module->m_port_signal_indices.at(top_port_index++)) = m_nets.size();
+                m_nets.push_back(global_port_net);
 
                 if (port->m_direction == PinDirection::input || port->m_direction == PinDirection::inout)
                 {
@@ -1595,11 +1767,17 @@ namespace hal
             }
         }
 
-        if (auto res = instantiate_module("top_module", top_module, nullptr, top_assignments); res.is_error())
+        if (auto res = instantiate_module("top_module", top_name_id, top_module, nullptr, std::move(top_signal_nets)); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not construct netlist: unable to instantiate top module");
         }
 
+        // names are no longer required once all instances have been created
+        m_signal_name_ids.clear();
+        m_instance_name_ids.clear();
+        m_signal_name_occurrences   = std::vector<u32>();
+        m_instance_name_occurrences = std::vector<u32>();
+
         // merge nets without gates in between them
         while (!m_nets_to_merge.empty())
         {
@@ -1625,10 +1803,16 @@ namespace hal
                     continue;
                 }
 
-                auto master_net = m_net_by_name.at(master);
+                auto master_net = m_nets.at(master);
                 for (const auto& slave : merge_set)
                 {
-                    auto slave_net = m_net_by_name.at(slave);
+                    auto slave_net = m_nets.at(slave);
+
+                    // slave has already been merged into another master
+                    if (slave_net == nullptr || slave_net == master_net)
+                    {
+                        continue;
+                    }
 
                     // merge sources
                     if (slave_net->is_global_input_net())
@@ -1702,7 +1886,7 @@ namespace hal
                     }
 
                     m_netlist->delete_net(slave_net);
-                    m_net_by_name.erase(slave);
+                    m_nets.at(slave) = nullptr;
                 }
 
                 m_nets_to_merge.erase(master);
@@ -1771,32 +1955,251 @@ namespace hal
             }
         }
 
+        m_nets = std::vector<Net*>();
+        m_module_ports.clear();
+
         m_netlist->enable_automatic_net_checks(true);
         return OK({});
     }
 
+
+    Result<std::vector<VerilogModule*>> VerilogParser::get_instantiated_modules(VerilogModule* top_module) const
+    {
+        // depth-first search in post order, reversed afterwards to obtain parents before their children
+        std::vector<VerilogModule*> post_order;
+        std::unordered_set<VerilogModule*> visited;
+        std::unordered_set<VerilogModule*> on_stack;
+        std::vector<std::pair<VerilogModule*, u32>> stack = {{top_module, 0}};
+        visited.insert(top_module);
+        on_stack.insert(top_module);
+
+        while (!stack.empty())
+        {
+            auto& [verilog_module, instance_index] = stack.back();
+            if (instance_index == verilog_module->m_instances.size())
+            {
+                post_order.push_back(verilog_module);
+                on_stack.erase(verilog_module);
+                stack.pop_back();
+                continue;
+            }
+
+            const VerilogInstance* instance = verilog_module->m_instances.at(instance_index++).get();
+            if (const auto it = m_modules_by_name.find(instance->m_type); it != m_modules_by_name.end())
+            {
+                if (on_stack.find(it->second) != on_stack.end())
+                {
+                    return ERR("module '" + it->second->m_name + "' instantiates itself");
+                }
+
+                if (visited.insert(it->second).second)
+                {
+                    on_stack.insert(it->second);
+                    stack.emplace_back(it->second, 0);
+                }
+            }
+        }
+
+        return OK(std::vector<VerilogModule*>(post_order.rbegin(), post_order.rend()));
+    }
+
+    Result<std::monostate> VerilogParser::resolve_signals(const std::vector<VerilogModule*>& instantiated_modules)
+    {
+        // assign dense signal indices to all expanded port identifiers and signal names, starting with the ports
+        std::unordered_map<const VerilogModule*, std::unordered_map<std::string_view, u32>> signal_indices;
+        for (VerilogModule* verilog_module : instantiated_modules)
+        {
+            auto& module_signal_indices = signal_indices[verilog_module];
+            release_signal_indices(verilog_module);
+
+            const auto get_signal_index = [verilog_module, &module_signal_indices](std::string_view name) {
+                const auto [it, is_new] = module_signal_indices.emplace(name, verilog_module->m_signal_index_names.size());
+                if (is_new)
+                {
+                    verilog_module->m_signal_index_names.push_back(name);
+                }
+                return it->second;
+            };
+
+            for (const auto& port : verilog_module->m_ports)
+            {
+                for (const std::string& expanded_port_identifier : port->m_expanded_identifiers)
+                {
+                    verilog_module->m_port_signal_indices.push_back(get_signal_index(expanded_port_identifier));
+                }
+            }
+
+            for (const auto& signal : verilog_module->m_signals)
+            {
+                for (const std::string& expanded_name : signal->m_expanded_names)
+                {
+                    verilog_module->m_signal_indices.push_back(get_signal_index(expanded_name));
+                    verilog_module->m_signal_name_ids.push_back(intern_name(m_signal_name_ids, m_signal_name_occurrences, expanded_name));
+                }
+            }
+        }
+
+        // cache pins and pin groups of all gate types by name
+        std::unordered_map<const GateType*, std::unordered_map<std::string, std::vector<GatePin*>>> pins_by_name;
+        const auto get_pins = [&pins_by_name](const GateType* gate_type, const std::string& name) -> const std::vector<GatePin*>* {
+            auto [types_it, is_new] = pins_by_name.try_emplace(gate_type);
+            if (is_new)
+            {
+                for (auto* pin : gate_type->get_pins())
+                {
+                    types_it->second[pin->get_name()] = {pin};
+                }
+
+                for (const auto* pin_group : gate_type->get_pin_groups())
+                {
+                    types_it->second[pin_group->get_name()] = pin_group->get_pins();
+                }
+            }
+
+            if (const auto pins_it = types_it->second.find(name); pins_it != types_it->second.end())
+            {
+                return &pins_it->second;
+            }
+            return nullptr;
+        };
+
+        // resolve all assignments and instances to signal indices
+        for (VerilogModule* verilog_module : instantiated_modules)
+        {
+            const auto& module_signal_indices = signal_indices.at(verilog_module);
+
+            const auto resolve = [&module_signal_indices](const std::string& name) -> std::optional<u32> {
+                if (const auto it = module_signal_indices.find(name); it != module_signal_indices.end())
+                {
+                    return it->second;
+                }
+                else if (name == "'0'")
+                {
+                    return SIGNAL_ZERO;
+                }
+                else if (name == "'1'")
+                {
+                    return SIGNAL_ONE;
+                }
+                else if (name == "'Z'" || name == "'X'" || name.empty())
+                {
+                    return SIGNAL_UNCONNECTED;
+                }
+                return std::nullopt;
+            };
+
+            for (const auto& [left_expanded_signal, right_expanded_signal] : verilog_module->m_expanded_assignments)
+            {
+                const std::optional<u32> left  = resolve(left_expanded_signal);
+                const std::optional<u32> right = resolve(right_expanded_signal);
+                if (!left.has_value() || left.value() == SIGNAL_UNCONNECTED)
+                {
+                    return ERR("could not resolve signals of module '" + verilog_module->m_name + "': failed to find signal '" + left_expanded_signal + "'");
+                }
+                if (!right.has_value())
+                {
+                    return ERR("could not resolve signals of module '" + verilog_module->m_name + "': failed to find signal '" + right_expanded_signal + "'");
+                }
+
+                verilog_module->m_assignment_signal_indices.emplace_back(left.value(), right.value());
+            }
+
+            for (const auto& instance : verilog_module->m_instances)
+            {
+                instance->m_name_id = intern_name(m_instance_name_ids, m_instance_name_occurrences, instance->m_name);
+
+                // instance is another module
+                if (const auto module_it = m_modules_by_name.find(instance->m_type); module_it != m_modules_by_name.end())
+                {
+                    instance->m_module = module_it->second;
+
+                    const auto& instance_signal_indices = signal_indices.at(instance->m_module);
+                    for (const auto& [port, assignment] : instance->m_expanded_port_assignments)
+                    {
+                        const std::optional<u32> signal = resolve(assignment);
+                        if (!signal.has_value())
+                        {
+                            return ERR("could not resolve signals of module '" + verilog_module->m_name + "': port assignment '" + port + " = " + assignment + "' of instance '"
+                                       + instance->m_name + "' is invalid");
+                        }
+
+                        if (signal.value() != SIGNAL_UNCONNECTED)
+                        {
+                            instance->m_module_port_signals.emplace_back(instance_signal_indices.at(port), signal.value());
+                        }
+                    }
+                }
+                // otherwise it has to be an element from the gate library
+                else if (const auto gate_type_it = m_gate_types.find(instance->m_type); gate_type_it != m_gate_types.end())
+                {
+                    instance->m_gate_type = gate_type_it->second;
+
+                    for (const auto& port_assignment : instance->m_port_assignments)
+                    {
+                        if (!port_assignment.m_port_name.has_value())
+                        {
+                            return ERR("could not resolve signals of module '" + verilog_module->m_name + "': parsing of unnamed ports is not yet supported");
+                        }
+
+                        const std::string& port_name              = port_assignment.m_port_name.value();
+                        const std::vector<GatePin*>* pins         = get_pins(instance->m_gate_type, port_name);
+                        const std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+
+                        for (u32 i = 0; i < std::min(right_port.size(), (pins != nullptr) ? pins->size() : 1); i++)
+                        {
+                            const std::optional<u32> signal = resolve(right_port.at(i));
+                            if (!signal.has_value())
+                            {
+                                return ERR("could not resolve signals of module '" + verilog_module->m_name + "': failed to assign '" + right_port.at(i) + "' to pin '" + port_name
+                                           + "' of gate '" + instance->m_name + "' of type '" + instance->m_type + "' as the assignment is invalid");
+                            }
+
+                            if (signal.value() == SIGNAL_UNCONNECTED)
+                            {
+                                continue;
+                            }
+
+                            if (pins == nullptr)
+                            {
+                                return ERR("could not resolve signals of module '" + verilog_module->m_name + "': failed to assign net '" + right_port.at(i) + "' to pin '" + port_name
+                                           + "' as it is not a pin of gate '" + instance->m_name + "' of type '" + instance->m_type + "'");
+                            }
+
+                            instance->m_gate_pin_signals.emplace_back(pins->at(i), signal.value());
+                        }
+                    }
+                }
+                else
+                {
+                    return ERR("could not resolve signals of module '" + verilog_module->m_name + "': failed to find gate type '" + instance->m_type + "' of instance '" + instance->m_name
+                               + "' in gate library '" + m_netlist->get_gate_library()->get_name() + "'");
+                }
+            }
+        }
+
+        return OK({});
+    }
+
     Result<Module*> VerilogParser::instantiate_module(const std::string& instance_identifier,
+                                                      const u32 instance_name_id,
                                                       VerilogModule* verilog_module,
                                                       Module* parent,
-                                                      const std::unordered_map<std::string, std::string>& parent_module_assignments)
+                                                      std::vector<u32> signal_nets)
     {
-        std::unordered_map<std::string, std::string> signal_alias;
-        std::unordered_map<std::string, std::string> instance_alias;
-
         // TODO check parent module assignments for port aliases
 
-        instance_alias[instance_identifier] = get_unique_alias(m_instance_name_occurrences, instance_identifier);
+        const std::string instance_alias = get_unique_alias(m_instance_name_occurrences, instance_name_id, instance_identifier);
 
         // create netlist module
         Module* module;
         if (parent == nullptr)
         {
             module = m_netlist->get_top_module();
-            module->set_name(instance_alias.at(instance_identifier));
+            module->set_name(instance_alias);
         }
         else
         {
-            module = m_netlist->create_module(instance_alias.at(instance_identifier), parent);
+            module = m_netlist->create_module(instance_alias, parent);
         }
 
         std::string instance_type = verilog_module->m_name;
@@ -1816,13 +2219,14 @@ namespace hal
         }
 
         // assign module port names and attributes
+        u32 port_index = 0;
         for (const auto& port : verilog_module->m_ports)
         {
             for (const std::string& expanded_port_identifier : port->m_expanded_identifiers)
             {
-                if (const auto it = parent_module_assignments.find(expanded_port_identifier); it != parent_module_assignments.end())
+                if (const u32 net_id = signal_nets.at(verilog_module->m_port_signal_indices.at(port_index++)); net_id != NO_NET)
                 {
-                    Net* port_net            = m_net_by_name.at(it->second);
+                    Net* port_net = m_nets.at(net_id);
                     m_module_ports[port_net].push_back(std::make_tuple(port->m_direction, expanded_port_identifier, module));
 
                     // assign port attributes
@@ -1843,24 +2247,29 @@ namespace hal
             }
         }
 
-        // create internal signals
+        // create internal signals, nets assigned by the parent module take precedence
+        u32 signal_index = 0;
         for (const auto& signal : verilog_module->m_signals)
         {
             for (const std::string& expanded_name : signal->m_expanded_names)
             {
-                signal_alias[expanded_name] = get_unique_alias(m_signal_name_occurrences, expanded_name);
+                const u32 name_id = verilog_module->m_signal_name_ids.at(signal_index);
+                u32& net_id       = signal_nets.at(verilog_module->m_signal_indices.at(signal_index++));
 
                 // create new net for the signal
-                Net* signal_net = m_netlist->create_net(signal_alias.at(expanded_name));
+                Net* signal_net = m_netlist->create_net(get_unique_alias(m_signal_name_occurrences, name_id, expanded_name));
                 if (signal_net == nullptr)
                 {
                     return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to create net '" + expanded_name + "'");
                 }
 
-                m_net_by_name[signal_alias.at(expanded_name)] = signal_net;
+                if (net_id == NO_NET)
+                {
+                    net_id = m_nets.size();
+                }
+                m_nets.push_back(signal_net);
 
                 // assign signal attributes
-
                 for (const VerilogDataEntry& attribute : signal->m_attributes)
                 {
                     if (!signal_net->set_data("attribute", attribute.m_name, "unknown", attribute.m_value))
@@ -1877,40 +2286,39 @@ namespace hal
             }
         }
 
-        // schedule assigned nets for merging
-        for (const auto& [left_expanded_signal, right_expanded_signal] : verilog_module->m_expanded_assignments)
-        {
-            std::string a = left_expanded_signal;
-            std::string b = right_expanded_signal;
-
-            if (const auto parent_it = parent_module_assignments.find(a); parent_it != parent_module_assignments.end())
-            {
-                a = parent_it->second;
-            }
-            else if (const auto alias_it = signal_alias.find(a); alias_it != signal_alias.end())
+        // translate a signal index of this module into a net ID
+        const auto get_net_id = [&signal_nets](const u32 signal) -> u32 {
+            if (signal == SIGNAL_ZERO)
             {
-                a = alias_it->second;
+                return NET_ZERO;
             }
-            else
+            else if (signal == SIGNAL_ONE)
             {
-                return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to find alias for net '" + a + "'");
+                return NET_ONE;
             }
+            return signal_nets.at(signal);
+        };
 
-            if (const auto parent_it = parent_module_assignments.find(b); parent_it != parent_module_assignments.end())
-            {
-                b = parent_it->second;
-            }
-            else if (const auto alias_it = signal_alias.find(b); alias_it != signal_alias.end())
+        // schedule assigned nets for merging
+        for (const auto& [left_signal, right_signal] : verilog_module->m_assignment_signal_indices)
+        {
+            if (right_signal == SIGNAL_UNCONNECTED)
             {
-                b = alias_it->second;
+                continue;
             }
-            else if (b == "'Z'" || b == "'X'")
+
+            const u32 a = get_net_id(left_signal);
+            if (a == NO_NET)
             {
-                continue;
+                return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to find alias for net '"
+                           + std::string(verilog_module->m_signal_index_names.at(left_signal)) + "'");
             }
-            else if (b != "'0'" && b != "'1'")
+
+            const u32 b = get_net_id(right_signal);
+            if (b == NO_NET)
             {
-                return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to find alias for net '" + b + "'");
+                return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to find alias for net '"
+                           + std::string(verilog_module->m_signal_index_names.at(right_signal)) + "'");
             }
 
             m_nets_to_merge[b].push_back(a);
@@ -1922,41 +2330,30 @@ namespace hal
             // will later hold either module or gate, so attributes can be assigned properly
             DataContainer* container = nullptr;
 
-            // assign actual signal names to ports
-            std::unordered_map<std::string, std::string> instance_assignments;
-
             // if the instance is another entity, recursively instantiate it
-            if (auto module_it = m_modules_by_name.find(instance->m_type); module_it != m_modules_by_name.end())
+            if (instance->m_module != nullptr)
             {
-                // expand port assignments
-                for (const auto& [port, assignment] : instance->m_expanded_port_assignments)
+                // assign actual nets to ports
+                std::vector<u32> instance_signal_nets(instance->m_module->m_signal_index_names.size(), NO_NET);
+                for (const auto& [port_signal, signal] : instance->m_module_port_signals)
                 {
-                    if (const auto it = parent_module_assignments.find(assignment); it != parent_module_assignments.end())
+                    if (const u32 net_id = get_net_id(signal); net_id != NO_NET)
                     {
-                        instance_assignments[port] = it->second;
+                        instance_signal_nets.at(port_signal) = net_id;
                     }
                     else
                     {
-                        if (const auto alias_it = signal_alias.find(assignment); alias_it != signal_alias.end())
-                        {
-                            instance_assignments[port] = alias_it->second;
-                        }
-                        else if (assignment == "'0'" || assignment == "'1'")
-                        {
-                            instance_assignments[port] = assignment;
-                        }
-                        else if (assignment != "'Z'" && assignment != "'X'" && assignment != "")
-                        {
-                            return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': port assignment '" + port + " = " + assignment + "' is invalid");
-                        }
+                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': port assignment '"
+                                   + std::string(instance->m_module->m_signal_index_names.at(port_signal)) + " = " + std::string(verilog_module->m_signal_index_names.at(signal))
+                                   + "' is invalid");
                     }
                 }
 
-                if (auto res = instantiate_module(instance->m_name, module_it->second, module, instance_assignments); res.is_error())
+                if (auto res = instantiate_module(instance->m_name, instance->m_name_id, instance->m_module, module, std::move(instance_signal_nets)); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(),
                                       "could not create instance '" + instance_identifier + "' of type '" + instance_type + "': unable to create instance '" + instance->m_name + "' of type '"
-                                          + module_it->second->m_name + "'");
+                                          + instance->m_module->m_name + "'");
                 }
                 else
                 {
@@ -1964,12 +2361,10 @@ namespace hal
                 }
             }
             // otherwise it has to be an element from the gate library
-            else if (const auto gate_type_it = m_gate_types.find(instance->m_type); gate_type_it != m_gate_types.end())
+            else
             {
                 // create the new gate
-                instance_alias[instance->m_name] = get_unique_alias(m_instance_name_occurrences, instance->m_name);
-
-                Gate* new_gate = m_netlist->create_gate(gate_type_it->second, instance_alias.at(instance->m_name));
+                Gate* new_gate = m_netlist->create_gate(instance->m_gate_type, get_unique_alias(m_instance_name_occurrences, instance->m_name_id, instance->m_name));
                 if (new_gate == nullptr)
                 {
                     return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to create gate '" + instance->m_name + "'");
@@ -1994,93 +2389,32 @@ namespace hal
                                + "' as VCC gate");
                 }
 
-                // cache pin names
-                std::unordered_map<std::string, GatePin*> pin_names_map;
-                for (auto* pin : gate_type_it->second->get_pins())
-                {
-                    pin_names_map[pin->get_name()] = pin;
-                }
-
-                // expand pin assignments
-                for (const auto& [pin, assignment] : instance->m_expanded_port_assignments)
+                // connect pins to their nets
+                for (const auto& [pin, signal] : instance->m_gate_pin_signals)
                 {
-                    std::string signal;
-
-                    if (const auto parent_it = parent_module_assignments.find(assignment); parent_it != parent_module_assignments.end())
-                    {
-                        signal = parent_it->second;
-                    }
-                    else if (const auto alias_it = signal_alias.find(assignment); alias_it != signal_alias.end())
+                    const u32 net_id = get_net_id(signal);
+                    if (net_id == NO_NET)
                     {
-                        signal = alias_it->second;
-                    }
-                    else if (assignment == "'0'" || assignment == "'1'")
-                    {
-                        signal = assignment;
-                    }
-                    else if (assignment == "'Z'" || assignment == "'X'")
-                    {
-                        continue;
-                    }
-                    else
-                    {
-                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to assign '" + assignment + "' to pin '" + pin + "' of gate '"
-                                   + instance->m_name + "' of type '" + instance->m_type + "' as the assignment is invalid");
+                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to assign signal'"
+                                   + std::string(verilog_module->m_signal_index_names.at(signal)) + "' to pin '" + pin->get_name() + "' as the signal has not been declared");
                     }
 
-                    // get the respective net for the assignment
-                    if (const auto net_it = m_net_by_name.find(signal); net_it == m_net_by_name.end())
+                    Net* current_net             = m_nets.at(net_id);
+                    const PinDirection direction = pin->get_direction();
+
+                    if ((direction == PinDirection::output || direction == PinDirection::inout) && !current_net->add_source(new_gate, pin))
                     {
-                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to assign signal'" + signal + "' to pin '" + pin
-                                   + "' as the signal has not been declared");
+                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + current_net->get_name()
+                                   + "' as a source to gate '" + new_gate->get_name() + "' via pin '" + pin->get_name() + "'");
                     }
-                    else
-                    {
-                        Net* current_net = net_it->second;
-
-                        // add net src/dst by pin types
-                        bool is_input  = false;
-                        bool is_output = false;
-
-                        if (const auto it = pin_names_map.find(pin); it != pin_names_map.end())
-                        {
-                            PinDirection direction = it->second->get_direction();
-                            if (direction == PinDirection::input || direction == PinDirection::inout)
-                            {
-                                is_input = true;
-                            }
-
-                            if (direction == PinDirection::output || direction == PinDirection::inout)
-                            {
-                                is_output = true;
-                            }
-                        }
 
-                        if (!is_input && !is_output)
-                        {
-                            return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to assign net '" + signal + "' to pin '" + pin
-                                       + "' as it is not a pin of gate '" + new_gate->get_name() + "' of type '" + new_gate->get_type()->get_name() + "'");
-                        }
-
-                        if (is_output && !current_net->add_source(new_gate, pin))
-                        {
-                            return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + signal + "' as a source to gate '"
-                                       + new_gate->get_name() + "' via pin '" + pin + "'");
-                        }
-
-                        if (is_input && !current_net->add_destination(new_gate, pin))
-                        {
-                            return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + signal + "' as a destination to gate '"
-                                       + new_gate->get_name() + "' via pin '" + pin + "'");
-                        }
+                    if ((direction == PinDirection::input || direction == PinDirection::inout) && !current_net->add_destination(new_gate, pin))
+                    {
+                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + current_net->get_name()
+                                   + "' as a destination to gate '" + new_gate->get_name() + "' via pin '" + pin->get_name() + "'");
                     }
                 }
             }
-            else
-            {
-                return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to find gate type '" + instance->m_type + "' in gate library '"
-                           + m_netlist->get_gate_library()->get_name() + "'");
-            }
 
             // assign instance attributes
             for (const VerilogDataEntry& attribute : instance->m_attributes)
@@ -2116,6 +2450,12 @@ namespace hal
             }
         }
 
+        // the signal indices of this module are no longer required once its last instance has been created
+        if (--verilog_module->m_num_remaining_instances == 0)
+        {
+            release_signal_indices(verilog_module);
+        }
+
         return OK(module);
     }
 
@@ -2123,17 +2463,27 @@ namespace hal
     // ###################          Helper Functions          ####################
     // ###########################################################################
 
-    std::string VerilogParser::get_unique_alias(std::unordered_map<std::string, u32>& name_occurrences, const std::string& name) const
+    u32 VerilogParser::intern_name(std::unordered_map<std::string_view, u32>& name_ids, std::vector<u32>& name_occurrences, std::string_view name) const
+    {
+        const auto [it, is_new] = name_ids.emplace(name, name_occurrences.size());
+        if (is_new)
+        {
+            name_occurrences.push_back(0);
+        }
+        return it->second;
+    }
+
+    std::string VerilogParser::get_unique_alias(std::vector<u32>& name_occurrences, const u32 name_id, const std::string& name) const
     {
         // if the name only appears once, we don't have to suffix it
-        if (name_occurrences[name] < 2)
+        if (name_occurrences.at(name_id) < 2)
         {
             return name;
         }
 
-        name_occurrences[name]++;
+        name_occurrences.at(name_id)++;
 
         // otherwise, add a unique string to the name
-        return name + "__[" + std::to_string(name_occurrences[name]) + "]__";
+        return name + "__[" + std::to_string(name_occurrences.at(name_id)) + "]__";
     }
 }    // namespace hal
@@ -1,5 +1,7 @@
 #include "verilog_parser/verilog_parser.h"
 
+#include "hal_core/utilities/compression.h"
+
 #include "netlist_test_utils.h"
 #include "gate_library_test_utils.h"
 
@@ -140,6 +142,57 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing that gzip- and zstd-compressed input files are decompressed transparently.
+     *
+     * Functions: parse
+     */
+    TEST_F(VerilogParserTest, check_compressed_input) 
+    {
+        TEST_START
+        {
+            std::string netlist_input("module top (net_global_in, net_global_out);"
+                                      "  input net_global_in;"
+                                      "  output net_global_out;"
+                                      "BUF gate_0 (.I (net_global_in), .O (net_global_out));"
+                                      "endmodule");
+            const GateLibrary* gate_lib = test_utils::get_gate_library();
+
+            for (const auto& [format, file_name] : std::vector<std::pair<CompressionFormat, std::string>>{{CompressionFormat::gzip, "netlist.v.gz"}, {CompressionFormat::zstd, "netlist.v.zst"}})
+            {
+                if (!compression::is_supported(format))
+                {
+                    continue;
+                }
+
+                std::filesystem::path verilog_file = test_utils::create_sandbox_path(file_name);
+                ASSERT_TRUE(compression::write_file(verilog_file, netlist_input, format).is_ok());
+
+                VerilogParser verilog_parser;
+                auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                ASSERT_TRUE(nl_res.is_ok());
+                std::unique_ptr<Netlist> nl = nl_res.get();
+                ASSERT_NE(nl, nullptr);
+
+                EXPECT_EQ(nl->get_gates().size(), 1);
+                ASSERT_EQ(nl->get_gates(test_utils::gate_type_filter("BUF")).size(), 1);
+                EXPECT_EQ(nl->get_global_input_nets().size(), 1);
+                EXPECT_EQ(nl->get_global_output_nets().size(), 1);
+            }
+            {
+                // truncated input is rejected
+                NO_COUT_TEST_BLOCK;
+                std::filesystem::path verilog_file = test_utils::create_sandbox_path("netlist.v.gz");
+                ASSERT_TRUE(compression::write_file(verilog_file, netlist_input, CompressionFormat::gzip).is_ok());
+                std::filesystem::resize_file(verilog_file, std::filesystem::file_size(verilog_file) / 2);
+
+                VerilogParser verilog_parser;
+                EXPECT_TRUE(verilog_parser.parse_and_instantiate(verilog_file, gate_lib).is_error());
+            }
+        }
+        TEST_END
+    }
+
     /**
      * The same test, as the main example, but use white spaces of different types (' ','\n','\t') in various locations (or remove some unnecessary ones)
      *
@@ -1795,6 +1848,239 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the parsing of files containing many modules, which are lexed and parsed in independent groups. The 'endmodule' keyword
+     * is placed within comments, strings, and identifiers to verify that such occurrences do not split the file at the wrong position.
+     *
+     * Functions: parse
+     */
+    TEST_F(VerilogParserTest, check_module_groups) {
+
+        TEST_START
+            {
+                std::string netlist_input;
+                for (u32 i = 0; i < 16; i++)
+                {
+                    const std::string idx = std::to_string(i);
+                    netlist_input += "(* attr = \"endmodule\" *)\n"
+                                     "module MODULE_" + idx + " (in, out);\n"
+                                     "  input in;\n"
+                                     "  output out;\n"
+                                     "  wire \\net_endmodule ;\n"
+                                     "  // endmodule\n"
+                                     "  /* endmodule\n"
+                                     "     endmodule */\n"
+                                     "BUF gate_0 (.I (in), .O (\\net_endmodule ));\n"
+                                     "BUF gate_1 (.I (\\net_endmodule ), .O (out));\n"
+                                     "endmodule\n";
+                }
+                netlist_input += "module top (global_in, global_out);\n"
+                                 "  input global_in;\n"
+                                 "  output global_out;\n";
+                for (u32 i = 0; i < 16; i++)
+                {
+                    netlist_input += "  wire net_" + std::to_string(i) + ";\n";
+                }
+                for (u32 i = 0; i < 16; i++)
+                {
+                    const std::string in = (i == 0) ? "global_in" : "net_" + std::to_string(i - 1);
+                    netlist_input += "MODULE_" + std::to_string(i) + " inst_" + std::to_string(i) + " (.in (" + in + "), .out (net_" + std::to_string(i) + "));\n";
+                }
+                netlist_input += "assign global_out = net_15;\n"
+                                 "endmodule";
+
+                const GateLibrary* gate_lib = test_utils::get_gate_library();
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", netlist_input);
+                VerilogParser verilog_parser;
+                auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                ASSERT_TRUE(nl_res.is_ok());
+                std::unique_ptr<Netlist> nl = nl_res.get();
+                ASSERT_NE(nl, nullptr);
+
+                EXPECT_EQ(nl->get_gates().size(), 32);
+                EXPECT_EQ(nl->get_top_module()->get_type(), "top");
+                EXPECT_EQ(nl->get_top_module()->get_submodules().size(), 16);
+                for (Module* mod : nl->get_top_module()->get_submodules())
+                {
+                    EXPECT_EQ(mod->get_data("attribute", "attr"), std::make_tuple("unknown", "endmodule"));
+                }
+            }
+            {
+                // modules with the same name in different parts of the file
+                std::string netlist_input;
+                for (u32 i = 0; i < 16; i++)
+                {
+                    netlist_input += "module MODULE_" + std::to_string(i % 15) + " (in, out);\n"
+                                     "  input in;\n"
+                                     "  output out;\n"
+                                     "BUF gate_0 (.I (in), .O (out));\n"
+                                     "endmodule\n";
+                }
+
+                const GateLibrary* gate_lib = test_utils::get_gate_library();
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", netlist_input);
+                VerilogParser verilog_parser;
+                auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                EXPECT_TRUE(nl_res.is_error());
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the instantiation of modules that are instantiated many times within a deep hierarchy, as well as the repeated
+     * instantiation of the same parsed netlist.
+     *
+     * Functions: parse, instantiate
+     */
+    TEST_F(VerilogParserTest, check_repeated_instantiation) {
+
+        TEST_START
+            {
+                // every level instantiates the level below twice, resulting in 64 leaf modules containing one gate each
+                std::string netlist_input("module LEVEL_0 (in, out);\n"
+                                          "  input in;\n"
+                                          "  output out;\n"
+                                          "  wire net_0;\n"
+                                          "  assign net_0 = in;\n"
+                                          "BUF gate_0 (.I (net_0), .O (out));\n"
+                                          "endmodule\n");
+                for (u32 i = 1; i <= 6; i++)
+                {
+                    const std::string lower = "LEVEL_" + std::to_string(i - 1);
+                    netlist_input += "module LEVEL_" + std::to_string(i) + " (in, out);\n"
+                                     "  input in;\n"
+                                     "  output out;\n"
+                                     "  wire net_0;\n"
+                                     + lower + " inst_0 (.in (in), .out (net_0));\n"
+                                     + lower + " inst_1 (.in (net_0), .out (out));\n"
+                                     "endmodule\n";
+                }
+                netlist_input += "module top (global_in, global_out);\n"
+                                 "  input global_in;\n"
+                                 "  output global_out;\n"
+                                 "LEVEL_6 inst_top (.in (global_in), .out (global_out));\n"
+                                 "endmodule";
+
+                const GateLibrary* gate_lib = test_utils::get_gate_library();
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", netlist_input);
+                VerilogParser verilog_parser;
+                ASSERT_TRUE(verilog_parser.parse(verilog_file).is_ok());
+
+                // instantiating the same parsed netlist twice must yield identical netlists
+                for (u32 round = 0; round < 2; round++)
+                {
+                    auto nl_res = verilog_parser.instantiate(gate_lib);
+                    ASSERT_TRUE(nl_res.is_ok());
+                    std::unique_ptr<Netlist> nl = nl_res.get();
+                    ASSERT_NE(nl, nullptr);
+
+                    EXPECT_EQ(nl->get_gates().size(), 64);
+                    EXPECT_EQ(nl->get_modules().size(), 1 + 127);
+
+                    // all gates form a single chain from the global input to the global output
+                    std::set<std::string> gate_names;
+                    for (const Gate* gate : nl->get_gates())
+                    {
+                        gate_names.insert(gate->get_name());
+                        ASSERT_NE(gate->get_fan_in_net("I"), nullptr);
+                        ASSERT_NE(gate->get_fan_out_net("O"), nullptr);
+                        EXPECT_EQ(gate->get_fan_in_net("I")->get_num_of_sources() + (gate->get_fan_in_net("I")->is_global_input_net() ? 1 : 0), 1);
+                    }
+                    EXPECT_EQ(gate_names.size(), 64);
+                    EXPECT_EQ(nl->get_global_input_nets().size(), 1);
+                    EXPECT_EQ(nl->get_global_output_nets().size(), 1);
+                    EXPECT_EQ(nl->get_nets().size(), 65);
+                }
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the collection of gate types required from the gate library, which excludes types defined as modules.
+     *
+     * Functions: parse, get_required_gate_types
+     */
+    TEST_F(VerilogParserTest, check_required_gate_types) {
+
+        TEST_START
+            {
+                std::string netlist_input("module MODULE_CHILD (in, out);\n"
+                                          "  input in;\n"
+                                          "  output out;\n"
+                                          "BUF gate_0 (.I (in), .O (out));\n"
+                                          "endmodule\n"
+                                          "module top (global_in_0, global_in_1, global_out);\n"
+                                          "  input global_in_0, global_in_1;\n"
+                                          "  output global_out;\n"
+                                          "  wire net_0;\n"
+                                          "AND2 gate_1 (.I0 (global_in_0), .I1 (global_in_1), .O (net_0));\n"
+                                          "MODULE_CHILD child (.in (net_0), .out (global_out));\n"
+                                          "endmodule");
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", netlist_input);
+                VerilogParser verilog_parser;
+                ASSERT_TRUE(verilog_parser.parse(verilog_file).is_ok());
+
+                const auto gate_types = verilog_parser.get_required_gate_types();
+                ASSERT_TRUE(gate_types.has_value());
+                EXPECT_EQ(gate_types.value(), std::unordered_set<std::string>({"BUF", "AND2"}));
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the tokenization of tokens that are not contiguous within the input file, i.e., escape characters within identifiers and
+     * floating point numbers or multi-character tokens separated by whitespace, as well as Windows line endings.
+     *
+     * Functions: parse
+     */
+    TEST_F(VerilogParserTest, check_non_contiguous_tokens) {
+
+        TEST_START
+            {
+                std::string netlist_input("module top (\r\n"
+                                        "  global_in,\r\n"
+                                        "  global_out\r\n"
+                                        " ) ;\r\n"
+                                        "  input global_in;\r\n"
+                                        "  output global_out;\r\n"
+                                        "  wire net\\_0 ;\r\n"
+                                        "BUF # (\r\n"
+                                        "  .key_floating_point(1 . 5),\r\n"
+                                        "  .key_integer(123)\r\n"
+                                        ") \r\n"
+                                        "gate_0 (\r\n"
+                                        "  .I (global_in ),\r\n"
+                                        "  .O (net_0 )\r\n"
+                                        " ) ;\r\n"
+                                        "BUF gate_1 (\r\n"
+                                        "  .I (net_\\0 ),\r\n"
+                                        "  .O (global_out )\r\n"
+                                        " ) ;\r\n"
+                                        "endmodule");
+                const GateLibrary* gate_lib = test_utils::get_gate_library();
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", netlist_input);
+                VerilogParser verilog_parser;
+                auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                ASSERT_TRUE(nl_res.is_ok());
+                std::unique_ptr<Netlist> nl = nl_res.get();
+                ASSERT_NE(nl, nullptr);
+
+                ASSERT_EQ(nl->get_gates(test_utils::gate_filter("BUF", "gate_0")).size(), 1);
+                ASSERT_EQ(nl->get_gates(test_utils::gate_filter("BUF", "gate_1")).size(), 1);
+                Gate* gate_0 = *nl->get_gates(test_utils::gate_filter("BUF", "gate_0")).begin();
+                Gate* gate_1 = *nl->get_gates(test_utils::gate_filter("BUF", "gate_1")).begin();
+
+                EXPECT_EQ(gate_0->get_data("generic", "key_floating_point"), std::make_tuple("floating_point", "1.5"));
+                EXPECT_EQ(gate_0->get_data("generic", "key_integer"), std::make_tuple("integer", "123"));
+
+                // both escaped spellings refer to the same net
+                ASSERT_NE(gate_0->get_fan_out_net("O"), nullptr);
+                EXPECT_EQ(gate_0->get_fan_out_net("O")->get_name(), "net_0");
+                EXPECT_EQ(gate_0->get_fan_out_net("O"), gate_1->get_fan_in_net("I"));
+            }
+        TEST_END
+    }
+
     /**
      * Testing the usage of attributes for gates nets and modules
      *
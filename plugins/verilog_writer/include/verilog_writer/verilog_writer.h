@@ -51,7 +51,8 @@ namespace hal
         ~VerilogWriter() = default;
 
         /**
-         * Write the netlist to a Verilog file at the provided location.
+         * Write the netlist to a Verilog file at the provided location.<br>
+         * Module declarations are rendered in parallel and streamed to the file in hierarchical order.
          *
          * @param[in] netlist - The netlist.
          * @param[in] file_path - The output path.
@@ -62,10 +63,7 @@ namespace hal
     private:
         static const std::set<std::string> valid_types;
 
-        Result<std::monostate> write_module_declaration(std::stringstream& res_stream,
-                                                        const Module* module,
-                                                        std::unordered_map<const Module*, std::string>& module_type_aliases,
-                                                        std::unordered_map<std::string, u32>& module_type_occurrences) const;
+        Result<std::monostate> write_module_declaration(std::stringstream& res_stream, const Module* module, const std::unordered_map<const Module*, std::string>& module_type_aliases) const;
         Result<std::monostate> write_gate_instance(std::stringstream& res_stream,
                                                    const Gate* gate,
                                                    std::unordered_map<const DataContainer*, std::string>& aliases,
@@ -74,7 +72,7 @@ namespace hal
                                                      const Module* module,
                                                      std::unordered_map<const DataContainer*, std::string>& aliases,
                                                      std::unordered_map<std::string, u32>& identifier_occurrences,
-                                                     std::unordered_map<const Module*, std::string>& module_type_aliases) const;
+                                                     const std::unordered_map<const Module*, std::string>& module_type_aliases) const;
         Result<std::monostate> write_parameter_assignments(std::stringstream& res_stream, const DataContainer* container) const;
         Result<std::monostate> write_pin_assignments(std::stringstream& res_stream,
                                                      const std::vector<std::pair<std::string, std::vector<const Net*>>>& pin_assignments,
@@ -5,17 +5,27 @@
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel_for_each.h"
 
+#include <algorithm>
 #include <fstream>
+#include <thread>
 
 namespace hal
 {
     const std::set<std::string> VerilogWriter::valid_types = {"string", "integer", "floating_point", "bit_value", "bit_vector", "bit_string"};
 
-    Result<std::monostate> VerilogWriter::write(Netlist* netlist, const std::filesystem::path& file_path)
+    namespace
     {
-        std::stringstream res_stream;
+        // number of module declarations rendered per thread before the batch is written to the file
+        const u32 MODULES_PER_THREAD = 16;
+
+        // size of the buffer between the rendered declarations and the output file
+        const u64 WRITE_BUFFER_SIZE = 1 << 20;
+    }    // namespace
 
+    Result<std::monostate> VerilogWriter::write(Netlist* netlist, const std::filesystem::path& file_path)
+    {
         if (netlist == nullptr)
         {
             return ERR("could not write netlist to Verilog file '" + file_path.string() + "': netlist is a 'nullptr'");
@@ -26,26 +36,26 @@ namespace hal
             return ERR("could not write netlist to Verilog file '" + file_path.string() + "': file path is empty");
         }
 
-        // get modules in hierarchical order (bottom-up)
+        // get modules in hierarchical order (bottom-up), visiting submodules by ascending ID so that the output is deterministic
         std::vector<Module*> ordered_modules;
         {
-            const std::vector<Module*> modules = netlist->get_modules();
-            std::unordered_set<Module*> modules_set(modules.begin(), modules.end());
-
-            while (!modules_set.empty())
+            std::vector<std::pair<Module*, bool>> stack = {{netlist->get_top_module(), false}};
+            while (!stack.empty())
             {
-                for (auto it = modules_set.begin(); it != modules_set.end();)
+                const auto [mod, visited] = stack.back();
+                stack.pop_back();
+                if (visited)
                 {
-                    std::vector<Module*> submodules = (*it)->get_submodules();
-                    if (submodules.empty() || std::all_of(submodules.begin(), submodules.end(), [modules_set](Module* submod) { return modules_set.find(submod) == modules_set.end(); }))
-                    {
-                        ordered_modules.push_back(*it);
-                        it = modules_set.erase(it);
-                    }
-                    else
-                    {
-                        it++;
-                    }
+                    ordered_modules.push_back(mod);
+                    continue;
+                }
+
+                stack.push_back({mod, true});
+                std::vector<Module*> submodules = mod->get_submodules();
+                std::sort(submodules.begin(), submodules.end(), [](const Module* a, const Module* b) { return a->get_id() > b->get_id(); });
+                for (Module* submod : submodules)
+                {
+                    stack.push_back({submod, false});
                 }
             }
 
@@ -54,54 +64,88 @@ namespace hal
 
         // TODO take care of 1 and 0 nets (probably rework their handling within the core to supply a "is_gnd_net" and "is_vcc_net" function)
 
-        std::unordered_map<const Module*, std::string> module_aliases;
-        std::unordered_map<std::string, u32> module_identifier_occurrences;
-        for (Module* mod : ordered_modules)
+        // module type aliases are shared by all declarations, so they are assigned upfront
+        std::unordered_map<const Module*, std::string> module_type_aliases;
+        std::unordered_map<std::string, u32> module_type_occurrences;
+        for (const Module* mod : ordered_modules)
         {
-            if (auto res = write_module_declaration(res_stream, mod, module_aliases, module_identifier_occurrences); res.is_error())
+            // empty modules are not declared
+            if (mod->get_gates(nullptr, true).empty() && !mod->is_top_module())
             {
-                return ERR_APPEND(res.get_error(), "could not write netlist to Verilog file '" + file_path.string() + "': failed to write module declaration");
+                continue;
             }
-            res_stream << std::endl;
+
+            // deal with unspecified module type
+            std::string module_type = mod->get_type();
+            if (module_type.empty())
+            {
+                module_type = mod->get_name();
+                if (!mod->is_top_module())
+                {
+                    module_type += "_type";
+                }
+            }
+            module_type_aliases[mod] = get_unique_alias(module_type_occurrences, module_type);
         }
 
-        // write to file
+        std::vector<char> write_buffer(WRITE_BUFFER_SIZE);
         std::ofstream file;
+        file.rdbuf()->pubsetbuf(write_buffer.data(), write_buffer.size());
         file.open(file_path.string(), std::ofstream::out);
         if (!file.is_open())
         {
             return ERR("could not write netlist to Verilog file '" + file_path.string() + "': failed to open file");
         }
         file << "`timescale 1 ps/1 ps" << std::endl;
-        file << res_stream.str();
+
+        // module declarations only depend on their own identifiers and the module type aliases, so they are rendered in parallel and written in order
+        const u32 batch_size = std::max(1u, std::thread::hardware_concurrency()) * MODULES_PER_THREAD;
+        std::vector<std::stringstream> buffers(batch_size);
+        std::vector<Result<std::monostate>> results(batch_size, OK({}));
+        for (u32 batch_begin = 0; batch_begin < ordered_modules.size(); batch_begin += batch_size)
+        {
+            const u32 batch_end = std::min((u32)ordered_modules.size(), batch_begin + batch_size);
+            utils::parallel_for_each(batch_begin, batch_end, [this, &ordered_modules, &module_type_aliases, &buffers, &results, batch_begin](u32 i) {
+                std::stringstream& buffer = buffers[i - batch_begin];
+                results[i - batch_begin]  = write_module_declaration(buffer, ordered_modules[i], module_type_aliases);
+                buffer << std::endl;
+            });
+
+            for (u32 i = batch_begin; i < batch_end; i++)
+            {
+                if (results[i - batch_begin].is_error())
+                {
+                    file.close();
+                    std::filesystem::remove(file_path);
+                    return ERR_APPEND(results[i - batch_begin].get_error(), "could not write netlist to Verilog file '" + file_path.string() + "': failed to write module declaration");
+                }
+
+                std::stringstream& buffer = buffers[i - batch_begin];
+                file << buffer.rdbuf();
+                buffer.str(std::string());
+                buffer.clear();
+            }
+        }
+
         file.close();
+        if (file.fail())
+        {
+            return ERR("could not write netlist to Verilog file '" + file_path.string() + "': failed to write file");
+        }
 
         return OK({});
     }
 
     Result<std::monostate> VerilogWriter::write_module_declaration(std::stringstream& res_stream,
                                                                    const Module* module,
-                                                                   std::unordered_map<const Module*, std::string>& module_type_aliases,
-                                                                   std::unordered_map<std::string, u32>& module_type_occurrences) const
+                                                                   const std::unordered_map<const Module*, std::string>& module_type_aliases) const
     {
-        // deal with empty modules
-        if (module->get_gates(nullptr, true).empty() && !module->is_top_module())
+        // empty modules have not been assigned an alias and are not declared
+        if (module_type_aliases.find(module) == module_type_aliases.end())
         {
             return OK({});
         }
 
-        // deal with unspecified module type
-        std::string module_type = module->get_type();
-        if (module_type.empty())
-        {
-            module_type = module->get_name();
-            if (!module->is_top_module())
-            {
-                module_type += "_type";
-            }
-        }
-        module_type_aliases[module] = get_unique_alias(module_type_occurrences, module_type);
-
         if (const std::string& design_name = module->get_netlist()->get_design_name(); module_type_aliases.at(module) == "top_module" && !design_name.empty())
         {
             res_stream << "module " << escape(design_name);
@@ -170,7 +214,11 @@ namespace hal
         port_nets.reserve(output_nets_tmp.size());
         port_nets.insert(output_nets_tmp.begin(), output_nets_tmp.end());
 
-        for (Net* net : module->get_nets())
+        // nets are stored unordered, so they are declared by ascending ID
+        const std::unordered_set<Net*> module_nets = module->get_nets();
+        std::vector<Net*> nets(module_nets.begin(), module_nets.end());
+        std::sort(nets.begin(), nets.end(), [](const Net* a, const Net* b) { return a->get_id() < b->get_id(); });
+        for (Net* net : nets)
         {
             if (port_nets.find(net) != port_nets.end())
             {
@@ -199,6 +247,12 @@ namespace hal
         // write module instances
         for (const Module* sub_module : module->get_submodules())
         {
+            // empty modules are not declared and therefore not instantiated
+            if (module_type_aliases.find(sub_module) == module_type_aliases.end())
+            {
+                continue;
+            }
+
             res_stream << std::endl;
             if (auto res = write_module_instance(res_stream, sub_module, aliases, identifier_occurrences, module_type_aliases); res.is_error())
             {
@@ -278,9 +332,15 @@ namespace hal
                                                                 const Module* module,
                                                                 std::unordered_map<const DataContainer*, std::string>& aliases,
                                                                 std::unordered_map<std::string, u32>& identifier_occurrences,
-                                                                std::unordered_map<const Module*, std::string>& module_type_aliases) const
+                                                                const std::unordered_map<const Module*, std::string>& module_type_aliases) const
     {
-        res_stream << "    " << escape(module_type_aliases.at(module));
+        const auto type_it = module_type_aliases.find(module);
+        if (type_it == module_type_aliases.end())
+        {
+            return ERR("could not write sub-module '" + module->get_name() + "' with ID " + std::to_string(module->get_id()) + ": module is empty and has not been declared");
+        }
+
+        res_stream << "    " << escape(type_it->second);
         if (auto res = write_parameter_assignments(res_stream, module); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not write sub-module '" + module->get_name() + "' with ID " + std::to_string(module->get_id()) + ": failed to write parameter assignments");
@@ -6,6 +6,9 @@
 #include "hal_core/plugin_system/plugin_manager.h"
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
 
+#include <fstream>
+#include <thread>
+
 namespace hal 
 {
     class VerilogWriterTest : public ::testing::Test {
@@ -425,4 +428,92 @@ namespace hal
             }
         TEST_END
     }
+    /**
+     * Test writing a netlist with more module declarations than are rendered in a single batch, including nested and empty modules.
+     * The output must be deterministic and parse back into an equivalent netlist.
+     *
+     * Functions: write
+     */
+    TEST_F(VerilogWriterTest, check_many_modules) {
+        TEST_START
+            {
+                // a chain of buffers, each in its own module, with groups of four modules nested in a common parent module
+                const u32 num_stages = 2 * 16 * std::max(1u, std::thread::hardware_concurrency()) + 3;
+                std::unique_ptr<Netlist> nl = std::make_unique<Netlist>(m_gl);
+                {
+                    std::vector<Gate*> bufs;
+                    for (u32 i = 0; i < num_stages; i++)
+                    {
+                        bufs.push_back(nl->create_gate(m_gl->get_gate_type_by_name("BUF"), "buf_" + std::to_string(i)));
+                        if (i > 0)
+                        {
+                            test_utils::connect(nl.get(), bufs.at(i - 1), "O", bufs.at(i), "I", "net_" + std::to_string(i));
+                        }
+                    }
+                    test_utils::connect_global_in(nl.get(), bufs.front(), "I", "in");
+                    test_utils::connect_global_out(nl.get(), bufs.back(), "O", "out");
+
+                    Module* group = nullptr;
+                    for (u32 i = 0; i < num_stages; i++)
+                    {
+                        if (i % 4 == 0)
+                        {
+                            group = nl->create_module("group_" + std::to_string(i / 4), nl->get_top_module());
+                        }
+                        ASSERT_NE(nl->create_module("stage_" + std::to_string(i), group, {bufs.at(i)}), nullptr);
+                    }
+
+                    // empty modules, including an empty module within an empty module, are not written
+                    Module* empty_0 = nl->create_module("empty_0", nl->get_top_module());
+                    ASSERT_NE(nl->create_module("empty_1", empty_0), nullptr);
+                    ASSERT_NE(nl->create_module("empty_2", group), nullptr);
+                }
+
+                VerilogWriter verilog_writer;
+                std::filesystem::path path_netlist = test_utils::create_sandbox_path("test.v");
+                ASSERT_TRUE(verilog_writer.write(nl.get(), path_netlist).is_ok());
+                std::filesystem::path path_netlist_2 = test_utils::create_sandbox_path("test_2.v");
+                ASSERT_TRUE(verilog_writer.write(nl.get(), path_netlist_2).is_ok());
+
+                const auto read_file = [](const std::filesystem::path& path) {
+                    std::ifstream ifs(path);
+                    return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+                };
+                const std::string content = read_file(path_netlist);
+                EXPECT_EQ(read_file(path_netlist_2), content);
+                EXPECT_EQ(content.find("empty_"), std::string::npos);
+
+                VerilogParser verilog_parser;
+                auto parsed_nl_res = verilog_parser.parse_and_instantiate(path_netlist, m_gl);
+                ASSERT_TRUE(parsed_nl_res.is_ok()) << parsed_nl_res.get_error().get();
+                std::unique_ptr<Netlist> parsed_nl = parsed_nl_res.get();
+                ASSERT_NE(parsed_nl, nullptr);
+
+                const u32 num_groups = (num_stages + 3) / 4;
+                EXPECT_EQ(parsed_nl->get_gates().size(), num_stages);
+                EXPECT_EQ(parsed_nl->get_modules().size(), 1 + num_groups + num_stages);
+                ASSERT_EQ(parsed_nl->get_global_input_nets().size(), 1);
+                ASSERT_EQ(parsed_nl->get_global_output_nets().size(), 1);
+
+                // every buffer is in its own module within the correct group and drives the next buffer
+                const Net* net = parsed_nl->get_global_input_nets().front();
+                for (u32 i = 0; i < num_stages; i++)
+                {
+                    ASSERT_EQ(net->get_destinations().size(), 1);
+                    const Gate* buf = net->get_destinations().front()->get_gate();
+                    EXPECT_EQ(buf->get_name(), "buf_" + std::to_string(i));
+
+                    const Module* stage = buf->get_module();
+                    EXPECT_EQ(stage->get_name(), "stage_" + std::to_string(i));
+                    ASSERT_NE(stage->get_parent_module(), nullptr);
+                    EXPECT_EQ(stage->get_parent_module()->get_name(), "group_" + std::to_string(i / 4));
+                    EXPECT_TRUE(stage->get_parent_module()->get_parent_module()->is_top_module());
+
+                    net = buf->get_fan_out_net("O");
+                    ASSERT_NE(net, nullptr);
+                }
+                EXPECT_TRUE(net->is_global_output_net());
+            }
+        TEST_END
+    }
 } //namespace hal
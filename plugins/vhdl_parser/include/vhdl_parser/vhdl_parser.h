@@ -30,13 +30,14 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #include "hal_core/utilities/result.h"
 #include "hal_core/utilities/special_strings.h"
 #include "hal_core/utilities/token_stream.h"
 #include "vhdl_parser/vhdl_entity.h"
 
 #include <optional>
-#include <sstream>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -68,6 +69,13 @@ namespace hal
          */
         Result<std::unique_ptr<Netlist>> instantiate(const GateLibrary* gate_library) override;
 
+        /**
+         * Get the names of all types instantiated within the parsed VHDL netlist that are not defined as entities and hence must be provided by the gate library.
+         *
+         * @returns The names of the required gate types.
+         */
+        std::optional<std::unordered_set<std::string>> get_required_gate_types() const override;
+
     private:
         enum class AttributeTarget
         {
@@ -79,7 +87,7 @@ namespace hal
         using ci_string          = core_strings::CaseInsensitiveString;
         using attribute_buffer_t = std::map<AttributeTarget, std::map<ci_string, std::tuple<u32, std::string, std::string, std::string>>>;
 
-        std::stringstream m_fs;
+        std::unique_ptr<MemoryMappedFile> m_file;
         std::filesystem::path m_path;
 
         // temporary netlist
@@ -89,9 +97,15 @@ namespace hal
         std::unordered_map<ci_string, VHDLEntity> m_entities;
         ci_string m_last_entity;
 
-        // token stream of entire input file
+        // token stream of the input parsed by this parser
         TokenStream<ci_string> m_token_stream;
 
+        // dependencies on preceding parts of the file, only recorded when parsing a group of entities independently
+        bool m_is_group_parser = false;
+        std::vector<std::pair<ci_string, u32>> m_unresolved_entities;
+        std::vector<std::pair<ci_string, u32>> m_unresolved_attribute_types;
+        std::optional<std::set<ci_string>> m_libraries_at_first_instance;
+
         // some caching
         std::unordered_map<ci_string, GateType*> m_gate_types;
         std::unordered_map<ci_string, GateType*> m_vcc_gate_types;
@@ -114,7 +128,9 @@ namespace hal
         std::unordered_map<ci_string, std::vector<ci_string>> m_nets_to_merge;
 
         // parse HDL into intermediate format
-        void tokenize();
+        void parse_entity_groups(const std::vector<std::string_view>& groups, std::vector<std::unique_ptr<VHDLParser>>& group_parsers, std::vector<Result<std::monostate>>& group_results) const;
+        bool merge_entity_groups(std::vector<std::unique_ptr<VHDLParser>>& group_parsers, const std::vector<Result<std::monostate>>& group_results);
+        bool tokenize(std::string_view data, u32 line_number);
         Result<std::monostate> parse_tokens();
         void parse_library();
         Result<std::monostate> parse_entity();
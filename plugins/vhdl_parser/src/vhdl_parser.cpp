@@ -6,55 +6,153 @@
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/utilities/enums.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel_for_each.h"
 #include "hal_core/utilities/utils.h"
 
 #include <fstream>
 #include <iomanip>
 #include <queue>
+#include <thread>
 
 namespace hal
 {
+    namespace
+    {
+        /**
+         * Checks whether the line starting at the given position begins with the given keyword (case-insensitive) followed by whitespace.
+         */
+        bool line_starts_with_keyword(std::string_view data, u64 pos, std::string_view keyword)
+        {
+            pos = data.find_first_not_of(" \t", pos);
+            if (pos == std::string_view::npos || data.size() - pos <= keyword.size())
+            {
+                return false;
+            }
+
+            for (u64 i = 0; i < keyword.size(); i++)
+            {
+                if (std::tolower(static_cast<unsigned char>(data[pos + i])) != keyword[i])
+                {
+                    return false;
+                }
+            }
+
+            return std::isspace(static_cast<unsigned char>(data[pos + keyword.size()]));
+        }
+
+        /**
+         * Splits the file contents into at most max_num_groups groups of roughly equal size.
+         * A group always begins with a line starting with the keyword 'entity', including the preceding comments and library clauses.
+         * Dependencies between groups are not resolved here but detected when merging the parsed groups.
+         */
+        std::vector<std::string_view> split_into_entity_groups(std::string_view data, u32 max_num_groups)
+        {
+            std::vector<u64> line_begins;
+            for (u64 pos = 0; pos < data.size();)
+            {
+                line_begins.push_back(pos);
+                if (pos = data.find('\n', pos); pos == std::string_view::npos)
+                {
+                    break;
+                }
+                pos++;
+            }
+
+            // candidate boundaries are the beginnings of entity declarations, moved upwards past any blank lines, comments, and library clauses belonging to them
+            std::vector<u64> boundaries;
+            for (u64 i = 1; i < line_begins.size(); i++)
+            {
+                if (!line_starts_with_keyword(data, line_begins.at(i), "entity"))
+                {
+                    continue;
+                }
+
+                u64 j = i;
+                while (j > 1)
+                {
+                    const u64 prev_begin = line_begins.at(j - 1);
+                    const u64 prev_text  = data.find_first_not_of(" \t\r", prev_begin);
+                    if (prev_text == std::string_view::npos || data[prev_text] == '\n' || data.substr(prev_text, 2) == "--" || line_starts_with_keyword(data, prev_begin, "library")
+                        || line_starts_with_keyword(data, prev_begin, "use"))
+                    {
+                        j--;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                if (boundaries.empty() || boundaries.back() < line_begins.at(j))
+                {
+                    boundaries.push_back(line_begins.at(j));
+                }
+            }
+
+            std::vector<std::string_view> groups;
+            const u64 target_size = data.size() / std::max(1u, max_num_groups) + 1;
+            u64 group_begin       = 0;
+            for (const u64 boundary : boundaries)
+            {
+                if (groups.size() + 1 < max_num_groups && boundary - group_begin >= target_size)
+                {
+                    groups.push_back(data.substr(group_begin, boundary - group_begin));
+                    group_begin = boundary;
+                }
+            }
+            groups.push_back(data.substr(group_begin));
+
+            return groups;
+        }
+    }    // namespace
+
     Result<std::monostate> VHDLParser::parse(const std::filesystem::path& file_path)
     {
         m_path = file_path;
         m_entities.clear();
         m_attribute_buffer.clear();
         m_attribute_types.clear();
+        m_libraries.clear();
 
+        if (auto res = MemoryMappedFile::open(file_path); res.is_error())
         {
-            std::ifstream ifs;
-            ifs.open(file_path.string(), std::ifstream::in);
-            if (!ifs.is_open())
-            {
-                return ERR("unable to open VHDL file '" + file_path.string() + "'");
-            }
-            m_fs << ifs.rdbuf();
-            ifs.close();
+            return ERR_APPEND(res.get_error(), "unable to open VHDL file '" + file_path.string() + "'");
+        }
+        else
+        {
+            m_file = res.get();
         }
 
-        // tokenize file
-        tokenize();
-
-        // parse tokens into intermediate format
-        try
+        // lex and parse groups of entities concurrently, fall back to parsing the entire file at once if a group depends on another one
+        const std::string_view data = m_file->get_data();
+        std::vector<std::unique_ptr<VHDLParser>> group_parsers;
+        std::vector<Result<std::monostate>> group_results;
+        if (const auto groups = split_into_entity_groups(data, std::max(1u, std::thread::hardware_concurrency())); groups.size() > 1)
         {
-            if (const auto res = parse_tokens(); res.is_error())
+            parse_entity_groups(groups, group_parsers, group_results);
+            if (!merge_entity_groups(group_parsers, group_results))
             {
-                return ERR_APPEND(res.get_error(), "could not parse VHDL file '" + m_path.string() + "'");
+                group_parsers.clear();
             }
         }
-        catch (TokenStream<ci_string>::TokenStreamException& e)
+
+        if (group_parsers.empty())
         {
-            if (e.line_number != (u32)-1)
-            {
-                return ERR("could not parse VHDL file '" + m_path.string() + "': " + core_strings::to<std::string>(e.message) + " near line " + std::to_string(e.line_number));
-            }
-            else
+            m_entities.clear();
+            m_attribute_types.clear();
+            m_libraries.clear();
+
+            parse_entity_groups({data}, group_parsers, group_results);
+            if (group_results.front().is_error())
             {
-                return ERR("could not parse VHDL file '" + m_path.string() + "': " + core_strings::to<std::string>(e.message));
+                return ERR(group_results.front().get_error());
             }
+            merge_entity_groups(group_parsers, group_results);
         }
 
+        group_parsers.clear();
+        m_file.reset();
+
         if (m_entities.empty())
         {
             return ERR("could not parse VHDL file '" + m_path.string() + "': it does not contain any entities");
@@ -353,24 +451,181 @@ namespace hal
         return OK(std::move(result));
     }
 
+    std::optional<std::unordered_set<std::string>> VHDLParser::get_required_gate_types() const
+    {
+        std::unordered_set<std::string> gate_types;
+        for (const auto& [entity_name, entity] : m_entities)
+        {
+            for (const auto& [instance_name, instance_type] : entity.m_instance_types)
+            {
+                if (m_entities.find(instance_type) == m_entities.end())
+                {
+                    gate_types.insert(core_strings::to<std::string>(instance_type));
+                }
+            }
+        }
+        return gate_types;
+    }
+
     // ###########################################################################
     // ###########          Parse HDL into Intermediate Format          ##########
     // ###########################################################################
 
-    void VHDLParser::tokenize()
+    void VHDLParser::parse_entity_groups(const std::vector<std::string_view>& groups,
+                                         std::vector<std::unique_ptr<VHDLParser>>& group_parsers,
+                                         std::vector<Result<std::monostate>>& group_results) const
+    {
+        // line number of the first line of every group
+        std::vector<u32> first_lines;
+        first_lines.reserve(groups.size());
+        u32 line_number = 1;
+        for (const auto& group : groups)
+        {
+            first_lines.push_back(line_number);
+            line_number += std::count(group.begin(), group.end(), '\n');
+        }
+
+        group_parsers.clear();
+        group_results.clear();
+        for (u32 i = 0; i < groups.size(); i++)
+        {
+            group_parsers.push_back(std::make_unique<VHDLParser>());
+            group_parsers.back()->m_is_group_parser = groups.size() > 1;
+            group_results.push_back(OK({}));
+        }
+
+        utils::parallel_for_each(0, groups.size(), [&](u32 i) {
+            VHDLParser* parser = group_parsers.at(i).get();
+            if (!parser->tokenize(groups.at(i), first_lines.at(i)) && i + 1 < groups.size())
+            {
+                group_results.at(i) = ERR("could not parse VHDL file '" + m_path.string() + "': group of entities ends within a string or escaped identifier");
+                return;
+            }
+
+            try
+            {
+                if (const auto res = parser->parse_tokens(); res.is_error())
+                {
+                    group_results.at(i) = ERR_APPEND(res.get_error(), "could not parse VHDL file '" + m_path.string() + "'");
+                }
+            }
+            catch (TokenStream<ci_string>::TokenStreamException& e)
+            {
+                if (e.line_number != (u32)-1)
+                {
+                    group_results.at(i) =
+                        ERR("could not parse VHDL file '" + m_path.string() + "': " + core_strings::to<std::string>(e.message) + " near line " + std::to_string(e.line_number));
+                }
+                else
+                {
+                    group_results.at(i) = ERR("could not parse VHDL file '" + m_path.string() + "': " + core_strings::to<std::string>(e.message));
+                }
+            }
+
+            parser->m_token_stream = TokenStream<ci_string>();
+        });
+    }
+
+    bool VHDLParser::merge_entity_groups(std::vector<std::unique_ptr<VHDLParser>>& group_parsers, const std::vector<Result<std::monostate>>& group_results)
+    {
+        // verify that no group depends on the preceding ones before merging anything
+        std::set<ci_string> libraries;
+        std::set<ci_string> attribute_types;
+        std::set<ci_string> entities;
+        for (u32 i = 0; i < group_parsers.size(); i++)
+        {
+            const VHDLParser* parser = group_parsers.at(i).get();
+            if (group_results.at(i).is_error())
+            {
+                return false;
+            }
+
+            // libraries of preceding groups must already be known when the first instance type is resolved
+            if (parser->m_libraries_at_first_instance.has_value()
+                && !std::includes(parser->m_libraries_at_first_instance->begin(), parser->m_libraries_at_first_instance->end(), libraries.begin(), libraries.end()))
+            {
+                return false;
+            }
+
+            for (const auto& [entity_name, _] : parser->m_unresolved_entities)
+            {
+                UNUSED(_);
+                if (entities.find(entity_name) == entities.end())
+                {
+                    return false;
+                }
+            }
+
+            for (const auto& [attribute_name, _] : parser->m_unresolved_attribute_types)
+            {
+                UNUSED(_);
+                if (attribute_types.find(attribute_name) != attribute_types.end())
+                {
+                    return false;
+                }
+            }
+
+            for (const auto& [entity_name, _] : parser->m_entities)
+            {
+                UNUSED(_);
+                if (!entities.insert(entity_name).second)
+                {
+                    return false;
+                }
+            }
+
+            libraries.insert(parser->m_libraries.begin(), parser->m_libraries.end());
+            for (const auto& [attribute_name, _] : parser->m_attribute_types)
+            {
+                UNUSED(_);
+                attribute_types.insert(attribute_name);
+            }
+        }
+
+        for (auto& parser : group_parsers)
+        {
+            for (const auto& [attribute_name, line_number] : parser->m_unresolved_attribute_types)
+            {
+                log_warning("vhdl_parser", "attribute {} has unknown base type in line {}.", attribute_name, line_number);
+            }
+
+            for (auto& [entity_name, entity] : parser->m_entities)
+            {
+                m_entities.emplace(entity_name, std::move(entity));
+            }
+            m_libraries.insert(parser->m_libraries.begin(), parser->m_libraries.end());
+            for (auto& [attribute_name, attribute_type] : parser->m_attribute_types)
+            {
+                m_attribute_types[attribute_name] = attribute_type;
+            }
+            if (!parser->m_last_entity.empty())
+            {
+                m_last_entity = parser->m_last_entity;
+            }
+        }
+
+        return true;
+    }
+
+    bool VHDLParser::tokenize(std::string_view data, u32 line_number)
     {
         std::vector<Token<core_strings::CaseInsensitiveString>> parsed_tokens;
         const std::string delimiters = ",(): ;=><&";
         core_strings::CaseInsensitiveString current_token;
-        u32 line_number = 0;
 
-        std::string line;
         bool in_string = false;
         bool escaped   = false;
 
-        while (std::getline(m_fs, line))
+        for (u64 line_begin = 0; line_begin < data.size(); line_number++)
         {
-            line_number++;
+            u64 line_end = data.find('\n', line_begin);
+            if (line_end == std::string_view::npos)
+            {
+                line_end = data.size();
+            }
+            std::string line(data.substr(line_begin, line_end - line_begin));
+            line_begin = line_end + 1;
+
             if (line.find("--") != std::string::npos)
             {
                 line = line.substr(0, line.find("--"));
@@ -444,7 +699,9 @@ namespace hal
                 current_token.clear();
             }
         }
-        m_token_stream = TokenStream(parsed_tokens, {"("}, {")"});
+        m_token_stream = TokenStream(std::move(parsed_tokens), {"("}, {")"});
+
+        return !in_string && !escaped;
     }
 
     Result<std::monostate> VHDLParser::parse_tokens()
@@ -669,7 +926,15 @@ namespace hal
 
             if (const auto type_it = m_attribute_types.find(attribute_name); type_it == m_attribute_types.end())
             {
-                log_warning("vhdl_parser", "attribute {} has unknown base type in line {}.", attribute_name, line_number);
+                // the base type may be declared within a preceding group of entities, hence defer the warning until merging
+                if (m_is_group_parser)
+                {
+                    m_unresolved_attribute_types.emplace_back(attribute_name, line_number);
+                }
+                else
+                {
+                    log_warning("vhdl_parser", "attribute {} has unknown base type in line {}.", attribute_name, line_number);
+                }
                 attribute_type = "unknown";
             }
             else
@@ -893,8 +1158,16 @@ namespace hal
             }
             if (m_entities.find(instance_type) == m_entities.end())
             {
-                return ERR("could not parse instance '" + core_strings::to<std::string>(instance_name) + "' of type '" + core_strings::to<std::string>(instance_type) + "': entity with name '"
-                           + core_strings::to<std::string>(instance_type) + "' does not exist (line " + std::to_string(line_number) + ")");
+                // the entity may be declared within a preceding group of entities, hence defer the check until merging
+                if (m_is_group_parser)
+                {
+                    m_unresolved_entities.emplace_back(instance_type, line_number);
+                }
+                else
+                {
+                        return ERR("could not parse instance '" + core_strings::to<std::string>(instance_name) + "' of type '" + core_strings::to<std::string>(instance_type) + "': entity with name '"
+                               + core_strings::to<std::string>(instance_type) + "' does not exist (line " + std::to_string(line_number) + ")");
+                }
             }
         }
         else if (m_token_stream.peek() == "component")
@@ -907,6 +1180,12 @@ namespace hal
             instance_type = m_token_stream.consume();
             ci_string prefix;
 
+            // libraries declared within preceding groups of entities must be known at this point, which is verified when merging
+            if (m_is_group_parser && !m_libraries_at_first_instance.has_value())
+            {
+                m_libraries_at_first_instance = m_libraries;
+            }
+
             // find longest matching library prefix
             for (const auto& lib : m_libraries)
             {
@@ -1694,6 +1694,172 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the parsing of files containing many entities, which are split into groups that are parsed independently of each other.
+     * Dependencies between groups, such as attribute types or instantiated entities declared in preceding groups, must be resolved as well.
+     *
+     * Functions: parse
+     */
+    TEST_F(VHDLParserTest, check_entity_groups) {
+
+        TEST_START
+            {
+                // attribute type declared in the first entity only, entities instantiated using 'entity work.<name>'
+                std::string netlist_input("library SIMPRIM;\n"
+                                          "use SIMPRIM.VCOMPONENTS.ALL;\n");
+                for (u32 i = 0; i < 16; i++)
+                {
+                    const std::string idx = std::to_string(i);
+                    netlist_input += "-- entity ENT_" + idx + " is\n"
+                                     "entity ENT_" + idx + " is\n"
+                                     + ((i == 0) ? "  attribute attri_name : string;\n" : "")
+                                     + "  attribute attri_name of ENT_" + idx + " : entity is \"attri_value\";\n"
+                                     "  port (\n"
+                                     "    ent_in : in STD_LOGIC;\n"
+                                     "    ent_out : out STD_LOGIC\n"
+                                     "  );\n"
+                                     "end ENT_" + idx + ";\n"
+                                     "architecture STRUCTURE of ENT_" + idx + " is\n"
+                                     "  signal net_0 : STD_LOGIC;\n"
+                                     "begin\n"
+                                     "  gate_0 : SIMPRIM.VCOMPONENTS.BUF\n"
+                                     "    port map (\n"
+                                     "      I => ent_in,\n"
+                                     "      O => net_0\n"
+                                     "    );\n"
+                                     "  gate_1 : BUF\n"
+                                     "    port map (\n"
+                                     "      I => net_0,\n"
+                                     "      O => ent_out\n"
+                                     "    );\n"
+                                     "end STRUCTURE;\n\n";
+                }
+                netlist_input += "entity TOP is\n"
+                                 "  port (\n"
+                                 "    global_in : in STD_LOGIC;\n"
+                                 "    global_out : out STD_LOGIC\n"
+                                 "  );\n"
+                                 "end TOP;\n"
+                                 "architecture STRUCTURE of TOP is\n";
+                for (u32 i = 0; i < 16; i++)
+                {
+                    netlist_input += "  signal net_" + std::to_string(i) + " : STD_LOGIC;\n";
+                }
+                netlist_input += "begin\n";
+                for (u32 i = 0; i < 16; i++)
+                {
+                    const std::string in = (i == 0) ? "global_in" : "net_" + std::to_string(i - 1);
+                    netlist_input += "  inst_" + std::to_string(i) + " : entity work.ENT_" + std::to_string(i) + "\n"
+                                     "    port map (\n"
+                                     "      ent_in => " + in + ",\n"
+                                     "      ent_out => net_" + std::to_string(i) + "\n"
+                                     "    );\n";
+                }
+                netlist_input += "  global_out <= net_15;\n"
+                                 "end STRUCTURE;";
+
+                const GateLibrary* gate_lib = test_utils::get_gate_library();
+                std::filesystem::path vhdl_file = test_utils::create_sandbox_file("netlist.vhd", netlist_input);
+                VHDLParser vhdl_parser;
+                auto nl_res = vhdl_parser.parse_and_instantiate(vhdl_file, gate_lib);
+                ASSERT_TRUE(nl_res.is_ok());
+                std::unique_ptr<Netlist> nl = nl_res.get();
+                ASSERT_NE(nl, nullptr);
+
+                EXPECT_EQ(nl->get_gates(test_utils::gate_type_filter("BUF")).size(), 32);
+                EXPECT_EQ(nl->get_top_module()->get_type(), "TOP");
+                EXPECT_EQ(nl->get_top_module()->get_submodules().size(), 16);
+                for (Module* mod : nl->get_top_module()->get_submodules())
+                {
+                    EXPECT_EQ(mod->get_data("attribute", "attri_name"), std::make_tuple("string", "attri_value"));
+                }
+            }
+            {
+                // entities with the same name in different parts of the file
+                NO_COUT_TEST_BLOCK;
+                std::string netlist_input;
+                for (u32 i = 0; i < 16; i++)
+                {
+                    const std::string idx = std::to_string(i % 15);
+                    netlist_input += "entity ENT_" + idx + " is\n"
+                                     "  port (\n"
+                                     "    ent_in : in STD_LOGIC;\n"
+                                     "    ent_out : out STD_LOGIC\n"
+                                     "  );\n"
+                                     "end ENT_" + idx + ";\n"
+                                     "architecture STRUCTURE of ENT_" + idx + " is\n"
+                                     "begin\n"
+                                     "  gate_0 : BUF\n"
+                                     "    port map (\n"
+                                     "      I => ent_in,\n"
+                                     "      O => ent_out\n"
+                                     "    );\n"
+                                     "end STRUCTURE;\n";
+                }
+
+                const GateLibrary* gate_lib = test_utils::get_gate_library();
+                std::filesystem::path vhdl_file = test_utils::create_sandbox_file("netlist.vhd", netlist_input);
+                VHDLParser vhdl_parser;
+                auto nl_res = vhdl_parser.parse_and_instantiate(vhdl_file, gate_lib);
+                EXPECT_TRUE(nl_res.is_error());
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the collection of gate types required from the gate library, which excludes types defined as entities.
+     *
+     * Functions: parse, get_required_gate_types
+     */
+    TEST_F(VHDLParserTest, check_required_gate_types) {
+
+        TEST_START
+            {
+                std::string netlist_input("entity ENT_CHILD is\n"
+                                          "  port (\n"
+                                          "    ent_in : in STD_LOGIC;\n"
+                                          "    ent_out : out STD_LOGIC\n"
+                                          "  );\n"
+                                          "end ENT_CHILD;\n"
+                                          "architecture STRUCTURE of ENT_CHILD is\n"
+                                          "begin\n"
+                                          "  gate_0 : BUF\n"
+                                          "    port map (\n"
+                                          "      I => ent_in,\n"
+                                          "      O => ent_out\n"
+                                          "    );\n"
+                                          "end STRUCTURE;\n"
+                                          "entity TOP is\n"
+                                          "  port (\n"
+                                          "    global_in : in STD_LOGIC;\n"
+                                          "    global_out : out STD_LOGIC\n"
+                                          "  );\n"
+                                          "end TOP;\n"
+                                          "architecture STRUCTURE of TOP is\n"
+                                          "  signal net_0 : STD_LOGIC;\n"
+                                          "begin\n"
+                                          "  gate_1 : INV\n"
+                                          "    port map (\n"
+                                          "      I => global_in,\n"
+                                          "      O => net_0\n"
+                                          "    );\n"
+                                          "  child : ENT_CHILD\n"
+                                          "    port map (\n"
+                                          "      ent_in => net_0,\n"
+                                          "      ent_out => global_out\n"
+                                          "    );\n"
+                                          "end STRUCTURE;");
+                std::filesystem::path vhdl_file = test_utils::create_sandbox_file("netlist.vhd", netlist_input);
+                VHDLParser vhdl_parser;
+                ASSERT_TRUE(vhdl_parser.parse(vhdl_file).is_ok());
+
+                const auto gate_types = vhdl_parser.get_required_gate_types();
+                ASSERT_TRUE(gate_types.has_value());
+                EXPECT_EQ(gate_types.value(), std::unordered_set<std::string>({"BUF", "INV"}));
+            }
+        TEST_END
+    }
+
     /** NOTE: Currently Unsupported...
      * Testing the usage of components, which should define new Gate types with custom input/output/inout pins.
      * (currently unsupported...)
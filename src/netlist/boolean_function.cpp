@@ -904,35 +904,14 @@ namespace hal
     Result<BooleanFunction> BooleanFunction::from_string(const std::string& expression)
     {
         using BooleanFunctionParser::ParserType;
-        using BooleanFunctionParser::Token;
 
-        static const std::vector<std::tuple<ParserType, std::function<Result<std::vector<Token>>(const std::string&)>>> parsers = {
-            {ParserType::Standard, BooleanFunctionParser::parse_with_standard_grammar},
-            {ParserType::Liberty, BooleanFunctionParser::parse_with_liberty_grammar},
-        };
-
-        for (const auto& [parser_type, parser] : parsers)
+        for (const auto& parser_type : {ParserType::Standard, ParserType::Liberty})
         {
-            auto tokens = parser(expression);
-            // (1) skip if parser cannot translate to tokens
-            if (tokens.is_error())
-            {
-                continue;
-            }
-
-            // (2) skip if cannot translate to valid reverse-polish notation
-            tokens = BooleanFunctionParser::reverse_polish_notation(tokens.get(), expression, parser_type);
-            if (tokens.is_error())
-            {
-                continue;
-            }
-            // (3) skip if reverse-polish notation tokens are no valid Boolean function
-            auto function = BooleanFunctionParser::translate(tokens.get(), expression);
-            if (function.is_error())
+            // skip if parser cannot translate expression to a valid Boolean function
+            if (auto function = BooleanFunctionParser::parse_expression(expression, parser_type); function.is_ok())
             {
-                continue;
+                return function;
             }
-            return function;
         }
         return ERR("could not parse Boolean function from string: no parser available for '" + expression + "'");
     }
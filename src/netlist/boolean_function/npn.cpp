@@ -0,0 +1,530 @@
+#include "hal_core/netlist/boolean_function/npn.h"
+
+#include "hal_core/utilities/parallel_for_each.h"
+
+#include <algorithm>
+#include <bitset>
+#include <functional>
+
+namespace hal
+{
+    namespace NPN
+    {
+        namespace
+        {
+            // positive cofactor masks of the first six variables within a 64-bit word
+            constexpr u64 VARIABLE_MASKS[6] = {0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull, 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+            // masks to swap two adjacent variables i and i + 1 within a 64-bit word: bits that stay, bits that move up, bits that move down
+            constexpr u64 SWAP_MASKS[5][3] = {{0x9999999999999999ull, 0x2222222222222222ull, 0x4444444444444444ull},
+                                              {0xC3C3C3C3C3C3C3C3ull, 0x0C0C0C0C0C0C0C0Cull, 0x3030303030303030ull},
+                                              {0xF00FF00FF00FF00Full, 0x00F000F000F000F0ull, 0x0F000F000F000F00ull},
+                                              {0xFF0000FFFF0000FFull, 0x0000FF000000FF00ull, 0x00FF000000FF0000ull},
+                                              {0xFFFF00000000FFFFull, 0x00000000FFFF0000ull, 0x0000FFFF00000000ull}};
+
+            u32 get_num_words(u32 num_variables)
+            {
+                return (num_variables <= 6) ? 1 : (1u << (num_variables - 6));
+            }
+
+            u64 get_row_mask(u32 num_variables)
+            {
+                return (num_variables >= 6) ? ~0ull : ((1ull << (1u << num_variables)) - 1);
+            }
+
+            u32 count_ones(const TruthTable& tt)
+            {
+                u32 count = 0;
+                for (u32 w = 0; w < get_num_words(tt.num_variables); w++)
+                {
+                    count += std::bitset<64>(tt.words[w]).count();
+                }
+                return count;
+            }
+
+            // number of ones within the positive cofactor of a variable
+            u32 count_cofactor_ones(const TruthTable& tt, u32 var)
+            {
+                u32 count = 0;
+                for (u32 w = 0; w < get_num_words(tt.num_variables); w++)
+                {
+                    if (var < 6)
+                    {
+                        count += std::bitset<64>(tt.words[w] & VARIABLE_MASKS[var]).count();
+                    }
+                    else if ((w >> (var - 6)) & 1)
+                    {
+                        count += std::bitset<64>(tt.words[w]).count();
+                    }
+                }
+                return count;
+            }
+
+            void complement(TruthTable& tt)
+            {
+                for (u32 w = 0; w < get_num_words(tt.num_variables); w++)
+                {
+                    tt.words[w] = ~tt.words[w];
+                }
+                tt.words[0] &= get_row_mask(tt.num_variables);
+            }
+
+            void flip_variable(TruthTable& tt, u32 var)
+            {
+                if (var < 6)
+                {
+                    const u32 shift = 1u << var;
+                    const u64 mask  = VARIABLE_MASKS[var];
+                    for (u32 w = 0; w < get_num_words(tt.num_variables); w++)
+                    {
+                        tt.words[w] = ((tt.words[w] & mask) >> shift) | ((tt.words[w] << shift) & mask);
+                    }
+                }
+                else if (var == 6)
+                {
+                    std::swap(tt.words[0], tt.words[1]);
+                    std::swap(tt.words[2], tt.words[3]);
+                }
+                else
+                {
+                    std::swap(tt.words[0], tt.words[2]);
+                    std::swap(tt.words[1], tt.words[3]);
+                }
+            }
+
+            // swap variables i and i + 1
+            void swap_adjacent_variables(TruthTable& tt, u32 var)
+            {
+                if (var < 5)
+                {
+                    const u32 shift = 1u << var;
+                    for (u32 w = 0; w < get_num_words(tt.num_variables); w++)
+                    {
+                        const u64 word = tt.words[w];
+                        tt.words[w]    = (word & SWAP_MASKS[var][0]) | ((word & SWAP_MASKS[var][1]) << shift) | ((word & SWAP_MASKS[var][2]) >> shift);
+                    }
+                }
+                else if (var == 5)
+                {
+                    for (u32 w = 0; w < get_num_words(tt.num_variables); w += 2)
+                    {
+                        const u64 low  = tt.words[w];
+                        const u64 high = tt.words[w + 1];
+                        tt.words[w]     = (low & 0x00000000FFFFFFFFull) | (high << 32);
+                        tt.words[w + 1] = (low >> 32) | (high & 0xFFFFFFFF00000000ull);
+                    }
+                }
+                else
+                {
+                    std::swap(tt.words[1], tt.words[2]);
+                }
+            }
+
+            void swap_variables(TruthTable& tt, u32 a, u32 b)
+            {
+                if (a > b)
+                {
+                    std::swap(a, b);
+                }
+                if (a == b)
+                {
+                    return;
+                }
+
+                // move a up to the position of b, then move b (now one position below) down to the position of a
+                for (u32 k = a; k < b; k++)
+                {
+                    swap_adjacent_variables(tt, k);
+                }
+                for (u32 k = b - 1; k > a; k--)
+                {
+                    swap_adjacent_variables(tt, k - 1);
+                }
+            }
+
+            // move every variable v to position order.index(v)
+            TruthTable permute(TruthTable tt, const std::vector<u32>& order)
+            {
+                std::vector<u32> var_at_position(order.size());
+                std::vector<u32> position_of_var(order.size());
+                for (u32 i = 0; i < order.size(); i++)
+                {
+                    var_at_position[i] = i;
+                    position_of_var[i] = i;
+                }
+
+                for (u32 p = 0; p < order.size(); p++)
+                {
+                    for (u32 q = position_of_var[order[p]]; q > p; q--)
+                    {
+                        swap_adjacent_variables(tt, q - 1);
+                        std::swap(var_at_position[q - 1], var_at_position[q]);
+                        position_of_var[var_at_position[q - 1]] = q - 1;
+                        position_of_var[var_at_position[q]]     = q;
+                    }
+                }
+                return tt;
+            }
+        }    // namespace
+
+        Result<TruthTable> TruthTable::from_words(const std::vector<u64>& words, u32 num_variables)
+        {
+            if (num_variables > 8)
+            {
+                return ERR("could not create truth table: " + std::to_string(num_variables) + " variables exceed the maximum of 8 variables");
+            }
+            if (words.size() < get_num_words(num_variables))
+            {
+                return ERR("could not create truth table: " + std::to_string(words.size()) + " words are not sufficient for " + std::to_string(num_variables) + " variables");
+            }
+
+            TruthTable tt;
+            tt.num_variables = num_variables;
+            for (u32 w = 0; w < get_num_words(num_variables); w++)
+            {
+                tt.words[w] = words.at(w);
+            }
+            tt.words[0] &= get_row_mask(num_variables);
+            return OK(tt);
+        }
+
+        Result<TruthTable> TruthTable::from_values(const std::vector<BooleanFunction::Value>& values)
+        {
+            u32 num_variables = 0;
+            while ((1ull << num_variables) < values.size())
+            {
+                num_variables++;
+            }
+            if ((1ull << num_variables) != values.size() || num_variables > 8)
+            {
+                return ERR("could not create truth table: " + std::to_string(values.size()) + " values do not correspond to a function of at most 8 variables");
+            }
+
+            TruthTable tt;
+            tt.num_variables = num_variables;
+            for (u32 m = 0; m < values.size(); m++)
+            {
+                if (values.at(m) == BooleanFunction::Value::ONE)
+                {
+                    tt.words[m >> 6] |= 1ull << (m & 63);
+                }
+                else if (values.at(m) != BooleanFunction::Value::ZERO)
+                {
+                    return ERR("could not create truth table: value '" + BooleanFunction::to_string(values.at(m)) + "' at row " + std::to_string(m) + " is neither 0 nor 1");
+                }
+            }
+            return OK(tt);
+        }
+
+        std::vector<u64> TruthTable::to_words() const
+        {
+            return std::vector<u64>(words.begin(), words.begin() + get_num_words(num_variables));
+        }
+
+        bool TruthTable::operator==(const TruthTable& other) const
+        {
+            return num_variables == other.num_variables && words == other.words;
+        }
+
+        bool TruthTable::operator!=(const TruthTable& other) const
+        {
+            return !(*this == other);
+        }
+
+        bool TruthTable::operator<(const TruthTable& other) const
+        {
+            if (num_variables != other.num_variables)
+            {
+                return num_variables < other.num_variables;
+            }
+            return std::lexicographical_compare(words.rbegin(), words.rend(), other.words.rbegin(), other.words.rend());
+        }
+
+        Result<TruthTable> apply_transform(const TruthTable& truth_table, const Transform& transform)
+        {
+            const u32 n = truth_table.num_variables;
+            if (transform.permutation.size() != n)
+            {
+                return ERR("could not apply NPN transformation: permutation of size " + std::to_string(transform.permutation.size()) + " does not match the "
+                           + std::to_string(n) + " variables of the truth table");
+            }
+
+            std::vector<bool> used(n, false);
+            for (u32 p : transform.permutation)
+            {
+                if (p >= n || used[p])
+                {
+                    return ERR("could not apply NPN transformation: invalid permutation");
+                }
+                used[p] = true;
+            }
+
+            TruthTable result;
+            result.num_variables = n;
+            for (u32 m = 0; m < (1u << n); m++)
+            {
+                u32 target = 0;
+                for (u32 v = 0; v < n; v++)
+                {
+                    target |= (((m >> v) ^ (transform.input_negations >> v)) & 1) << transform.permutation[v];
+                }
+                if ((((truth_table.words[m >> 6] >> (m & 63)) & 1) != 0) != transform.output_negation)
+                {
+                    result.words[target >> 6] |= 1ull << (target & 63);
+                }
+            }
+            return OK(result);
+        }
+
+        CanonicalForm canonicalize(const TruthTable& truth_table)
+        {
+            const u32 n        = truth_table.num_variables;
+            const u32 num_rows = 1u << n;
+            const u32 num_ones = count_ones(truth_table);
+
+            std::vector<bool> output_negations;
+            if (2 * num_ones <= num_rows)
+            {
+                output_negations.push_back(false);
+            }
+            if (2 * num_ones >= num_rows)
+            {
+                output_negations.push_back(true);
+            }
+
+            CanonicalForm best;
+            bool has_best = false;
+
+            for (bool output_negation : output_negations)
+            {
+                TruthTable g = truth_table;
+                if (output_negation)
+                {
+                    complement(g);
+                }
+                const u32 ones = count_ones(g);
+
+                // negate inputs such that the positive cofactor holds at least as many ones as the negative one, ties are enumerated
+                u32 fixed_negations = 0;
+                std::vector<u32> ties;
+                for (u32 v = 0; v < n; v++)
+                {
+                    const u32 c1 = count_cofactor_ones(g, v);
+                    const u32 c0 = ones - c1;
+                    if (c1 < c0)
+                    {
+                        fixed_negations |= 1u << v;
+                    }
+                    else if (c1 == c0)
+                    {
+                        ties.push_back(v);
+                    }
+                }
+
+                for (u32 t = 0; t < (1u << ties.size()); t++)
+                {
+                    u32 input_negations = fixed_negations;
+                    for (u32 i = 0; i < ties.size(); i++)
+                    {
+                        if ((t >> i) & 1)
+                        {
+                            input_negations |= 1u << ties[i];
+                        }
+                    }
+
+                    TruthTable h = g;
+                    for (u32 v = 0; v < n; v++)
+                    {
+                        if ((input_negations >> v) & 1)
+                        {
+                            flip_variable(h, v);
+                        }
+                    }
+
+                    // order the inputs by their cofactor weights, inputs of equal weight form a group whose order is enumerated
+                    std::vector<u32> weights(n);
+                    std::vector<u32> sorted_vars(n);
+                    for (u32 v = 0; v < n; v++)
+                    {
+                        weights[v]     = count_cofactor_ones(h, v);
+                        sorted_vars[v] = v;
+                    }
+                    std::stable_sort(sorted_vars.begin(), sorted_vars.end(), [&weights](u32 a, u32 b) { return weights[a] < weights[b]; });
+
+                    // within each group, symmetric inputs are interchangeable and only their distinct arrangements are enumerated
+                    struct Group
+                    {
+                        u32 first_position;
+                        std::vector<std::vector<u32>> symmetry_classes;
+                        std::vector<u32> labels;
+                    };
+                    std::vector<Group> groups;
+                    for (u32 p = 0; p < n; p++)
+                    {
+                        const u32 v = sorted_vars[p];
+                        if (groups.empty() || weights[sorted_vars[p - 1]] != weights[v])
+                        {
+                            groups.push_back({p, {}, {}});
+                        }
+
+                        Group& group = groups.back();
+                        u32 label    = group.symmetry_classes.size();
+                        for (u32 c = 0; c < group.symmetry_classes.size(); c++)
+                        {
+                            TruthTable swapped = h;
+                            swap_variables(swapped, group.symmetry_classes[c].front(), v);
+                            if (swapped == h)
+                            {
+                                label = c;
+                                break;
+                            }
+                        }
+                        if (label == group.symmetry_classes.size())
+                        {
+                            group.symmetry_classes.emplace_back();
+                        }
+                        group.symmetry_classes[label].push_back(v);
+                        group.labels.push_back(label);
+                    }
+                    for (Group& group : groups)
+                    {
+                        std::sort(group.labels.begin(), group.labels.end());
+                    }
+
+                    std::vector<u32> order(n);
+                    std::function<void(u32)> enumerate = [&](u32 group_index) {
+                        if (group_index == groups.size())
+                        {
+                            const TruthTable candidate = permute(h, order);
+                            if (!has_best || candidate < best.truth_table)
+                            {
+                                has_best                        = true;
+                                best.truth_table                = candidate;
+                                best.transform.input_negations  = input_negations;
+                                best.transform.output_negation  = output_negation;
+                                best.transform.permutation.assign(n, 0);
+                                for (u32 p = 0; p < n; p++)
+                                {
+                                    best.transform.permutation[order[p]] = p;
+                                }
+                            }
+                            return;
+                        }
+
+                        Group& group = groups[group_index];
+                        do
+                        {
+                            std::vector<u32> next_member(group.symmetry_classes.size(), 0);
+                            for (u32 i = 0; i < group.labels.size(); i++)
+                            {
+                                const u32 label                  = group.labels[i];
+                                order[group.first_position + i] = group.symmetry_classes[label][next_member[label]++];
+                            }
+                            enumerate(group_index + 1);
+                        } while (std::next_permutation(group.labels.begin(), group.labels.end()));
+                    };
+                    enumerate(0);
+                }
+            }
+
+            return best;
+        }
+
+        std::size_t Library::TruthTableHash::operator()(const TruthTable& truth_table) const
+        {
+            std::size_t h = truth_table.num_variables;
+            for (u64 word : truth_table.words)
+            {
+                h ^= std::hash<u64>()(word) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            }
+            return h;
+        }
+
+        void Library::add_function(const std::string& name, const TruthTable& truth_table)
+        {
+            CanonicalForm canonical_form = canonicalize(truth_table);
+            m_index[canonical_form.truth_table].push_back({name, std::move(canonical_form.transform)});
+            m_size++;
+        }
+
+        Result<std::monostate> Library::add_function(const std::string& name, const BooleanFunction& function, const std::vector<std::string>& ordered_variables)
+        {
+            if (function.size() != 1)
+            {
+                return ERR("could not add function '" + name + "' to NPN library: Boolean function '" + function.to_string() + "' is not of size 1");
+            }
+
+            auto tt_res = function.compute_truth_table(ordered_variables);
+            if (tt_res.is_error())
+            {
+                return ERR_APPEND(tt_res.get_error(), "could not add function '" + name + "' to NPN library: unable to compute truth table");
+            }
+
+            auto res = TruthTable::from_values(tt_res.get().front());
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not add function '" + name + "' to NPN library: unable to convert truth table");
+            }
+
+            add_function(name, res.get());
+            return OK({});
+        }
+
+        u32 Library::size() const
+        {
+            return m_size;
+        }
+
+        std::vector<std::string> Library::find(const TruthTable& truth_table) const
+        {
+            std::vector<std::string> names;
+            if (const auto it = m_index.find(canonicalize(truth_table).truth_table); it != m_index.end())
+            {
+                for (const auto& entry : it->second)
+                {
+                    names.push_back(entry.name);
+                }
+            }
+            return names;
+        }
+
+        std::vector<Match> Library::match(const netlist_utils::CutEnumeration& cuts) const
+        {
+            const auto& nets = cuts.get_nets();
+
+            std::vector<std::vector<Match>> net_matches(nets.size());
+            utils::parallel_for_each(0, nets.size(), [&](u32 i) {
+                Net* net = nets.at(i);
+                for (auto& cut : cuts.get_cuts(net))
+                {
+                    if (cut.truth_table.empty() || (cut.leaves.size() == 1 && cut.leaves.front() == net))
+                    {
+                        continue;
+                    }
+
+                    const auto tt_res = TruthTable::from_words(cut.truth_table, cut.leaves.size());
+                    if (tt_res.is_error())
+                    {
+                        continue;
+                    }
+
+                    const CanonicalForm canonical_form = canonicalize(tt_res.get());
+                    if (const auto it = m_index.find(canonical_form.truth_table); it != m_index.end())
+                    {
+                        for (const auto& entry : it->second)
+                        {
+                            net_matches.at(i).push_back({net, cut, entry.name, canonical_form.transform, entry.transform});
+                        }
+                    }
+                }
+            });
+
+            std::vector<Match> matches;
+            for (auto& m : net_matches)
+            {
+                std::move(m.begin(), m.end(), std::back_inserter(matches));
+            }
+            return matches;
+        }
+    }    // namespace NPN
+}    // namespace hal
@@ -0,0 +1,376 @@
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/parser.h"
+
+#include <limits>
+
+namespace hal
+{
+    namespace BooleanFunctionParser
+    {
+        namespace
+        {
+            /**
+             * Recursive-descent parser that translates a Boolean function string directly into the
+             * nodes of a Boolean function in reverse-polish notation.
+             *
+             * The operator precedence and associativity match the token-based parsers, i.e.,
+             * 'Not' binds strongest, followed by 'And', 'Xor', and 'Or', and chains of the same
+             * binary operation are right-associative (e.g., "A & B & C" is parsed as "A & (B & C)").
+             * Chains are collected iteratively so that long expressions do not result in deep
+             * recursion, only brackets increase the recursion depth.
+             */
+            class RecursiveDescentParser
+            {
+            public:
+                RecursiveDescentParser(const std::string& expression, const ParserType& type) : m_expression(expression), m_type(type)
+                {
+                    // every node consumes at least one character of the expression
+                    m_nodes.reserve(expression.size());
+                }
+
+                Result<BooleanFunction> parse()
+                {
+                    skip_whitespace();
+                    if (!parse_or())
+                    {
+                        return ERR("could not parse Boolean function '" + m_expression + "': " + m_error);
+                    }
+                    skip_whitespace();
+                    if (m_pos != m_expression.size())
+                    {
+                        unexpected_character();
+                        return ERR("could not parse Boolean function '" + m_expression + "': " + m_error);
+                    }
+
+                    return BooleanFunction::build(std::move(m_nodes));
+                }
+
+            private:
+                const std::string& m_expression;
+                const ParserType m_type;
+
+                u32 m_pos = 0;
+                std::vector<BooleanFunction::Node> m_nodes;
+                std::string m_error;
+
+                bool is_liberty() const
+                {
+                    return m_type == ParserType::Liberty;
+                }
+
+                char peek(u32 offset = 0) const
+                {
+                    return (m_pos + offset < m_expression.size()) ? m_expression[m_pos + offset] : '\0';
+                }
+
+                static bool is_whitespace(char c)
+                {
+                    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+                }
+
+                static bool is_letter(char c)
+                {
+                    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+                }
+
+                static bool is_digit(char c)
+                {
+                    return c >= '0' && c <= '9';
+                }
+
+                static bool is_identifier_character(char c)
+                {
+                    return is_letter(c) || is_digit(c) || c == '_';
+                }
+
+                bool skip_whitespace()
+                {
+                    const u32 start = m_pos;
+                    while (is_whitespace(peek()))
+                    {
+                        m_pos++;
+                    }
+                    return m_pos != start;
+                }
+
+                bool unexpected_character()
+                {
+                    if (m_pos < m_expression.size())
+                    {
+                        m_error = "unexpected character '" + std::string(1, m_expression[m_pos]) + "' at position " + std::to_string(m_pos);
+                    }
+                    else
+                    {
+                        m_error = "unexpected end of expression";
+                    }
+                    return false;
+                }
+
+                bool is_and_operator(char c) const
+                {
+                    return c == '&' || (is_liberty() && c == '*');
+                }
+
+                bool is_or_operator(char c) const
+                {
+                    return c == '|' || (is_liberty() && c == '+');
+                }
+
+                bool is_not_operator(char c) const
+                {
+                    return c == '!' || (!is_liberty() && c == '~');
+                }
+
+                bool is_operand_start(char c) const
+                {
+                    return is_letter(c) || c == '0' || c == '1' || c == '(' || is_not_operator(c) || (!is_liberty() && c == '\\');
+                }
+
+                void emit_operations(u16 type, u32 count)
+                {
+                    for (u32 i = 0; i < count; i++)
+                    {
+                        m_nodes.push_back(BooleanFunction::Node::Operation(type, m_nodes.back().size));
+                    }
+                }
+
+                // or := xor (('|' | '+') xor)*
+                bool parse_or()
+                {
+                    u32 num_operations = 0;
+                    while (true)
+                    {
+                        if (!parse_xor())
+                        {
+                            return false;
+                        }
+                        if (!is_or_operator(peek()))
+                        {
+                            break;
+                        }
+                        m_pos++;
+                        skip_whitespace();
+                        num_operations++;
+                    }
+                    emit_operations(BooleanFunction::NodeType::Or, num_operations);
+                    return true;
+                }
+
+                // xor := and ('^' and)*
+                bool parse_xor()
+                {
+                    u32 num_operations = 0;
+                    while (true)
+                    {
+                        if (!parse_and())
+                        {
+                            return false;
+                        }
+                        if (peek() != '^')
+                        {
+                            break;
+                        }
+                        m_pos++;
+                        skip_whitespace();
+                        num_operations++;
+                    }
+                    emit_operations(BooleanFunction::NodeType::Xor, num_operations);
+                    return true;
+                }
+
+                // and := unary (('&' | '*' | ' ') unary)*, whitespace between two operands denotes an 'And' in Liberty functions
+                bool parse_and()
+                {
+                    u32 num_operations = 0;
+                    while (true)
+                    {
+                        if (!parse_unary())
+                        {
+                            return false;
+                        }
+
+                        const bool separated = skip_whitespace();
+                        if (is_and_operator(peek()))
+                        {
+                            m_pos++;
+                            skip_whitespace();
+                        }
+                        else if (!(is_liberty() && separated && is_operand_start(peek())))
+                        {
+                            break;
+                        }
+                        num_operations++;
+                    }
+                    emit_operations(BooleanFunction::NodeType::And, num_operations);
+                    return true;
+                }
+
+                // unary := ('!' | '~')* primary '\''*
+                bool parse_unary()
+                {
+                    u32 num_operations = 0;
+                    while (is_not_operator(peek()))
+                    {
+                        m_pos++;
+                        skip_whitespace();
+                        num_operations++;
+                    }
+
+                    if (!parse_primary())
+                    {
+                        return false;
+                    }
+
+                    // a Liberty suffix negation applies to the directly preceding operand and hence binds stronger than a prefix negation
+                    while (is_liberty() && peek() == '\'')
+                    {
+                        m_pos++;
+                        emit_operations(BooleanFunction::NodeType::Not, 1);
+                    }
+
+                    emit_operations(BooleanFunction::NodeType::Not, num_operations);
+                    return true;
+                }
+
+                // primary := variable | constant | '(' or ')'
+                bool parse_primary()
+                {
+                    const char c = peek();
+                    if (c == '(')
+                    {
+                        m_pos++;
+                        skip_whitespace();
+                        if (!parse_or())
+                        {
+                            return false;
+                        }
+                        if (peek() != ')')
+                        {
+                            return unexpected_character();
+                        }
+                        m_pos++;
+                        return true;
+                    }
+                    else if (c == '0' || c == '1')
+                    {
+                        return parse_constant();
+                    }
+                    else if (is_letter(c) || (!is_liberty() && c == '\\'))
+                    {
+                        return parse_variable();
+                    }
+
+                    return unexpected_character();
+                }
+
+                // constant := '0' | '1' | "0b" ('0' | '1') | ('0' | '1') "'b1", the latter two only in standard functions
+                bool parse_constant()
+                {
+                    char value = peek();
+                    if (!is_liberty())
+                    {
+                        if (peek(1) == '\'' && peek(2) == 'b' && peek(3) == '1')
+                        {
+                            m_pos += 3;
+                        }
+                        else if (value == '0' && peek(1) == 'b')
+                        {
+                            u32 offset = 2;
+                            while (is_whitespace(peek(offset)))
+                            {
+                                offset++;
+                            }
+                            if (peek(offset) == '0' || peek(offset) == '1')
+                            {
+                                value = peek(offset);
+                                m_pos += offset;
+                            }
+                        }
+                    }
+                    m_pos++;
+
+                    m_nodes.push_back(BooleanFunction::Node::Constant({(value == '0') ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE}));
+                    return true;
+                }
+
+                // variable := '\'? identifier ('(' int ')' | '[' int ']')?, escaping and square brackets only in standard functions
+                bool parse_variable()
+                {
+                    const bool escaped = (peek() == '\\');
+                    const u32 start    = escaped ? m_pos + 1 : m_pos;
+                    if (start >= m_expression.size() || !is_letter(m_expression[start]))
+                    {
+                        return unexpected_character();
+                    }
+
+                    u32 end = start + 1;
+                    while (end < m_expression.size() && is_identifier_character(m_expression[end]))
+                    {
+                        end++;
+                    }
+
+                    // optional index that is part of the variable name
+                    if (end < m_expression.size() && (m_expression[end] == '(' || (!is_liberty() && m_expression[end] == '[')))
+                    {
+                        const char open  = m_expression[end];
+                        const char close = (open == '(') ? ')' : ']';
+
+                        u32 index_end = end + 1;
+                        bool negative = false;
+                        if (index_end < m_expression.size() && (m_expression[index_end] == '+' || m_expression[index_end] == '-'))
+                        {
+                            negative = (m_expression[index_end] == '-');
+                            index_end++;
+                        }
+
+                        const u32 digits_start = index_end;
+                        i64 index              = 0;
+                        bool overflow          = false;
+                        while (index_end < m_expression.size() && is_digit(m_expression[index_end]))
+                        {
+                            if (!overflow)
+                            {
+                                index    = index * 10 + (m_expression[index_end] - '0');
+                                overflow = (index > (i64)std::numeric_limits<i32>::max() + 1);
+                            }
+                            index_end++;
+                        }
+                        if (negative)
+                        {
+                            index = -index;
+                        }
+
+                        if (index_end != digits_start && !overflow && index <= std::numeric_limits<i32>::max() && index_end < m_expression.size() && m_expression[index_end] == close)
+                        {
+                            std::string name;
+                            name.reserve(end - start + 12);
+                            name.append(m_expression, start, end - start);
+                            name += open;
+                            name += std::to_string(index);
+                            name += close;
+
+                            m_pos = index_end + 1;
+                            m_nodes.push_back(BooleanFunction::Node::Variable(name, 1));
+                            return true;
+                        }
+                    }
+
+                    // escaped variable names must carry an index
+                    if (escaped)
+                    {
+                        return unexpected_character();
+                    }
+
+                    m_pos = end;
+                    m_nodes.push_back(BooleanFunction::Node::Variable(m_expression.substr(start, end - start), 1));
+                    return true;
+                }
+            };
+        }    // namespace
+
+        Result<BooleanFunction> parse_expression(const std::string& expression, const ParserType& parser)
+        {
+            return RecursiveDescentParser(expression, parser).parse();
+        }
+    }    // namespace BooleanFunctionParser
+}    // namespace hal
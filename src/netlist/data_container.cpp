@@ -2,10 +2,19 @@
 
 #include "hal_core/utilities/log.h"
 
+#include <mutex>
+
 namespace hal
 {
+    namespace
+    {
+        // lazily loaded entries are decoded rarely, a single lock keeps the containers small
+        std::mutex lazy_data_mutex;
+    }    // namespace
+
     bool DataContainer::operator==(const DataContainer& other) const
     {
+        load_lazy_data();
         return m_data == other.get_data_map();
     }
 
@@ -22,9 +31,10 @@ namespace hal
             return false;
         }
 
+        load_lazy_data();
         m_data[std::make_tuple(category, key)] = std::make_tuple(value_data_type, value);
 
-        //notify_updated();
+        notify_updated();
 
         if (log_with_info_level)
         {
@@ -46,6 +56,7 @@ namespace hal
             return false;
         }
 
+        load_lazy_data();
         auto it = m_data.find(std::make_tuple(category, key));
         if (it == m_data.end())
         {
@@ -56,7 +67,7 @@ namespace hal
         auto deleted_value = std::get<1>(it->second);
         m_data.erase(it);
 
-        //notify_updated();
+        notify_updated();
 
         if (log_with_info_level)
         {
@@ -71,12 +82,63 @@ namespace hal
 
     const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& DataContainer::get_data_map() const
     {
+        load_lazy_data();
         return m_data;
     }
 
     void DataContainer::set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map)
     {
+        {
+            std::lock_guard<std::mutex> lock(lazy_data_mutex);
+            m_lazy_data.reset();
+            m_has_lazy_data = false;
+        }
         m_data = map;
+
+        notify_updated();
+    }
+
+    void DataContainer::set_lazy_data(std::shared_ptr<const LazyDataSource> source, u64 offset, u64 size)
+    {
+        std::lock_guard<std::mutex> lock(lazy_data_mutex);
+        m_data.clear();
+        m_lazy_data     = std::make_unique<LazyDataReference>(LazyDataReference{std::move(source), offset, size});
+        m_has_lazy_data = true;
+    }
+
+    bool DataContainer::has_lazy_data() const
+    {
+        return m_has_lazy_data;
+    }
+
+    void DataContainer::load_lazy_data() const
+    {
+        if (!m_has_lazy_data)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(lazy_data_mutex);
+        if (!m_has_lazy_data)
+        {
+            return;
+        }
+
+        if (auto res = m_lazy_data->source->decode_data(m_lazy_data->offset, m_lazy_data->size); res.is_ok())
+        {
+            m_data = res.get();
+        }
+        else
+        {
+            log_error("netlist", "could not load lazily deserialized data:\n{}", res.get_error().get());
+        }
+
+        m_lazy_data.reset();
+        m_has_lazy_data = false;
+    }
+
+    void DataContainer::notify_updated()
+    {
     }
 
     bool DataContainer::has_data(const std::string& category, const std::string& key) const
@@ -86,6 +148,7 @@ namespace hal
             return false;
         }
 
+        load_lazy_data();
         if (auto it = m_data.find(std::make_tuple(category, key)); it == m_data.end())
         {
             return false;
@@ -102,6 +165,7 @@ namespace hal
             return std::make_tuple("", "");
         }
 
+        load_lazy_data();
         auto it = m_data.find(std::make_tuple(category, key));
         if (it == m_data.end())
         {
@@ -27,7 +27,8 @@ namespace hal
                                                                                    {GateEvent::event::removed, "removed"},
                                                                                    {GateEvent::event::name_changed, "name_changed"},
                                                                                    {GateEvent::event::location_changed, "location_changed"},
-                                                                                   {GateEvent::event::boolean_function_changed, "boolean_function_changed"}};
+                                                                                   {GateEvent::event::boolean_function_changed, "boolean_function_changed"},
+                                                                                   {GateEvent::event::data_changed, "data_changed"}};
 
     template<>
     std::map<NetEvent::event, std::string> EnumStrings<NetEvent::event>::data = {{NetEvent::event::created, "created"},
@@ -36,7 +37,8 @@ namespace hal
                                                                                  {NetEvent::event::src_added, "src_added"},
                                                                                  {NetEvent::event::src_removed, "src_removed"},
                                                                                  {NetEvent::event::dst_added, "dst_added"},
-                                                                                 {NetEvent::event::dst_removed, "dst_removed"}};
+                                                                                 {NetEvent::event::dst_removed, "dst_removed"},
+                                                                                 {NetEvent::event::data_changed, "data_changed"}};
 
     template<>
     std::map<ModuleEvent::event, std::string> EnumStrings<ModuleEvent::event>::data = {{ModuleEvent::event::created, "created"},
@@ -52,7 +54,8 @@ namespace hal
                                                                                        {ModuleEvent::event::gates_remove_begin, "gates_remove_begin"},
                                                                                        {ModuleEvent::event::gates_remove_end, "gates_remove_end"},
                                                                                        {ModuleEvent::event::gate_removed, "gate_removed"},
-                                                                                       {ModuleEvent::event::pin_changed, "pin_changed"}};
+                                                                                       {ModuleEvent::event::pin_changed, "pin_changed"},
+                                                                                       {ModuleEvent::event::data_changed, "data_changed"}};
 
     template<>
     std::map<GroupingEvent::event, std::string> EnumStrings<GroupingEvent::event>::data = {{GroupingEvent::event::created, "created"},
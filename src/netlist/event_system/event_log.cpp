@@ -40,6 +40,10 @@ namespace hal
             {
                 log_info("event", "changed name of gate with id {:08x} to '{}'", gate->get_id(), gate->get_name());
             }
+            else if (event == GateEvent::event::data_changed)
+            {
+                log_info("event", "changed data of gate '{}' (id {:08x})", gate->get_name(), gate->get_id());
+            }
             else
             {
                 log_error("event", "unknown gate event");
@@ -83,6 +87,10 @@ namespace hal
                 auto gate = net->get_netlist()->get_gate_by_id(associated_data);
                 log_info("event", "removed destination gate '{}' (id {:08x}) from net '{}' (id {:08x})", gate->get_name(), gate->get_id(), net->get_name(), net->get_id());
             }
+            else if (event == NetEvent::event::data_changed)
+            {
+                log_info("event", "changed data of net '{}' (id {:08x})", net->get_name(), net->get_id());
+            }
             else
             {
                 log_error("event", "unknown net event");
@@ -289,6 +297,10 @@ namespace hal
             {
                 log_info("event", "changed port of module '{}' (id {:08x})", module->get_name(), module->get_id());
             }
+            else if (event == ModuleEvent::event::data_changed)
+            {
+                log_info("event", "changed data of module '{}' (id {:08x})", module->get_name(), module->get_id());
+            }
             else
             {
                 log_error("event", "unknown module event");
@@ -15,6 +15,7 @@
 
 #include <assert.h>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 
 template<typename T, T m, int k>
@@ -40,6 +41,11 @@ static u64 bitreverse(u64 n)
 
 namespace hal
 {
+    namespace
+    {
+        std::mutex lazy_function_mutex;
+    }    // namespace
+
     Gate::Gate(NetlistInternalManager* mgr, EventHandler* event_handler, const u32 id, GateType* gt, const std::string& name, i32 x, i32 y)
         : m_internal_manager(mgr), m_id(id), m_name(name), m_type(gt), m_x(x), m_y(y), m_event_handler(event_handler)
     {
@@ -66,6 +72,7 @@ namespace hal
             return false;
         }
 
+        load_lazy_boolean_functions();
         if (m_functions != other.get_boolean_functions(true))
         {
             log_info("gate", "the gates with IDs {} and {} are not equal due to an unequal Boolean functions.", m_id, other.get_id());
@@ -204,6 +211,7 @@ namespace hal
             }
         }
 
+        load_lazy_boolean_functions();
         if (auto it = m_functions.find(internal_name); it != m_functions.end())
         {
             return it->second;
@@ -244,6 +252,7 @@ namespace hal
             res = m_type->get_boolean_functions();
         }
 
+        load_lazy_boolean_functions();
         for (const auto& it : m_functions)
         {
             res[it.first] = it.second;
@@ -260,6 +269,11 @@ namespace hal
         return res;
     }
 
+    void Gate::notify_updated()
+    {
+        m_event_handler->notify(GateEvent::event::data_changed, this);
+    }
+
     BooleanFunction Gate::get_lut_function(const GatePin* pin) const
     {
         UNUSED(pin);
@@ -436,11 +450,47 @@ namespace hal
             }
         }
 
+        load_lazy_boolean_functions();
         m_functions[name] = func;
         m_event_handler->notify(GateEvent::event::boolean_function_changed, this);
         return true;
     }
 
+    void Gate::set_lazy_boolean_functions(std::shared_ptr<const LazyDataSource> source, u64 offset, u64 size)
+    {
+        std::lock_guard<std::mutex> lock(lazy_function_mutex);
+        m_functions.clear();
+        m_lazy_functions     = std::make_unique<LazyDataReference>(LazyDataReference{std::move(source), offset, size});
+        m_has_lazy_functions = true;
+    }
+
+    void Gate::load_lazy_boolean_functions() const
+    {
+        if (!m_has_lazy_functions)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(lazy_function_mutex);
+        if (!m_has_lazy_functions)
+        {
+            return;
+        }
+
+        // the decoded functions have been added through add_boolean_function before serialization, so they are stored as is
+        if (auto res = m_lazy_functions->source->decode_functions(m_lazy_functions->offset, m_lazy_functions->size); res.is_ok())
+        {
+            m_functions = res.get();
+        }
+        else
+        {
+            log_error("gate", "could not load lazily deserialized Boolean functions of gate '{}' with ID {}:\n{}", m_name, m_id, res.get_error().get());
+        }
+
+        m_lazy_functions.reset();
+        m_has_lazy_functions = false;
+    }
+
     bool Gate::mark_vcc_gate()
     {
         return m_internal_manager->m_netlist->mark_vcc_gate(this);
@@ -0,0 +1,939 @@
+#include "hal_core/netlist/gate_library/gate_library_cache.h"
+
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/lut_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_port_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/timing_component.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+#include "hal_core/utilities/utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+namespace hal
+{
+    namespace gate_library_cache
+    {
+        namespace
+        {
+            // must be increased whenever the layout of the cache file or the numbering of any of the stored enums changes
+            const u32 CACHE_VERSION   = 1;
+            const char CACHE_MAGIC[8] = {'H', 'A', 'L', 'G', 'L', 'C', 'H', 'E'};
+
+            u64 hash_content(std::string_view data)
+            {
+                // FNV-1a
+                u64 hash = 0xcbf29ce484222325ULL;
+                for (const char c : data)
+                {
+                    hash ^= (u8)c;
+                    hash *= 0x100000001b3ULL;
+                }
+                return hash;
+            }
+
+            struct CacheKey
+            {
+                std::string path;
+                u64 mtime;
+                u64 size;
+                u64 hash;
+            };
+
+            Result<CacheKey> compute_key(const std::filesystem::path& file_path)
+            {
+                std::error_code ec;
+                CacheKey key;
+                key.path = std::filesystem::absolute(file_path, ec).string();
+
+                const auto mtime = std::filesystem::last_write_time(file_path, ec);
+                if (ec)
+                {
+                    return ERR("could not compute cache key for gate library file '" + file_path.string() + "': " + ec.message());
+                }
+                key.mtime = (u64)mtime.time_since_epoch().count();
+
+                auto file = MemoryMappedFile::open(file_path);
+                if (file.is_error())
+                {
+                    return ERR_APPEND(file.get_error(), "could not compute cache key for gate library file '" + file_path.string() + "'");
+                }
+                key.size = file.get()->get_size();
+                key.hash = hash_content(file.get()->get_data());
+
+                return OK(key);
+            }
+
+            class CacheWriter
+            {
+            public:
+                void write_u8(u8 value)
+                {
+                    m_data.push_back((char)value);
+                }
+
+                void write_u16(u16 value)
+                {
+                    write_raw(&value, sizeof(value));
+                }
+
+                void write_u32(u32 value)
+                {
+                    write_raw(&value, sizeof(value));
+                }
+
+                void write_u64(u64 value)
+                {
+                    write_raw(&value, sizeof(value));
+                }
+
+                void write_double(double value)
+                {
+                    write_raw(&value, sizeof(value));
+                }
+
+                void write_string(const std::string& value)
+                {
+                    write_u32((u32)value.size());
+                    m_data.append(value);
+                }
+
+                void write_doubles(const std::vector<double>& values)
+                {
+                    write_u32((u32)values.size());
+                    write_raw(values.data(), values.size() * sizeof(double));
+                }
+
+                void write_lookup_table(const TimingComponent::LookupTable& table)
+                {
+                    write_string(table.variable_1);
+                    write_string(table.variable_2);
+                    write_doubles(table.index_1);
+                    write_doubles(table.index_2);
+                    write_doubles(table.values);
+                }
+
+                void write_raw(const void* data, size_t size)
+                {
+                    m_data.append((const char*)data, size);
+                }
+
+                void write_boolean_function(const BooleanFunction& bf)
+                {
+                    const auto& nodes = bf.get_nodes();
+                    write_u32((u32)nodes.size());
+                    for (const auto& node : nodes)
+                    {
+                        write_u16(node.type);
+                        write_u16(node.size);
+                        if (node.is_constant())
+                        {
+                            write_u16((u16)node.constant.size());
+                            for (const auto value : node.constant)
+                            {
+                                write_u8((u8)(i8)value);
+                            }
+                        }
+                        else if (node.is_index())
+                        {
+                            write_u16(node.index);
+                        }
+                        else if (node.is_variable())
+                        {
+                            write_string(node.variable);
+                        }
+                    }
+                }
+
+                const std::string& get_data() const
+                {
+                    return m_data;
+                }
+
+            private:
+                std::string m_data;
+            };
+
+            class CacheReader
+            {
+            public:
+                CacheReader(std::string_view data) : m_data(data)
+                {
+                }
+
+                u8 read_u8()
+                {
+                    u8 value = 0;
+                    read_raw(&value, sizeof(value));
+                    return value;
+                }
+
+                u16 read_u16()
+                {
+                    u16 value = 0;
+                    read_raw(&value, sizeof(value));
+                    return value;
+                }
+
+                u32 read_u32()
+                {
+                    u32 value = 0;
+                    read_raw(&value, sizeof(value));
+                    return value;
+                }
+
+                u64 read_u64()
+                {
+                    u64 value = 0;
+                    read_raw(&value, sizeof(value));
+                    return value;
+                }
+
+                double read_double()
+                {
+                    double value = 0.0;
+                    read_raw(&value, sizeof(value));
+                    return value;
+                }
+
+                std::vector<double> read_doubles()
+                {
+                    const u32 size = read_u32();
+                    if (m_failed || (m_data.size() - m_pos) / sizeof(double) < size)
+                    {
+                        m_failed = true;
+                        return {};
+                    }
+                    std::vector<double> values(size);
+                    read_raw(values.data(), size * sizeof(double));
+                    return values;
+                }
+
+                TimingComponent::LookupTable read_lookup_table()
+                {
+                    TimingComponent::LookupTable table;
+                    table.variable_1 = read_string();
+                    table.variable_2 = read_string();
+                    table.index_1    = read_doubles();
+                    table.index_2    = read_doubles();
+                    table.values     = read_doubles();
+                    return table;
+                }
+
+                std::string read_string()
+                {
+                    const u32 size = read_u32();
+                    if (m_failed || m_data.size() - m_pos < size)
+                    {
+                        m_failed = true;
+                        return "";
+                    }
+                    std::string value(m_data.substr(m_pos, size));
+                    m_pos += size;
+                    return value;
+                }
+
+                void read_raw(void* data, size_t size)
+                {
+                    if (m_failed || m_data.size() - m_pos < size)
+                    {
+                        m_failed = true;
+                        return;
+                    }
+                    std::memcpy(data, m_data.data() + m_pos, size);
+                    m_pos += size;
+                }
+
+                Result<BooleanFunction> read_boolean_function()
+                {
+                    const u32 num_nodes = read_u32();
+                    if (num_nodes == 0)
+                    {
+                        return OK(BooleanFunction());
+                    }
+
+                    std::vector<BooleanFunction::Node> nodes;
+                    for (u32 i = 0; i < num_nodes && !m_failed; i++)
+                    {
+                        const u16 type = read_u16();
+                        const u16 size = read_u16();
+                        if (type == BooleanFunction::NodeType::Constant)
+                        {
+                            std::vector<BooleanFunction::Value> values(read_u16());
+                            for (auto& value : values)
+                            {
+                                value = (BooleanFunction::Value)(i8)read_u8();
+                            }
+                            nodes.push_back(BooleanFunction::Node::Constant(values));
+                        }
+                        else if (type == BooleanFunction::NodeType::Index)
+                        {
+                            nodes.push_back(BooleanFunction::Node::Index(read_u16(), size));
+                        }
+                        else if (type == BooleanFunction::NodeType::Variable)
+                        {
+                            nodes.push_back(BooleanFunction::Node::Variable(read_string(), size));
+                        }
+                        else
+                        {
+                            nodes.push_back(BooleanFunction::Node::Operation(type, size));
+                        }
+                    }
+
+                    if (m_failed)
+                    {
+                        return ERR("unexpected end of data while reading Boolean function");
+                    }
+                    return BooleanFunction::build(std::move(nodes));
+                }
+
+                bool failed() const
+                {
+                    return m_failed;
+                }
+
+                bool at_end() const
+                {
+                    return m_pos == m_data.size();
+                }
+
+            private:
+                std::string_view m_data;
+                size_t m_pos  = 0;
+                bool m_failed = false;
+            };
+
+            void write_key(CacheWriter& writer, const CacheKey& key)
+            {
+                writer.write_raw(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+                writer.write_u32(CACHE_VERSION);
+                writer.write_string(key.path);
+                writer.write_u64(key.mtime);
+                writer.write_u64(key.size);
+                writer.write_u64(key.hash);
+            }
+
+            void write_components(CacheWriter& writer, const GateType* gt)
+            {
+                // components form a chain of single children and are returned bottom-up, so store them top-down
+                std::vector<GateTypeComponent*> components = gt->get_components();
+                writer.write_u32((u32)components.size());
+                for (auto it = components.rbegin(); it != components.rend(); it++)
+                {
+                    const GateTypeComponent* component = *it;
+                    writer.write_u8((u8)component->get_type());
+                    switch (component->get_type())
+                    {
+                        case GateTypeComponent::ComponentType::lut: {
+                            writer.write_u8(component->convert_to<LUTComponent>()->is_init_ascending());
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::ff: {
+                            const FFComponent* ff = component->convert_to<FFComponent>();
+                            writer.write_boolean_function(ff->get_next_state_function());
+                            writer.write_boolean_function(ff->get_clock_function());
+                            writer.write_boolean_function(ff->get_async_reset_function());
+                            writer.write_boolean_function(ff->get_async_set_function());
+                            writer.write_u32((u32)ff->get_async_set_reset_behavior().first);
+                            writer.write_u32((u32)ff->get_async_set_reset_behavior().second);
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::latch: {
+                            const LatchComponent* latch = component->convert_to<LatchComponent>();
+                            writer.write_boolean_function(latch->get_data_in_function());
+                            writer.write_boolean_function(latch->get_enable_function());
+                            writer.write_boolean_function(latch->get_async_reset_function());
+                            writer.write_boolean_function(latch->get_async_set_function());
+                            writer.write_u32((u32)latch->get_async_set_reset_behavior().first);
+                            writer.write_u32((u32)latch->get_async_set_reset_behavior().second);
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::ram: {
+                            writer.write_u32(component->convert_to<RAMComponent>()->get_bit_size());
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::mac: {
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::init: {
+                            const InitComponent* init = component->convert_to<InitComponent>();
+                            writer.write_string(init->get_init_category());
+                            writer.write_u32((u32)init->get_init_identifiers().size());
+                            for (const auto& identifier : init->get_init_identifiers())
+                            {
+                                writer.write_string(identifier);
+                            }
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::state: {
+                            const StateComponent* state = component->convert_to<StateComponent>();
+                            writer.write_string(state->get_state_identifier());
+                            writer.write_string(state->get_neg_state_identifier());
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::ram_port: {
+                            const RAMPortComponent* ram_port = component->convert_to<RAMPortComponent>();
+                            writer.write_string(ram_port->get_data_group());
+                            writer.write_string(ram_port->get_address_group());
+                            writer.write_boolean_function(ram_port->get_clock_function());
+                            writer.write_boolean_function(ram_port->get_enable_function());
+                            writer.write_u8(ram_port->is_write_port());
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::timing: {
+                            const TimingComponent* timing = component->convert_to<TimingComponent>();
+                            writer.write_double(timing->get_area());
+                            writer.write_double(timing->get_leakage_power());
+
+                            // sort capacitances by pin name to obtain reproducible cache files
+                            std::vector<std::pair<std::string, double>> capacitances(timing->get_pin_capacitances().begin(), timing->get_pin_capacitances().end());
+                            std::sort(capacitances.begin(), capacitances.end());
+                            writer.write_u32((u32)capacitances.size());
+                            for (const auto& [pin, capacitance] : capacitances)
+                            {
+                                writer.write_string(pin);
+                                writer.write_double(capacitance);
+                            }
+
+                            writer.write_u32((u32)timing->get_timing_arcs().size());
+                            for (const auto& arc : timing->get_timing_arcs())
+                            {
+                                writer.write_string(arc.pin);
+                                writer.write_string(arc.related_pin);
+                                writer.write_string(arc.timing_sense);
+                                writer.write_string(arc.timing_type);
+                                writer.write_lookup_table(arc.cell_rise);
+                                writer.write_lookup_table(arc.cell_fall);
+                                writer.write_lookup_table(arc.rise_transition);
+                                writer.write_lookup_table(arc.fall_transition);
+                            }
+                            break;
+                        }
+                    }
+                }
+            }
+
+            Result<std::unique_ptr<GateTypeComponent>> read_components(CacheReader& reader)
+            {
+                struct ComponentData
+                {
+                    GateTypeComponent::ComponentType type;
+                    std::vector<BooleanFunction> functions;
+                    std::vector<std::string> strings;
+                    std::vector<u32> values;
+                    std::vector<double> reals;
+                    std::vector<std::pair<std::string, double>> capacitances;
+                    std::vector<TimingComponent::TimingArc> timing_arcs;
+                };
+
+                const u32 num_components = reader.read_u32();
+                std::vector<ComponentData> top_down;
+                for (u32 i = 0; i < num_components && !reader.failed(); i++)
+                {
+                    ComponentData data;
+                    data.type           = (GateTypeComponent::ComponentType)reader.read_u8();
+                    u32 num_functions   = 0;
+                    u32 num_strings     = 0;
+                    u32 num_values      = 0;
+                    bool dynamic_string = false;
+                    switch (data.type)
+                    {
+                        case GateTypeComponent::ComponentType::lut:
+                            num_values = 1;
+                            break;
+                        case GateTypeComponent::ComponentType::ff:
+                        case GateTypeComponent::ComponentType::latch:
+                            num_functions = 4;
+                            num_values    = 2;
+                            break;
+                        case GateTypeComponent::ComponentType::ram:
+                            num_values = 1;
+                            break;
+                        case GateTypeComponent::ComponentType::mac:
+                            break;
+                        case GateTypeComponent::ComponentType::init:
+                            dynamic_string = true;
+                            break;
+                        case GateTypeComponent::ComponentType::state:
+                            num_strings = 2;
+                            break;
+                        case GateTypeComponent::ComponentType::ram_port:
+                            num_strings   = 2;
+                            num_functions = 2;
+                            num_values    = 1;
+                            break;
+                        case GateTypeComponent::ComponentType::timing: {
+                            data.reals.push_back(reader.read_double());
+                            data.reals.push_back(reader.read_double());
+                            const u32 num_capacitances = reader.read_u32();
+                            for (u32 j = 0; j < num_capacitances && !reader.failed(); j++)
+                            {
+                                std::string pin          = reader.read_string();
+                                const double capacitance = reader.read_double();
+                                data.capacitances.emplace_back(std::move(pin), capacitance);
+                            }
+                            const u32 num_arcs = reader.read_u32();
+                            for (u32 j = 0; j < num_arcs && !reader.failed(); j++)
+                            {
+                                TimingComponent::TimingArc arc;
+                                arc.pin             = reader.read_string();
+                                arc.related_pin     = reader.read_string();
+                                arc.timing_sense    = reader.read_string();
+                                arc.timing_type     = reader.read_string();
+                                arc.cell_rise       = reader.read_lookup_table();
+                                arc.cell_fall       = reader.read_lookup_table();
+                                arc.rise_transition = reader.read_lookup_table();
+                                arc.fall_transition = reader.read_lookup_table();
+                                data.timing_arcs.push_back(std::move(arc));
+                            }
+                            break;
+                        }
+                        default:
+                            return ERR("unknown component type " + std::to_string((u32)data.type));
+                    }
+
+                    if (dynamic_string)
+                    {
+                        data.strings.push_back(reader.read_string());
+                        num_strings = reader.read_u32();
+                    }
+                    for (u32 j = 0; j < num_strings && !reader.failed(); j++)
+                    {
+                        data.strings.push_back(reader.read_string());
+                    }
+                    for (u32 j = 0; j < num_functions; j++)
+                    {
+                        auto bf = reader.read_boolean_function();
+                        if (bf.is_error())
+                        {
+                            return ERR_APPEND(bf.get_error(), "could not read Boolean function of component");
+                        }
+                        data.functions.push_back(bf.get());
+                    }
+                    for (u32 j = 0; j < num_values; j++)
+                    {
+                        // the LUT bit-order and the RAM port direction are stored as single bytes
+                        const bool is_flag = data.type == GateTypeComponent::ComponentType::lut || data.type == GateTypeComponent::ComponentType::ram_port;
+                        data.values.push_back(is_flag ? reader.read_u8() : reader.read_u32());
+                    }
+                    top_down.push_back(std::move(data));
+                }
+
+                if (reader.failed())
+                {
+                    return ERR("unexpected end of data while reading components");
+                }
+
+                // rebuild the chain bottom-up
+                std::unique_ptr<GateTypeComponent> component = nullptr;
+                for (auto it = top_down.rbegin(); it != top_down.rend(); it++)
+                {
+                    ComponentData& data = *it;
+                    switch (data.type)
+                    {
+                        case GateTypeComponent::ComponentType::lut:
+                            component = GateTypeComponent::create_lut_component(std::move(component), data.values.at(0) != 0);
+                            break;
+                        case GateTypeComponent::ComponentType::ff: {
+                            component       = GateTypeComponent::create_ff_component(std::move(component), data.functions.at(0), data.functions.at(1));
+                            FFComponent* ff = component->convert_to<FFComponent>();
+                            ff->set_async_reset_function(data.functions.at(2));
+                            ff->set_async_set_function(data.functions.at(3));
+                            ff->set_async_set_reset_behavior((AsyncSetResetBehavior)data.values.at(0), (AsyncSetResetBehavior)data.values.at(1));
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::latch: {
+                            component             = GateTypeComponent::create_latch_component(std::move(component));
+                            LatchComponent* latch = component->convert_to<LatchComponent>();
+                            latch->set_data_in_function(data.functions.at(0));
+                            latch->set_enable_function(data.functions.at(1));
+                            latch->set_async_reset_function(data.functions.at(2));
+                            latch->set_async_set_function(data.functions.at(3));
+                            latch->set_async_set_reset_behavior((AsyncSetResetBehavior)data.values.at(0), (AsyncSetResetBehavior)data.values.at(1));
+                            break;
+                        }
+                        case GateTypeComponent::ComponentType::ram:
+                            component = GateTypeComponent::create_ram_component(std::move(component), data.values.at(0));
+                            break;
+                        case GateTypeComponent::ComponentType::mac:
+                            component = GateTypeComponent::create_mac_component();
+                            break;
+                        case GateTypeComponent::ComponentType::init:
+                            component = GateTypeComponent::create_init_component(data.strings.at(0), std::vector<std::string>(data.strings.begin() + 1, data.strings.end()));
+                            break;
+                        case GateTypeComponent::ComponentType::state:
+                            component = GateTypeComponent::create_state_component(std::move(component), data.strings.at(0), data.strings.at(1));
+                            break;
+                        case GateTypeComponent::ComponentType::ram_port:
+                            component = GateTypeComponent::create_ram_port_component(
+                                std::move(component), data.strings.at(0), data.strings.at(1), data.functions.at(0), data.functions.at(1), data.values.at(0) != 0);
+                            break;
+                        case GateTypeComponent::ComponentType::timing: {
+                            component               = GateTypeComponent::create_timing_component(std::move(component));
+                            TimingComponent* timing = component->convert_to<TimingComponent>();
+                            timing->set_area(data.reals.at(0));
+                            timing->set_leakage_power(data.reals.at(1));
+                            for (const auto& [pin, capacitance] : data.capacitances)
+                            {
+                                timing->set_pin_capacitance(pin, capacitance);
+                            }
+                            for (const auto& arc : data.timing_arcs)
+                            {
+                                timing->add_timing_arc(arc);
+                            }
+                            break;
+                        }
+                    }
+                }
+
+                return OK(std::move(component));
+            }
+
+            void write_gate_type(CacheWriter& writer, const GateLibrary* gate_lib, const GateType* gt)
+            {
+                writer.write_u32(gt->get_id());
+                writer.write_string(gt->get_name());
+
+                const std::set<GateTypeProperty> properties = gt->get_properties();
+                writer.write_u32((u32)properties.size());
+                for (const auto property : properties)
+                {
+                    writer.write_u32((u32)property);
+                }
+
+                write_components(writer, gt);
+
+                const std::vector<PinGroup<GatePin>*> pin_groups = gt->get_pin_groups();
+                writer.write_u32((u32)pin_groups.size());
+                for (const auto* pin_group : pin_groups)
+                {
+                    writer.write_u32(pin_group->get_id());
+                    writer.write_string(pin_group->get_name());
+                    writer.write_u32((u32)pin_group->get_direction());
+                    writer.write_u32((u32)pin_group->get_type());
+                    writer.write_u8(pin_group->is_ascending());
+                    writer.write_u32(pin_group->get_start_index());
+
+                    const std::vector<GatePin*> pins = pin_group->get_pins();
+                    writer.write_u32((u32)pins.size());
+                    for (const auto* pin : pins)
+                    {
+                        writer.write_u32(pin->get_id());
+                        writer.write_string(pin->get_name());
+                        writer.write_u32((u32)pin->get_direction());
+                        writer.write_u32((u32)pin->get_type());
+                    }
+                }
+
+                // sort Boolean functions by name to obtain reproducible cache files
+                std::vector<std::pair<std::string, const BooleanFunction*>> functions;
+                for (const auto& [name, bf] : gt->get_boolean_functions())
+                {
+                    functions.emplace_back(name, &bf);
+                }
+                std::sort(functions.begin(), functions.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+                writer.write_u32((u32)functions.size());
+                for (const auto& [name, bf] : functions)
+                {
+                    writer.write_string(name);
+                    writer.write_boolean_function(*bf);
+                }
+
+                const auto vcc_gate_types = gate_lib->get_vcc_gate_types();
+                const auto gnd_gate_types = gate_lib->get_gnd_gate_types();
+                writer.write_u8(vcc_gate_types.find(gt->get_name()) != vcc_gate_types.end());
+                writer.write_u8(gnd_gate_types.find(gt->get_name()) != gnd_gate_types.end());
+            }
+
+            Result<std::monostate> read_gate_type(CacheReader& reader, GateLibrary* gate_lib)
+            {
+                const u32 id           = reader.read_u32();
+                const std::string name = reader.read_string();
+
+                std::set<GateTypeProperty> properties;
+                const u32 num_properties = reader.read_u32();
+                for (u32 i = 0; i < num_properties && !reader.failed(); i++)
+                {
+                    properties.insert((GateTypeProperty)reader.read_u32());
+                }
+
+                auto component = read_components(reader);
+                if (component.is_error())
+                {
+                    return ERR_APPEND(component.get_error(), "could not read gate type '" + name + "'");
+                }
+
+                if (reader.failed())
+                {
+                    return ERR("could not read gate type: unexpected end of data");
+                }
+
+                GateType* gt = gate_lib->create_gate_type(name, properties, component.get());
+                if (gt == nullptr)
+                {
+                    return ERR("could not read gate type '" + name + "': failed to create gate type");
+                }
+                if (gt->get_id() != id)
+                {
+                    return ERR("could not read gate type '" + name + "': expected ID " + std::to_string(id) + " but got ID " + std::to_string(gt->get_id()));
+                }
+
+                const u32 num_pin_groups = reader.read_u32();
+                for (u32 i = 0; i < num_pin_groups && !reader.failed(); i++)
+                {
+                    const u32 group_id                 = reader.read_u32();
+                    const std::string group_name       = reader.read_string();
+                    const PinDirection group_direction = (PinDirection)reader.read_u32();
+                    const PinType group_type           = (PinType)reader.read_u32();
+                    const bool ascending               = reader.read_u8() != 0;
+                    const u32 start_index              = reader.read_u32();
+
+                    std::vector<GatePin*> pins;
+                    const u32 num_pins = reader.read_u32();
+                    for (u32 j = 0; j < num_pins && !reader.failed(); j++)
+                    {
+                        const u32 pin_id                 = reader.read_u32();
+                        const std::string pin_name       = reader.read_string();
+                        const PinDirection pin_direction = (PinDirection)reader.read_u32();
+                        const PinType pin_type           = (PinType)reader.read_u32();
+                        if (reader.failed())
+                        {
+                            break;
+                        }
+
+                        auto pin = gt->create_pin(pin_id, pin_name, pin_direction, pin_type, false);
+                        if (pin.is_error())
+                        {
+                            return ERR_APPEND(pin.get_error(), "could not read gate type '" + name + "': failed to create pin '" + pin_name + "'");
+                        }
+                        pins.push_back(pin.get());
+                    }
+
+                    if (reader.failed())
+                    {
+                        break;
+                    }
+
+                    if (auto res = gt->create_pin_group(group_id, group_name, pins, group_direction, group_type, ascending, start_index); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not read gate type '" + name + "': failed to create pin group '" + group_name + "'");
+                    }
+                }
+
+                std::unordered_map<std::string, BooleanFunction> functions;
+                const u32 num_functions = reader.read_u32();
+                for (u32 i = 0; i < num_functions && !reader.failed(); i++)
+                {
+                    std::string function_name = reader.read_string();
+                    auto bf                   = reader.read_boolean_function();
+                    if (bf.is_error())
+                    {
+                        return ERR_APPEND(bf.get_error(), "could not read gate type '" + name + "': failed to read Boolean function '" + function_name + "'");
+                    }
+                    functions.emplace(std::move(function_name), bf.get());
+                }
+                gt->add_boolean_functions(functions);
+
+                if (reader.read_u8() != 0)
+                {
+                    gate_lib->mark_vcc_gate_type(gt);
+                }
+                if (reader.read_u8() != 0)
+                {
+                    gate_lib->mark_gnd_gate_type(gt);
+                }
+
+                if (reader.failed())
+                {
+                    return ERR("could not read gate type '" + name + "': unexpected end of data");
+                }
+
+                return OK({});
+            }
+        }    // namespace
+
+        std::filesystem::path get_cache_path(const std::filesystem::path& file_path)
+        {
+            std::error_code ec;
+            const std::string absolute_path = std::filesystem::absolute(file_path, ec).string();
+
+            std::stringstream ss;
+            ss << file_path.stem().string() << "_" << std::hex << std::setw(16) << std::setfill('0') << hash_content(absolute_path) << ".hglc";
+            return utils::get_user_share_directory() / "gate_library_cache" / ss.str();
+        }
+
+        Result<std::monostate> write(const GateLibrary* gate_lib, const std::filesystem::path& file_path, const std::filesystem::path& cache_path)
+        {
+            if (gate_lib == nullptr)
+            {
+                return ERR("could not write gate library cache file '" + cache_path.string() + "': gate library is a 'nullptr'");
+            }
+
+            auto key = compute_key(file_path);
+            if (key.is_error())
+            {
+                return ERR_APPEND(key.get_error(), "could not write gate library cache file '" + cache_path.string() + "'");
+            }
+
+            CacheWriter writer;
+            write_key(writer, key.get());
+
+            writer.write_string(gate_lib->get_name());
+            writer.write_string(gate_lib->get_gate_location_data_category());
+            writer.write_string(gate_lib->get_gate_location_data_identifiers().first);
+            writer.write_string(gate_lib->get_gate_location_data_identifiers().second);
+
+            const std::vector<std::string> includes = gate_lib->get_includes();
+            writer.write_u32((u32)includes.size());
+            for (const auto& include : includes)
+            {
+                writer.write_string(include);
+            }
+
+            // gate type IDs are assigned sequentially on creation, so store the gate types ordered by ID
+            std::vector<GateType*> gate_types;
+            for (const auto& [name, gt] : gate_lib->get_gate_types())
+            {
+                gate_types.push_back(gt);
+            }
+            std::sort(gate_types.begin(), gate_types.end(), [](const GateType* a, const GateType* b) { return a->get_id() < b->get_id(); });
+
+            writer.write_u32((u32)gate_types.size());
+            for (const auto* gt : gate_types)
+            {
+                write_gate_type(writer, gate_lib, gt);
+            }
+
+            std::error_code ec;
+            std::filesystem::create_directories(cache_path.parent_path(), ec);
+
+            // write to a temporary file first so that concurrent readers never observe a partially written cache file
+            std::filesystem::path tmp_path = cache_path;
+            tmp_path += ".tmp" + std::to_string(std::random_device{}());
+            {
+                std::ofstream ofs(tmp_path, std::ios::binary | std::ios::trunc);
+                if (!ofs.is_open())
+                {
+                    return ERR("could not write gate library cache file '" + cache_path.string() + "': failed to open file '" + tmp_path.string() + "'");
+                }
+                ofs.write(writer.get_data().data(), writer.get_data().size());
+                if (!ofs.good())
+                {
+                    ofs.close();
+                    std::filesystem::remove(tmp_path, ec);
+                    return ERR("could not write gate library cache file '" + cache_path.string() + "': failed to write file '" + tmp_path.string() + "'");
+                }
+            }
+
+            std::filesystem::rename(tmp_path, cache_path, ec);
+            if (ec)
+            {
+                std::filesystem::remove(tmp_path, ec);
+                return ERR("could not write gate library cache file '" + cache_path.string() + "': failed to replace existing file");
+            }
+
+            return OK({});
+        }
+
+        Result<std::unique_ptr<GateLibrary>> read(const std::filesystem::path& file_path, const std::filesystem::path& cache_path)
+        {
+            if (!std::filesystem::exists(cache_path))
+            {
+                return ERR("could not read gate library cache file '" + cache_path.string() + "': file does not exist");
+            }
+
+            auto file = MemoryMappedFile::open(cache_path);
+            if (file.is_error())
+            {
+                return ERR_APPEND(file.get_error(), "could not read gate library cache file '" + cache_path.string() + "'");
+            }
+            CacheReader reader(file.get()->get_data());
+
+            char magic[sizeof(CACHE_MAGIC)] = {};
+            reader.read_raw(magic, sizeof(magic));
+            if (reader.failed() || std::memcmp(magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0)
+            {
+                return ERR("could not read gate library cache file '" + cache_path.string() + "': file is not a gate library cache file");
+            }
+            if (const u32 version = reader.read_u32(); version != CACHE_VERSION)
+            {
+                return ERR("could not read gate library cache file '" + cache_path.string() + "': cache version " + std::to_string(version) + " does not match expected version "
+                           + std::to_string(CACHE_VERSION));
+            }
+
+            CacheKey cached_key;
+            cached_key.path  = reader.read_string();
+            cached_key.mtime = reader.read_u64();
+            cached_key.size  = reader.read_u64();
+            cached_key.hash  = reader.read_u64();
+            if (reader.failed())
+            {
+                return ERR("could not read gate library cache file '" + cache_path.string() + "': unexpected end of data");
+            }
+
+            // the modification time and size are checked first to avoid hashing the gate library file if the cache file is outdated anyway
+            std::error_code ec;
+            const std::string absolute_path = std::filesystem::absolute(file_path, ec).string();
+            const auto mtime                = std::filesystem::last_write_time(file_path, ec);
+            const u64 size                  = std::filesystem::file_size(file_path, ec);
+            if (ec || cached_key.path != absolute_path || cached_key.size != size)
+            {
+                return ERR("could not read gate library cache file '" + cache_path.string() + "': cache file is outdated");
+            }
+            if ((u64)mtime.time_since_epoch().count() != cached_key.mtime)
+            {
+                // the file may have been touched without changing its contents
+                auto key = compute_key(file_path);
+                if (key.is_error())
+                {
+                    return ERR_APPEND(key.get_error(), "could not read gate library cache file '" + cache_path.string() + "'");
+                }
+                if (key.get().hash != cached_key.hash)
+                {
+                    return ERR("could not read gate library cache file '" + cache_path.string() + "': cache file is outdated");
+                }
+            }
+
+            const std::string name = reader.read_string();
+            auto gate_lib          = std::make_unique<GateLibrary>(file_path, name);
+
+            const std::string location_category = reader.read_string();
+            const std::string location_x        = reader.read_string();
+            const std::string location_y        = reader.read_string();
+            gate_lib->set_gate_location_data_category(location_category);
+            gate_lib->set_gate_location_data_identifiers(location_x, location_y);
+
+            const u32 num_includes = reader.read_u32();
+            for (u32 i = 0; i < num_includes && !reader.failed(); i++)
+            {
+                gate_lib->add_include(reader.read_string());
+            }
+
+            const u32 num_gate_types = reader.read_u32();
+            for (u32 i = 0; i < num_gate_types && !reader.failed(); i++)
+            {
+                if (auto res = read_gate_type(reader, gate_lib.get()); res.is_error())
+                {
+                    return ERR_APPEND(res.get_error(), "could not read gate library cache file '" + cache_path.string() + "'");
+                }
+            }
+
+            if (reader.failed() || !reader.at_end())
+            {
+                return ERR("could not read gate library cache file '" + cache_path.string() + "': file is corrupted");
+            }
+
+            return OK(std::move(gate_lib));
+        }
+    }    // namespace gate_library_cache
+}    // namespace hal
@@ -1,11 +1,14 @@
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
 
 #include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_library_cache.h"
+#include "hal_core/netlist/gate_library/gate_library_manifest.h"
 #include "hal_core/netlist/gate_library/gate_library_parser/gate_library_parser_manager.h"
 #include "hal_core/netlist/gate_library/gate_library_writer/gate_library_writer_manager.h"
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/utils.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace hal
@@ -16,6 +19,32 @@ namespace hal
         {
             std::map<std::filesystem::path, std::unique_ptr<GateLibrary>> m_gate_libraries;
 
+            // lower case gate type names mapped to all gate libraries providing a gate type of that name
+            std::unordered_map<std::string, std::vector<GateLibrary*>> m_gate_type_index;
+            bool m_gate_type_index_valid = false;
+
+            // summary of all gate library files within the gate library directories, built on first use
+            std::vector<gate_library_manifest::Entry> m_manifest;
+            bool m_manifest_valid = false;
+
+            void update_gate_type_index()
+            {
+                if (m_gate_type_index_valid)
+                {
+                    return;
+                }
+
+                m_gate_type_index.clear();
+                for (const auto& [path, lib] : m_gate_libraries)
+                {
+                    for (const auto& [gt_name, gt] : lib->get_gate_types())
+                    {
+                        m_gate_type_index[utils::to_lower(gt_name)].push_back(lib.get());
+                    }
+                }
+                m_gate_type_index_valid = true;
+            }
+
             Result<std::monostate> prepare_library(const std::unique_ptr<GateLibrary>& lib)
             {
                 auto gate_types = lib->get_gate_types();
@@ -94,20 +123,39 @@ namespace hal
                 }
             }
 
-            std::unique_ptr<GateLibrary> gate_lib = gate_library_parser_manager::parse(file_path);
-            if (gate_lib == nullptr)
+            const std::filesystem::path cache_path = gate_library_cache::get_cache_path(file_path);
+
+            std::unique_ptr<GateLibrary> gate_lib;
+            if (auto res = gate_library_cache::read(file_path, cache_path); res.is_ok())
             {
-                return nullptr;
+                log_info("gate_library_manager", "loaded gate library '{}' from cache file '{}'.", file_path.string(), cache_path.string());
+                gate_lib = res.get();
             }
-
-            if (auto res = prepare_library(gate_lib); res.is_error())
+            else
             {
-                log_error("gate_library_parser", "error encountered while loading gate library:\n{}", res.get_error().get());
-                return nullptr;
+                log_debug("gate_library_manager", "no valid cache file for gate library '{}':\n{}", file_path.string(), res.get_error().get());
+
+                gate_lib = gate_library_parser_manager::parse(file_path);
+                if (gate_lib == nullptr)
+                {
+                    return nullptr;
+                }
+
+                if (auto prep_res = prepare_library(gate_lib); prep_res.is_error())
+                {
+                    log_error("gate_library_parser", "error encountered while loading gate library:\n{}", prep_res.get_error().get());
+                    return nullptr;
+                }
+
+                if (auto write_res = gate_library_cache::write(gate_lib.get(), file_path, cache_path); write_res.is_error())
+                {
+                    log_warning("gate_library_manager", "could not cache gate library '{}':\n{}", file_path.string(), write_res.get_error().get());
+                }
             }
 
             GateLibrary* res                     = gate_lib.get();
             m_gate_libraries[file_path.string()] = std::move(gate_lib);
+            m_gate_type_index_valid              = false;
             return res;
         }
 
@@ -169,6 +217,7 @@ namespace hal
         void remove(std::filesystem::path file_path)
         {
             m_gate_libraries.erase(file_path);
+            m_gate_type_index_valid = false;
         }
 
         GateLibrary* get_gate_library(const std::string& file_path)
@@ -189,6 +238,12 @@ namespace hal
                 auto lib_path = utils::get_file(stripped_name, utils::get_gate_library_directories());
                 if (lib_path.empty())
                 {
+                    // the query may also be the name of a gate library
+                    if (GateLibrary* gate_lib = get_gate_library_by_name(file_path); gate_lib != nullptr)
+                    {
+                        return gate_lib;
+                    }
+
                     log_info("gate_library_manager", "could not find gate library file '{}'.", stripped_name.string());
                     return nullptr;
                 }
@@ -214,6 +269,15 @@ namespace hal
                     return it.second.get();
                 }
             }
+
+            // not loaded yet -> load from the gate library directories
+            for (const auto& entry : get_manifest())
+            {
+                if (entry.is_valid() && entry.name == lib_name)
+                {
+                    return load(entry.path);
+                }
+            }
             return nullptr;
         }
 
@@ -227,5 +291,118 @@ namespace hal
             }
             return res;
         }
+
+        const std::vector<gate_library_manifest::Entry>& get_manifest(bool rescan)
+        {
+            if (m_manifest_valid && !rescan)
+            {
+                return m_manifest;
+            }
+
+            const std::filesystem::path manifest_path = gate_library_manifest::get_manifest_path();
+
+            std::map<std::filesystem::path, gate_library_manifest::Entry> persisted_entries;
+            if (auto res = gate_library_manifest::read(manifest_path); res.is_ok())
+            {
+                for (auto& entry : res.get())
+                {
+                    persisted_entries.emplace(entry.path, std::move(entry));
+                }
+            }
+            else
+            {
+                log_debug("gate_library_manager", "no valid gate library manifest found:\n{}", res.get_error().get());
+            }
+
+            bool changed = false;
+            m_manifest.clear();
+            for (const auto& path : get_all_path())
+            {
+                const std::filesystem::path absolute_path = std::filesystem::absolute(path);
+                if (auto it = persisted_entries.find(absolute_path); it != persisted_entries.end() && it->second.is_up_to_date())
+                {
+                    m_manifest.push_back(std::move(it->second));
+                    persisted_entries.erase(it);
+                    continue;
+                }
+
+                // new or modified gate library file, hence it has to be loaded once to learn about its gate types
+                GateLibrary* gate_lib = nullptr;
+                if (auto it = m_gate_libraries.find(absolute_path); it != m_gate_libraries.end())
+                {
+                    gate_lib = it->second.get();
+                }
+                else
+                {
+                    gate_lib = load(absolute_path);
+                }
+                m_manifest.push_back(gate_library_manifest::create_entry(absolute_path, gate_lib));
+                changed = true;
+            }
+
+            // entries of gate library files that no longer exist
+            changed |= !persisted_entries.empty();
+
+            if (changed)
+            {
+                if (auto res = gate_library_manifest::write(m_manifest, manifest_path); res.is_error())
+                {
+                    log_warning("gate_library_manager", "could not persist gate library manifest:\n{}", res.get_error().get());
+                }
+            }
+
+            m_manifest_valid = true;
+            return m_manifest;
+        }
+
+        std::vector<GateLibrary*> load_by_gate_types(const std::unordered_set<std::string>& gate_type_names)
+        {
+            std::vector<GateLibrary*> res;
+            for (const auto& entry : get_manifest())
+            {
+                if (!entry.is_valid())
+                {
+                    continue;
+                }
+
+                if (std::all_of(gate_type_names.begin(), gate_type_names.end(), [&entry](const std::string& name) { return entry.may_contain_gate_type(name); }))
+                {
+                    if (GateLibrary* gate_lib = get_gate_library(entry.path.string()); gate_lib != nullptr)
+                    {
+                        res.push_back(gate_lib);
+                    }
+                }
+            }
+            return res;
+        }
+
+        std::vector<std::pair<GateLibrary*, double>> get_gate_libraries_by_coverage(const std::unordered_set<std::string>& gate_type_names)
+        {
+            update_gate_type_index();
+
+            std::unordered_map<GateLibrary*, u32> num_covered;
+            for (const auto& name : gate_type_names)
+            {
+                if (const auto it = m_gate_type_index.find(utils::to_lower(name)); it != m_gate_type_index.end())
+                {
+                    for (GateLibrary* lib : it->second)
+                    {
+                        num_covered[lib]++;
+                    }
+                }
+            }
+
+            std::vector<std::pair<GateLibrary*, double>> res;
+            res.reserve(m_gate_libraries.size());
+            for (const auto& it : m_gate_libraries)
+            {
+                GateLibrary* lib = it.second.get();
+                res.emplace_back(lib, gate_type_names.empty() ? 1.0 : (double)num_covered[lib] / gate_type_names.size());
+            }
+
+            // keep the order of libraries with equal coverage stable
+            std::stable_sort(res.begin(), res.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+            return res;
+        }
     }    // namespace gate_library_manager
 }    // namespace hal
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include "hal_core/netlist/gate_library/gate_library_manifest.h"
+
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+#include "hal_core/utilities/utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+namespace hal
+{
+    namespace gate_library_manifest
+    {
+        namespace
+        {
+            // must be increased whenever the layout of the manifest file or the Bloom filter hashing changes
+            const u32 MANIFEST_VERSION   = 1;
+            const char MANIFEST_MAGIC[8] = {'H', 'A', 'L', 'G', 'L', 'M', 'A', 'N'};
+
+            // about 1% false positives for 10 bits per gate type and 7 hash functions
+            const u32 FILTER_BITS_PER_GATE_TYPE = 10;
+            const u32 FILTER_NUM_HASHES         = 7;
+
+            std::pair<u64, u64> hash_gate_type_name(const std::string& gate_type_name)
+            {
+                // FNV-1a on the lower case name, the second hash is derived by a splitmix64 finalizer
+                u64 h1 = 0xcbf29ce484222325ULL;
+                for (const char c : utils::to_lower(gate_type_name))
+                {
+                    h1 ^= (u8)c;
+                    h1 *= 0x100000001b3ULL;
+                }
+
+                u64 h2 = h1 + 0x9e3779b97f4a7c15ULL;
+                h2     = (h2 ^ (h2 >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                h2     = (h2 ^ (h2 >> 27)) * 0x94d049bb133111ebULL;
+                h2     = h2 ^ (h2 >> 31);
+
+                return {h1, h2 | 1};
+            }
+
+            void append_raw(std::string& data, const void* value, size_t size)
+            {
+                data.append((const char*)value, size);
+            }
+
+            void append_string(std::string& data, const std::string& value)
+            {
+                const u32 size = (u32)value.size();
+                append_raw(data, &size, sizeof(size));
+                data.append(value);
+            }
+
+            bool consume_raw(std::string_view& data, void* value, size_t size)
+            {
+                if (data.size() < size)
+                {
+                    return false;
+                }
+                std::memcpy(value, data.data(), size);
+                data.remove_prefix(size);
+                return true;
+            }
+
+            bool consume_string(std::string_view& data, std::string& value)
+            {
+                u32 size = 0;
+                if (!consume_raw(data, &size, sizeof(size)) || data.size() < size)
+                {
+                    return false;
+                }
+                value = std::string(data.substr(0, size));
+                data.remove_prefix(size);
+                return true;
+            }
+        }    // namespace
+
+        bool Entry::may_contain_gate_type(const std::string& gate_type_name) const
+        {
+            if (gate_type_filter.empty())
+            {
+                return false;
+            }
+
+            const u64 num_bits  = gate_type_filter.size() * 64;
+            const auto [h1, h2] = hash_gate_type_name(gate_type_name);
+            for (u32 i = 0; i < FILTER_NUM_HASHES; i++)
+            {
+                const u64 bit = (h1 + i * h2) % num_bits;
+                if ((gate_type_filter.at(bit / 64) & (1ULL << (bit % 64))) == 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool Entry::is_up_to_date() const
+        {
+            std::error_code ec;
+            const auto file_mtime = std::filesystem::last_write_time(path, ec);
+            if (ec)
+            {
+                return false;
+            }
+            const u64 file_size = std::filesystem::file_size(path, ec);
+            if (ec)
+            {
+                return false;
+            }
+            return (u64)file_mtime.time_since_epoch().count() == mtime && file_size == size;
+        }
+
+        bool Entry::is_valid() const
+        {
+            return !name.empty();
+        }
+
+        Entry create_entry(const std::filesystem::path& file_path, const GateLibrary* gate_lib)
+        {
+            Entry entry;
+            std::error_code ec;
+            entry.path = std::filesystem::absolute(file_path, ec);
+            if (const auto mtime = std::filesystem::last_write_time(file_path, ec); !ec)
+            {
+                entry.mtime = (u64)mtime.time_since_epoch().count();
+            }
+            if (const auto size = std::filesystem::file_size(file_path, ec); !ec)
+            {
+                entry.size = size;
+            }
+
+            if (gate_lib == nullptr)
+            {
+                return entry;
+            }
+
+            const auto gate_types = gate_lib->get_gate_types();
+            entry.name            = gate_lib->get_name();
+            entry.num_gate_types  = (u32)gate_types.size();
+
+            const u64 num_words = std::max<u64>(1, (gate_types.size() * FILTER_BITS_PER_GATE_TYPE + 63) / 64);
+            const u64 num_bits  = num_words * 64;
+            entry.gate_type_filter.assign(num_words, 0);
+            for (const auto& [gt_name, gt] : gate_types)
+            {
+                const auto [h1, h2] = hash_gate_type_name(gt_name);
+                for (u32 i = 0; i < FILTER_NUM_HASHES; i++)
+                {
+                    const u64 bit = (h1 + i * h2) % num_bits;
+                    entry.gate_type_filter.at(bit / 64) |= (1ULL << (bit % 64));
+                }
+            }
+
+            return entry;
+        }
+
+        std::filesystem::path get_manifest_path()
+        {
+            return utils::get_user_share_directory() / "gate_library_manifest.bin";
+        }
+
+        Result<std::monostate> write(const std::vector<Entry>& entries, const std::filesystem::path& manifest_path)
+        {
+            std::string data;
+            append_raw(data, MANIFEST_MAGIC, sizeof(MANIFEST_MAGIC));
+            append_raw(data, &MANIFEST_VERSION, sizeof(MANIFEST_VERSION));
+
+            const u32 num_entries = (u32)entries.size();
+            append_raw(data, &num_entries, sizeof(num_entries));
+            for (const auto& entry : entries)
+            {
+                append_string(data, entry.path.string());
+                append_string(data, entry.name);
+                append_raw(data, &entry.mtime, sizeof(entry.mtime));
+                append_raw(data, &entry.size, sizeof(entry.size));
+                append_raw(data, &entry.num_gate_types, sizeof(entry.num_gate_types));
+
+                const u32 num_words = (u32)entry.gate_type_filter.size();
+                append_raw(data, &num_words, sizeof(num_words));
+                append_raw(data, entry.gate_type_filter.data(), num_words * sizeof(u64));
+            }
+
+            std::error_code ec;
+            std::filesystem::create_directories(manifest_path.parent_path(), ec);
+
+            // write to a temporary file first so that concurrent readers never observe a partially written manifest
+            std::filesystem::path tmp_path = manifest_path;
+            tmp_path += ".tmp" + std::to_string(std::random_device{}());
+            {
+                std::ofstream ofs(tmp_path, std::ios::binary | std::ios::trunc);
+                if (!ofs.is_open())
+                {
+                    return ERR("could not write gate library manifest '" + manifest_path.string() + "': failed to open file '" + tmp_path.string() + "'");
+                }
+                ofs.write(data.data(), data.size());
+                if (!ofs.good())
+                {
+                    ofs.close();
+                    std::filesystem::remove(tmp_path, ec);
+                    return ERR("could not write gate library manifest '" + manifest_path.string() + "': failed to write file '" + tmp_path.string() + "'");
+                }
+            }
+
+            std::filesystem::rename(tmp_path, manifest_path, ec);
+            if (ec)
+            {
+                std::filesystem::remove(tmp_path, ec);
+                return ERR("could not write gate library manifest '" + manifest_path.string() + "': failed to replace existing file");
+            }
+
+            return OK({});
+        }
+
+        Result<std::vector<Entry>> read(const std::filesystem::path& manifest_path)
+        {
+            if (!std::filesystem::exists(manifest_path))
+            {
+                return ERR("could not read gate library manifest '" + manifest_path.string() + "': file does not exist");
+            }
+
+            auto file = MemoryMappedFile::open(manifest_path);
+            if (file.is_error())
+            {
+                return ERR_APPEND(file.get_error(), "could not read gate library manifest '" + manifest_path.string() + "'");
+            }
+            std::string_view data = file.get()->get_data();
+
+            char magic[sizeof(MANIFEST_MAGIC)] = {};
+            u32 version                        = 0;
+            if (!consume_raw(data, magic, sizeof(magic)) || std::memcmp(magic, MANIFEST_MAGIC, sizeof(MANIFEST_MAGIC)) != 0)
+            {
+                return ERR("could not read gate library manifest '" + manifest_path.string() + "': file is not a gate library manifest");
+            }
+            if (!consume_raw(data, &version, sizeof(version)) || version != MANIFEST_VERSION)
+            {
+                return ERR("could not read gate library manifest '" + manifest_path.string() + "': manifest version " + std::to_string(version) + " does not match expected version "
+                           + std::to_string(MANIFEST_VERSION));
+            }
+
+            u32 num_entries = 0;
+            if (!consume_raw(data, &num_entries, sizeof(num_entries)))
+            {
+                return ERR("could not read gate library manifest '" + manifest_path.string() + "': file is corrupted");
+            }
+
+            std::vector<Entry> entries;
+            for (u32 i = 0; i < num_entries; i++)
+            {
+                Entry entry;
+                std::string path;
+                u32 num_words = 0;
+                if (!consume_string(data, path) || !consume_string(data, entry.name) || !consume_raw(data, &entry.mtime, sizeof(entry.mtime))
+                    || !consume_raw(data, &entry.size, sizeof(entry.size)) || !consume_raw(data, &entry.num_gate_types, sizeof(entry.num_gate_types))
+                    || !consume_raw(data, &num_words, sizeof(num_words)) || data.size() < (u64)num_words * sizeof(u64))
+                {
+                    return ERR("could not read gate library manifest '" + manifest_path.string() + "': file is corrupted");
+                }
+                entry.path = path;
+                entry.gate_type_filter.resize(num_words);
+                consume_raw(data, entry.gate_type_filter.data(), num_words * sizeof(u64));
+                entries.push_back(std::move(entry));
+            }
+
+            if (!data.empty())
+            {
+                return ERR("could not read gate library manifest '" + manifest_path.string() + "': file is corrupted");
+            }
+
+            return OK(entries);
+        }
+    }    // namespace gate_library_manifest
+}    // namespace hal
@@ -2,6 +2,7 @@
 
 #include "hal_core/netlist/gate_library/gate_library.h"
 #include "hal_core/netlist/gate_library/gate_library_parser/gate_library_parser.h"
+#include "hal_core/utilities/compression.h"
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/utils.h"
 
@@ -19,7 +20,7 @@ namespace hal
 
             ParserFactory get_parser_factory_for_file(const std::filesystem::path& file_name)
             {
-                auto extension = utils::to_lower(file_name.extension().string());
+                auto extension = utils::to_lower(compression::strip_extension(file_name).extension().string());
                 if (!extension.empty() && extension[0] != '.')
                 {
                     extension = "." + extension;
@@ -8,6 +8,7 @@
 #include "hal_core/netlist/gate_library/gate_type_component/ram_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/ram_port_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/timing_component.h"
 
 namespace hal
 {
@@ -19,7 +20,8 @@ namespace hal
                                                                                                                    {GateTypeComponent::ComponentType::mac, "mac"},
                                                                                                                    {GateTypeComponent::ComponentType::init, "init"},
                                                                                                                    {GateTypeComponent::ComponentType::state, "state"},
-                                                                                                                   {GateTypeComponent::ComponentType::ram_port, "ram_port"}};
+                                                                                                                   {GateTypeComponent::ComponentType::ram_port, "ram_port"},
+                                                                                                                   {GateTypeComponent::ComponentType::timing, "timing"}};
 
     std::unique_ptr<GateTypeComponent> GateTypeComponent::create_lut_component(std::unique_ptr<GateTypeComponent> component, bool init_ascending)
     {
@@ -78,6 +80,11 @@ namespace hal
         return std::make_unique<RAMPortComponent>(std::move(component), data_group, addr_group, clock_bf.clone(), enable_bf.clone(), is_write);
     }
 
+    std::unique_ptr<GateTypeComponent> GateTypeComponent::create_timing_component(std::unique_ptr<GateTypeComponent> component)
+    {
+        return std::make_unique<TimingComponent>(std::move(component));
+    }
+
     GateTypeComponent* GateTypeComponent::get_component(const std::function<bool(const GateTypeComponent*)>& filter) const
     {
         std::vector<GateTypeComponent*> components = this->get_components(filter);
@@ -0,0 +1,174 @@
+#include "hal_core/netlist/gate_library/gate_type_component/timing_component.h"
+
+#include <algorithm>
+
+namespace hal
+{
+    namespace
+    {
+        // get the lower breakpoint of the segment to interpolate in and the relative position of the value within that segment
+        std::pair<u32, double> locate_segment(const std::vector<double>& index, double value)
+        {
+            if (index.size() < 2)
+            {
+                return {0, 0.0};
+            }
+
+            // values outside of the index range are extrapolated using the first or last segment
+            const u32 lower   = (u32)(std::upper_bound(index.begin() + 1, index.end() - 1, value) - index.begin()) - 1;
+            const double span = index.at(lower + 1) - index.at(lower);
+            if (span == 0.0)
+            {
+                return {lower, 0.0};
+            }
+            return {lower, (value - index.at(lower)) / span};
+        }
+    }    // namespace
+
+    bool TimingComponent::LookupTable::is_empty() const
+    {
+        return values.empty();
+    }
+
+    double TimingComponent::LookupTable::evaluate(double value_1, double value_2) const
+    {
+        if (values.empty())
+        {
+            return 0.0;
+        }
+        if (index_1.empty())
+        {
+            return values.front();
+        }
+
+        const u32 size_2 = index_2.empty() ? 1 : (u32)index_2.size();
+        if (values.size() != index_1.size() * size_2)
+        {
+            return 0.0;
+        }
+
+        const auto [lower_1, weight_1] = locate_segment(index_1, value_1);
+        const auto [lower_2, weight_2] = locate_segment(index_2, value_2);
+        const u32 upper_1              = (index_1.size() > 1) ? lower_1 + 1 : lower_1;
+        const u32 upper_2              = (index_2.size() > 1) ? lower_2 + 1 : lower_2;
+
+        const auto value_at = [this, size_2](u32 i, u32 j) { return values.at(i * size_2 + j); };
+
+        return (1.0 - weight_1) * (1.0 - weight_2) * value_at(lower_1, lower_2) + (1.0 - weight_1) * weight_2 * value_at(lower_1, upper_2)
+               + weight_1 * (1.0 - weight_2) * value_at(upper_1, lower_2) + weight_1 * weight_2 * value_at(upper_1, upper_2);
+    }
+
+    bool TimingComponent::LookupTable::operator==(const LookupTable& other) const
+    {
+        return variable_1 == other.variable_1 && variable_2 == other.variable_2 && index_1 == other.index_1 && index_2 == other.index_2 && values == other.values;
+    }
+
+    bool TimingComponent::LookupTable::operator!=(const LookupTable& other) const
+    {
+        return !operator==(other);
+    }
+
+    bool TimingComponent::TimingArc::operator==(const TimingArc& other) const
+    {
+        return pin == other.pin && related_pin == other.related_pin && timing_sense == other.timing_sense && timing_type == other.timing_type && cell_rise == other.cell_rise
+               && cell_fall == other.cell_fall && rise_transition == other.rise_transition && fall_transition == other.fall_transition;
+    }
+
+    bool TimingComponent::TimingArc::operator!=(const TimingArc& other) const
+    {
+        return !operator==(other);
+    }
+
+    TimingComponent::TimingComponent(std::unique_ptr<GateTypeComponent> component) : m_component(std::move(component))
+    {
+    }
+
+    TimingComponent::ComponentType TimingComponent::get_type() const
+    {
+        return m_type;
+    }
+
+    bool TimingComponent::is_class_of(const GateTypeComponent* component)
+    {
+        return component->get_type() == m_type;
+    }
+
+    std::vector<GateTypeComponent*> TimingComponent::get_components(const std::function<bool(const GateTypeComponent*)>& filter) const
+    {
+        if (m_component != nullptr)
+        {
+            std::vector<GateTypeComponent*> res = m_component->get_components(filter);
+            if (filter)
+            {
+                if (filter(m_component.get()))
+                {
+                    res.push_back(m_component.get());
+                }
+            }
+            else
+            {
+                res.push_back(m_component.get());
+            }
+
+            return res;
+        }
+
+        return {};
+    }
+
+    const std::vector<TimingComponent::TimingArc>& TimingComponent::get_timing_arcs() const
+    {
+        return m_timing_arcs;
+    }
+
+    std::vector<TimingComponent::TimingArc> TimingComponent::get_timing_arcs(const std::string& pin) const
+    {
+        std::vector<TimingArc> res;
+        std::copy_if(m_timing_arcs.begin(), m_timing_arcs.end(), std::back_inserter(res), [&pin](const TimingArc& arc) { return arc.pin == pin; });
+        return res;
+    }
+
+    void TimingComponent::add_timing_arc(const TimingArc& arc)
+    {
+        m_timing_arcs.push_back(arc);
+    }
+
+    const std::unordered_map<std::string, double>& TimingComponent::get_pin_capacitances() const
+    {
+        return m_pin_capacitances;
+    }
+
+    double TimingComponent::get_pin_capacitance(const std::string& pin) const
+    {
+        if (const auto it = m_pin_capacitances.find(pin); it != m_pin_capacitances.end())
+        {
+            return it->second;
+        }
+        return 0.0;
+    }
+
+    void TimingComponent::set_pin_capacitance(const std::string& pin, double capacitance)
+    {
+        m_pin_capacitances[pin] = capacitance;
+    }
+
+    double TimingComponent::get_leakage_power() const
+    {
+        return m_leakage_power;
+    }
+
+    void TimingComponent::set_leakage_power(double leakage_power)
+    {
+        m_leakage_power = leakage_power;
+    }
+
+    double TimingComponent::get_area() const
+    {
+        return m_area;
+    }
+
+    void TimingComponent::set_area(double area)
+    {
+        m_area = area;
+    }
+}    // namespace hal
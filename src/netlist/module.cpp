@@ -79,6 +79,11 @@ namespace hal
         return (uintptr_t)this;
     }
 
+    void Module::notify_updated()
+    {
+        m_event_handler->notify(ModuleEvent::event::data_changed, this);
+    }
+
     u32 Module::get_id() const
     {
         return m_id;
@@ -477,6 +482,26 @@ namespace hal
         }
     }
 
+    Result<std::monostate> Module::update_net(Net* net)
+    {
+        if (net == nullptr)
+        {
+            return ERR("could not update net of module '" + m_name + "' with ID " + std::to_string(m_id) + ": net is a 'nullptr'");
+        }
+
+        for (Module* mod = this; mod != nullptr; mod = mod->m_parent)
+        {
+            if (auto res = mod->check_net(net, false); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(),
+                                  "could not update net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " of module '" + mod->m_name + "' with ID "
+                                      + std::to_string(mod->m_id));
+            }
+        }
+
+        return OK({});
+    }
+
     bool Module::contains_net(Net* net, bool recursive) const
     {
         if (net == nullptr)
@@ -1366,6 +1391,29 @@ namespace hal
         return OK({});
     }
 
+    Result<std::monostate> Module::clear_pins()
+    {
+        for (ModulePin* pin : get_pins())
+        {
+            if (auto res = remove_pin_net(pin->get_net()); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not clear pins of module '" + m_name + "' with ID " + std::to_string(m_id));
+            }
+        }
+
+        // pin groups may remain without any pins
+        for (PinGroup<ModulePin>* pin_group : get_pin_groups())
+        {
+            if (auto res = delete_pin_group_internal(pin_group); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not clear pins of module '" + m_name + "' with ID " + std::to_string(m_id));
+            }
+        }
+
+        m_event_handler->notify(ModuleEvent::event::pin_changed, this);
+        return OK({});
+    }
+
     Result<ModulePin*> Module::assign_pin_net(const u32 pin_id, Net* net, PinDirection direction, const std::string& name, PinType type)
     {
         std::string name_internal;
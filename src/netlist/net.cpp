@@ -85,6 +85,11 @@ namespace hal
         return (uintptr_t)this;
     }
 
+    void Net::notify_updated()
+    {
+        m_event_handler->notify(NetEvent::event::data_changed, this);
+    }
+
     u32 Net::get_id() const
     {
         return m_id;
@@ -7,6 +7,7 @@
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist_internal_manager.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel_for_each.h"
 
 namespace hal
 {
@@ -396,6 +397,7 @@ namespace hal
             return true;
         }
         m_global_input_nets.push_back(n);
+        m_global_input_nets_set.insert(n);
 
         // update internal nets and port nets
         if (m_manager->m_net_checks_enabled)
@@ -426,6 +428,7 @@ namespace hal
             return true;
         }
         m_global_output_nets.push_back(n);
+        m_global_output_nets_set.insert(n);
 
         // update internal nets and port nets
         if (m_manager->m_net_checks_enabled)
@@ -450,13 +453,13 @@ namespace hal
         {
             return false;
         }
-        auto it = std::find(m_global_input_nets.begin(), m_global_input_nets.end(), n);
-        if (it == m_global_input_nets.end())
+        if (!is_global_input_net(n))
         {
             log_debug("netlist", "net '{}' with ID {} is not registered as global input net in the netlist with ID {}.", n->get_name(), n->get_id(), m_netlist_id);
             return false;
         }
-        m_global_input_nets.erase(it);
+        m_global_input_nets.erase(std::find(m_global_input_nets.begin(), m_global_input_nets.end(), n));
+        m_global_input_nets_set.erase(n);
 
         // update internal nets and port nets
         if (m_manager->m_net_checks_enabled)
@@ -481,13 +484,13 @@ namespace hal
         {
             return false;
         }
-        auto it = std::find(m_global_output_nets.begin(), m_global_output_nets.end(), n);
-        if (it == m_global_output_nets.end())
+        if (!is_global_output_net(n))
         {
             log_debug("netlist", "net '{}' with ID {} is not registered as global output net in the netlist with ID {}.", n->get_name(), n->get_id(), m_netlist_id);
             return false;
         }
-        m_global_output_nets.erase(it);
+        m_global_output_nets.erase(std::find(m_global_output_nets.begin(), m_global_output_nets.end(), n));
+        m_global_output_nets_set.erase(n);
 
         // update internal nets and port nets
         if (m_manager->m_net_checks_enabled)
@@ -508,12 +511,12 @@ namespace hal
 
     bool Netlist::is_global_input_net(const Net* n) const
     {
-        return (std::find(m_global_input_nets.begin(), m_global_input_nets.end(), n) != m_global_input_nets.end());
+        return m_global_input_nets_set.find(n) != m_global_input_nets_set.end();
     }
 
     bool Netlist::is_global_output_net(const Net* n) const
     {
-        return (std::find(m_global_output_nets.begin(), m_global_output_nets.end(), n) != m_global_output_nets.end());
+        return m_global_output_nets_set.find(n) != m_global_output_nets_set.end();
     }
 
     const std::vector<Net*>& Netlist::get_global_input_nets() const
@@ -531,6 +534,25 @@ namespace hal
         m_manager->m_net_checks_enabled = enable_checks;
     }
 
+    void Netlist::reserve(u32 num_gates, u32 num_nets, u32 num_modules)
+    {
+        m_gates_map.reserve(num_gates);
+        m_gates_set.reserve(num_gates);
+        m_gates.reserve(num_gates);
+        m_nets_map.reserve(num_nets);
+        m_nets_set.reserve(num_nets);
+        m_nets.reserve(num_nets);
+        m_modules_map.reserve(num_modules);
+        m_modules_set.reserve(num_modules);
+        m_modules.reserve(num_modules);
+    }
+
+    void Netlist::update_module_nets()
+    {
+        // every module only writes its own net sets and reads the (unchanged) gates and nets
+        utils::parallel_for_each(m_modules, [](Module* module) { module->update_nets(); });
+    }
+
     /*
      * ################################################################
      *      module functions
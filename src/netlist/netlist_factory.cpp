@@ -4,6 +4,7 @@
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser_manager.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/utilities/compression.h"
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/program_arguments.h"
 #include "hal_core/netlist/project_manager.h"
@@ -87,7 +88,7 @@ namespace hal
                 return nullptr;
             }
 
-            auto extension = netlist_file.extension();
+            auto extension = compression::strip_extension(netlist_file).extension();
 
             if (extension == ".hal")
             {
@@ -50,7 +50,7 @@ namespace hal
             {
                 return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied net '" + net->m_name + "' with ID " + std::to_string(net->m_id));
             }
-            c_net->m_data = net->m_data;
+            c_net->m_data = net->get_data_map();
         }
 
         // copy gates
@@ -99,7 +99,7 @@ namespace hal
                 }
             }
 
-            c_gate->m_data = gate->m_data;
+            c_gate->m_data = gate->get_data_map();
         }
 
         // copy modules
@@ -132,7 +132,7 @@ namespace hal
                 return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied module '" + module->m_name + "' with ID " + std::to_string(module->m_id));
             }
 
-            c_module->m_data = module->m_data;
+            c_module->m_data = module->get_data_map();
             c_module->m_type = module->m_type;
         }
 
@@ -241,7 +241,7 @@ namespace hal
                 std::vector<ModulePin*> c_pins;
                 for (ModulePin* pin : pin_group->get_pins())
                 {
-                    if (const auto res = c_module->create_pin(pin->get_id(), pin->get_name(), c_netlist->get_net_by_id(pin->get_net()->m_id), PinType::none, false); res.is_error())
+                    if (const auto res = c_module->create_pin(pin->get_id(), pin->get_name(), c_netlist->get_net_by_id(pin->get_net()->m_id), pin->get_type(), false); res.is_error())
                     {
                         return ERR_APPEND(res.get_error(),
                                           "could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied module pin '" + pin->get_name() + "' of module '"
@@ -492,7 +492,16 @@ namespace hal
             return nullptr;
         }
 
-        if (net->is_a_source(gate, pin))
+        // check whether pin is valid for this gate, avoiding to copy all output pins of the gate type for every endpoint
+        if (const PinDirection direction = pin->get_direction();
+            (direction != PinDirection::output && direction != PinDirection::inout) || gate->get_type()->get_pin_by_id(pin->get_id()) != pin)
+        {
+            log_error("net", "gate '{}' with ID {} has no output pin called '{}' in netlist with ID {}.", gate->get_name(), gate->get_id(), pin->get_name(), m_netlist->m_netlist_id);
+            return nullptr;
+        }
+
+        // check whether src has already an assigned net, this also covers the pin already being a source of this net without scanning all sources of the net
+        if (auto fan_out_net = gate->get_fan_out_net(pin); fan_out_net == net)
         {
             log_error("net",
                       "pin '{}' of gate '{}' with ID {} is already a source of net '{}' with ID {} in netlist with ID {}.",
@@ -504,18 +513,7 @@ namespace hal
                       m_netlist->m_netlist_id);
             return nullptr;
         }
-
-        // check whether pin is valid for this gate
-        auto output_pins = gate->get_type()->get_output_pins();
-
-        if ((std::find(output_pins.begin(), output_pins.end(), pin) == output_pins.end()))
-        {
-            log_error("net", "gate '{}' with ID {} has no output pin called '{}' in netlist with ID {}.", gate->get_name(), gate->get_id(), pin->get_name(), m_netlist->m_netlist_id);
-            return nullptr;
-        }
-
-        // check whether src has already an assigned net
-        if (auto fan_out_net = gate->get_fan_out_net(pin); fan_out_net != nullptr)
+        else if (fan_out_net != nullptr)
         {
             log_error("net",
                       "gate '{}' with ID {} is already connected to net '{}' with ID {} at output pin '{}', cannot assign new net '{}' with ID {} in netlist with ID {}.",
@@ -630,7 +628,16 @@ namespace hal
             return nullptr;
         }
 
-        if (net->is_a_destination(gate, pin))
+        // check whether pin is valid for this gate, avoiding to copy all input pins of the gate type for every endpoint
+        if (const PinDirection direction = pin->get_direction();
+            (direction != PinDirection::input && direction != PinDirection::inout) || gate->get_type()->get_pin_by_id(pin->get_id()) != pin)
+        {
+            log_error("net", "gate '{}' with ID {} has no input pin called '{}' in netlist with ID {}.", gate->get_name(), gate->get_id(), pin->get_name(), m_netlist->m_netlist_id);
+            return nullptr;
+        }
+
+        // check whether dst has already an assigned net, this also covers the pin already being a destination of this net without scanning all destinations of the net
+        if (auto fan_in_net = gate->get_fan_in_net(pin); fan_in_net == net)
         {
             log_error("net",
                       "pin '{}' of gate '{}' with ID {} is already a destination of net '{}' with ID {} in netlist with ID {}.",
@@ -642,18 +649,7 @@ namespace hal
                       m_netlist->m_netlist_id);
             return nullptr;
         }
-
-        // check whether pin is valid for this gate
-        auto input_pins = gate->get_type()->get_input_pins();
-
-        if ((std::find(input_pins.begin(), input_pins.end(), pin) == input_pins.end()))
-        {
-            log_error("net", "gate '{}' with ID {} has no input pin called '{}' in netlist with ID {}.", gate->get_name(), gate->get_id(), pin->get_name(), m_netlist->m_netlist_id);
-            return nullptr;
-        }
-
-        // check whether dst has already an assigned net
-        if (auto fan_in_net = gate->get_fan_in_net(pin); fan_in_net != nullptr)
+        else if (fan_in_net != nullptr)
         {
             log_error("net",
                       "gate '{}' with ID {} is already connected to net '{}' with ID {} at input pin '{}', cannot assign new net '{}' with ID {} in netlist with ID {}.",
@@ -4,7 +4,9 @@
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser.h"
+#include "hal_core/utilities/compression.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/utils.h"
 
 #include <fstream>
 
@@ -19,7 +21,7 @@ namespace hal
 
             ParserFactory get_parser_factory_for_file(const std::filesystem::path& file_name)
             {
-                std::string extension = utils::to_lower(file_name.extension().string());
+                std::string extension = utils::to_lower(compression::strip_extension(file_name).extension().string());
                 if (!extension.empty() && extension[0] != '.')
                 {
                     extension = "." + extension;
@@ -49,8 +51,9 @@ namespace hal
                 }
 
                 log_info("netlist_parser",
-                         "finished parsing in {:2.2f} seconds.",
-                         (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000);
+                         "finished parsing in {:2.2f} seconds (peak memory usage: {:.1f} MiB).",
+                         (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000,
+                         (double)utils::get_peak_memory_usage() / (1024 * 1024));
 
                 std::vector<std::unique_ptr<Netlist>> netlists;
 
@@ -71,9 +74,10 @@ namespace hal
                         netlist->set_input_filename(file_name.string());
 
                         log_info("netlist_parser",
-                                 "instantiated '{}' in {:2.2f} seconds.",
+                                 "instantiated '{}' in {:2.2f} seconds (peak memory usage: {:.1f} MiB).",
                                  file_name.string(),
-                                 (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000);
+                                 (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000,
+                                 (double)utils::get_peak_memory_usage() / (1024 * 1024));
 
                         netlists.push_back(std::move(netlist));
                     }
@@ -81,9 +85,31 @@ namespace hal
                 else
                 {
                     log_warning("netlist_parser", "no (valid) gate library specified, trying to auto-detect gate library...");
-                    gate_library_manager::load_all();
 
-                    for (GateLibrary* lib_it : gate_library_manager::get_gate_libraries())
+                    // only instantiate the netlist with gate libraries that provide all required gate types, best matches first
+                    std::vector<GateLibrary*> candidate_libraries;
+                    if (const auto gate_type_names = parser->get_required_gate_types(); gate_type_names.has_value())
+                    {
+                        // only load gate libraries that may provide all required gate types according to the manifest
+                        gate_library_manager::load_by_gate_types(gate_type_names.value());
+
+                        for (const auto& [lib, coverage] : gate_library_manager::get_gate_libraries_by_coverage(gate_type_names.value()))
+                        {
+                            if (coverage < 1.0)
+                            {
+                                log_debug("netlist_parser", "skipping gate library '{}' as it only provides {:.1f}% of the required gate types.", lib->get_name(), coverage * 100);
+                                continue;
+                            }
+                            candidate_libraries.push_back(lib);
+                        }
+                    }
+                    else
+                    {
+                        gate_library_manager::load_all();
+                        candidate_libraries = gate_library_manager::get_gate_libraries();
+                    }
+
+                    for (GateLibrary* lib_it : candidate_libraries)
                     {
                         begin_time = std::chrono::high_resolution_clock::now();
 
@@ -102,9 +128,10 @@ namespace hal
                             netlist->set_input_filename(file_name.string());
 
                             log_info("netlist_parser",
-                                     "instantiated '{}' in {:2.2f} seconds.",
+                                     "instantiated '{}' in {:2.2f} seconds (peak memory usage: {:.1f} MiB).",
                                      file_name.string(),
-                                     (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000);
+                                     (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000,
+                                     (double)utils::get_peak_memory_usage() / (1024 * 1024));
 
                             netlists.push_back(std::move(netlist));
 
@@ -133,7 +160,7 @@ namespace hal
 
         bool can_parse(const std::filesystem::path& file_name)
         {
-            std::string extension = utils::to_lower(file_name.extension().string());
+            std::string extension = utils::to_lower(compression::strip_extension(file_name).extension().string());
             if (!extension.empty() && extension[0] != '.')
             {
                 extension = "." + extension;
@@ -6,8 +6,11 @@
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel_for_each.h"
 
 #include <deque>
+#include <numeric>
+#include <optional>
 #include <queue>
 #include <unordered_set>
 
@@ -1461,5 +1464,1719 @@ namespace hal
 
             return OK(std::vector<Gate*>(gate_chain.begin(), gate_chain.end()));
         }
+
+        namespace
+        {
+            /**
+             * Bit-parallel evaluation of a single-bit Boolean function made up of AND, OR, XOR, and NOT operations.
+             * Each variable is assigned a 64-bit word so that up to 64 input combinations are evaluated at once.
+             */
+            Result<u64> evaluate_word(const BooleanFunction& function, const std::unordered_map<std::string, u64>& assignment)
+            {
+                std::vector<u64> stack;
+                stack.reserve(function.length());
+
+                for (const auto& node : function.get_nodes())
+                {
+                    if (node.size != 1)
+                    {
+                        return ERR("could not evaluate Boolean function '" + function.to_string() + "': node '" + node.to_string() + "' is not of size 1");
+                    }
+
+                    switch (node.type)
+                    {
+                        case BooleanFunction::NodeType::Constant: {
+                            if (node.constant.front() == BooleanFunction::Value::ZERO)
+                            {
+                                stack.push_back(0);
+                            }
+                            else if (node.constant.front() == BooleanFunction::Value::ONE)
+                            {
+                                stack.push_back(~0ull);
+                            }
+                            else
+                            {
+                                return ERR("could not evaluate Boolean function '" + function.to_string() + "': constant '" + node.to_string() + "' is neither 0 nor 1");
+                            }
+                            break;
+                        }
+                        case BooleanFunction::NodeType::Variable: {
+                            const auto it = assignment.find(node.variable);
+                            if (it == assignment.end())
+                            {
+                                return ERR("could not evaluate Boolean function '" + function.to_string() + "': no value assigned to variable '" + node.variable + "'");
+                            }
+                            stack.push_back(it->second);
+                            break;
+                        }
+                        case BooleanFunction::NodeType::Not: {
+                            stack.back() = ~stack.back();
+                            break;
+                        }
+                        case BooleanFunction::NodeType::And:
+                        case BooleanFunction::NodeType::Or:
+                        case BooleanFunction::NodeType::Xor: {
+                            const u64 p1 = stack.back();
+                            stack.pop_back();
+                            const u64 p0 = stack.back();
+                            stack.back() = (node.type == BooleanFunction::NodeType::And) ? (p0 & p1) : ((node.type == BooleanFunction::NodeType::Or) ? (p0 | p1) : (p0 ^ p1));
+                            break;
+                        }
+                        default:
+                            return ERR("could not evaluate Boolean function '" + function.to_string() + "': operation '" + node.to_string() + "' is not supported");
+                    }
+                }
+
+                if (stack.size() != 1)
+                {
+                    return ERR("could not evaluate Boolean function '" + function.to_string() + "': malformed node list");
+                }
+
+                return OK(stack.back());
+            }
+
+            /**
+             * Bit-parallel evaluation of a single-bit Boolean function made up of AND, OR, XOR, and NOT operations on multiple 64-bit words at once.
+             * The variables are resolved only once before the words are evaluated one after another.
+             */
+            Result<std::monostate> evaluate_words(const BooleanFunction& function, const std::unordered_map<std::string, const u64*>& assignment, u32 num_words, u64* result)
+            {
+                const auto& nodes = function.get_nodes();
+
+                std::vector<const u64*> operands(nodes.size(), nullptr);
+                for (u32 i = 0; i < nodes.size(); i++)
+                {
+                    const auto& node = nodes.at(i);
+                    if (node.size != 1)
+                    {
+                        return ERR("could not evaluate Boolean function '" + function.to_string() + "': node '" + node.to_string() + "' is not of size 1");
+                    }
+
+                    if (node.type == BooleanFunction::NodeType::Variable)
+                    {
+                        const auto it = assignment.find(node.variable);
+                        if (it == assignment.end())
+                        {
+                            return ERR("could not evaluate Boolean function '" + function.to_string() + "': no value assigned to variable '" + node.variable + "'");
+                        }
+                        operands[i] = it->second;
+                    }
+                    else if (node.type == BooleanFunction::NodeType::Constant)
+                    {
+                        if (node.constant.front() != BooleanFunction::Value::ZERO && node.constant.front() != BooleanFunction::Value::ONE)
+                        {
+                            return ERR("could not evaluate Boolean function '" + function.to_string() + "': constant '" + node.to_string() + "' is neither 0 nor 1");
+                        }
+                    }
+                    else if (node.type != BooleanFunction::NodeType::Not && node.type != BooleanFunction::NodeType::And && node.type != BooleanFunction::NodeType::Or
+                             && node.type != BooleanFunction::NodeType::Xor)
+                    {
+                        return ERR("could not evaluate Boolean function '" + function.to_string() + "': operation '" + node.to_string() + "' is not supported");
+                    }
+                }
+
+                std::vector<u64> stack;
+                stack.reserve(nodes.size());
+                for (u32 w = 0; w < num_words; w++)
+                {
+                    stack.clear();
+                    for (u32 i = 0; i < nodes.size(); i++)
+                    {
+                        const auto& node = nodes[i];
+                        switch (node.type)
+                        {
+                            case BooleanFunction::NodeType::Constant:
+                                stack.push_back((node.constant.front() == BooleanFunction::Value::ONE) ? ~0ull : 0ull);
+                                break;
+                            case BooleanFunction::NodeType::Variable:
+                                stack.push_back(operands[i][w]);
+                                break;
+                            case BooleanFunction::NodeType::Not:
+                                stack.back() = ~stack.back();
+                                break;
+                            default: {
+                                if (stack.size() < 2)
+                                {
+                                    return ERR("could not evaluate Boolean function '" + function.to_string() + "': malformed node list");
+                                }
+                                const u64 p1 = stack.back();
+                                stack.pop_back();
+                                const u64 p0 = stack.back();
+                                stack.back() = (node.type == BooleanFunction::NodeType::And) ? (p0 & p1) : ((node.type == BooleanFunction::NodeType::Or) ? (p0 | p1) : (p0 ^ p1));
+                                break;
+                            }
+                        }
+                    }
+
+                    if (stack.size() != 1)
+                    {
+                        return ERR("could not evaluate Boolean function '" + function.to_string() + "': malformed node list");
+                    }
+                    result[w] = stack.back();
+                }
+
+                return OK({});
+            }
+
+            /**
+             * Check whether a gate implements combinational logic that may be rewired or removed, i.e., it is neither sequential nor a GND or VCC gate.
+             */
+            bool is_combinational_logic(const Gate* gate)
+            {
+                const GateType* gt = gate->get_type();
+                return gt->has_property(GateTypeProperty::combinational) && !gt->has_property(GateTypeProperty::sequential) && !gt->has_property(GateTypeProperty::power)
+                       && !gt->has_property(GateTypeProperty::ground) && !gate->is_gnd_gate() && !gate->is_vcc_gate();
+            }
+
+            /**
+             * The combinational gates of a netlist sorted into topological levels, such that every gate only depends on gates of lower levels.
+             * Gates within combinational loops are not assigned to any level.
+             */
+            struct CombinationalLevels
+            {
+                std::vector<Gate*> gates;
+                std::unordered_map<const Gate*, u32> gate_indices;
+                std::vector<std::vector<u32>> levels;
+            };
+
+            CombinationalLevels get_combinational_levels(const Netlist* netlist)
+            {
+                CombinationalLevels result;
+                for (Gate* gate : netlist->get_gates())
+                {
+                    if (is_combinational_logic(gate))
+                    {
+                        result.gate_indices[gate] = result.gates.size();
+                        result.gates.push_back(gate);
+                    }
+                }
+
+                std::vector<u32> num_pending_predecessors(result.gates.size(), 0);
+                std::vector<std::vector<u32>> successors(result.gates.size());
+                for (u32 i = 0; i < result.gates.size(); i++)
+                {
+                    for (const Net* in_net : result.gates.at(i)->get_fan_in_nets())
+                    {
+                        for (const Endpoint* src_ep : in_net->get_sources())
+                        {
+                            if (const auto it = result.gate_indices.find(src_ep->get_gate()); it != result.gate_indices.end())
+                            {
+                                successors.at(it->second).push_back(i);
+                                num_pending_predecessors.at(i)++;
+                            }
+                        }
+                    }
+                }
+
+                std::vector<u32> current_level;
+                for (u32 i = 0; i < result.gates.size(); i++)
+                {
+                    if (num_pending_predecessors.at(i) == 0)
+                    {
+                        current_level.push_back(i);
+                    }
+                }
+                while (!current_level.empty())
+                {
+                    std::vector<u32> next_level;
+                    for (u32 i : current_level)
+                    {
+                        for (u32 j : successors.at(i))
+                        {
+                            if (--num_pending_predecessors.at(j) == 0)
+                            {
+                                next_level.push_back(j);
+                            }
+                        }
+                    }
+                    result.levels.push_back(std::move(current_level));
+                    current_level = std::move(next_level);
+                }
+
+                return result;
+            }
+
+            /**
+             * Structural identity of a gate made up of its type, the signals at its input pins, and its configuration.
+             * A signal is identified by a pair of pointers, which is either the net itself or the gate and pin that drive it.
+             */
+            struct StructuralKey
+            {
+                const GateType* type;
+                std::vector<std::pair<const void*, const void*>> inputs;
+                std::string configuration;
+
+                bool operator==(const StructuralKey& other) const
+                {
+                    return type == other.type && inputs == other.inputs && configuration == other.configuration;
+                }
+            };
+
+            struct StructuralKeyHash
+            {
+                std::size_t operator()(const StructuralKey& key) const
+                {
+                    std::size_t h = std::hash<const GateType*>()(key.type);
+                    for (const auto& [first, second] : key.inputs)
+                    {
+                        h ^= std::hash<const void*>()(first) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+                        h ^= std::hash<const void*>()(second) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+                    }
+                    return h ^ (std::hash<std::string>()(key.configuration) << 1);
+                }
+            };
+
+            /**
+             * Get a string representation of the custom Boolean functions and the INIT data of a gate, as they alter the behavior of gates of the same type.
+             */
+            std::string get_gate_configuration(const Gate* gate)
+            {
+                std::string configuration;
+
+                std::map<std::string, std::string> custom_functions;
+                for (const auto& [name, function] : gate->get_boolean_functions(true))
+                {
+                    custom_functions[name] = function.to_string();
+                }
+                for (const auto& [name, function] : custom_functions)
+                {
+                    configuration += name + "=" + function + ";";
+                }
+                if (gate->get_type()->has_component_of_type(GateTypeComponent::ComponentType::init))
+                {
+                    if (const auto init_res = gate->get_init_data(); init_res.is_ok())
+                    {
+                        configuration += "INIT=" + utils::join(",", init_res.get());
+                    }
+                }
+
+                return configuration;
+            }
+
+            /**
+             * Collects all nets that had an endpoint added or removed while automatic net checks were disabled, together with the modules of the affected gates,
+             * so that the modules can be re-synchronized once all edits are done.
+             * Nets that may have become unused are deleted only afterwards, since module pins may still refer to them until then.
+             */
+            class DeferredModuleUpdate
+            {
+            public:
+                void touch(Net* net, Gate* gate)
+                {
+                    m_touched_nets[net].insert(gate->get_module());
+                }
+
+                void add_dead_net_candidate(Net* net)
+                {
+                    m_dead_net_candidates.push_back(net);
+                }
+
+                /**
+                 * Update all affected modules and delete all candidate nets that are no longer connected to any gate.
+                 * Must be called after automatic net checks have been enabled again.
+                 *
+                 * @returns The number of deleted nets on success, an error otherwise.
+                 */
+                Result<u32> apply(Netlist* netlist)
+                {
+                    for (auto& [net, modules] : m_touched_nets)
+                    {
+                        if (!netlist->is_net_in_netlist(net))
+                        {
+                            continue;
+                        }
+
+                        for (const Endpoint* ep : net->get_sources())
+                        {
+                            modules.insert(ep->get_gate()->get_module());
+                        }
+                        for (const Endpoint* ep : net->get_destinations())
+                        {
+                            modules.insert(ep->get_gate()->get_module());
+                        }
+
+                        for (Module* mod : modules)
+                        {
+                            if (auto res = mod->update_net(net); res.is_error())
+                            {
+                                return ERR(res.get_error());
+                            }
+                        }
+                    }
+
+                    u32 num_deleted = 0;
+                    std::unordered_set<Net*> visited;
+                    for (Net* net : m_dead_net_candidates)
+                    {
+                        if (!visited.insert(net).second || !netlist->is_net_in_netlist(net))
+                        {
+                            continue;
+                        }
+
+                        if (net->get_num_of_sources() == 0 && net->get_num_of_destinations() == 0 && !net->is_global_input_net() && !net->is_global_output_net())
+                        {
+                            if (!netlist->delete_net(net))
+                            {
+                                return ERR("could not remove net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + " from netlist with ID "
+                                           + std::to_string(netlist->get_id()));
+                            }
+                            num_deleted++;
+                        }
+                    }
+
+                    m_touched_nets.clear();
+                    m_dead_net_candidates.clear();
+                    return OK(num_deleted);
+                }
+
+            private:
+                std::unordered_map<Net*, std::unordered_set<Module*>> m_touched_nets;
+                std::vector<Net*> m_dead_net_candidates;
+            };
+
+            /**
+             * Move all destinations of one net to another net and record the changes.
+             *
+             * @returns The gates of the moved destinations on success, an error otherwise.
+             */
+            Result<std::vector<Gate*>> move_destinations(Net* from, Net* to, DeferredModuleUpdate& update)
+            {
+                std::vector<Gate*> moved_gates;
+                for (Endpoint* ep : from->get_destinations())
+                {
+                    Gate* dst_gate   = ep->get_gate();
+                    GatePin* dst_pin = ep->get_pin();
+
+                    update.touch(from, dst_gate);
+                    if (!from->remove_destination(ep))
+                    {
+                        return ERR("could not move destinations from net '" + from->get_name() + "' with ID " + std::to_string(from->get_id()) + " to net '" + to->get_name()
+                                   + "' with ID " + std::to_string(to->get_id()) + ": failed to remove destination at gate '" + dst_gate->get_name() + "' with ID "
+                                   + std::to_string(dst_gate->get_id()));
+                    }
+                    if (to->add_destination(dst_gate, dst_pin) == nullptr)
+                    {
+                        return ERR("could not move destinations from net '" + from->get_name() + "' with ID " + std::to_string(from->get_id()) + " to net '" + to->get_name()
+                                   + "' with ID " + std::to_string(to->get_id()) + ": failed to add destination at gate '" + dst_gate->get_name() + "' with ID "
+                                   + std::to_string(dst_gate->get_id()));
+                    }
+                    update.touch(to, dst_gate);
+                    moved_gates.push_back(dst_gate);
+                }
+
+                return OK(moved_gates);
+            }
+
+            /**
+             * Redirect all outputs of a gate to the corresponding outputs of a structurally identical gate.
+             * If the representative does not drive a net at an output pin, the net of the gate is handed over to the representative instead.
+             *
+             * @returns The gates whose inputs have been changed on success, an error otherwise.
+             */
+            Result<std::vector<Gate*>> redirect_outputs(Gate* gate, Gate* representative, DeferredModuleUpdate& update)
+            {
+                std::vector<Gate*> affected_gates;
+                for (const GatePin* pin : gate->get_type()->get_output_pins())
+                {
+                    Net* out_net = gate->get_fan_out_net(pin);
+                    if (out_net == nullptr)
+                    {
+                        continue;
+                    }
+
+                    if (Net* rep_net = representative->get_fan_out_net(pin); rep_net != nullptr)
+                    {
+                        auto res = move_destinations(out_net, rep_net, update);
+                        if (res.is_error())
+                        {
+                            return ERR(res.get_error());
+                        }
+                        const auto& moved_gates = res.get();
+                        affected_gates.insert(affected_gates.end(), moved_gates.begin(), moved_gates.end());
+                        update.add_dead_net_candidate(out_net);
+                    }
+                    else
+                    {
+                        update.touch(out_net, gate);
+                        if (!out_net->remove_source(gate, pin) || out_net->add_source(representative, pin->get_name()) == nullptr)
+                        {
+                            return ERR("could not merge gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + " into gate '" + representative->get_name()
+                                       + "' with ID " + std::to_string(representative->get_id()) + ": failed to reconnect net '" + out_net->get_name() + "' with ID "
+                                       + std::to_string(out_net->get_id()));
+                        }
+                        update.touch(out_net, representative);
+                        for (Endpoint* dst : out_net->get_destinations())
+                        {
+                            affected_gates.push_back(dst->get_gate());
+                        }
+                    }
+                }
+
+                return OK(affected_gates);
+            }
+
+            /**
+             * Worklist-driven implementation of the netlist sweep.
+             * All edits are performed with automatic net checks disabled, hence every net that had an endpoint added or removed is recorded together with the modules
+             * of the affected gates so that the modules can be updated once at the end of the sweep.
+             */
+            class Sweeper
+            {
+            public:
+                Sweeper(Netlist* netlist, const SweepConfig& config) : m_netlist(netlist), m_config(config)
+                {
+                    if (const auto& gnd_gates = netlist->get_gnd_gates(); !gnd_gates.empty() && !gnd_gates.front()->get_fan_out_nets().empty())
+                    {
+                        m_gnd_net = gnd_gates.front()->get_fan_out_nets().front();
+                    }
+                    if (const auto& vcc_gates = netlist->get_vcc_gates(); !vcc_gates.empty() && !vcc_gates.front()->get_fan_out_nets().empty())
+                    {
+                        m_vcc_net = vcc_gates.front()->get_fan_out_nets().front();
+                    }
+                }
+
+                Result<SweepStatistics> run()
+                {
+                    m_netlist->enable_automatic_net_checks(false);
+
+                    auto res = process_worklist();
+
+                    // always restore a consistent netlist, even if the sweep has been aborted
+                    m_netlist->enable_automatic_net_checks(true);
+                    if (auto update_res = update_modules(); update_res.is_error() && res.is_ok())
+                    {
+                        res = ERR(update_res.get_error());
+                    }
+
+                    if (res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not sweep netlist with ID " + std::to_string(m_netlist->get_id()));
+                    }
+
+                    return OK(m_stats);
+                }
+
+            private:
+                enum class SignalKind
+                {
+                    none,
+                    constant_zero,
+                    constant_one,
+                    buffer,
+                    inverter
+                };
+
+                Netlist* m_netlist;
+                const SweepConfig& m_config;
+                SweepStatistics m_stats;
+
+                Net* m_gnd_net = nullptr;
+                Net* m_vcc_net = nullptr;
+
+                std::deque<Gate*> m_worklist;
+                std::unordered_set<Gate*> m_queued;
+                std::unordered_set<Gate*> m_removed_gates;
+                std::unordered_map<StructuralKey, Gate*, StructuralKeyHash> m_structural_hash;
+                DeferredModuleUpdate m_update;
+
+                void enqueue(Gate* gate)
+                {
+                    if (m_removed_gates.find(gate) == m_removed_gates.end() && is_combinational_logic(gate) && m_queued.insert(gate).second)
+                    {
+                        m_worklist.push_back(gate);
+                    }
+                }
+
+                void enqueue(const std::vector<Gate*>& gates)
+                {
+                    for (Gate* gate : gates)
+                    {
+                        enqueue(gate);
+                    }
+                }
+
+                std::optional<bool> get_constant_value(const Net* net) const
+                {
+                    if (net == nullptr || net->get_num_of_sources() != 1)
+                    {
+                        return std::nullopt;
+                    }
+
+                    const Gate* src_gate = net->get_sources().front()->get_gate();
+                    if (src_gate->is_gnd_gate())
+                    {
+                        return false;
+                    }
+                    if (src_gate->is_vcc_gate())
+                    {
+                        return true;
+                    }
+                    return std::nullopt;
+                }
+
+                bool is_dangling(const Gate* gate) const
+                {
+                    if (gate->get_type()->get_output_pins().empty())
+                    {
+                        return false;
+                    }
+
+                    for (const Net* out_net : gate->get_fan_out_nets())
+                    {
+                        if (out_net->get_num_of_destinations() != 0 || out_net->is_global_output_net())
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                /**
+                 * Classify the signal at the output pin of a gate as a constant, a buffered input, or an inverted input, taking constant inputs into account.
+                 * Only single-bit functions of at most six non-constant inputs are classified.
+                 */
+                std::pair<SignalKind, const GatePin*> classify_output(const Gate* gate, const GatePin* out_pin) const
+                {
+                    const BooleanFunction function = gate->get_boolean_function(out_pin);
+                    if (function.is_empty())
+                    {
+                        return {SignalKind::none, nullptr};
+                    }
+
+                    static const u64 variable_masks[6] = {
+                        0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull, 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+                    std::unordered_map<std::string, u64> assignment;
+                    std::vector<const GatePin*> variable_pins;
+                    u32 num_constants = 0;
+                    for (const std::string& var : function.get_variable_names())
+                    {
+                        const GatePin* pin = gate->get_type()->get_pin_by_name(var);
+                        if (pin == nullptr || pin->get_direction() != PinDirection::input)
+                        {
+                            return {SignalKind::none, nullptr};
+                        }
+
+                        const Net* in_net = gate->get_fan_in_net(pin);
+                        if (in_net == nullptr)
+                        {
+                            return {SignalKind::none, nullptr};
+                        }
+
+                        if (const auto value = get_constant_value(in_net); value.has_value())
+                        {
+                            assignment[var] = value.value() ? ~0ull : 0ull;
+                            num_constants++;
+                        }
+                        else
+                        {
+                            if (variable_pins.size() == 6)
+                            {
+                                return {SignalKind::none, nullptr};
+                            }
+                            assignment[var] = variable_masks[variable_pins.size()];
+                            variable_pins.push_back(pin);
+                        }
+                    }
+
+                    // functions of more than one variable without constant inputs cannot be reduced to a constant or a single input
+                    if (num_constants == 0 && variable_pins.size() > 1)
+                    {
+                        return {SignalKind::none, nullptr};
+                    }
+
+                    const auto res = evaluate_word(function, assignment);
+                    if (res.is_error())
+                    {
+                        return {SignalKind::none, nullptr};
+                    }
+
+                    const u64 row_mask = (variable_pins.size() == 6) ? ~0ull : ((1ull << (1u << variable_pins.size())) - 1);
+                    const u64 value    = res.get() & row_mask;
+
+                    if (value == 0)
+                    {
+                        return {SignalKind::constant_zero, nullptr};
+                    }
+                    if (value == row_mask)
+                    {
+                        return {SignalKind::constant_one, nullptr};
+                    }
+                    for (u32 i = 0; i < variable_pins.size(); i++)
+                    {
+                        if (value == (variable_masks[i] & row_mask))
+                        {
+                            return {SignalKind::buffer, variable_pins.at(i)};
+                        }
+                        if (value == (~variable_masks[i] & row_mask))
+                        {
+                            return {SignalKind::inverter, variable_pins.at(i)};
+                        }
+                    }
+
+                    return {SignalKind::none, nullptr};
+                }
+
+                StructuralKey get_structural_key(const Gate* gate) const
+                {
+                    StructuralKey key;
+                    key.type = gate->get_type();
+                    for (const GatePin* pin : key.type->get_input_pins())
+                    {
+                        key.inputs.push_back({gate->get_fan_in_net(pin), nullptr});
+                    }
+                    key.configuration = get_gate_configuration(gate);
+                    return key;
+                }
+
+                Result<std::monostate> move_destinations(Net* from, Net* to)
+                {
+                    auto res = netlist_utils::move_destinations(from, to, m_update);
+                    if (res.is_error())
+                    {
+                        return ERR(res.get_error());
+                    }
+                    enqueue(res.get());
+                    return OK({});
+                }
+
+                Result<std::monostate> remove_gate(Gate* gate)
+                {
+                    for (Net* in_net : gate->get_fan_in_nets())
+                    {
+                        m_update.touch(in_net, gate);
+                        for (Endpoint* src : in_net->get_sources())
+                        {
+                            enqueue(src->get_gate());
+                        }
+                        m_update.add_dead_net_candidate(in_net);
+                    }
+                    for (Net* out_net : gate->get_fan_out_nets())
+                    {
+                        m_update.touch(out_net, gate);
+                        m_update.add_dead_net_candidate(out_net);
+                    }
+
+                    const u32 gate_id = gate->get_id();
+                    if (!m_netlist->delete_gate(gate))
+                    {
+                        return ERR("could not remove gate with ID " + std::to_string(gate_id) + " from netlist with ID " + std::to_string(m_netlist->get_id()));
+                    }
+                    m_removed_gates.insert(gate);
+                    m_stats.removed_gates++;
+
+                    return OK({});
+                }
+
+                /**
+                 * Find the net that carries the same signal as the given output pin, if the gate passes through one of its inputs,
+                 * inverts a signal that has been inverted by its predecessor, or evaluates to a constant.
+                 */
+                Net* find_replacement_net(const Gate* gate, const GatePin* out_pin, u32*& counter)
+                {
+                    const auto [kind, in_pin] = classify_output(gate, out_pin);
+                    switch (kind)
+                    {
+                        case SignalKind::constant_zero:
+                            counter = &m_stats.propagated_constants;
+                            return m_config.propagate_constants ? m_gnd_net : nullptr;
+                        case SignalKind::constant_one:
+                            counter = &m_stats.propagated_constants;
+                            return m_config.propagate_constants ? m_vcc_net : nullptr;
+                        case SignalKind::buffer:
+                            counter = &m_stats.collapsed_buffers;
+                            return m_config.collapse_buffers ? gate->get_fan_in_net(in_pin) : nullptr;
+                        case SignalKind::inverter: {
+                            if (!m_config.collapse_inverter_pairs)
+                            {
+                                return nullptr;
+                            }
+
+                            Net* inverted_net = gate->get_fan_in_net(in_pin);
+                            if (inverted_net->get_num_of_sources() != 1)
+                            {
+                                return nullptr;
+                            }
+
+                            const Endpoint* pred_ep = inverted_net->get_sources().front();
+                            const Gate* pred_gate   = pred_ep->get_gate();
+                            if (pred_gate == gate || !is_combinational_logic(pred_gate))
+                            {
+                                return nullptr;
+                            }
+
+                            if (const auto [pred_kind, pred_in_pin] = classify_output(pred_gate, pred_ep->get_pin()); pred_kind == SignalKind::inverter)
+                            {
+                                counter = &m_stats.collapsed_inverter_pairs;
+                                return pred_gate->get_fan_in_net(pred_in_pin);
+                            }
+                            return nullptr;
+                        }
+                        default:
+                            return nullptr;
+                    }
+                }
+
+                Result<std::monostate> merge_into(Gate* gate, Gate* representative)
+                {
+                    auto res = redirect_outputs(gate, representative, m_update);
+                    if (res.is_error())
+                    {
+                        return ERR(res.get_error());
+                    }
+                    enqueue(res.get());
+
+                    m_stats.merged_gates++;
+                    return OK({});
+                }
+
+                Result<std::monostate> process_gate(Gate* gate)
+                {
+                    if (m_config.remove_dangling_logic && is_dangling(gate))
+                    {
+                        return remove_gate(gate);
+                    }
+
+                    bool changed = false;
+                    if (m_config.propagate_constants || m_config.collapse_buffers || m_config.collapse_inverter_pairs)
+                    {
+                        for (Endpoint* out_ep : gate->get_fan_out_endpoints())
+                        {
+                            Net* out_net = out_ep->get_net();
+                            if (out_net->get_num_of_destinations() == 0 || out_net->is_global_output_net())
+                            {
+                                continue;
+                            }
+
+                            u32* counter      = nullptr;
+                            Net* replacement = find_replacement_net(gate, out_ep->get_pin(), counter);
+                            if (replacement == nullptr || replacement == out_net)
+                            {
+                                continue;
+                            }
+
+                            if (auto res = move_destinations(out_net, replacement); res.is_error())
+                            {
+                                return res;
+                            }
+                            (*counter)++;
+                            changed = true;
+                        }
+                    }
+
+                    if (!changed && m_config.merge_duplicate_gates)
+                    {
+                        StructuralKey key = get_structural_key(gate);
+                        if (auto it = m_structural_hash.find(key); it == m_structural_hash.end())
+                        {
+                            m_structural_hash.emplace(std::move(key), gate);
+                        }
+                        else if (Gate* rep = it->second; rep != gate)
+                        {
+                            // the representative may have been removed or rewired since it was hashed
+                            if (m_removed_gates.find(rep) != m_removed_gates.end() || !(get_structural_key(rep) == it->first))
+                            {
+                                it->second = gate;
+                            }
+                            else
+                            {
+                                const auto out_nets = gate->get_fan_out_nets();
+                                if (std::none_of(out_nets.begin(), out_nets.end(), [](const Net* n) { return n->is_global_output_net(); }))
+                                {
+                                    if (auto res = merge_into(gate, rep); res.is_error())
+                                    {
+                                        return res;
+                                    }
+                                    changed = true;
+                                }
+                            }
+                        }
+                    }
+
+                    if (changed)
+                    {
+                        enqueue(gate);
+                    }
+
+                    return OK({});
+                }
+
+                Result<std::monostate> process_worklist()
+                {
+                    for (Gate* gate : m_netlist->get_gates())
+                    {
+                        enqueue(gate);
+                    }
+
+                    while (!m_worklist.empty())
+                    {
+                        Gate* gate = m_worklist.front();
+                        m_worklist.pop_front();
+                        m_queued.erase(gate);
+
+                        if (m_removed_gates.find(gate) != m_removed_gates.end())
+                        {
+                            continue;
+                        }
+
+                        if (auto res = process_gate(gate); res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(), "could not process gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()));
+                        }
+                    }
+
+                    return OK({});
+                }
+
+                Result<std::monostate> update_modules()
+                {
+                    auto res = m_update.apply(m_netlist);
+                    if (res.is_error())
+                    {
+                        return ERR(res.get_error());
+                    }
+                    m_stats.removed_nets += res.get();
+                    return OK({});
+                }
+            };
+        }    // namespace
+
+        Result<SweepStatistics> sweep(Netlist* netlist, const SweepConfig& config)
+        {
+            if (netlist == nullptr)
+            {
+                return ERR("could not sweep netlist: netlist is a 'nullptr'");
+            }
+
+            Sweeper sweeper(netlist, config);
+            return sweeper.run();
+        }
+
+        Result<u32> merge_duplicate_gates(Netlist* netlist)
+        {
+            if (netlist == nullptr)
+            {
+                return ERR("could not merge duplicate gates: netlist is a 'nullptr'");
+            }
+
+            // gates within combinational loops are not part of any level and are therefore never merged
+            const CombinationalLevels topology = get_combinational_levels(netlist);
+            const auto& gates                  = topology.gates;
+            const auto& gate_indices           = topology.gate_indices;
+
+            // union-find over gates, duplicates are always attached directly to their representative, which is never merged itself
+            std::vector<u32> representatives(gates.size());
+            std::iota(representatives.begin(), representatives.end(), 0);
+            const auto find_representative = [&representatives](u32 i) {
+                while (representatives.at(i) != i)
+                {
+                    i = representatives.at(i);
+                }
+                return i;
+            };
+
+            // signals driven by merged gates are identified by the representative gate and the output pin, all other signals by their net
+            const auto get_signal = [&gates, &gate_indices, &find_representative](const Net* net) -> std::pair<const void*, const void*> {
+                if (net == nullptr)
+                {
+                    return {nullptr, nullptr};
+                }
+                if (net->get_num_of_sources() == 1)
+                {
+                    const Endpoint* src_ep = net->get_sources().front();
+                    if (const auto it = gate_indices.find(src_ep->get_gate()); it != gate_indices.end())
+                    {
+                        return {gates.at(find_representative(it->second)), src_ep->get_pin()};
+                    }
+                }
+                return {net, nullptr};
+            };
+
+            // hash each level in parallel unless it is small, structurally identical gates always reside on the same level
+            std::vector<std::pair<u32, u32>> duplicates;
+            for (const auto& level : topology.levels)
+            {
+                std::vector<StructuralKey> keys(level.size());
+                utils::parallel_for_each(0, level.size(), [&](u32 i) {
+                    const Gate* gate = gates.at(level.at(i));
+                    StructuralKey& key = keys.at(i);
+                    key.type           = gate->get_type();
+                    for (const GatePin* pin : key.type->get_input_pins())
+                    {
+                        key.inputs.push_back(get_signal(gate->get_fan_in_net(pin)));
+                    }
+                    key.configuration = get_gate_configuration(gate);
+                }, 256);
+
+                std::unordered_map<StructuralKey, u32, StructuralKeyHash> structural_hash;
+                for (u32 i = 0; i < level.size(); i++)
+                {
+                    if (const auto [it, inserted] = structural_hash.emplace(std::move(keys.at(i)), level.at(i)); !inserted)
+                    {
+                        representatives.at(level.at(i)) = it->second;
+                        duplicates.push_back({level.at(i), it->second});
+                    }
+                }
+            }
+
+            // gates driving global output nets are kept, but their fan-out has already been taken into account when hashing their successors
+            netlist->enable_automatic_net_checks(false);
+            DeferredModuleUpdate update;
+            u32 num_merged = 0;
+            Result<std::monostate> res = OK({});
+            for (const auto& [duplicate_index, representative_index] : duplicates)
+            {
+                Gate* gate           = gates.at(duplicate_index);
+                Gate* representative = gates.at(representative_index);
+
+                const auto out_nets = gate->get_fan_out_nets();
+                if (std::any_of(out_nets.begin(), out_nets.end(), [](const Net* n) { return n->is_global_output_net(); }))
+                {
+                    continue;
+                }
+
+                if (auto redirect_res = redirect_outputs(gate, representative, update); redirect_res.is_error())
+                {
+                    res = ERR(redirect_res.get_error());
+                    break;
+                }
+
+                for (Net* in_net : gate->get_fan_in_nets())
+                {
+                    update.touch(in_net, gate);
+                }
+                for (Net* out_net : gate->get_fan_out_nets())
+                {
+                    update.touch(out_net, gate);
+                }
+
+                const u32 gate_id = gate->get_id();
+                if (!netlist->delete_gate(gate))
+                {
+                    res = ERR("could not remove gate with ID " + std::to_string(gate_id) + " from netlist with ID " + std::to_string(netlist->get_id()));
+                    break;
+                }
+                num_merged++;
+            }
+
+            // always restore a consistent netlist, even if merging has been aborted
+            netlist->enable_automatic_net_checks(true);
+            if (auto update_res = update.apply(netlist); update_res.is_error() && res.is_ok())
+            {
+                res = ERR(update_res.get_error());
+            }
+
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not merge duplicate gates of netlist with ID " + std::to_string(netlist->get_id()));
+            }
+
+            return OK(num_merged);
+        }
+
+        namespace
+        {
+            u64 splitmix64(u64& state)
+            {
+                u64 z = (state += 0x9e3779b97f4a7c15ull);
+                z     = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+                z     = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+                return z ^ (z >> 31);
+            }
+
+            std::optional<bool> get_constant_net_value(const Net* net)
+            {
+                if (net->get_num_of_sources() != 1)
+                {
+                    return std::nullopt;
+                }
+
+                const Gate* src_gate = net->get_sources().front()->get_gate();
+                if (src_gate->is_gnd_gate())
+                {
+                    return false;
+                }
+                if (src_gate->is_vcc_gate())
+                {
+                    return true;
+                }
+                return std::nullopt;
+            }
+
+            struct SimulationResult
+            {
+                std::unordered_map<Net*, std::vector<u64>> signatures;
+
+                // nets whose signature has been computed from the Boolean function of their source gate
+                std::unordered_set<const Net*> simulated_nets;
+            };
+
+            Result<SimulationResult> simulate_random_patterns(const Netlist* netlist, u32 num_bits, u64 seed)
+            {
+                if (num_bits == 0 || num_bits > 1024 || num_bits % 64 != 0)
+                {
+                    return ERR("could not simulate netlist with ID " + std::to_string(netlist->get_id()) + ": signature width of " + std::to_string(num_bits)
+                               + " bits is not a multiple of 64 between 64 and 1024");
+                }
+                const u32 num_words = num_bits / 64;
+
+                // assign random or constant patterns to all nets up front, so that the map is not modified during the parallel simulation
+                SimulationResult result;
+                result.signatures.reserve(netlist->get_nets().size());
+                for (Net* net : netlist->get_nets())
+                {
+                    std::vector<u64>& signature = result.signatures[net];
+                    if (const auto value = get_constant_net_value(net); value.has_value())
+                    {
+                        signature.assign(num_words, value.value() ? ~0ull : 0ull);
+                    }
+                    else
+                    {
+                        u64 state = seed ^ ((u64)net->get_id() * 0xd1b54a32d192ed03ull);
+                        signature.resize(num_words);
+                        for (u64& word : signature)
+                        {
+                            word = splitmix64(state);
+                        }
+                    }
+                }
+
+                const CombinationalLevels topology = get_combinational_levels(netlist);
+                for (const auto& level : topology.levels)
+                {
+                    std::vector<std::vector<const Net*>> simulated_nets(level.size());
+                    utils::parallel_for_each(0, level.size(), [&](u32 i) {
+                        const Gate* gate = topology.gates.at(level.at(i));
+
+                        std::unordered_map<std::string, const u64*> assignment;
+                        for (const Endpoint* ep : gate->get_fan_in_endpoints())
+                        {
+                            assignment[ep->get_pin()->get_name()] = result.signatures.at(ep->get_net()).data();
+                        }
+
+                        for (const Endpoint* ep : gate->get_fan_out_endpoints())
+                        {
+                            Net* out_net = ep->get_net();
+                            if (out_net->get_num_of_sources() != 1)
+                            {
+                                continue;
+                            }
+
+                            const BooleanFunction function = gate->get_boolean_function(ep->get_pin());
+                            if (function.is_empty())
+                            {
+                                continue;
+                            }
+
+                            // the map entry exists already, hence writing to it from different threads is safe
+                            std::vector<u64> signature(num_words);
+                            if (evaluate_words(function, assignment, num_words, signature.data()).is_ok())
+                            {
+                                result.signatures.find(out_net)->second = std::move(signature);
+                                simulated_nets.at(i).push_back(out_net);
+                            }
+                        }
+                    }, 32);
+
+                    for (const auto& nets : simulated_nets)
+                    {
+                        result.simulated_nets.insert(nets.begin(), nets.end());
+                    }
+                }
+
+                return OK(result);
+            }
+
+            /**
+             * Proves or refutes the equivalence of nets using a single persistent solver.
+             * The combinational logic is encoded lazily, i.e., only the transitive fan-in of queried nets is added to the solver, and each net is encoded only once.
+             */
+            class EquivalenceProver
+            {
+            public:
+                enum class Outcome
+                {
+                    equivalent,
+                    different,
+                    unknown
+                };
+
+                EquivalenceProver(const SimulationResult& simulation, u32 timeout_in_ms) : m_simulation(simulation), m_solver(m_context)
+                {
+                    z3::params params(m_context);
+                    params.set("timeout", timeout_in_ms);
+                    m_solver.set(params);
+                }
+
+                Result<std::monostate> encode(const Net* net)
+                {
+                    std::vector<const Net*> stack = {net};
+                    while (!stack.empty())
+                    {
+                        const Net* current = stack.back();
+                        if (m_variables.find(current) != m_variables.end())
+                        {
+                            stack.pop_back();
+                            continue;
+                        }
+
+                        z3::expr variable = m_context.bv_const(("net_" + std::to_string(current->get_id())).c_str(), 1);
+                        if (const auto value = get_constant_net_value(current); value.has_value())
+                        {
+                            m_solver.add(variable == m_context.bv_val(value.value() ? 1 : 0, 1));
+                        }
+                        else if (m_simulation.simulated_nets.find(current) != m_simulation.simulated_nets.end())
+                        {
+                            const Endpoint* src_ep = current->get_sources().front();
+                            const Gate* src_gate   = src_ep->get_gate();
+
+                            // encode the fan-in first, simulated nets form an acyclic graph
+                            bool fan_in_encoded = true;
+                            std::map<std::string, z3::expr> var2expr;
+                            for (const Endpoint* ep : src_gate->get_fan_in_endpoints())
+                            {
+                                if (const auto it = m_variables.find(ep->get_net()); it != m_variables.end())
+                                {
+                                    var2expr.emplace(ep->get_pin()->get_name(), it->second);
+                                }
+                                else
+                                {
+                                    stack.push_back(ep->get_net());
+                                    fan_in_encoded = false;
+                                }
+                            }
+                            if (!fan_in_encoded)
+                            {
+                                continue;
+                            }
+
+                            const z3::expr function = src_gate->get_boolean_function(src_ep->get_pin()).to_z3(m_context, var2expr);
+                            if (static_cast<Z3_ast>(function) == nullptr)
+                            {
+                                return ERR("could not encode net '" + current->get_name() + "' with ID " + std::to_string(current->get_id()) + ": failed to translate Boolean function of gate '"
+                                           + src_gate->get_name() + "' with ID " + std::to_string(src_gate->get_id()));
+                            }
+                            m_solver.add(variable == function);
+                        }
+
+                        m_variables.emplace(current, variable);
+                        stack.pop_back();
+                    }
+
+                    return OK({});
+                }
+
+                /**
+                 * Check whether the signal of net b equals the (complemented) signal of net a. Both nets must have been encoded before.
+                 */
+                Outcome prove(const Net* a, const Net* b, bool complemented)
+                {
+                    const z3::expr& expr_a = m_variables.at(a);
+                    const z3::expr& expr_b = m_variables.at(b);
+
+                    // the query is guarded by a fresh literal that is assumed for this check only and disabled afterwards
+                    const z3::expr guard = m_context.bool_const(("query_" + std::to_string(m_num_queries++)).c_str());
+                    m_solver.add(z3::implies(guard, complemented ? (expr_a == expr_b) : (expr_a != expr_b)));
+
+                    z3::expr_vector assumptions(m_context);
+                    assumptions.push_back(guard);
+                    const z3::check_result res = m_solver.check(assumptions);
+                    if (res == z3::sat)
+                    {
+                        m_model = std::make_unique<z3::model>(m_solver.get_model());
+                    }
+                    m_solver.add(!guard);
+
+                    switch (res)
+                    {
+                        case z3::unsat:
+                            return Outcome::equivalent;
+                        case z3::sat:
+                            return Outcome::different;
+                        default:
+                            return Outcome::unknown;
+                    }
+                }
+
+                /**
+                 * Get the value of an encoded net within the counterexample of the last query that returned `different`.
+                 */
+                bool get_counterexample_value(const Net* net) const
+                {
+                    return m_model->eval(m_variables.at(net), true).get_numeral_uint() != 0;
+                }
+
+            private:
+                const SimulationResult& m_simulation;
+                z3::context m_context;
+                z3::solver m_solver;
+                std::unique_ptr<z3::model> m_model;
+                std::unordered_map<const Net*, z3::expr> m_variables;
+                u64 m_num_queries = 0;
+            };
+
+            struct SignatureHash
+            {
+                std::size_t operator()(const std::vector<u64>& signature) const
+                {
+                    std::size_t h = signature.size();
+                    for (u64 word : signature)
+                    {
+                        h ^= std::hash<u64>()(word) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+                    }
+                    return h;
+                }
+            };
+        }    // namespace
+
+        Result<std::unordered_map<Net*, std::vector<u64>>> compute_net_signatures(const Netlist* netlist, u32 num_bits, u64 seed)
+        {
+            if (netlist == nullptr)
+            {
+                return ERR("could not compute net signatures: netlist is a 'nullptr'");
+            }
+
+            auto res = simulate_random_patterns(netlist, num_bits, seed);
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not compute net signatures of netlist with ID " + std::to_string(netlist->get_id()));
+            }
+
+            return OK(std::move(res.get().signatures));
+        }
+
+        Result<std::vector<NetEquivalenceClass>> get_equivalent_nets(const Netlist* netlist, const NetEquivalenceConfig& config)
+        {
+            if (netlist == nullptr)
+            {
+                return ERR("could not get equivalent nets: netlist is a 'nullptr'");
+            }
+
+            auto sim_res = simulate_random_patterns(netlist, config.signature_width, config.seed);
+            if (sim_res.is_error())
+            {
+                return ERR_APPEND(sim_res.get_error(), "could not get equivalent nets of netlist with ID " + std::to_string(netlist->get_id()));
+            }
+            const SimulationResult& simulation = sim_res.get();
+
+            // bucket nets by their signature, signatures with the first bit set are complemented if complements are considered
+            std::vector<std::vector<std::pair<Net*, bool>>> candidates;
+            std::unordered_map<std::vector<u64>, u32, SignatureHash> candidate_indices;
+            for (Net* net : netlist->get_nets())
+            {
+                std::vector<u64> signature = simulation.signatures.at(net);
+                const bool complemented    = config.consider_complements && (signature.front() & 1) != 0;
+                if (complemented)
+                {
+                    for (u64& word : signature)
+                    {
+                        word = ~word;
+                    }
+                }
+
+                const auto [it, inserted] = candidate_indices.emplace(std::move(signature), candidates.size());
+                if (inserted)
+                {
+                    candidates.emplace_back();
+                }
+                candidates.at(it->second).push_back({net, complemented});
+            }
+
+            const auto to_equivalence_class = [](const std::vector<std::pair<Net*, bool>>& members) {
+                NetEquivalenceClass eq_class;
+                for (const auto& [net, complemented] : members)
+                {
+                    eq_class.nets.push_back(net);
+                    eq_class.complemented.push_back(complemented != members.front().second);
+                }
+                return eq_class;
+            };
+
+            std::vector<NetEquivalenceClass> result;
+            if (!config.sat_refinement)
+            {
+                for (const auto& members : candidates)
+                {
+                    if (members.size() > 1)
+                    {
+                        result.push_back(to_equivalence_class(members));
+                    }
+                }
+                return OK(result);
+            }
+
+            EquivalenceProver prover(simulation, config.query_timeout_in_ms);
+            u32 num_undecided = 0;
+            std::deque<std::vector<std::pair<Net*, bool>>> worklist;
+            for (auto& members : candidates)
+            {
+                if (members.size() > 1)
+                {
+                    worklist.push_back(std::move(members));
+                }
+            }
+
+            while (!worklist.empty())
+            {
+                auto members = std::move(worklist.front());
+                worklist.pop_front();
+
+                for (const auto& [net, complemented] : members)
+                {
+                    if (auto res = prover.encode(net); res.is_error())
+                    {
+                        return ERR_APPEND(res.get_error(), "could not get equivalent nets of netlist with ID " + std::to_string(netlist->get_id()));
+                    }
+                }
+
+                const auto& [representative, rep_complemented] = members.front();
+                std::vector<std::pair<Net*, bool>> confirmed = {members.front()};
+                std::deque<std::pair<Net*, bool>> pending(members.begin() + 1, members.end());
+                while (!pending.empty())
+                {
+                    const auto [net, complemented] = pending.front();
+                    pending.pop_front();
+
+                    const auto outcome = prover.prove(representative, net, complemented != rep_complemented);
+                    if (outcome == EquivalenceProver::Outcome::equivalent)
+                    {
+                        confirmed.push_back({net, complemented});
+                    }
+                    else if (outcome == EquivalenceProver::Outcome::different)
+                    {
+                        // the counterexample distinguishes the representative from all pending nets that evaluate differently
+                        const bool rep_value = prover.get_counterexample_value(representative) != rep_complemented;
+                        std::vector<std::pair<Net*, bool>> split   = {{net, complemented}};
+                        std::deque<std::pair<Net*, bool>> remaining;
+                        for (const auto& member : pending)
+                        {
+                            if ((prover.get_counterexample_value(member.first) != member.second) == rep_value)
+                            {
+                                remaining.push_back(member);
+                            }
+                            else
+                            {
+                                split.push_back(member);
+                            }
+                        }
+                        pending = std::move(remaining);
+                        if (split.size() > 1)
+                        {
+                            worklist.push_back(std::move(split));
+                        }
+                    }
+                    else
+                    {
+                        num_undecided++;
+                    }
+                }
+
+                if (confirmed.size() > 1)
+                {
+                    result.push_back(to_equivalence_class(confirmed));
+                }
+            }
+
+            if (num_undecided > 0)
+            {
+                log_debug("netlist_utils",
+                          "could not decide equivalence of {} nets within {} ms per query in netlist with ID {}, the nets have been removed from their classes.",
+                          num_undecided,
+                          config.query_timeout_in_ms,
+                          netlist->get_id());
+            }
+
+            return OK(result);
+        }
+
+        const std::vector<Net*>& CutEnumeration::get_nets() const
+        {
+            return m_nets;
+        }
+
+        u32 CutEnumeration::get_num_cuts(const Net* net) const
+        {
+            if (const auto it = m_cut_ranges.find(net); it != m_cut_ranges.end())
+            {
+                return it->second.second;
+            }
+            return 0;
+        }
+
+        u64 CutEnumeration::get_num_cuts() const
+        {
+            return m_cuts.size();
+        }
+
+        std::vector<Cut> CutEnumeration::get_cuts(const Net* net) const
+        {
+            std::vector<Cut> cuts;
+            if (const auto it = m_cut_ranges.find(net); it != m_cut_ranges.end())
+            {
+                const auto [first, count] = it->second;
+                cuts.reserve(count);
+                for (u32 i = first; i < first + count; i++)
+                {
+                    const CutEntry& entry = m_cuts.at(i);
+                    Cut cut;
+                    cut.leaves.assign(m_leaves.begin() + entry.leaves_offset, m_leaves.begin() + entry.leaves_offset + entry.num_leaves);
+                    cut.truth_table.assign(m_truth_tables.begin() + entry.truth_table_offset, m_truth_tables.begin() + entry.truth_table_offset + entry.num_truth_table_words);
+                    cuts.push_back(std::move(cut));
+                }
+            }
+            return cuts;
+        }
+
+        namespace
+        {
+            u32 get_num_truth_table_words(u32 num_variables)
+            {
+                return (num_variables <= 6) ? 1 : (1u << (num_variables - 6));
+            }
+
+            /**
+             * Re-express a truth table over a subset of leaves as a truth table over a superset of these leaves. Both sets of leaves must be sorted by ID.
+             */
+            std::vector<u64> expand_truth_table(const u64* truth_table, const std::vector<Net*>& sub_leaves, const std::vector<Net*>& super_leaves)
+            {
+                std::vector<u32> positions;
+                positions.reserve(sub_leaves.size());
+                for (u32 i = 0, j = 0; i < sub_leaves.size(); i++)
+                {
+                    while (super_leaves.at(j) != sub_leaves.at(i))
+                    {
+                        j++;
+                    }
+                    positions.push_back(j);
+                }
+
+                const u32 num_rows = 1u << super_leaves.size();
+                std::vector<u64> result(get_num_truth_table_words(super_leaves.size()), 0);
+                for (u32 m = 0; m < num_rows; m++)
+                {
+                    u32 sub_m = 0;
+                    for (u32 i = 0; i < positions.size(); i++)
+                    {
+                        sub_m |= ((m >> positions[i]) & 1) << i;
+                    }
+                    if ((truth_table[sub_m >> 6] >> (sub_m & 63)) & 1)
+                    {
+                        result[m >> 6] |= 1ull << (m & 63);
+                    }
+                }
+                return result;
+            }
+
+            bool is_subset(const std::vector<Net*>& sub, const std::vector<Net*>& super)
+            {
+                return std::includes(super.begin(), super.end(), sub.begin(), sub.end(), [](const Net* a, const Net* b) { return a->get_id() < b->get_id(); });
+            }
+        }    // namespace
+
+        Result<CutEnumeration> enumerate_cuts(const Netlist* netlist, const CutEnumerationConfig& config)
+        {
+            if (netlist == nullptr)
+            {
+                return ERR("could not enumerate cuts: netlist is a 'nullptr'");
+            }
+            if (config.max_cut_size == 0 || config.max_cut_size > 8)
+            {
+                return ERR("could not enumerate cuts of netlist with ID " + std::to_string(netlist->get_id()) + ": maximum cut size of " + std::to_string(config.max_cut_size)
+                           + " is not between 1 and 8");
+            }
+            if (config.max_cuts_per_net == 0)
+            {
+                return ERR("could not enumerate cuts of netlist with ID " + std::to_string(netlist->get_id()) + ": at least one cut must be kept per net");
+            }
+
+            struct LocalCut
+            {
+                std::vector<Net*> leaves;
+                std::vector<u64> truth_table;
+            };
+
+            // a partial cut references one cut of each of the fan-in nets processed so far
+            struct PartialCut
+            {
+                std::vector<Net*> leaves;
+                std::vector<u32> chosen_cuts;
+            };
+
+            const auto by_id = [](const Net* a, const Net* b) { return a->get_id() < b->get_id(); };
+            const auto by_priority = [&by_id](const auto& a, const auto& b) {
+                if (a.leaves.size() != b.leaves.size())
+                {
+                    return a.leaves.size() < b.leaves.size();
+                }
+                return std::lexicographical_compare(a.leaves.begin(), a.leaves.end(), b.leaves.begin(), b.leaves.end(), by_id);
+            };
+
+            CutEnumeration result;
+            const u32 max_partial_cuts = config.max_cuts_per_net * config.max_cuts_per_net;
+
+            // nets without enumerated cuts only provide their trivial cut
+            const auto get_fan_in_cuts = [&result, &config](Net* net) {
+                std::vector<LocalCut> cuts;
+                if (const auto it = result.m_cut_ranges.find(net); it != result.m_cut_ranges.end())
+                {
+                    for (u32 i = it->second.first; i < it->second.first + it->second.second; i++)
+                    {
+                        const auto& entry = result.m_cuts.at(i);
+                        LocalCut cut;
+                        cut.leaves.assign(result.m_leaves.begin() + entry.leaves_offset, result.m_leaves.begin() + entry.leaves_offset + entry.num_leaves);
+                        cut.truth_table.assign(result.m_truth_tables.begin() + entry.truth_table_offset,
+                                               result.m_truth_tables.begin() + entry.truth_table_offset + entry.num_truth_table_words);
+                        cuts.push_back(std::move(cut));
+                    }
+                }
+                else
+                {
+                    cuts.push_back({{net}, config.compute_truth_tables ? std::vector<u64>({0x2}) : std::vector<u64>()});
+                }
+                return cuts;
+            };
+
+            // nets driven by a gate with a missing or unsupported Boolean function only get their trivial cut
+            const auto compute_cuts = [&](const Gate* gate, const GatePin* out_pin, Net* out_net) -> std::vector<LocalCut> {
+                // the trivial cut is always kept and does not count towards the limit
+                std::vector<LocalCut> cuts;
+                cuts.push_back({{out_net}, config.compute_truth_tables ? std::vector<u64>({0x2}) : std::vector<u64>()});
+
+                const BooleanFunction function = gate->get_boolean_function(out_pin);
+                if (function.is_empty())
+                {
+                    return cuts;
+                }
+
+                std::vector<std::string> variables;
+                std::vector<std::vector<LocalCut>> fan_in_cuts;
+                for (const std::string& var : function.get_variable_names())
+                {
+                    const GatePin* pin = gate->get_type()->get_pin_by_name(var);
+                    if (pin == nullptr || pin->get_direction() != PinDirection::input)
+                    {
+                        return cuts;
+                    }
+                    Net* in_net = gate->get_fan_in_net(pin);
+                    if (in_net == nullptr)
+                    {
+                        return cuts;
+                    }
+                    variables.push_back(var);
+                    fan_in_cuts.push_back(get_fan_in_cuts(in_net));
+                }
+
+                // merge the cuts of all fan-in nets one after another, pruning the intermediate results to the best candidates
+                std::vector<PartialCut> partial_cuts = {PartialCut()};
+                for (const auto& cuts : fan_in_cuts)
+                {
+                    std::vector<PartialCut> next_partial_cuts;
+                    for (const auto& partial_cut : partial_cuts)
+                    {
+                        for (u32 j = 0; j < cuts.size(); j++)
+                        {
+                            const auto& cut = cuts.at(j);
+                            PartialCut merged;
+                            std::set_union(partial_cut.leaves.begin(), partial_cut.leaves.end(), cut.leaves.begin(), cut.leaves.end(), std::back_inserter(merged.leaves), by_id);
+                            if (merged.leaves.size() > config.max_cut_size)
+                            {
+                                continue;
+                            }
+                            merged.chosen_cuts = partial_cut.chosen_cuts;
+                            merged.chosen_cuts.push_back(j);
+                            next_partial_cuts.push_back(std::move(merged));
+                        }
+                    }
+
+                    std::stable_sort(next_partial_cuts.begin(), next_partial_cuts.end(), by_priority);
+                    next_partial_cuts.erase(
+                        std::unique(next_partial_cuts.begin(), next_partial_cuts.end(), [](const PartialCut& a, const PartialCut& b) { return a.leaves == b.leaves; }),
+                        next_partial_cuts.end());
+                    if (next_partial_cuts.size() > max_partial_cuts)
+                    {
+                        next_partial_cuts.resize(max_partial_cuts);
+                    }
+                    partial_cuts = std::move(next_partial_cuts);
+                }
+
+                for (const auto& partial_cut : partial_cuts)
+                {
+                    if (cuts.size() > config.max_cuts_per_net)
+                    {
+                        break;
+                    }
+                    if (std::any_of(cuts.begin() + 1, cuts.end(), [&partial_cut](const LocalCut& c) { return is_subset(c.leaves, partial_cut.leaves); }))
+                    {
+                        continue;
+                    }
+
+                    LocalCut cut;
+                    cut.leaves = partial_cut.leaves;
+                    if (config.compute_truth_tables)
+                    {
+                        const u32 num_words = get_num_truth_table_words(cut.leaves.size());
+                        std::vector<std::vector<u64>> expanded_truth_tables;
+                        expanded_truth_tables.reserve(variables.size());
+                        std::unordered_map<std::string, const u64*> assignment;
+                        for (u32 i = 0; i < variables.size(); i++)
+                        {
+                            const auto& chosen_cut = fan_in_cuts.at(i).at(partial_cut.chosen_cuts.at(i));
+                            expanded_truth_tables.push_back(expand_truth_table(chosen_cut.truth_table.data(), chosen_cut.leaves, cut.leaves));
+                            assignment[variables.at(i)] = expanded_truth_tables.back().data();
+                        }
+
+                        cut.truth_table.resize(num_words);
+                        if (evaluate_words(function, assignment, num_words, cut.truth_table.data()).is_error())
+                        {
+                            cuts.resize(1);
+                            return cuts;
+                        }
+                        if (cut.leaves.size() < 6)
+                        {
+                            cut.truth_table[0] &= (1ull << (1u << cut.leaves.size())) - 1;
+                        }
+                    }
+                    cuts.push_back(std::move(cut));
+                }
+
+                return cuts;
+            };
+
+            const CombinationalLevels topology = get_combinational_levels(netlist);
+            for (const auto& level : topology.levels)
+            {
+                std::vector<std::vector<std::pair<Net*, std::vector<LocalCut>>>> level_cuts(level.size());
+                utils::parallel_for_each(0, level.size(), [&](u32 i) {
+                    const Gate* gate = topology.gates.at(level.at(i));
+                    for (const Endpoint* ep : gate->get_fan_out_endpoints())
+                    {
+                        Net* out_net = ep->get_net();
+                        if (out_net->get_num_of_sources() != 1)
+                        {
+                            continue;
+                        }
+                        level_cuts.at(i).push_back({out_net, compute_cuts(gate, ep->get_pin(), out_net)});
+                    }
+                }, 32);
+
+                // append the cuts of the level to the arena only after all threads have finished reading from it
+                for (auto& gate_cuts : level_cuts)
+                {
+                    for (auto& [net, cuts] : gate_cuts)
+                    {
+                        result.m_nets.push_back(net);
+                        result.m_cut_ranges[net] = {(u32)result.m_cuts.size(), (u32)cuts.size()};
+                        for (const auto& cut : cuts)
+                        {
+                            result.m_cuts.push_back({(u32)result.m_leaves.size(), (u32)result.m_truth_tables.size(), (u32)cut.leaves.size(), (u32)cut.truth_table.size()});
+                            result.m_leaves.insert(result.m_leaves.end(), cut.leaves.begin(), cut.leaves.end());
+                            result.m_truth_tables.insert(result.m_truth_tables.end(), cut.truth_table.begin(), cut.truth_table.end());
+                        }
+                    }
+                }
+            }
+
+            return OK(result);
+        }
     }    // namespace netlist_utils
 }    // namespace hal
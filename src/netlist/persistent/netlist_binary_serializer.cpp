@@ -0,0 +1,1478 @@
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/lazy_data_source.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+#include "hal_core/utilities/utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifndef DURATION
+#define DURATION(begin_time) ((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000)
+#endif
+
+namespace hal
+{
+    namespace netlist_binary_serializer
+    {
+        namespace
+        {
+            // must be increased whenever the layout of any section or the numbering of any of the stored enums changes
+            const u32 FORMAT_VERSION   = 1;
+            const char FORMAT_MAGIC[8] = {'H', 'A', 'L', 'N', 'L', 'B', 'I', 'N'};
+            const u32 BYTE_ORDER_MARK  = 0x01020304;
+            const u32 INVALID_INDEX    = 0xFFFFFFFF;
+
+            // all sections start at offsets that are a multiple of this alignment
+            const u64 SECTION_ALIGNMENT = 8;
+
+            enum class SectionId : u32
+            {
+                strings      = 1,
+                netlist      = 2,
+                gates        = 3,
+                nets         = 4,
+                sources      = 5,
+                destinations = 6,
+                globals      = 7,
+                modules      = 8,
+                pin_groups   = 9,
+                data         = 10,
+                functions    = 11
+            };
+
+            enum class DataOwner : u8
+            {
+                gate   = 0,
+                net    = 1,
+                module = 2
+            };
+
+            struct SectionEntry
+            {
+                u32 id;
+                u32 reserved;
+                u64 offset;
+                u64 size;
+            };
+
+            struct FileHeader
+            {
+                char magic[8];
+                u32 version;
+                u32 byte_order_mark;
+                u32 num_sections;
+                u32 reserved;
+            };
+
+            // ===== writing =====
+
+            class SectionWriter
+            {
+            public:
+                template<typename T>
+                void write_value(T value)
+                {
+                    align(alignof(T));
+                    m_data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+                }
+
+                // every column is aligned to its element type so that it can be accessed in place once mapped
+                template<typename T>
+                void write_column(const std::vector<T>& values)
+                {
+                    align(alignof(T));
+                    m_data.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+                }
+
+                void write_raw(std::string_view data)
+                {
+                    m_data.append(data);
+                }
+
+                const std::string& get_data() const
+                {
+                    return m_data;
+                }
+
+            private:
+                void align(u64 alignment)
+                {
+                    m_data.resize((m_data.size() + alignment - 1) / alignment * alignment, '\0');
+                }
+
+                std::string m_data;
+            };
+
+            class StringTable
+            {
+            public:
+                u32 add(const std::string& value)
+                {
+                    const auto [it, inserted] = m_indices.emplace(value, (u32)m_strings.size());
+                    if (inserted)
+                    {
+                        m_strings.push_back(&it->first);
+                    }
+                    return it->second;
+                }
+
+                void write(SectionWriter& writer) const
+                {
+                    std::vector<u64> offsets;
+                    offsets.reserve(m_strings.size() + 1);
+                    offsets.push_back(0);
+                    for (const std::string* value : m_strings)
+                    {
+                        offsets.push_back(offsets.back() + value->size());
+                    }
+
+                    writer.write_value<u64>(m_strings.size());
+                    writer.write_column(offsets);
+                    for (const std::string* value : m_strings)
+                    {
+                        writer.write_raw(*value);
+                    }
+                }
+
+            private:
+                // the keys of the map are stable in memory, so the table just points to them
+                std::unordered_map<std::string, u32> m_indices;
+                std::vector<const std::string*> m_strings;
+            };
+
+            struct CsrColumns
+            {
+                std::vector<u64> offsets = {0};
+
+                void close_row(u64 size)
+                {
+                    offsets.push_back(size);
+                }
+            };
+
+            std::string serialize(const Netlist* nl)
+            {
+                StringTable strings;
+                std::vector<std::pair<SectionId, SectionWriter>> sections;
+
+                // netlist information
+                {
+                    SectionWriter writer;
+                    writer.write_value<u32>(nl->get_id());
+                    writer.write_value<u32>(strings.add(nl->get_gate_library()->get_path().string()));
+                    writer.write_value<u32>(strings.add(nl->get_input_filename().string()));
+                    writer.write_value<u32>(strings.add(nl->get_design_name()));
+                    writer.write_value<u32>(strings.add(nl->get_device_name()));
+                    sections.emplace_back(SectionId::netlist, std::move(writer));
+                }
+
+                // gates, all other sections refer to gates by their index within the (ID-sorted) gate columns
+                std::vector<Gate*> gates = nl->get_gates();
+                std::sort(gates.begin(), gates.end(), [](const Gate* lhs, const Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                std::unordered_map<const Gate*, u32> gate_indices;
+                gate_indices.reserve(gates.size());
+                {
+                    std::vector<u32> ids, names, types;
+                    std::vector<i32> xs, ys;
+                    ids.reserve(gates.size());
+                    names.reserve(gates.size());
+                    types.reserve(gates.size());
+                    xs.reserve(gates.size());
+                    ys.reserve(gates.size());
+                    for (const Gate* gate : gates)
+                    {
+                        gate_indices.emplace(gate, (u32)ids.size());
+                        ids.push_back(gate->get_id());
+                        names.push_back(strings.add(gate->get_name()));
+                        types.push_back(strings.add(gate->get_type()->get_name()));
+                        xs.push_back(gate->get_location_x());
+                        ys.push_back(gate->get_location_y());
+                    }
+
+                    SectionWriter writer;
+                    writer.write_value<u64>(ids.size());
+                    writer.write_column(ids);
+                    writer.write_column(names);
+                    writer.write_column(types);
+                    writer.write_column(xs);
+                    writer.write_column(ys);
+                    sections.emplace_back(SectionId::gates, std::move(writer));
+                }
+
+                // nets and their endpoints
+                std::vector<Net*> nets = nl->get_nets();
+                std::sort(nets.begin(), nets.end(), [](const Net* lhs, const Net* rhs) { return lhs->get_id() < rhs->get_id(); });
+                std::unordered_map<const Net*, u32> net_indices;
+                net_indices.reserve(nets.size());
+                {
+                    std::vector<u32> ids, names;
+                    ids.reserve(nets.size());
+                    names.reserve(nets.size());
+                    for (const Net* net : nets)
+                    {
+                        net_indices.emplace(net, (u32)ids.size());
+                        ids.push_back(net->get_id());
+                        names.push_back(strings.add(net->get_name()));
+                    }
+
+                    SectionWriter writer;
+                    writer.write_value<u64>(ids.size());
+                    writer.write_column(ids);
+                    writer.write_column(names);
+                    sections.emplace_back(SectionId::nets, std::move(writer));
+                }
+
+                for (const bool sources : {true, false})
+                {
+                    CsrColumns csr;
+                    std::vector<u32> endpoint_gates, endpoint_pins;
+                    for (const Net* net : nets)
+                    {
+                        std::vector<Endpoint*> endpoints = sources ? net->get_sources() : net->get_destinations();
+                        std::sort(endpoints.begin(), endpoints.end(), [](const Endpoint* lhs, const Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
+                        for (const Endpoint* ep : endpoints)
+                        {
+                            endpoint_gates.push_back(gate_indices.at(ep->get_gate()));
+                            endpoint_pins.push_back(ep->get_pin()->get_id());
+                        }
+                        csr.close_row(endpoint_gates.size());
+                    }
+
+                    SectionWriter writer;
+                    writer.write_column(csr.offsets);
+                    writer.write_column(endpoint_gates);
+                    writer.write_column(endpoint_pins);
+                    sections.emplace_back(sources ? SectionId::sources : SectionId::destinations, std::move(writer));
+                }
+
+                // global gates and nets
+                {
+                    std::vector<u32> gnd_gates, vcc_gates, input_nets, output_nets;
+                    for (const Gate* gate : gates)
+                    {
+                        if (nl->is_gnd_gate(gate))
+                        {
+                            gnd_gates.push_back(gate_indices.at(gate));
+                        }
+                        if (nl->is_vcc_gate(gate))
+                        {
+                            vcc_gates.push_back(gate_indices.at(gate));
+                        }
+                    }
+                    for (const Net* net : nets)
+                    {
+                        if (nl->is_global_input_net(net))
+                        {
+                            input_nets.push_back(net_indices.at(net));
+                        }
+                        if (nl->is_global_output_net(net))
+                        {
+                            output_nets.push_back(net_indices.at(net));
+                        }
+                    }
+
+                    SectionWriter writer;
+                    for (const auto* column : {&gnd_gates, &vcc_gates, &input_nets, &output_nets})
+                    {
+                        writer.write_value<u64>(column->size());
+                    }
+                    for (const auto* column : {&gnd_gates, &vcc_gates, &input_nets, &output_nets})
+                    {
+                        writer.write_column(*column);
+                    }
+                    sections.emplace_back(SectionId::globals, std::move(writer));
+                }
+
+                // modules in breadth-first order so that parents always precede their submodules
+                std::vector<const Module*> modules;
+                std::unordered_map<const Module*, u32> module_indices;
+                {
+                    std::queue<const Module*> q;
+                    q.push(nl->get_top_module());
+                    while (!q.empty())
+                    {
+                        const Module* module = q.front();
+                        q.pop();
+
+                        module_indices.emplace(module, (u32)modules.size());
+                        modules.push_back(module);
+
+                        for (const Module* sm : module->get_submodules())
+                        {
+                            q.push(sm);
+                        }
+                    }
+
+                    std::vector<u32> ids, names, types, parents;
+                    CsrColumns csr;
+                    std::vector<u32> module_gates;
+                    for (const Module* module : modules)
+                    {
+                        ids.push_back(module->get_id());
+                        names.push_back(strings.add(module->get_name()));
+                        types.push_back(strings.add(module->get_type()));
+                        parents.push_back(module->is_top_module() ? INVALID_INDEX : module_indices.at(module->get_parent_module()));
+
+                        std::vector<u32> indices;
+                        for (const Gate* gate : module->get_gates(nullptr, false))
+                        {
+                            indices.push_back(gate_indices.at(gate));
+                        }
+                        std::sort(indices.begin(), indices.end());
+                        module_gates.insert(module_gates.end(), indices.begin(), indices.end());
+                        csr.close_row(module_gates.size());
+                    }
+
+                    SectionWriter writer;
+                    writer.write_value<u64>(ids.size());
+                    writer.write_column(ids);
+                    writer.write_column(names);
+                    writer.write_column(types);
+                    writer.write_column(parents);
+                    writer.write_column(csr.offsets);
+                    writer.write_column(module_gates);
+                    sections.emplace_back(SectionId::modules, std::move(writer));
+                }
+
+                // module pin groups and pins
+                {
+                    std::vector<u32> group_modules, group_ids, group_names, group_start_indices;
+                    std::vector<u8> group_directions, group_types, group_ascending;
+                    CsrColumns csr;
+                    std::vector<u32> pin_ids, pin_names, pin_nets;
+                    std::vector<u8> pin_types;
+                    for (const Module* module : modules)
+                    {
+                        for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+                        {
+                            group_modules.push_back(module_indices.at(module));
+                            group_ids.push_back(pin_group->get_id());
+                            group_names.push_back(strings.add(pin_group->get_name()));
+                            group_start_indices.push_back(pin_group->get_start_index());
+                            group_directions.push_back((u8)pin_group->get_direction());
+                            group_types.push_back((u8)pin_group->get_type());
+                            group_ascending.push_back(pin_group->is_ascending() ? 1 : 0);
+
+                            for (const ModulePin* pin : pin_group->get_pins())
+                            {
+                                pin_ids.push_back(pin->get_id());
+                                pin_names.push_back(strings.add(pin->get_name()));
+                                pin_nets.push_back(net_indices.at(pin->get_net()));
+                                pin_types.push_back((u8)pin->get_type());
+                            }
+                            csr.close_row(pin_ids.size());
+                        }
+                    }
+
+                    SectionWriter writer;
+                    writer.write_value<u64>(group_ids.size());
+                    writer.write_column(group_modules);
+                    writer.write_column(group_ids);
+                    writer.write_column(group_names);
+                    writer.write_column(group_start_indices);
+                    writer.write_column(group_directions);
+                    writer.write_column(group_types);
+                    writer.write_column(group_ascending);
+                    writer.write_column(csr.offsets);
+                    writer.write_column(pin_ids);
+                    writer.write_column(pin_names);
+                    writer.write_column(pin_nets);
+                    writer.write_column(pin_types);
+                    sections.emplace_back(SectionId::pin_groups, std::move(writer));
+                }
+
+                // data entries of gates, nets, and modules
+                {
+                    std::vector<u8> owner_types;
+                    std::vector<u32> owners, categories, keys, data_types, values;
+                    const auto add_entries = [&](DataOwner owner_type, u32 owner, const DataContainer* container) {
+                        for (const auto& [key, entry] : container->get_data_map())
+                        {
+                            owner_types.push_back((u8)owner_type);
+                            owners.push_back(owner);
+                            categories.push_back(strings.add(std::get<0>(key)));
+                            keys.push_back(strings.add(std::get<1>(key)));
+                            data_types.push_back(strings.add(std::get<0>(entry)));
+                            values.push_back(strings.add(std::get<1>(entry)));
+                        }
+                    };
+                    for (u32 i = 0; i < gates.size(); i++)
+                    {
+                        add_entries(DataOwner::gate, i, gates[i]);
+                    }
+                    for (u32 i = 0; i < nets.size(); i++)
+                    {
+                        add_entries(DataOwner::net, i, nets[i]);
+                    }
+                    for (u32 i = 0; i < modules.size(); i++)
+                    {
+                        add_entries(DataOwner::module, i, modules[i]);
+                    }
+
+                    SectionWriter writer;
+                    writer.write_value<u64>(owners.size());
+                    writer.write_column(owner_types);
+                    writer.write_column(owners);
+                    writer.write_column(categories);
+                    writer.write_column(keys);
+                    writer.write_column(data_types);
+                    writer.write_column(values);
+                    sections.emplace_back(SectionId::data, std::move(writer));
+                }
+
+                // custom Boolean functions as pre-parsed node vectors
+                {
+                    std::vector<u32> function_gates, function_names;
+                    CsrColumns csr;
+                    std::vector<u16> node_types, node_sizes;
+                    std::vector<u32> node_payloads;
+                    std::vector<u8> constant_values;
+                    for (u32 i = 0; i < gates.size(); i++)
+                    {
+                        const auto functions = gates[i]->get_boolean_functions(true);
+                        std::vector<std::string> function_keys;
+                        for (const auto& [name, function] : functions)
+                        {
+                            function_keys.push_back(name);
+                        }
+                        std::sort(function_keys.begin(), function_keys.end());
+
+                        for (const std::string& name : function_keys)
+                        {
+                            function_gates.push_back(i);
+                            function_names.push_back(strings.add(name));
+                            for (const BooleanFunction::Node& node : functions.at(name).get_nodes())
+                            {
+                                node_types.push_back(node.type);
+                                node_sizes.push_back(node.size);
+                                if (node.is_constant())
+                                {
+                                    // constants occupy 'size' consecutive values
+                                    node_payloads.push_back((u32)constant_values.size());
+                                    for (const BooleanFunction::Value value : node.constant)
+                                    {
+                                        constant_values.push_back((u8)(i8)value);
+                                    }
+                                }
+                                else if (node.is_index())
+                                {
+                                    node_payloads.push_back(node.index);
+                                }
+                                else if (node.is_variable())
+                                {
+                                    node_payloads.push_back(strings.add(node.variable));
+                                }
+                                else
+                                {
+                                    node_payloads.push_back(0);
+                                }
+                            }
+                            csr.close_row(node_types.size());
+                        }
+                    }
+
+                    SectionWriter writer;
+                    writer.write_value<u64>(function_gates.size());
+                    writer.write_value<u64>(constant_values.size());
+                    writer.write_column(function_gates);
+                    writer.write_column(function_names);
+                    writer.write_column(csr.offsets);
+                    writer.write_column(node_types);
+                    writer.write_column(node_sizes);
+                    writer.write_column(node_payloads);
+                    writer.write_column(constant_values);
+                    sections.emplace_back(SectionId::functions, std::move(writer));
+                }
+
+                // the string table is complete only after all other sections have been assembled
+                {
+                    SectionWriter writer;
+                    strings.write(writer);
+                    sections.emplace_back(SectionId::strings, std::move(writer));
+                }
+
+                // assemble the file: header, section table, and aligned sections
+                std::vector<SectionEntry> table;
+                u64 offset = sizeof(FileHeader) + sections.size() * sizeof(SectionEntry);
+                for (const auto& [id, writer] : sections)
+                {
+                    offset = (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+                    table.push_back({(u32)id, 0, offset, writer.get_data().size()});
+                    offset += writer.get_data().size();
+                }
+
+                FileHeader header;
+                std::memcpy(header.magic, FORMAT_MAGIC, sizeof(FORMAT_MAGIC));
+                header.version         = FORMAT_VERSION;
+                header.byte_order_mark = BYTE_ORDER_MARK;
+                header.num_sections    = (u32)sections.size();
+                header.reserved        = 0;
+
+                std::string res;
+                res.reserve(offset);
+                res.append(reinterpret_cast<const char*>(&header), sizeof(header));
+                res.append(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(SectionEntry));
+                for (u32 i = 0; i < sections.size(); i++)
+                {
+                    res.resize(table[i].offset, '\0');
+                    res.append(sections[i].second.get_data());
+                }
+                return res;
+            }
+
+            // ===== reading =====
+
+            template<typename T>
+            struct Column
+            {
+                const T* data = nullptr;
+                u64 size      = 0;
+
+                const T& operator[](u64 index) const
+                {
+                    return data[index];
+                }
+            };
+
+            class SectionReader
+            {
+            public:
+                SectionReader(std::string_view data) : m_data(data)
+                {
+                }
+
+                template<typename T>
+                T read_value()
+                {
+                    const Column<T> column = read_column<T>(1);
+                    return m_failed ? T() : column[0];
+                }
+
+                // columns are not copied but point directly into the (mapped) file
+                template<typename T>
+                Column<T> read_column(u64 size)
+                {
+                    align(alignof(T));
+                    if (m_failed || size > (m_data.size() - m_pos) / sizeof(T))
+                    {
+                        m_failed = true;
+                        return {};
+                    }
+
+                    Column<T> column;
+                    column.data = reinterpret_cast<const T*>(m_data.data() + m_pos);
+                    column.size = size;
+                    if (reinterpret_cast<std::uintptr_t>(column.data) % alignof(T) != 0)
+                    {
+                        m_failed = true;
+                        return {};
+                    }
+                    m_pos += size * sizeof(T);
+                    return column;
+                }
+
+                std::string_view read_remaining()
+                {
+                    std::string_view res = m_data.substr(m_pos);
+                    m_pos                = m_data.size();
+                    return res;
+                }
+
+                bool failed() const
+                {
+                    return m_failed;
+                }
+
+            private:
+                void align(u64 alignment)
+                {
+                    const u64 pos = (m_pos + alignment - 1) / alignment * alignment;
+                    if (pos > m_data.size())
+                    {
+                        m_failed = true;
+                        return;
+                    }
+                    m_pos = pos;
+                }
+
+                std::string_view m_data;
+                u64 m_pos     = 0;
+                bool m_failed = false;
+            };
+
+            class StringView
+            {
+            public:
+                Result<std::monostate> init(std::string_view section)
+                {
+                    SectionReader reader(section);
+                    const u64 size = reader.read_value<u64>();
+                    if (reader.failed() || size >= INVALID_INDEX)
+                    {
+                        return ERR("invalid string table");
+                    }
+                    m_offsets = reader.read_column<u64>(size + 1);
+                    m_chars   = reader.read_remaining();
+                    if (reader.failed() || m_offsets[0] != 0)
+                    {
+                        return ERR("invalid string table");
+                    }
+                    for (u64 i = 0; i < size; i++)
+                    {
+                        if (m_offsets[i] > m_offsets[i + 1] || m_offsets[i + 1] > m_chars.size())
+                        {
+                            return ERR("invalid string table");
+                        }
+                    }
+                    return OK({});
+                }
+
+                bool contains(u32 index) const
+                {
+                    return index + 1 < m_offsets.size;
+                }
+
+                // the caller has to make sure that the index is valid
+                std::string_view get(u32 index) const
+                {
+                    return m_chars.substr(m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+                }
+
+                u64 size() const
+                {
+                    return m_offsets.size - 1;
+                }
+
+            private:
+                Column<u64> m_offsets;
+                std::string_view m_chars;
+            };
+
+            template<typename T>
+            bool all_below(const Column<T>& column, u64 bound)
+            {
+                return std::all_of(column.data, column.data + column.size, [bound](T value) { return (u64)value < bound; });
+            }
+
+            bool is_valid_csr(const Column<u64>& offsets, u64 num_values)
+            {
+                if (offsets.size == 0 || offsets[0] != 0 || offsets[offsets.size - 1] != num_values)
+                {
+                    return false;
+                }
+                for (u64 i = 1; i < offsets.size; i++)
+                {
+                    if (offsets[i - 1] > offsets[i])
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            struct DataColumns
+            {
+                Column<u32> categories;
+                Column<u32> keys;
+                Column<u32> data_types;
+                Column<u32> values;
+
+                bool is_valid(u64 begin, u64 end, const StringView& strings) const
+                {
+                    for (u64 i = begin; i < end; i++)
+                    {
+                        if (!strings.contains(categories[i]) || !strings.contains(keys[i]) || !strings.contains(data_types[i]) || !strings.contains(values[i]))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            };
+
+            struct FunctionColumns
+            {
+                Column<u32> names;
+                Column<u64> offsets;
+                Column<u16> node_types;
+                Column<u16> node_sizes;
+                Column<u32> node_payloads;
+                Column<u8> constant_values;
+
+                // the caller has to make sure that the index is valid
+                Result<BooleanFunction> decode(u64 index, const StringView& strings) const
+                {
+                    std::vector<BooleanFunction::Node> nodes;
+                    nodes.reserve(offsets[index + 1] - offsets[index]);
+                    for (u64 j = offsets[index]; j < offsets[index + 1]; j++)
+                    {
+                        const u16 type = node_types[j];
+                        const u16 size = node_sizes[j];
+                        const u32 data = node_payloads[j];
+                        if (type == BooleanFunction::NodeType::Constant)
+                        {
+                            if ((u64)data + size > constant_values.size)
+                            {
+                                return ERR("invalid function section: constant exceeds section");
+                            }
+                            std::vector<BooleanFunction::Value> values(size);
+                            for (u16 k = 0; k < size; k++)
+                            {
+                                values[k] = (BooleanFunction::Value)(i8)constant_values[data + k];
+                            }
+                            nodes.push_back(BooleanFunction::Node::Constant(values));
+                        }
+                        else if (type == BooleanFunction::NodeType::Index)
+                        {
+                            nodes.push_back(BooleanFunction::Node::Index((u16)data, size));
+                        }
+                        else if (type == BooleanFunction::NodeType::Variable)
+                        {
+                            if (!strings.contains(data))
+                            {
+                                return ERR("invalid function section: unknown variable name");
+                            }
+                            nodes.push_back(BooleanFunction::Node::Variable(std::string(strings.get(data)), size));
+                        }
+                        else
+                        {
+                            nodes.push_back(BooleanFunction::Node::Operation(type, size));
+                        }
+                    }
+                    return BooleanFunction::build(std::move(nodes));
+                }
+            };
+
+            /**
+             * Decodes data entries and custom Boolean functions of lazily deserialized objects directly from the columns of the mapped file.<br>
+             * Offsets and sizes refer to rows of the data section and the function section, respectively.
+             */
+            class BinaryLazyDataSource : public LazyDataSource
+            {
+            public:
+                BinaryLazyDataSource(std::shared_ptr<const MemoryMappedFile> file, const StringView& strings) : m_file(std::move(file)), m_strings(strings)
+                {
+                }
+
+                Result<std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>> decode_data(u64 offset, u64 size) const override
+                {
+                    if (offset > data.categories.size || size > data.categories.size - offset || !data.is_valid(offset, offset + size, m_strings))
+                    {
+                        return ERR("invalid data section");
+                    }
+
+                    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> res;
+                    for (u64 i = offset; i < offset + size; i++)
+                    {
+                        res[std::make_tuple(get_string(data.categories[i]), get_string(data.keys[i]))] = std::make_tuple(get_string(data.data_types[i]), get_string(data.values[i]));
+                    }
+                    return OK(res);
+                }
+
+                Result<std::unordered_map<std::string, BooleanFunction>> decode_functions(u64 offset, u64 size) const override
+                {
+                    if (offset > functions.names.size || size > functions.names.size - offset)
+                    {
+                        return ERR("invalid function section");
+                    }
+
+                    std::unordered_map<std::string, BooleanFunction> res;
+                    for (u64 i = offset; i < offset + size; i++)
+                    {
+                        if (!m_strings.contains(functions.names[i]))
+                        {
+                            return ERR("invalid function section: unknown function name");
+                        }
+                        auto function = functions.decode(i, m_strings);
+                        if (function.is_error())
+                        {
+                            return ERR_APPEND(function.get_error(), "failed to build Boolean function '" + get_string(functions.names[i]) + "'");
+                        }
+                        res[get_string(functions.names[i])] = function.get();
+                    }
+                    return OK(res);
+                }
+
+                DataColumns data;
+                FunctionColumns functions;
+
+            private:
+                std::string get_string(u32 index) const
+                {
+                    return std::string(m_strings.get(index));
+                }
+
+                // keeps the columns alive
+                std::shared_ptr<const MemoryMappedFile> m_file;
+                StringView m_strings;
+            };
+
+            GateLibrary* load_gate_library(const std::string& gate_library_path)
+            {
+                std::filesystem::path glib_path(gate_library_path);
+                GateLibrary* glib = gate_library_manager::get_gate_library(glib_path.string());
+                if (glib != nullptr)
+                {
+                    return glib;
+                }
+
+                // fall back to the same gate library in another format
+                glib_path.replace_extension((glib_path.extension() == ".hgl") ? ".lib" : ".hgl");
+                glib = gate_library_manager::get_gate_library(glib_path.string());
+                if (glib != nullptr)
+                {
+                    log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", gate_library_path, glib_path.string());
+                }
+                return glib;
+            }
+
+            // if a file is given, data entries and custom Boolean functions are decoded from it on first access
+            Result<std::unique_ptr<Netlist>> deserialize(std::string_view data, const GateLibrary* gate_library = nullptr, std::shared_ptr<const MemoryMappedFile> lazy_file = nullptr)
+            {
+                if (!is_binary_hal(data) || data.size() < sizeof(FileHeader))
+                {
+                    return ERR("not a binary .hal file");
+                }
+
+                FileHeader header;
+                std::memcpy(&header, data.data(), sizeof(FileHeader));
+                if (header.version != FORMAT_VERSION)
+                {
+                    return ERR("unsupported binary .hal format version " + std::to_string(header.version) + ", expected version " + std::to_string(FORMAT_VERSION));
+                }
+                if (header.byte_order_mark != BYTE_ORDER_MARK)
+                {
+                    return ERR("binary .hal file has been written on a platform with different byte order");
+                }
+                if (header.num_sections > (data.size() - sizeof(FileHeader)) / sizeof(SectionEntry))
+                {
+                    return ERR("truncated section table");
+                }
+
+                std::unordered_map<u32, std::string_view> section_data;
+                for (u32 i = 0; i < header.num_sections; i++)
+                {
+                    SectionEntry entry;
+                    std::memcpy(&entry, data.data() + sizeof(FileHeader) + i * sizeof(SectionEntry), sizeof(SectionEntry));
+                    if (entry.offset % SECTION_ALIGNMENT != 0 || entry.offset > data.size() || entry.size > data.size() - entry.offset)
+                    {
+                        return ERR("section " + std::to_string(entry.id) + " exceeds the file");
+                    }
+                    section_data[entry.id] = data.substr(entry.offset, entry.size);
+                }
+
+                // unknown sections are skipped, all known sections are required
+                std::unordered_map<SectionId, SectionReader> readers;
+                for (const SectionId id : {SectionId::strings,
+                                           SectionId::netlist,
+                                           SectionId::gates,
+                                           SectionId::nets,
+                                           SectionId::sources,
+                                           SectionId::destinations,
+                                           SectionId::globals,
+                                           SectionId::modules,
+                                           SectionId::pin_groups,
+                                           SectionId::data,
+                                           SectionId::functions})
+                {
+                    const auto it = section_data.find((u32)id);
+                    if (it == section_data.end())
+                    {
+                        return ERR("missing section " + std::to_string((u32)id));
+                    }
+                    readers.emplace(id, SectionReader(it->second));
+                }
+
+                StringView strings;
+                if (auto res = strings.init(section_data.at((u32)SectionId::strings)); res.is_error())
+                {
+                    return ERR(res.get_error());
+                }
+                const auto get_string = [&strings](u32 index) { return std::string(strings.get(index)); };
+
+                // netlist information
+                SectionReader& netlist_reader = readers.at(SectionId::netlist);
+                const u32 netlist_id          = netlist_reader.read_value<u32>();
+                const Column<u32> info        = netlist_reader.read_column<u32>(4);
+                if (netlist_reader.failed() || !all_below(info, strings.size()))
+                {
+                    return ERR("invalid netlist section");
+                }
+
+                const GateLibrary* glib = (gate_library != nullptr) ? gate_library : load_gate_library(get_string(info[0]));
+                if (glib == nullptr)
+                {
+                    return ERR("failed to load gate library '" + get_string(info[0]) + "'");
+                }
+
+                auto nl = std::make_unique<Netlist>(glib);
+
+                // disable automatically checking module nets
+                nl->enable_automatic_net_checks(false);
+
+                nl->set_id(netlist_id);
+                nl->set_input_filename(get_string(info[1]));
+                nl->set_design_name(get_string(info[2]));
+                nl->set_device_name(get_string(info[3]));
+
+                // every section starts with its object count, peek at them to pre-size the containers of the netlist
+                {
+                    SectionReader gates_reader   = readers.at(SectionId::gates);
+                    SectionReader nets_reader    = readers.at(SectionId::nets);
+                    SectionReader modules_reader = readers.at(SectionId::modules);
+                    nl->reserve(gates_reader.read_value<u64>(), nets_reader.read_value<u64>(), modules_reader.read_value<u64>());
+                }
+
+                // gates
+                std::vector<Gate*> gates;
+                {
+                    SectionReader& reader        = readers.at(SectionId::gates);
+                    const u64 num_gates          = reader.read_value<u64>();
+                    const Column<u32> ids        = reader.read_column<u32>(num_gates);
+                    const Column<u32> names      = reader.read_column<u32>(num_gates);
+                    const Column<u32> types      = reader.read_column<u32>(num_gates);
+                    const Column<i32> xs         = reader.read_column<i32>(num_gates);
+                    const Column<i32> ys         = reader.read_column<i32>(num_gates);
+                    if (reader.failed() || !all_below(names, strings.size()) || !all_below(types, strings.size()))
+                    {
+                        return ERR("invalid gate section");
+                    }
+
+                    // gate types are resolved only once per distinct type name
+                    const auto& gate_types = glib->get_gate_types();
+                    std::unordered_map<u32, GateType*> type_cache;
+
+                    gates.reserve(num_gates);
+                    for (u64 i = 0; i < num_gates; i++)
+                    {
+                        auto type_it = type_cache.find(types[i]);
+                        if (type_it == type_cache.end())
+                        {
+                            const auto gt_it = gate_types.find(get_string(types[i]));
+                            if (gt_it == gate_types.end())
+                            {
+                                return ERR("could not deserialize gate '" + get_string(names[i]) + "' with ID " + std::to_string(ids[i]) + ": failed to find gate type '" + get_string(types[i])
+                                           + "' in gate library '" + glib->get_name() + "'");
+                            }
+                            type_it = type_cache.emplace(types[i], gt_it->second).first;
+                        }
+
+                        Gate* gate = nl->create_gate(ids[i], type_it->second, get_string(names[i]), xs[i], ys[i]);
+                        if (gate == nullptr)
+                        {
+                            return ERR("could not deserialize gate '" + get_string(names[i]) + "' with ID " + std::to_string(ids[i]) + ": failed to create gate");
+                        }
+                        gates.push_back(gate);
+                    }
+                }
+
+                // nets
+                std::vector<Net*> nets;
+                {
+                    SectionReader& reader   = readers.at(SectionId::nets);
+                    const u64 num_nets      = reader.read_value<u64>();
+                    const Column<u32> ids   = reader.read_column<u32>(num_nets);
+                    const Column<u32> names = reader.read_column<u32>(num_nets);
+                    if (reader.failed() || !all_below(names, strings.size()))
+                    {
+                        return ERR("invalid net section");
+                    }
+
+                    nets.reserve(num_nets);
+                    for (u64 i = 0; i < num_nets; i++)
+                    {
+                        Net* net = nl->create_net(ids[i], get_string(names[i]));
+                        if (net == nullptr)
+                        {
+                            return ERR("could not deserialize net '" + get_string(names[i]) + "' with ID " + std::to_string(ids[i]) + ": failed to create net");
+                        }
+                        nets.push_back(net);
+                    }
+                }
+
+                // net endpoints
+                for (const bool sources : {true, false})
+                {
+                    SectionReader& reader              = readers.at(sources ? SectionId::sources : SectionId::destinations);
+                    const Column<u64> offsets          = reader.read_column<u64>(nets.size() + 1);
+                    const u64 num_endpoints            = reader.failed() ? 0 : offsets[nets.size()];
+                    const Column<u32> endpoint_gates   = reader.read_column<u32>(num_endpoints);
+                    const Column<u32> endpoint_pins    = reader.read_column<u32>(num_endpoints);
+                    const std::string endpoint_kind    = sources ? "source" : "destination";
+                    if (reader.failed() || !is_valid_csr(offsets, num_endpoints) || !all_below(endpoint_gates, gates.size()))
+                    {
+                        return ERR("invalid " + endpoint_kind + " section");
+                    }
+
+                    for (u64 i = 0; i < nets.size(); i++)
+                    {
+                        Net* net = nets[i];
+                        for (u64 j = offsets[i]; j < offsets[i + 1]; j++)
+                        {
+                            Gate* gate   = gates[endpoint_gates[j]];
+                            GatePin* pin = gate->get_type()->get_pin_by_id(endpoint_pins[j]);
+                            if (pin == nullptr)
+                            {
+                                return ERR("could not deserialize " + endpoint_kind + " of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get pin with ID "
+                                           + std::to_string(endpoint_pins[j]));
+                            }
+
+                            if (sources ? (net->add_source(gate, pin) == nullptr) : (net->add_destination(gate, pin) == nullptr))
+                            {
+                                return ERR("could not deserialize " + endpoint_kind + " of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add pin '"
+                                           + pin->get_name() + "' of gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()));
+                            }
+                        }
+                    }
+                }
+
+                // global gates and nets
+                {
+                    SectionReader& reader          = readers.at(SectionId::globals);
+                    const Column<u64> sizes        = reader.read_column<u64>(4);
+                    const Column<u32> gnd_gates    = reader.read_column<u32>(reader.failed() ? 0 : sizes[0]);
+                    const Column<u32> vcc_gates    = reader.read_column<u32>(reader.failed() ? 0 : sizes[1]);
+                    const Column<u32> input_nets   = reader.read_column<u32>(reader.failed() ? 0 : sizes[2]);
+                    const Column<u32> output_nets  = reader.read_column<u32>(reader.failed() ? 0 : sizes[3]);
+                    if (reader.failed() || !all_below(gnd_gates, gates.size()) || !all_below(vcc_gates, gates.size()) || !all_below(input_nets, nets.size())
+                        || !all_below(output_nets, nets.size()))
+                    {
+                        return ERR("invalid globals section");
+                    }
+
+                    for (u64 i = 0; i < gnd_gates.size; i++)
+                    {
+                        if (!nl->mark_gnd_gate(gates[gnd_gates[i]]))
+                        {
+                            return ERR("failed to mark GND gate");
+                        }
+                    }
+                    for (u64 i = 0; i < vcc_gates.size; i++)
+                    {
+                        if (!nl->mark_vcc_gate(gates[vcc_gates[i]]))
+                        {
+                            return ERR("failed to mark VCC gate");
+                        }
+                    }
+                    for (u64 i = 0; i < input_nets.size; i++)
+                    {
+                        if (!nl->mark_global_input_net(nets[input_nets[i]]))
+                        {
+                            return ERR("failed to mark global input net");
+                        }
+                    }
+                    for (u64 i = 0; i < output_nets.size; i++)
+                    {
+                        if (!nl->mark_global_output_net(nets[output_nets[i]]))
+                        {
+                            return ERR("failed to mark global output net");
+                        }
+                    }
+                }
+
+                // modules
+                std::vector<Module*> modules;
+                {
+                    SectionReader& reader          = readers.at(SectionId::modules);
+                    const u64 num_modules          = reader.read_value<u64>();
+                    const Column<u32> ids          = reader.read_column<u32>(num_modules);
+                    const Column<u32> names        = reader.read_column<u32>(num_modules);
+                    const Column<u32> types        = reader.read_column<u32>(num_modules);
+                    const Column<u32> parents      = reader.read_column<u32>(num_modules);
+                    const Column<u64> offsets      = reader.read_column<u64>(num_modules + 1);
+                    const u64 num_module_gates     = reader.failed() ? 0 : offsets[num_modules];
+                    const Column<u32> module_gates = reader.read_column<u32>(num_module_gates);
+                    if (reader.failed() || num_modules == 0 || parents[0] != INVALID_INDEX || !all_below(names, strings.size()) || !all_below(types, strings.size())
+                        || !is_valid_csr(offsets, num_module_gates) || !all_below(module_gates, gates.size()))
+                    {
+                        return ERR("invalid module section");
+                    }
+
+                    modules.reserve(num_modules);
+                    for (u64 i = 0; i < num_modules; i++)
+                    {
+                        Module* module;
+                        if (i == 0)
+                        {
+                            // top module must not be created but might be renamed
+                            module = nl->get_top_module();
+                            if (const std::string top_module_name = get_string(names[0]); top_module_name != module->get_name())
+                            {
+                                module->set_name(top_module_name);
+                            }
+                        }
+                        else
+                        {
+                            if (parents[i] >= i)
+                            {
+                                return ERR("could not deserialize module '" + get_string(names[i]) + "' with ID " + std::to_string(ids[i]) + ": parent module has not been deserialized yet");
+                            }
+                            module = nl->create_module(ids[i], get_string(names[i]), modules[parents[i]]);
+                            if (module == nullptr)
+                            {
+                                return ERR("could not deserialize module '" + get_string(names[i]) + "' with ID " + std::to_string(ids[i]) + ": failed to create module");
+                            }
+
+                            std::vector<Gate*> assigned_gates;
+                            assigned_gates.reserve(offsets[i + 1] - offsets[i]);
+                            for (u64 j = offsets[i]; j < offsets[i + 1]; j++)
+                            {
+                                assigned_gates.push_back(gates[module_gates[j]]);
+                            }
+                            module->assign_gates(assigned_gates);
+                        }
+                        module->set_type(get_string(types[i]));
+                        modules.push_back(module);
+                    }
+                }
+
+                // update module nets, internal nets, input nets, and output nets
+                nl->update_module_nets();
+
+                // module pins (nets must have been updated beforehand)
+                {
+                    SectionReader& reader                = readers.at(SectionId::pin_groups);
+                    const u64 num_groups                 = reader.read_value<u64>();
+                    const Column<u32> group_modules      = reader.read_column<u32>(num_groups);
+                    const Column<u32> group_ids          = reader.read_column<u32>(num_groups);
+                    const Column<u32> group_names        = reader.read_column<u32>(num_groups);
+                    const Column<u32> group_start_indices = reader.read_column<u32>(num_groups);
+                    const Column<u8> group_directions    = reader.read_column<u8>(num_groups);
+                    const Column<u8> group_types         = reader.read_column<u8>(num_groups);
+                    const Column<u8> group_ascending     = reader.read_column<u8>(num_groups);
+                    const Column<u64> offsets            = reader.read_column<u64>(num_groups + 1);
+                    const u64 num_pins                   = reader.failed() ? 0 : offsets[num_groups];
+                    const Column<u32> pin_ids            = reader.read_column<u32>(num_pins);
+                    const Column<u32> pin_names          = reader.read_column<u32>(num_pins);
+                    const Column<u32> pin_nets           = reader.read_column<u32>(num_pins);
+                    const Column<u8> pin_types           = reader.read_column<u8>(num_pins);
+                    if (reader.failed() || !all_below(group_modules, modules.size()) || !all_below(group_names, strings.size()) || !is_valid_csr(offsets, num_pins)
+                        || !all_below(pin_names, strings.size()) || !all_below(pin_nets, nets.size()))
+                    {
+                        return ERR("invalid pin group section");
+                    }
+
+                    for (u64 i = 0; i < num_groups; i++)
+                    {
+                        Module* module = modules[group_modules[i]];
+
+                        std::vector<ModulePin*> pins;
+                        for (u64 j = offsets[i]; j < offsets[i + 1]; j++)
+                        {
+                            const u32 pin_id = (pin_ids[j] > 0) ? pin_ids[j] : module->get_unique_pin_id();
+                            if (auto res = module->create_pin(pin_id, get_string(pin_names[j]), nets[pin_nets[j]], (PinType)pin_types[j], false); res.is_error())
+                            {
+                                return ERR_APPEND(res.get_error(),
+                                                  "could not deserialize pin '" + get_string(pin_names[j]) + "' of module '" + module->get_name() + "' with ID " + std::to_string(module->get_id())
+                                                      + ": failed to create pin");
+                            }
+                            else
+                            {
+                                pins.push_back(res.get());
+                            }
+                        }
+
+                        const u32 group_id = (group_ids[i] > 0) ? group_ids[i] : module->get_unique_pin_group_id();
+                        if (auto res = module->create_pin_group(
+                                group_id, get_string(group_names[i]), pins, (PinDirection)group_directions[i], (PinType)group_types[i], group_ascending[i] != 0, group_start_indices[i]);
+                            res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(),
+                                              "could not deserialize pin group '" + get_string(group_names[i]) + "' of module '" + module->get_name() + "' with ID "
+                                                  + std::to_string(module->get_id()) + ": failed to create pin group");
+                        }
+                    }
+                }
+
+                std::shared_ptr<BinaryLazyDataSource> lazy_source;
+                if (lazy_file != nullptr)
+                {
+                    lazy_source = std::make_shared<BinaryLazyDataSource>(std::move(lazy_file), strings);
+                }
+
+                // data entries, entries of the same object are stored consecutively
+                {
+                    SectionReader& reader        = readers.at(SectionId::data);
+                    const u64 num_entries        = reader.read_value<u64>();
+                    const Column<u8> owner_types = reader.read_column<u8>(num_entries);
+                    const Column<u32> owners     = reader.read_column<u32>(num_entries);
+                    DataColumns columns;
+                    columns.categories = reader.read_column<u32>(num_entries);
+                    columns.keys       = reader.read_column<u32>(num_entries);
+                    columns.data_types = reader.read_column<u32>(num_entries);
+                    columns.values     = reader.read_column<u32>(num_entries);
+                    if (reader.failed())
+                    {
+                        return ERR("invalid data section");
+                    }
+
+                    if (lazy_source != nullptr)
+                    {
+                        lazy_source->data = columns;
+                    }
+
+                    std::unordered_set<const DataContainer*> lazy_containers;
+                    for (u64 begin = 0; begin < num_entries;)
+                    {
+                        u64 end = begin + 1;
+                        while (end < num_entries && owner_types[end] == owner_types[begin] && owners[end] == owners[begin])
+                        {
+                            end++;
+                        }
+
+                        DataContainer* container = nullptr;
+                        switch ((DataOwner)owner_types[begin])
+                        {
+                            case DataOwner::gate:
+                                container = (owners[begin] < gates.size()) ? gates[owners[begin]] : nullptr;
+                                break;
+                            case DataOwner::net:
+                                container = (owners[begin] < nets.size()) ? nets[owners[begin]] : nullptr;
+                                break;
+                            case DataOwner::module:
+                                container = (owners[begin] < modules.size()) ? modules[owners[begin]] : nullptr;
+                                break;
+                        }
+                        if (container == nullptr)
+                        {
+                            return ERR("invalid data section: unknown owner of data entry");
+                        }
+
+                        // objects whose entries are split across several runs are decoded right away
+                        if (lazy_source != nullptr && lazy_containers.insert(container).second)
+                        {
+                            container->set_lazy_data(lazy_source, begin, end - begin);
+                        }
+                        else
+                        {
+                            if (!columns.is_valid(begin, end, strings))
+                            {
+                                return ERR("invalid data section");
+                            }
+                            for (u64 i = begin; i < end; i++)
+                            {
+                                container->set_data(get_string(columns.categories[i]), get_string(columns.keys[i]), get_string(columns.data_types[i]), get_string(columns.values[i]));
+                            }
+                        }
+                        begin = end;
+                    }
+                }
+
+                // custom Boolean functions, functions of the same gate are stored consecutively
+                {
+                    SectionReader& reader            = readers.at(SectionId::functions);
+                    const u64 num_functions          = reader.read_value<u64>();
+                    const u64 num_constant_values    = reader.read_value<u64>();
+                    const Column<u32> function_gates = reader.read_column<u32>(num_functions);
+                    FunctionColumns columns;
+                    columns.names                    = reader.read_column<u32>(num_functions);
+                    columns.offsets                  = reader.read_column<u64>(num_functions + 1);
+                    const u64 num_nodes              = reader.failed() ? 0 : columns.offsets[num_functions];
+                    columns.node_types               = reader.read_column<u16>(num_nodes);
+                    columns.node_sizes               = reader.read_column<u16>(num_nodes);
+                    columns.node_payloads            = reader.read_column<u32>(num_nodes);
+                    columns.constant_values          = reader.read_column<u8>(num_constant_values);
+                    if (reader.failed() || !all_below(function_gates, gates.size()) || !is_valid_csr(columns.offsets, num_nodes))
+                    {
+                        return ERR("invalid function section");
+                    }
+
+                    if (lazy_source != nullptr)
+                    {
+                        lazy_source->functions = columns;
+                    }
+
+                    std::unordered_set<const Gate*> lazy_gates;
+                    for (u64 begin = 0; begin < num_functions;)
+                    {
+                        u64 end = begin + 1;
+                        while (end < num_functions && function_gates[end] == function_gates[begin])
+                        {
+                            end++;
+                        }
+
+                        Gate* gate = gates[function_gates[begin]];
+                        if (lazy_source != nullptr && lazy_gates.insert(gate).second)
+                        {
+                            gate->set_lazy_boolean_functions(lazy_source, begin, end - begin);
+                            begin = end;
+                            continue;
+                        }
+
+                        for (u64 i = begin; i < end; i++)
+                        {
+                            if (!strings.contains(columns.names[i]))
+                            {
+                                return ERR("invalid function section");
+                            }
+
+                            auto function = columns.decode(i, strings);
+                            if (function.is_error())
+                            {
+                                return ERR_APPEND(function.get_error(),
+                                                  "could not deserialize gate '" + gate->get_name() + "' with ID " + std::to_string(gate->get_id()) + ": failed to build Boolean function '"
+                                                      + get_string(columns.names[i]) + "'");
+                            }
+                            gate->add_boolean_function(get_string(columns.names[i]), function.get());
+                        }
+                        begin = end;
+                    }
+                }
+
+                // re-enable automatically checking module nets
+                nl->enable_automatic_net_checks(true);
+
+                return OK(std::move(nl));
+            }
+        }    // namespace
+
+        bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file, CompressionFormat compression_format)
+        {
+            if (nl == nullptr)
+            {
+                return false;
+            }
+
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            // create directory if it got erased in the meantime
+            std::filesystem::path serialize_to_dir = hal_file.parent_path();
+            if (serialize_to_dir.empty())
+                return false;
+            if (!std::filesystem::exists(serialize_to_dir))
+            {
+                if (!std::filesystem::create_directory(serialize_to_dir))
+                    return false;
+            }
+
+            const std::string data = serialize(nl);
+
+            // the target is only replaced once the new file is complete, since lazily loaded entries may still refer to it
+            std::filesystem::path tmp_file = hal_file;
+            tmp_file += ".tmp";
+            if (auto res = compression::write_file(tmp_file, data, compression_format); res.is_error())
+            {
+                log_error("netlist_persistent",
+                          "could not open or create file {}: please verify that the file and the containing directory is writable\n{}",
+                          tmp_file.string(),
+                          res.get_error().get());
+                std::filesystem::remove(tmp_file);
+                return false;
+            }
+
+            utils::sync_file(tmp_file);
+
+            std::error_code ec;
+            std::filesystem::rename(tmp_file, hal_file, ec);
+            if (ec)
+            {
+                log_error("netlist_persistent", "could not replace file {}: {}", hal_file.string(), ec.message());
+                std::filesystem::remove(tmp_file);
+                return false;
+            }
+
+            log_info("netlist_persistent", "serialized netlist into binary format in {:2.2f} seconds", DURATION(begin_time));
+
+            return true;
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, bool lazy, const GateLibrary* gate_library)
+        {
+            auto file = MemoryMappedFile::open(hal_file);
+            if (file.is_error())
+            {
+                log_error("netlist_persistent", "unable to open '{}':\n{}", hal_file.string(), file.get_error().get());
+                return nullptr;
+            }
+
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            auto netlist = deserialize_from_mapped_file(std::move(file.get()), lazy, gate_library);
+            if (netlist)
+            {
+                log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", hal_file.string(), DURATION(begin_time));
+            }
+            return netlist;
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_mapped_file(std::shared_ptr<const MemoryMappedFile> file, bool lazy, const GateLibrary* gate_library)
+        {
+            if (file == nullptr)
+            {
+                return nullptr;
+            }
+
+            const std::string_view data = file->get_data();
+            auto res                    = deserialize(data, gate_library, lazy ? std::move(file) : nullptr);
+            if (res.is_error())
+            {
+                log_error("netlist_persistent", "could not deserialize netlist from binary .hal file:\n{}", res.get_error().get());
+                return nullptr;
+            }
+            return res.get();
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_buffer(std::string_view data)
+        {
+            auto res = deserialize(data);
+            if (res.is_error())
+            {
+                log_error("netlist_persistent", "could not deserialize netlist from binary .hal file:\n{}", res.get_error().get());
+                return nullptr;
+            }
+            return res.get();
+        }
+
+        bool is_binary_hal(std::string_view data)
+        {
+            return data.size() >= sizeof(FORMAT_MAGIC) && std::memcmp(data.data(), FORMAT_MAGIC, sizeof(FORMAT_MAGIC)) == 0;
+        }
+
+        bool convert_file(const std::filesystem::path& source_file, const std::filesystem::path& destination_file)
+        {
+            auto file = MemoryMappedFile::open(source_file);
+            if (file.is_error())
+            {
+                log_error("netlist_persistent", "unable to open '{}':\n{}", source_file.string(), file.get_error().get());
+                return false;
+            }
+
+            if (is_binary_hal(file.get()->get_data()))
+            {
+                auto netlist = deserialize_from_buffer(file.get()->get_data());
+                file.get().reset();
+                if (netlist == nullptr)
+                {
+                    return false;
+                }
+                log_info("netlist_persistent", "converting binary .hal file '{}' into JSON .hal file '{}'...", source_file.string(), destination_file.string());
+                return netlist_serializer::serialize_to_file(netlist.get(), destination_file);
+            }
+
+            file.get().reset();
+            auto netlist = netlist_serializer::deserialize_from_file(source_file);
+            if (netlist == nullptr)
+            {
+                return false;
+            }
+            log_info("netlist_persistent", "converting JSON .hal file '{}' into binary .hal file '{}'...", source_file.string(), destination_file.string());
+            return serialize_to_file(netlist.get(), destination_file);
+        }
+    }    // namespace netlist_binary_serializer
+}    // namespace hal
+
+#undef DURATION
@@ -0,0 +1,276 @@
+#include "hal_core/netlist/persistent/netlist_journal.h"
+
+#include "hal_core/netlist/event_system/event_handler.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/utils.h"
+
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+namespace hal
+{
+    namespace
+    {
+        // serializes appending to and rewriting of journal files between the main thread and a running compaction
+        std::mutex journal_mutex;
+
+        bool read_journal(const std::filesystem::path& journal_file, std::string& content)
+        {
+            content.clear();
+            if (!std::filesystem::exists(journal_file))
+            {
+                return true;
+            }
+
+            std::ifstream ifs(journal_file, std::ios::binary);
+            if (!ifs.good())
+            {
+                log_error("netlist_persistent", "could not open journal file '{}'.", journal_file.string());
+                return false;
+            }
+            std::stringstream buffer;
+            buffer << ifs.rdbuf();
+            content = buffer.str();
+            return true;
+        }
+
+        // only records terminated by a newline are complete, anything behind the last newline stems from an interrupted append
+        std::vector<std::string_view> split_records(std::string_view content)
+        {
+            std::vector<std::string_view> records;
+            size_t begin = 0;
+            for (size_t end = content.find('\n'); end != std::string_view::npos; end = content.find('\n', begin))
+            {
+                if (end > begin)
+                {
+                    records.push_back(content.substr(begin, end - begin));
+                }
+                begin = end + 1;
+            }
+            return records;
+        }
+    }    // namespace
+
+    NetlistJournal::NetlistJournal(Netlist* netlist) : m_netlist(netlist)
+    {
+        m_callback_name = "netlist_journal_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+
+        // the token is owned by the registered callbacks only, hence it expires once the event handler of the netlist is destroyed
+        auto alive      = std::make_shared<bool>(true);
+        m_netlist_alive = alive;
+
+        EventHandler* event_handler = m_netlist->get_event_handler();
+        event_handler->register_callback(m_callback_name,
+                                         std::function<void(NetlistEvent::event, Netlist*, u32)>([this, alive](NetlistEvent::event, Netlist*, u32) { m_netlist_changed = true; }));
+        event_handler->register_callback(m_callback_name,
+                                         std::function<void(GateEvent::event, Gate*, u32)>([this, alive](GateEvent::event, Gate* gate, u32) { m_gate_ids.insert(gate->get_id()); }));
+        event_handler->register_callback(m_callback_name, std::function<void(NetEvent::event, Net*, u32)>([this, alive](NetEvent::event, Net* net, u32) { m_net_ids.insert(net->get_id()); }));
+        event_handler->register_callback(m_callback_name, std::function<void(ModuleEvent::event, Module*, u32)>([this, alive](ModuleEvent::event e, Module* module, u32 associated_data) {
+                                             switch (e)
+                                             {
+                                                 case ModuleEvent::event::gate_assigned:
+                                                 case ModuleEvent::event::gate_removed:
+                                                     // module membership is stored with the gate
+                                                     m_gate_ids.insert(associated_data);
+                                                     break;
+                                                 case ModuleEvent::event::submodule_added:
+                                                 case ModuleEvent::event::submodule_removed:
+                                                     // the parent is stored with the submodule
+                                                     m_module_ids.insert(associated_data);
+                                                     break;
+                                                 case ModuleEvent::event::gates_assign_begin:
+                                                 case ModuleEvent::event::gates_assign_end:
+                                                 case ModuleEvent::event::gates_remove_begin:
+                                                 case ModuleEvent::event::gates_remove_end:
+                                                     break;
+                                                 default:
+                                                     m_module_ids.insert(module->get_id());
+                                                     break;
+                                             }
+                                         }));
+    }
+
+    NetlistJournal::~NetlistJournal()
+    {
+        if (!m_netlist_alive.expired())
+        {
+            m_netlist->get_event_handler()->unregister_callback(m_callback_name);
+        }
+    }
+
+    Netlist* NetlistJournal::get_netlist() const
+    {
+        if (m_netlist_alive.expired())
+        {
+            return nullptr;
+        }
+        return m_netlist;
+    }
+
+    bool NetlistJournal::has_changes() const
+    {
+        return m_netlist_changed || !m_gate_ids.empty() || !m_net_ids.empty() || !m_module_ids.empty();
+    }
+
+    void NetlistJournal::clear()
+    {
+        m_netlist_changed = false;
+        m_gate_ids.clear();
+        m_net_ids.clear();
+        m_module_ids.clear();
+    }
+
+    bool NetlistJournal::append_delta(const std::filesystem::path& journal_file)
+    {
+        if (!has_changes())
+        {
+            return true;
+        }
+
+        return append_record(journal_file, take_delta());
+    }
+
+    std::string NetlistJournal::take_delta()
+    {
+        if (!has_changes() || m_netlist_alive.expired())
+        {
+            return std::string();
+        }
+
+        std::string record = netlist_serializer::serialize_delta(m_netlist, m_netlist_changed, m_gate_ids, m_net_ids, m_module_ids);
+        clear();
+        return record;
+    }
+
+    bool NetlistJournal::append_record(const std::filesystem::path& journal_file, const std::string& record)
+    {
+        if (record.empty())
+        {
+            log_error("netlist_persistent", "could not append empty record to journal file '{}'.", journal_file.string());
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(journal_mutex);
+        {
+            std::ofstream ofs(journal_file, std::ios::binary | std::ios::app);
+            if (!ofs.good())
+            {
+                log_error("netlist_persistent", "could not open journal file '{}' for writing.", journal_file.string());
+                return false;
+            }
+            ofs.write(record.data(), record.size());
+            ofs.put('\n');
+            if (!ofs.good())
+            {
+                log_error("netlist_persistent", "could not append record to journal file '{}'.", journal_file.string());
+                return false;
+            }
+        }
+
+        return utils::sync_file(journal_file);
+    }
+
+    bool NetlistJournal::replay(Netlist* netlist, const std::filesystem::path& journal_file)
+    {
+        std::string content;
+        {
+            std::lock_guard<std::mutex> lock(journal_mutex);
+            if (!read_journal(journal_file, content))
+            {
+                return false;
+            }
+        }
+
+        std::vector<std::string_view> records = split_records(content);
+        if (records.empty())
+        {
+            return true;
+        }
+
+        log_info("netlist_persistent", "replaying {} records of journal file '{}'...", records.size(), journal_file.string());
+        return netlist_serializer::deserialize_deltas(netlist, records);
+    }
+
+    bool NetlistJournal::compact(const std::filesystem::path& hal_file, const std::filesystem::path& journal_file, const GateLibrary* gate_library, bool binary_format, CompressionFormat compression_format)
+    {
+        std::string content;
+        {
+            std::lock_guard<std::mutex> lock(journal_mutex);
+            if (!read_journal(journal_file, content))
+            {
+                return false;
+            }
+        }
+
+        // records appended from here on are kept in the journal
+        const size_t compacted_size = content.rfind('\n') + 1;
+        if (compacted_size == 0)
+        {
+            return true;
+        }
+
+        std::unique_ptr<Netlist> netlist = netlist_serializer::deserialize_from_file(hal_file, false, gate_library);
+        if (netlist == nullptr)
+        {
+            log_error("netlist_persistent", "could not compact journal file '{}': failed to load snapshot '{}'.", journal_file.string(), hal_file.string());
+            return false;
+        }
+
+        if (!netlist_serializer::deserialize_deltas(netlist.get(), split_records(std::string_view(content).substr(0, compacted_size))))
+        {
+            log_error("netlist_persistent", "could not compact journal file '{}': failed to replay records.", journal_file.string());
+            return false;
+        }
+
+        std::filesystem::path tmp_file = hal_file;
+        tmp_file += ".compact";
+        const bool written = binary_format ? netlist_binary_serializer::serialize_to_file(netlist.get(), tmp_file, compression_format)
+                                           : netlist_serializer::serialize_to_file(netlist.get(), tmp_file, compression_format);
+        if (!written)
+        {
+            log_error("netlist_persistent", "could not compact journal file '{}': failed to write snapshot.", journal_file.string());
+            std::filesystem::remove(tmp_file);
+            return false;
+        }
+
+        utils::sync_file(tmp_file);
+
+        std::lock_guard<std::mutex> lock(journal_mutex);
+
+        std::string current;
+        if (!read_journal(journal_file, current) || current.size() < compacted_size || current.compare(0, compacted_size, content, 0, compacted_size) != 0)
+        {
+            // the journal has been replaced in the meantime, hence the new snapshot does not belong to it
+            log_warning("netlist_persistent", "discarding compaction of journal file '{}' since it has been modified.", journal_file.string());
+            std::filesystem::remove(tmp_file);
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tmp_file, hal_file, ec);
+        if (ec)
+        {
+            log_error("netlist_persistent", "could not replace snapshot '{}': {}", hal_file.string(), ec.message());
+            std::filesystem::remove(tmp_file);
+            return false;
+        }
+
+        std::ofstream ofs(journal_file, std::ios::binary | std::ios::trunc);
+        if (!ofs.good())
+        {
+            log_error("netlist_persistent", "could not rewrite journal file '{}'.", journal_file.string());
+            return false;
+        }
+        ofs.write(current.data() + compacted_size, current.size() - compacted_size);
+        return ofs.good();
+    }
+}    // namespace hal
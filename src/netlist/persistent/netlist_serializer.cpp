@@ -3,12 +3,21 @@
 #include "hal_core/netlist/boolean_function.h"
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/lazy_data_source.h"
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
 #include "hal_core/netlist/project_manager.h"
 #include "hal_core/utilities/log.h"
-#include "rapidjson/filereadstream.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+#include "hal_core/utilities/parallel_for_each.h"
+#include "hal_core/utilities/utils.h"
+#include "rapidjson/document.h"
+#include "rapidjson/encodedstream.h"
+#include "rapidjson/filewritestream.h"
+#include "rapidjson/memorystream.h"
+#include "rapidjson/reader.h"
 #include "rapidjson/stringbuffer.h"
 
 #define PRETTY_JSON_OUTPUT false
@@ -18,10 +27,14 @@
 #include "rapidjson/writer.h"
 #endif
 
+#include <array>
 #include <chrono>
-#include <fstream>
+#include <cstdio>
+#include <iterator>
+#include <optional>
 #include <queue>
-#include <sstream>
+#include <set>
+#include <unordered_map>
 
 #ifndef DURATION
 #define DURATION(begin_time) ((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000)
@@ -36,14 +49,19 @@ namespace hal
         {
             const int SERIALIZATION_FORMAT_VERSION = 11;
 
-#define JSON_STR_HELPER(x) rapidjson::Value{}.SetString(x.c_str(), x.length(), allocator)
+            // size of the buffer between the JSON writer and the output file
+            const u64 WRITE_BUFFER_SIZE = 1 << 16;
 
-#define assert_availablility(MEMBER)                                                               \
-    if (!root.HasMember(MEMBER))                                                                   \
-    {                                                                                              \
-        log_critical("netlist_persistent", "'netlist' node does not include a '{}' node", MEMBER); \
-        return nullptr;                                                                            \
-    }
+            // size of the buffer between the decompressor and the JSON reader
+            const u64 READ_BUFFER_SIZE = 1 << 16;
+
+#if PRETTY_JSON_OUTPUT
+            template<typename OutputStream>
+            using JsonWriter = rapidjson::PrettyWriter<OutputStream>;
+#else
+            template<typename OutputStream>
+            using JsonWriter = rapidjson::Writer<OutputStream>;
+#endif
 
             namespace
             {
@@ -51,8 +69,9 @@ namespace hal
                 {
                     struct PinInformation
                     {
-                        i32 id = -1;
-                        Net* net;
+                        i32 id    = -1;
+                        Net* net  = nullptr;
+                        u32 net_id = 0;
                         std::string name;
                         PinType type = PinType::none;
                     };
@@ -66,144 +85,430 @@ namespace hal
                     u32 start_index = 0;
                 };
 
+                struct FunctionInformation
+                {
+                    Gate* gate;
+                    std::string name;
+                    std::string function;
+                };
+
             }    // namespace
 
+            // all objects are written to the output stream one by one without building a document first
+            template<typename Writer>
+            void write_string(Writer& writer, const std::string& value)
+            {
+                writer.String(value.c_str(), static_cast<rapidjson::SizeType>(value.length()));
+            }
+
             // serialize container data
-            rapidjson::Value serialize(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& data, rapidjson::Document::AllocatorType& allocator)
+            template<typename Writer>
+            void serialize(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& data, Writer& writer)
             {
-                rapidjson::Value val(rapidjson::kArrayType);
+                if (data.empty())
+                {
+                    return;
+                }
+
+                writer.Key("data");
+                writer.StartArray();
                 for (const auto& it : data)
                 {
-                    rapidjson::Value entry(rapidjson::kArrayType);
-                    entry.PushBack(JSON_STR_HELPER(std::get<0>(it.first)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<1>(it.first)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<0>(it.second)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<1>(it.second)), allocator);
-                    val.PushBack(entry, allocator);
+                    writer.StartArray();
+                    write_string(writer, std::get<0>(it.first));
+                    write_string(writer, std::get<1>(it.first));
+                    write_string(writer, std::get<0>(it.second));
+                    write_string(writer, std::get<1>(it.second));
+                    writer.EndArray();
                 }
-                return val;
+                writer.EndArray();
             }
 
-            void deserialize_data(DataContainer* c, const rapidjson::Value& val)
+            // serialize endpoints
+            template<typename Writer>
+            void serialize(const char* key, std::vector<Endpoint*> endpoints, Writer& writer)
             {
-                for (const auto& entry : val.GetArray())
+                if (endpoints.empty())
                 {
-                    c->set_data(entry[0].GetString(), entry[1].GetString(), entry[2].GetString(), entry[3].GetString());
+                    return;
+                }
+
+                std::sort(endpoints.begin(), endpoints.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
+
+                writer.Key(key);
+                writer.StartArray();
+                for (const Endpoint* ep : endpoints)
+                {
+                    writer.StartObject();
+                    writer.Key("gate_id");
+                    writer.Uint(ep->get_gate()->get_id());
+                    writer.Key("pin_id");
+                    writer.Uint(ep->get_pin()->get_id());
+                    writer.EndObject();
+                }
+                writer.EndArray();
+            }
+
+            // serialize gate, delta records additionally store the module of the gate since they do not contain the gates of a module
+            template<typename Writer>
+            void serialize(const Gate* gate, Writer& writer, bool with_module = false)
+            {
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(gate->get_id());
+                writer.Key("name");
+                write_string(writer, gate->get_name());
+                writer.Key("type");
+                write_string(writer, gate->get_type()->get_name());
+                if (with_module)
+                {
+                    writer.Key("module");
+                    writer.Uint(gate->get_module()->get_id());
+                }
+                serialize(gate->get_data_map(), writer);
+                {
+                    const auto functions = gate->get_boolean_functions(true);
+                    if (!functions.empty())
+                    {
+                        writer.Key("custom_functions");
+                        writer.StartObject();
+                        for (const auto& [name, function] : functions)
+                        {
+                            writer.Key(name.c_str(), static_cast<rapidjson::SizeType>(name.length()));
+                            write_string(writer, function.to_string());
+                        }
+                        writer.EndObject();
+                    }
                 }
+                writer.EndObject();
             }
 
-            // serialize endpoint
-            rapidjson::Value serialize(const Endpoint* ep, rapidjson::Document::AllocatorType& allocator)
+            // serialize net
+            template<typename Writer>
+            void serialize(const Net* net, Writer& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("gate_id", ep->get_gate()->get_id(), allocator);
-                val.AddMember("pin_id", ep->get_pin()->get_id(), allocator);
-                return val;
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(net->get_id());
+                writer.Key("name");
+                write_string(writer, net->get_name());
+                serialize("srcs", net->get_sources(), writer);
+                serialize("dsts", net->get_destinations(), writer);
+                serialize(net->get_data_map(), writer);
+                writer.EndObject();
             }
 
-            bool deserialize_destination(Netlist* nl, Net* net, const rapidjson::Value& val)
+            // serialize module
+            template<typename Writer>
+            void serialize(const Module* module, Writer& writer, bool with_gates = true)
             {
-                Gate* gate = nl->get_gate_by_id(val["gate_id"].GetUint());
-                GatePin* pin;
-                if (val.HasMember("pin_id"))
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(module->get_id());
+                writer.Key("type");
+                write_string(writer, module->get_type());
+                writer.Key("name");
+                write_string(writer, module->get_name());
+                writer.Key("parent");
+                const Module* parent = module->get_parent_module();
+                writer.Uint((parent == nullptr) ? 0 : parent->get_id());
+                if (with_gates)
                 {
-                    const u32 pin_id = val["pin_id"].GetUint();
-                    pin              = gate->get_type()->get_pin_by_id(pin_id);
-                    if (pin == nullptr)
+                    std::vector<Gate*> sorted = module->get_gates(nullptr, false);
+                    if (!sorted.empty())
                     {
-                        log_error("netlist_persistent",
-                                  "could not deserialize destination of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get pin with ID "
-                                      + std::to_string(pin_id));
-                        return false;
+                        std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                        writer.Key("gates");
+                        writer.StartArray();
+                        for (const Gate* g : sorted)
+                        {
+                            writer.Uint(g->get_id());
+                        }
+                        writer.EndArray();
                     }
                 }
-                else
                 {
-                    // legacy code for backward compatibility
-                    const std::string pin_name = val["pin_type"].GetString();
-                    pin                        = gate->get_type()->get_pin_by_name(pin_name);
-                    if (pin == nullptr)
+                    const std::vector<PinGroup<ModulePin>*> pin_groups = module->get_pin_groups();
+                    if (!pin_groups.empty())
                     {
-                        log_error("netlist_persistent",
-                                  "could not deserialize destination of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get pin with name '" + pin_name + "'");
-                        return false;
+                        writer.Key("pin_groups");
+                        writer.StartArray();
+                        for (const PinGroup<ModulePin>* pin_group : pin_groups)
+                        {
+                            writer.StartObject();
+                            writer.Key("id");
+                            writer.Uint(pin_group->get_id());
+                            writer.Key("name");
+                            write_string(writer, pin_group->get_name());
+                            writer.Key("direction");
+                            write_string(writer, enum_to_string(pin_group->get_direction()));
+                            writer.Key("type");
+                            write_string(writer, enum_to_string(pin_group->get_type()));
+                            writer.Key("ascending");
+                            writer.Bool(pin_group->is_ascending());
+                            writer.Key("start_index");
+                            writer.Uint(pin_group->get_start_index());
+                            writer.Key("pins");
+                            writer.StartArray();
+                            for (const ModulePin* pin : pin_group->get_pins())
+                            {
+                                writer.StartObject();
+                                writer.Key("id");
+                                writer.Uint(pin->get_id());
+                                writer.Key("name");
+                                write_string(writer, pin->get_name());
+                                writer.Key("type");
+                                write_string(writer, enum_to_string(pin->get_type()));
+                                writer.Key("net_id");
+                                writer.Uint(pin->get_net()->get_id());
+                                writer.EndObject();
+                            }
+                            writer.EndArray();
+                            writer.EndObject();
+                        }
+                        writer.EndArray();
                     }
                 }
-                if (!net->add_destination(gate, pin))
+                serialize(module->get_data_map(), writer);
+                writer.EndObject();
+            }
+
+            template<typename Writer>
+            void serialize(const char* key, const std::vector<u32>& ids, Writer& writer)
+            {
+                writer.Key(key);
+                writer.StartArray();
+                for (const u32 id : ids)
                 {
-                    log_error("netlist_persistent",
-                              "could not deserialize destination of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add pin '" + pin->get_name()
-                                  + "' as destination to net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()));
-                    return false;
+                    writer.Uint(id);
                 }
-                return true;
+                writer.EndArray();
             }
 
-            bool deserialize_source(Netlist* nl, Net* net, const rapidjson::Value& val)
+            // serialize netlist, the member order allows the deserializer to stream every section without buffering it
+            template<typename Writer>
+            void serialize(const Netlist* nl, Writer& writer)
             {
-                Gate* gate = nl->get_gate_by_id(val["gate_id"].GetUint());
-                GatePin* pin;
-                if (val.HasMember("pin_id"))
+                writer.StartObject();
+                writer.Key("serialization_format_version");
+                writer.Int(SERIALIZATION_FORMAT_VERSION);
+                writer.Key("netlist");
+                writer.StartObject();
+
+                writer.Key("gate_library");
+                write_string(writer, nl->get_gate_library()->get_path().string());
+                writer.Key("id");
+                writer.Uint(nl->get_id());
+                writer.Key("input_file");
+                write_string(writer, nl->get_input_filename().string());
+                writer.Key("design_name");
+                write_string(writer, nl->get_design_name());
+                writer.Key("device_name");
+                write_string(writer, nl->get_device_name());
+                // object counts allow the reader to pre-size its containers before the first object is read
+                writer.Key("num_gates");
+                writer.Uint(nl->get_gates().size());
+                writer.Key("num_nets");
+                writer.Uint(nl->get_nets().size());
+                writer.Key("num_modules");
+                writer.Uint(nl->get_modules().size());
+
                 {
-                    const u32 pin_id = val["pin_id"].GetUint();
-                    pin              = gate->get_type()->get_pin_by_id(pin_id);
-                    if (pin == nullptr)
+                    std::vector<u32> global_vccs;
+                    std::vector<u32> global_gnds;
+                    std::vector<Gate*> sorted = nl->get_gates();
+                    std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                    writer.Key("gates");
+                    writer.StartArray();
+                    for (const Gate* gate : sorted)
                     {
-                        log_error("netlist_persistent",
-                                  "could not deserialize source of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get pin with ID " + std::to_string(pin_id));
-                        return false;
+                        serialize(gate, writer);
+
+                        if (nl->is_gnd_gate(gate))
+                        {
+                            global_gnds.push_back(gate->get_id());
+                        }
+
+                        if (nl->is_vcc_gate(gate))
+                        {
+                            global_vccs.push_back(gate->get_id());
+                        }
                     }
+                    writer.EndArray();
+                    serialize("global_vcc", global_vccs, writer);
+                    serialize("global_gnd", global_gnds, writer);
                 }
-                else
                 {
-                    // legacy code for backward compatibility
-                    const std::string pin_name = val["pin_type"].GetString();
-                    pin                        = gate->get_type()->get_pin_by_name(pin_name);
-                    if (pin == nullptr)
+                    std::vector<u32> global_in;
+                    std::vector<u32> global_out;
+                    std::vector<Net*> sorted = nl->get_nets();
+                    std::sort(sorted.begin(), sorted.end(), [](Net* lhs, Net* rhs) { return lhs->get_id() < rhs->get_id(); });
+                    writer.Key("nets");
+                    writer.StartArray();
+                    for (const Net* net : sorted)
                     {
-                        log_error("netlist_persistent",
-                                  "could not deserialize source of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get pin with name '" + pin_name + "'");
-                        return false;
+                        serialize(net, writer);
+
+                        if (nl->is_global_input_net(net))
+                        {
+                            global_in.push_back(net->get_id());
+                        }
+
+                        if (nl->is_global_output_net(net))
+                        {
+                            global_out.push_back(net->get_id());
+                        }
                     }
+                    writer.EndArray();
+                    serialize("global_in", global_in, writer);
+                    serialize("global_out", global_out, writer);
                 }
-                if (net->add_source(gate, pin) == nullptr)
                 {
-                    log_error("netlist_persistent",
-                              "could not deserialize source of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add pin '" + pin->get_name()
-                                  + "' as source to net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()));
-                    return false;
+                    writer.Key("modules");
+                    writer.StartArray();
+
+                    // module ids are not sorted to preserve hierarchy
+                    std::queue<const Module*> q;
+                    q.push(nl->get_top_module());
+                    while (!q.empty())
+                    {
+                        const Module* module = q.front();
+                        q.pop();
+
+                        serialize(module, writer);
+
+                        for (const Module* sm : module->get_submodules())
+                        {
+                            q.push(sm);
+                        }
+                    }
+                    writer.EndArray();
                 }
-                return true;
+
+                writer.EndObject();
+                writer.EndObject();
+            }
+
+            GateLibrary* load_gate_library(const std::string& gate_library_path)
+            {
+                std::filesystem::path glib_path(gate_library_path);
+
+                GateLibrary* glib = gate_library_manager::get_gate_library(glib_path.string());
+
+                if (glib == nullptr)
+                {
+                    if (glib_path.extension() == ".hgl")
+                    {
+                        glib_path.replace_extension(".lib");
+                    }
+                    else
+                    {
+                        glib_path.replace_extension(".hgl");
+                    }
+
+                    glib = gate_library_manager::get_gate_library(glib_path.string());
+                    if (glib == nullptr)
+                    {
+                        log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '" + gate_library_path + "'");
+                        return nullptr;
+                    }
+                    else
+                    {
+                        log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", gate_library_path, glib_path.string());
+                    }
+                }
+
+                return glib;
             }
 
-            // serialize gate
-            rapidjson::Value serialize(const Gate* gate, rapidjson::Document::AllocatorType& allocator)
+            void check_format_version(const std::optional<u32>& encoded_version)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", gate->get_id(), allocator);
-                val.AddMember("name", gate->get_name(), allocator);
-                val.AddMember("type", gate->get_type()->get_name(), allocator);
-                auto data = serialize(gate->get_data_map(), allocator);
-                if (!data.Empty())
+                if (!encoded_version.has_value() || encoded_version.value() < SERIALIZATION_FORMAT_VERSION)
                 {
-                    val.AddMember("data", data, allocator);
+                    log_warning("netlist_persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
+                }
+                else if (encoded_version.value() > SERIALIZATION_FORMAT_VERSION)
+                {
+                    log_warning("netlist_persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
                 }
+            }
+
+            /**
+             * Parse the custom Boolean functions of all gates in parallel and add them to their gates afterwards.
+             * Parsing is independent for every function, whereas adding them to the gates has to be done sequentially.
+             */
+            bool deserialize_custom_functions(const std::vector<FunctionInformation>& functions)
+            {
+                std::vector<Result<BooleanFunction>> parsed(functions.size(), ERR("function has not been parsed"));
+                utils::parallel_for_each(0, functions.size(), [&functions, &parsed](u32 i) { parsed[i] = BooleanFunction::from_string(functions[i].function); });
+
+                for (u32 i = 0; i < functions.size(); i++)
                 {
-                    rapidjson::Value functions(rapidjson::kObjectType);
-                    for (const auto& [name, function] : gate->get_boolean_functions(true))
+                    const FunctionInformation& info = functions[i];
+                    if (parsed[i].is_error())
                     {
-                        const std::string function_str = function.to_string();
-                        functions.AddMember(JSON_STR_HELPER(name), JSON_STR_HELPER(function_str), allocator);
+                        log_error("netlist_persistent",
+                                  "could not deserialize gate '" + info.gate->get_name() + "' with ID " + std::to_string(info.gate->get_id())
+                                      + ": failed to parse Boolean function from string\n{}",
+                                  parsed[i].get_error().get());
+                        return false;
                     }
-                    if (functions.MemberCount() > 0)
+                    info.gate->add_boolean_function(info.name, parsed[i].get());
+                }
+
+                return true;
+            }
+
+            bool deserialize_module_pins(const std::unordered_map<Module*, std::vector<PinGroupInformation>>& pin_group_cache)
+            {
+                for (const auto& [sm, pin_groups] : pin_group_cache)
+                {
+                    for (const PinGroupInformation& pg : pin_groups)
                     {
-                        val.AddMember("custom_functions", functions, allocator);
+                        std::vector<ModulePin*> pins;
+                        for (const PinGroupInformation::PinInformation& p : pg.pins)
+                        {
+                            u32 pid = (p.id > 0) ? (u32)p.id : sm->get_unique_pin_id();
+                            if (auto res = sm->create_pin(pid, p.name, p.net, p.type, false); res.is_error())
+                            {
+                                log_error("netlist_persistent",
+                                          "could not deserialize pin '" + p.name + "' of module '" + sm->get_name() + "' with ID " + std::to_string(sm->get_id()) + ": failed to create pin\n{}",
+                                          res.get_error().get());
+                                return false;
+                            }
+                            else
+                            {
+                                pins.push_back(res.get());
+                            }
+                        }
+                        u32 pgid = (pg.id > 0) ? (u32)pg.id : sm->get_unique_pin_group_id();
+                        if (auto res = sm->create_pin_group(pgid, pg.name, pins, pg.direction, pg.type, pg.ascending, pg.start_index); res.is_error())
+                        {
+                            log_error("netlist_persistent",
+                                      "could not deserialize pin group '" + pg.name + "' of module '" + sm->get_name() + "' with ID " + std::to_string(sm->get_id())
+                                          + ": failed to create pin group\n{}",
+                                      res.get_error().get());
+                            return false;
+                        }
                     }
                 }
-                return val;
+                return true;
+            }
+
+            // ===== document-based deserialization of single objects, used for the delta records of the netlist journal =====
+
+            void deserialize_data(DataContainer* c, const rapidjson::Value& val)
+            {
+                for (const auto& entry : val.GetArray())
+                {
+                    c->set_data(entry[0].GetString(), entry[1].GetString(), entry[2].GetString(), entry[3].GetString());
+                }
             }
 
-            bool deserialize_gate(Netlist* nl, const rapidjson::Value& val, const std::unordered_map<std::string, hal::GateType*>& gate_types)
+            bool deserialize_gate(Netlist* nl,
+                                  const rapidjson::Value& val,
+                                  const std::unordered_map<std::string, hal::GateType*>& gate_types,
+                                  std::vector<FunctionInformation>& function_cache)
             {
                 const u32 gate_id           = val["id"].GetUint();
                 const std::string gate_name = val["name"].GetString();
@@ -227,15 +532,7 @@ namespace hal
                         auto functions = val["custom_functions"].GetObject();
                         for (auto f_it = functions.MemberBegin(); f_it != functions.MemberEnd(); ++f_it)
                         {
-                            auto func = BooleanFunction::from_string(f_it->value.GetString());
-                            if (func.is_error())
-                            {
-                                log_error("netlist_persistent",
-                                          "could not deserialize gate '" + gate_name + "' with ID " + std::to_string(gate_id) + ": failed to parse Boolean function from string\n{}",
-                                          func.get_error().get());
-                                return false;
-                            }
-                            gate->add_boolean_function(f_it->name.GetString(), func.get());
+                            function_cache.push_back({gate, f_it->name.GetString(), f_it->value.GetString()});
                         }
                     }
 
@@ -248,596 +545,1981 @@ namespace hal
                 return false;
             }
 
-            // serialize net
-            rapidjson::Value serialize(const Net* net, rapidjson::Document::AllocatorType& allocator)
+            void deserialize_pin_groups(Netlist* nl, Module* sm, const rapidjson::Value& val, std::unordered_map<Module*, std::vector<PinGroupInformation>>& pin_group_cache)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", net->get_id(), allocator);
-                val.AddMember("name", net->get_name(), allocator);
-
+                for (const auto& json_pin_group : val.GetArray())
                 {
-                    rapidjson::Value srcs(rapidjson::kArrayType);
-                    std::vector<Endpoint*> sorted = net->get_sources();
-                    std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
-                    for (const Endpoint* src : sorted)
+                    PinGroupInformation pin_group;
+                    pin_group.id   = json_pin_group["id"].GetUint();
+                    pin_group.name = json_pin_group["name"].GetString();
+                    if (json_pin_group.HasMember("direction"))
                     {
-                        srcs.PushBack(serialize(src, allocator), allocator);
+                        pin_group.direction = enum_from_string<PinDirection>(json_pin_group["direction"].GetString());
                     }
-                    if (!srcs.Empty())
+                    else
                     {
-                        val.AddMember("srcs", srcs, allocator);
+                        pin_group.direction = PinDirection::none;
                     }
-                }
-
-                {
-                    rapidjson::Value dsts(rapidjson::kArrayType);
-                    std::vector<Endpoint*> sorted = net->get_destinations();
-                    std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
-                    for (const Endpoint* dst : sorted)
+                    if (json_pin_group.HasMember("type"))
                     {
-                        dsts.PushBack(serialize(dst, allocator), allocator);
+                        pin_group.type = enum_from_string<PinType>(json_pin_group["type"].GetString());
                     }
-                    if (!dsts.Empty())
+                    else
                     {
-                        val.AddMember("dsts", dsts, allocator);
+                        pin_group.type = PinType::none;
                     }
-                }
+                    pin_group.ascending   = json_pin_group["ascending"].GetBool();
+                    pin_group.start_index = json_pin_group["start_index"].GetUint();
 
-                auto data = serialize(net->get_data_map(), allocator);
-                if (!data.Empty())
-                {
-                    val.AddMember("data", data, allocator);
+                    for (const auto& pin_node : json_pin_group["pins"].GetArray())
+                    {
+                        PinGroupInformation::PinInformation pin;
+                        pin.id   = pin_node["id"].GetUint();
+                        pin.name = pin_node["name"].GetString();
+                        pin.net  = nl->get_net_by_id(pin_node["net_id"].GetUint());
+                        pin.type = enum_from_string<PinType>(pin_node["type"].GetString());
+                        pin_group.pins.push_back(pin);
+                    }
+                    pin_group_cache[sm].push_back(pin_group);
                 }
-                return val;
             }
 
-            bool deserialize_net(Netlist* nl, const rapidjson::Value& val)
+            // ===== streaming deserialization =====
+
+            /**
+             * Parses data entries and custom Boolean functions of lazily deserialized objects from their JSON text within the mapped file.<br>
+             * Offsets and sizes refer to the byte range of the 'data' array or the 'custom_functions' object, respectively.
+             */
+            class JsonLazyDataSource : public LazyDataSource
             {
-                const u32 net_id           = val["id"].GetUint();
-                const std::string net_name = val["name"].GetString();
-                auto net                   = nl->create_net(net_id, net_name);
-                if (net == nullptr)
+            public:
+                JsonLazyDataSource(std::shared_ptr<const MemoryMappedFile> file) : m_file(std::move(file))
                 {
-                    log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(net_id) + ": failed to create net");
-                    return false;
                 }
 
-                if (val.HasMember("srcs"))
+                Result<std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>> decode_data(u64 offset, u64 size) const override
                 {
-                    for (const auto& src_node : val["srcs"].GetArray())
+                    rapidjson::Document document;
+                    if (!parse(offset, size, document) || !document.IsArray())
                     {
-                        if (!deserialize_source(nl, net, src_node))
-                        {
-                            log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(net_id) + ": failed to deserialize source");
-                            return false;
-                        }
+                        return ERR("invalid json string for data entries");
                     }
-                }
 
-                if (val.HasMember("dsts"))
-                {
-                    for (const auto& dst_node : val["dsts"].GetArray())
+                    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> res;
+                    for (const auto& entry : document.GetArray())
                     {
-                        if (!deserialize_destination(nl, net, dst_node))
+                        if (!entry.IsArray() || entry.Size() != 4 || !entry[0].IsString() || !entry[1].IsString() || !entry[2].IsString() || !entry[3].IsString())
                         {
-                            log_error("netlist_persistent", "could not deserialize net '" + net_name + "' with ID " + std::to_string(net_id) + ": failed to deserialize destination");
-                            return false;
+                            return ERR("data entries must consist of category, key, data type, and value");
                         }
+                        res[std::make_tuple(entry[0].GetString(), entry[1].GetString())] = std::make_tuple(entry[2].GetString(), entry[3].GetString());
                     }
+                    return OK(res);
                 }
 
-                if (val.HasMember("data"))
-                {
-                    deserialize_data(net, val["data"]);
-                }
-
-                return true;
-            }
-
-            // serialize module
-            rapidjson::Value serialize(const Module* module, rapidjson::Document::AllocatorType& allocator)
-            {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", module->get_id(), allocator);
-                val.AddMember("type", module->get_type(), allocator);
-                val.AddMember("name", module->get_name(), allocator);
-                Module* parent = module->get_parent_module();
-                if (parent == nullptr)
-                {
-                    val.AddMember("parent", 0, allocator);
-                }
-                else
-                {
-                    val.AddMember("parent", parent->get_id(), allocator);
-                }
+                Result<std::unordered_map<std::string, BooleanFunction>> decode_functions(u64 offset, u64 size) const override
                 {
-                    rapidjson::Value gates(rapidjson::kArrayType);
-                    std::vector<Gate*> sorted = module->get_gates(nullptr, false);
-                    std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
-                    for (const Gate* g : sorted)
-                    {
-                        gates.PushBack(g->get_id(), allocator);
-                    }
-                    if (!gates.Empty())
+                    rapidjson::Document document;
+                    if (!parse(offset, size, document) || !document.IsObject())
                     {
-                        val.AddMember("gates", gates, allocator);
+                        return ERR("invalid json string for custom Boolean functions");
                     }
-                }
-                {
-                    rapidjson::Value json_pin_groups(rapidjson::kArrayType);
-                    for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+
+                    std::unordered_map<std::string, BooleanFunction> res;
+                    for (auto f_it = document.MemberBegin(); f_it != document.MemberEnd(); ++f_it)
                     {
-                        rapidjson::Value json_pin_group(rapidjson::kObjectType);
-                        json_pin_group.AddMember("id", pin_group->get_id(), allocator);
-                        json_pin_group.AddMember("name", pin_group->get_name(), allocator);
-                        json_pin_group.AddMember("direction", enum_to_string(pin_group->get_direction()), allocator);
-                        json_pin_group.AddMember("type", enum_to_string(pin_group->get_type()), allocator);
-                        json_pin_group.AddMember("ascending", pin_group->is_ascending(), allocator);
-                        json_pin_group.AddMember("start_index", pin_group->get_start_index(), allocator);
-                        rapidjson::Value json_pins(rapidjson::kArrayType);
-                        for (const ModulePin* pin : pin_group->get_pins())
+                        const std::string name = f_it->name.GetString();
+                        if (!f_it->value.IsString())
                         {
-                            rapidjson::Value json_pin(rapidjson::kObjectType);
-                            json_pin.AddMember("id", pin->get_id(), allocator);
-                            json_pin.AddMember("name", pin->get_name(), allocator);
-                            json_pin.AddMember("type", enum_to_string(pin->get_type()), allocator);
-                            json_pin.AddMember("net_id", pin->get_net()->get_id(), allocator);
-                            json_pins.PushBack(json_pin, allocator);
+                            return ERR("custom Boolean function '" + name + "' is not a string");
                         }
-                        json_pin_group.AddMember("pins", json_pins, allocator);
-                        json_pin_groups.PushBack(json_pin_group, allocator);
-                    }
-                    if (!json_pin_groups.Empty())
-                    {
-                        val.AddMember("pin_groups", json_pin_groups, allocator);
+                        auto function = BooleanFunction::from_string(f_it->value.GetString());
+                        if (function.is_error())
+                        {
+                            return ERR_APPEND(function.get_error(), "failed to parse Boolean function '" + name + "' from string");
+                        }
+                        res[name] = function.get();
                     }
+                    return OK(res);
                 }
 
-                auto data = serialize(module->get_data_map(), allocator);
-                if (!data.Empty())
-                {
-                    val.AddMember("data", data, allocator);
-                }
-                return val;
-            }
-
-            bool deserialize_module(Netlist* nl, const rapidjson::Value& val, std::unordered_map<Module*, std::vector<PinGroupInformation>>& pin_group_cache)
-            {
-                const u32 module_id           = val["id"].GetUint();
-                const std::string module_name = val["name"].GetString();
-                const u32 parent_id           = val["parent"].GetUint();
-                Module* sm                    = nl->get_top_module();
-
-                if (parent_id == 0)
+            private:
+                bool parse(u64 offset, u64 size, rapidjson::Document& document) const
                 {
-                    // top_module must not be created but might be renamed
-                    const std::string top_module_name = val["name"].GetString();
-                    if (top_module_name != sm->get_name())
+                    const std::string_view data = m_file->get_data();
+                    if (offset > data.size() || size > data.size() - offset)
                     {
-                        sm->set_name(top_module_name);
+                        return false;
                     }
+                    document.Parse(data.data() + offset, size);
+                    return !document.HasParseError();
                 }
-                else
+
+                std::shared_ptr<const MemoryMappedFile> m_file;
+            };
+
+            /**
+             * SAX handler that creates gates, nets, and modules as soon as their JSON object has been read.<br>
+             * Only a single object of each kind is buffered at a time, so memory consumption does not depend on the size of the file.
+             * Sections listed before the sections they depend on (e.g., nets before gates) are buffered until their dependencies have been deserialized, so the member order only affects memory consumption.
+             */
+            class NetlistHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, NetlistHandler>
+            {
+            public:
+                /**
+                 * @param[in] stream - The stream that is parsed, used to locate the data entries and custom Boolean functions that are deserialized lazily, or a nullptr if there is no lazy source.
+                 * @param[in] lazy_source - The source to decode these from on first access, or a nullptr to decode them right away.
+                 * @param[in] gate_library - The gate library of the netlist, or a nullptr to load the gate library referenced by the file.
+                 */
+                NetlistHandler(const rapidjson::MemoryStream* stream, std::shared_ptr<const LazyDataSource> lazy_source, const GateLibrary* gate_library)
+                    : m_stream(stream), m_lazy_source(std::move(lazy_source)), m_given_gate_library(gate_library)
                 {
-                    sm = nl->create_module(module_id, module_name, nl->get_module_by_id(parent_id));
-                    if (sm == nullptr)
-                    {
-                        log_error("netlist_persistent", "could not deserialize module '" + module_name + "' with ID " + std::to_string(module_id) + ": failed to create module");
-                        return false;
-                    }
                 }
 
-                if (val.HasMember("type"))
+                bool Null()
                 {
-                    sm->set_type(val["type"].GetString());
+                    return true;
                 }
 
-                if (val.HasMember("gates"))
+                bool Bool(bool value)
                 {
-                    std::vector<Gate*> gates;
-                    for (auto& gate_node : val["gates"].GetArray())
+                    if (top() == Context::pin_group && m_key == "ascending")
                     {
-                        if (!sm->is_top_module())
-                        {
-                            gates.push_back(nl->get_gate_by_id(gate_node.GetUint()));
-                        }
+                        m_pin_group.ascending = value;
                     }
-                    sm->assign_gates(gates);
+                    return true;
                 }
 
-                if (val.HasMember("data"))
+                bool Int(int)
                 {
-                    deserialize_data(sm, val["data"]);
+                    return true;
                 }
 
-                if (val.HasMember("pin_groups"))
+                bool Uint(unsigned value)
                 {
-                    // pins need to be cached until all modules have been instantiated
-                    for (const auto& json_pin_group : val["pin_groups"].GetArray())
+                    switch (top())
                     {
-                        PinGroupInformation pin_group;
-                        pin_group.id   = json_pin_group["id"].GetUint();
-                        pin_group.name = json_pin_group["name"].GetString();
-                        if (json_pin_group.HasMember("direction"))
-                        {
-                            pin_group.direction = enum_from_string<PinDirection>(json_pin_group["direction"].GetString());
-                        }
-                        else
-                        {
-                            pin_group.direction = PinDirection::none;
-                        }
-                        if (json_pin_group.HasMember("type"))
-                        {
-                            pin_group.type = enum_from_string<PinType>(json_pin_group["type"].GetString());
-                        }
-                        else
+                        case Context::root:
+                            if (m_key == "serialization_format_version")
+                            {
+                                m_version = value;
+                            }
+                            break;
+                        case Context::netlist:
+                            if (m_key == "id")
+                            {
+                                m_netlist_id = value;
+                            }
+                            else if (m_key == "num_gates")
+                            {
+                                m_num_gates = value;
+                            }
+                            else if (m_key == "num_nets")
+                            {
+                                m_num_nets = value;
+                            }
+                            else if (m_key == "num_modules")
+                            {
+                                m_num_modules = value;
+                            }
+                            break;
+                        case Context::gate:
+                            if (m_key == "id")
+                            {
+                                m_gate.id = value;
+                            }
+                            break;
+                        case Context::id_list:
+                            return add_global(value);
+                        case Context::net:
+                            if (m_key == "id")
+                            {
+                                m_net.id = value;
+                            }
+                            break;
+                        case Context::endpoint:
+                            if (m_key == "gate_id")
+                            {
+                                m_endpoint.gate_id = value;
+                            }
+                            else if (m_key == "pin_id")
+                            {
+                                m_endpoint.pin_id = value;
+                            }
+                            break;
+                        case Context::module:
+                            if (m_key == "id")
+                            {
+                                m_module.id = value;
+                            }
+                            else if (m_key == "parent")
+                            {
+                                m_module.parent_id = value;
+                            }
+                            break;
+                        case Context::module_gates:
+                            m_module.gate_ids.push_back(value);
+                            break;
+                        case Context::pin_group:
+                            if (m_key == "id")
+                            {
+                                m_pin_group.id = value;
+                            }
+                            else if (m_key == "start_index")
+                            {
+                                m_pin_group.start_index = value;
+                            }
+                            break;
+                        case Context::pin:
+                        case Context::legacy_port:
+                            if (m_key == "id")
+                            {
+                                m_pin.id = value;
+                            }
+                            else if (m_key == "net_id")
+                            {
+                                m_pin.net_id = value;
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                    return true;
+                }
+
+                bool String(const char* str, rapidjson::SizeType length, bool)
+                {
+                    const std::string_view value(str, length);
+                    switch (top())
+                    {
+                        case Context::netlist:
+                            if (m_key == "gate_library")
+                            {
+                                m_gate_library = value;
+                                return apply_pending();
+                            }
+                            else if (m_key == "input_file")
+                            {
+                                m_input_file = std::string(value);
+                            }
+                            else if (m_key == "design_name")
+                            {
+                                m_design_name = std::string(value);
+                            }
+                            else if (m_key == "device_name")
+                            {
+                                m_device_name = std::string(value);
+                            }
+                            break;
+                        case Context::gate:
+                            if (m_key == "name")
+                            {
+                                m_gate.name = value;
+                            }
+                            else if (m_key == "type")
+                            {
+                                m_gate.type = value;
+                            }
+                            break;
+                        case Context::functions:
+                            m_gate.functions.emplace_back(m_key, value);
+                            break;
+                        case Context::data_entry:
+                            m_data_entry.emplace_back(value);
+                            break;
+                        case Context::net:
+                            if (m_key == "name")
+                            {
+                                m_net.name = value;
+                            }
+                            break;
+                        case Context::endpoint:
+                            // legacy code for backward compatibility
+                            if (m_key == "pin_type")
+                            {
+                                m_endpoint.pin_name = value;
+                            }
+                            break;
+                        case Context::module:
+                            if (m_key == "name")
+                            {
+                                m_module.name = value;
+                            }
+                            else if (m_key == "type")
+                            {
+                                m_module.type = std::string(value);
+                            }
+                            break;
+                        case Context::pin_group:
+                            if (m_key == "name")
+                            {
+                                m_pin_group.name = value;
+                            }
+                            else if (m_key == "direction")
+                            {
+                                m_pin_group.direction = enum_from_string<PinDirection>(std::string(value), PinDirection::none);
+                            }
+                            else if (m_key == "type")
+                            {
+                                m_pin_group.type = enum_from_string<PinType>(std::string(value), PinType::none);
+                            }
+                            break;
+                        case Context::pin:
+                            if (m_key == "name")
+                            {
+                                m_pin.name = value;
+                            }
+                            else if (m_key == "type")
+                            {
+                                m_pin.type = enum_from_string<PinType>(std::string(value), PinType::none);
+                            }
+                            break;
+                        case Context::legacy_port:
+                            if (m_key == "port_name")
+                            {
+                                m_pin.name = value;
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                    return true;
+                }
+
+                bool Key(const char* str, rapidjson::SizeType length, bool)
+                {
+                    m_key.assign(str, length);
+                    return true;
+                }
+
+                bool StartObject()
+                {
+                    if (m_stack.empty())
+                    {
+                        m_stack.push_back(Context::root);
+                        return true;
+                    }
+
+                    switch (top())
+                    {
+                        case Context::root:
+                            if (m_key == "netlist")
+                            {
+                                m_has_netlist = true;
+                                m_stack.push_back(Context::netlist);
+                                return true;
+                            }
+                            break;
+                        case Context::gate:
+                            if (m_key == "custom_functions")
+                            {
+                                if (m_lazy_source != nullptr)
+                                {
+                                    m_lazy_begin  = m_stream->Tell() - 1;
+                                    m_lazy_target = &m_gate.lazy_functions;
+                                    m_stack.push_back(Context::lazy_range);
+                                    return true;
+                                }
+                                m_stack.push_back(Context::functions);
+                                return true;
+                            }
+                            break;
+                        case Context::gates:
+                            m_gate = GateInformation();
+                            m_stack.push_back(Context::gate);
+                            return true;
+                        case Context::nets:
+                            m_net = NetInformation();
+                            m_stack.push_back(Context::net);
+                            return true;
+                        case Context::endpoints:
+                            m_endpoint = EndpointInformation();
+                            m_stack.push_back(Context::endpoint);
+                            return true;
+                        case Context::modules:
+                            m_module = ModuleInformation();
+                            m_stack.push_back(Context::module);
+                            return true;
+                        case Context::pin_groups:
+                            m_pin_group = PinGroupInformation();
+                            m_stack.push_back(Context::pin_group);
+                            return true;
+                        case Context::pins:
+                            m_pin = PinGroupInformation::PinInformation();
+                            m_stack.push_back(Context::pin);
+                            return true;
+                        case Context::legacy_ports:
+                            m_pin = PinGroupInformation::PinInformation();
+                            m_stack.push_back(Context::legacy_port);
+                            return true;
+                        default:
+                            break;
+                    }
+
+                    m_stack.push_back(Context::skip);
+                    return true;
+                }
+
+                bool EndObject(rapidjson::SizeType)
+                {
+                    const Context context = top();
+                    m_stack.pop_back();
+
+                    switch (context)
+                    {
+                        case Context::gate:
+                            return finish_gate();
+                        case Context::net:
+                            return finish_net();
+                        case Context::endpoint:
+                            (m_endpoint_is_source ? m_net.sources : m_net.destinations).push_back(m_endpoint);
+                            break;
+                        case Context::module:
+                            return finish_module();
+                        case Context::pin_group:
+                            m_module.pin_groups.push_back(std::move(m_pin_group));
+                            break;
+                        case Context::pin:
+                            m_pin_group.pins.push_back(m_pin);
+                            break;
+                        case Context::legacy_port: {
+                            // legacy code for backward compatibility
+                            PinGroupInformation pin_group;
+                            pin_group.name = m_pin.name;
+                            pin_group.pins.push_back(m_pin);
+                            m_module.pin_groups.push_back(std::move(pin_group));
+                            break;
+                        }
+                        case Context::lazy_range:
+                            finish_lazy_range();
+                            break;
+                        default:
+                            break;
+                    }
+                    return true;
+                }
+
+                bool StartArray()
+                {
+                    Context context = Context::skip;
+                    switch (top())
+                    {
+                        case Context::netlist:
+                            if (m_key == "gates")
+                            {
+                                if (!begin_section(m_gates_seen) || (m_nl == nullptr && !m_gate_library.empty() && !create_netlist()))
+                                {
+                                    return false;
+                                }
+                                context = Context::gates;
+                            }
+                            else if (m_key == "global_vcc" || m_key == "global_gnd")
+                            {
+                                if (!begin_section((m_key == "global_vcc") ? m_global_vcc_seen : m_global_gnd_seen))
+                                {
+                                    return false;
+                                }
+                                m_id_list = (m_key == "global_vcc") ? IdList::global_vcc : IdList::global_gnd;
+                                context   = Context::id_list;
+                            }
+                            else if (m_key == "nets")
+                            {
+                                if (!begin_section(m_nets_seen))
+                                {
+                                    return false;
+                                }
+                                context = Context::nets;
+                            }
+                            else if (m_key == "global_in" || m_key == "global_out")
+                            {
+                                if (!begin_section((m_key == "global_in") ? m_global_in_seen : m_global_out_seen))
+                                {
+                                    return false;
+                                }
+                                m_id_list = (m_key == "global_in") ? IdList::global_in : IdList::global_out;
+                                context   = Context::id_list;
+                            }
+                            else if (m_key == "modules")
+                            {
+                                if (!begin_section(m_modules_seen))
+                                {
+                                    return false;
+                                }
+                                context = Context::modules;
+                            }
+                            break;
+                        case Context::gate:
+                            if (m_key == "data")
+                            {
+                                context = begin_data(m_gate);
+                            }
+                            break;
+                        case Context::net:
+                            if (m_key == "data")
+                            {
+                                context = begin_data(m_net);
+                            }
+                            else if (m_key == "srcs" || m_key == "dsts")
+                            {
+                                m_endpoint_is_source = (m_key == "srcs");
+                                context              = Context::endpoints;
+                            }
+                            break;
+                        case Context::module:
+                            if (m_key == "data")
+                            {
+                                context = begin_data(m_module);
+                            }
+                            else if (m_key == "gates")
+                            {
+                                context = Context::module_gates;
+                            }
+                            else if (m_key == "pin_groups")
+                            {
+                                context = Context::pin_groups;
+                            }
+                            else if (m_key == "input_ports" || m_key == "output_ports")
+                            {
+                                context = Context::legacy_ports;
+                            }
+                            break;
+                        case Context::pin_group:
+                            if (m_key == "pins")
+                            {
+                                context = Context::pins;
+                            }
+                            break;
+                        case Context::data:
+                            m_data_entry.clear();
+                            context = Context::data_entry;
+                            break;
+                        default:
+                            break;
+                    }
+
+                    m_stack.push_back(context);
+                    return true;
+                }
+
+                bool EndArray(rapidjson::SizeType)
+                {
+                    const Context context = top();
+                    m_stack.pop_back();
+
+                    switch (context)
+                    {
+                        case Context::gates:
+                            m_gates_complete = true;
+                            return apply_pending();
+                        case Context::nets:
+                            m_nets_complete = true;
+                            return apply_pending();
+                        case Context::modules:
+                            m_modules_complete = true;
+                            return apply_pending();
+                        case Context::lazy_range:
+                            finish_lazy_range();
+                            break;
+                        case Context::data_entry:
+                            if (m_data_entry.size() != 4)
+                            {
+                                log_error("netlist_persistent", "could not deserialize netlist: data entries must consist of category, key, data type, and value");
+                                return false;
+                            }
+                            m_data_target->push_back({std::move(m_data_entry[0]), std::move(m_data_entry[1]), std::move(m_data_entry[2]), std::move(m_data_entry[3])});
+                            break;
+                        default:
+                            break;
+                    }
+                    return true;
+                }
+
+                /**
+                 * Complete the netlist after the whole file has been read.
+                 *
+                 * @returns The deserialized netlist or a nullptr on error.
+                 */
+                std::unique_ptr<Netlist> finish()
+                {
+                    check_format_version(m_version);
+
+                    if (!m_has_netlist)
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: file has no 'netlist' node");
+                        return nullptr;
+                    }
+
+                    for (const auto& [seen, name] : std::vector<std::pair<bool, std::string>>{{!m_gate_library.empty(), "gate_library"},
+                                                                                              {m_netlist_id.has_value(), "id"},
+                                                                                              {m_input_file.has_value(), "input_file"},
+                                                                                              {m_design_name.has_value(), "design_name"},
+                                                                                              {m_device_name.has_value(), "device_name"},
+                                                                                              {m_gates_seen, "gates"},
+                                                                                              {m_global_vcc_seen, "global_vcc"},
+                                                                                              {m_global_gnd_seen, "global_gnd"},
+                                                                                              {m_nets_seen, "nets"},
+                                                                                              {m_global_in_seen, "global_in"},
+                                                                                              {m_global_out_seen, "global_out"},
+                                                                                              {m_modules_seen, "modules"}})
+                    {
+                        if (!seen)
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node '{}'", name);
+                            return nullptr;
+                        }
+                    }
+
+                    // all sections are complete, so nothing remains buffered afterwards
+                    if (!apply_pending())
+                    {
+                        return nullptr;
+                    }
+
+                    m_nl->set_id(m_netlist_id.value());
+                    m_nl->set_input_filename(m_input_file.value());
+                    m_nl->set_design_name(m_design_name.value());
+                    m_nl->set_device_name(m_device_name.value());
+
+                    if (!deserialize_custom_functions(m_function_cache))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate");
+                        return nullptr;
+                    }
+
+                    // update module nets, internal nets, input nets, and output nets
+                    m_nl->update_module_nets();
+
+                    // load module pins (nets must have been updated beforehand)
+                    if (!deserialize_module_pins(m_pin_group_cache))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module pins");
+                        return nullptr;
+                    }
+
+                    // re-enable automatically checking module nets
+                    m_nl->enable_automatic_net_checks(true);
+
+                    return std::move(m_nl);
+                }
+
+            private:
+                enum class Context
+                {
+                    root,
+                    netlist,
+                    gates,
+                    gate,
+                    functions,
+                    data,
+                    data_entry,
+                    id_list,
+                    nets,
+                    net,
+                    endpoints,
+                    endpoint,
+                    modules,
+                    module,
+                    module_gates,
+                    pin_groups,
+                    pin_group,
+                    pins,
+                    pin,
+                    legacy_ports,
+                    legacy_port,
+                    lazy_range,
+                    skip
+                };
+
+                enum class IdList
+                {
+                    global_vcc,
+                    global_gnd,
+                    global_in,
+                    global_out
+                };
+
+                using DataEntries = std::vector<std::array<std::string, 4>>;
+
+                // offset and size of JSON text that is decoded lazily
+                using LazyRange = std::optional<std::pair<u64, u64>>;
+
+                struct GateInformation
+                {
+                    std::optional<u32> id;
+                    std::string name;
+                    std::string type;
+                    DataEntries data;
+                    LazyRange lazy_data;
+                    std::vector<std::pair<std::string, std::string>> functions;
+                    LazyRange lazy_functions;
+                };
+
+                struct EndpointInformation
+                {
+                    u32 gate_id = 0;
+                    std::optional<u32> pin_id;
+                    std::string pin_name;
+                };
+
+                struct NetInformation
+                {
+                    std::optional<u32> id;
+                    std::string name;
+                    std::vector<EndpointInformation> sources;
+                    std::vector<EndpointInformation> destinations;
+                    DataEntries data;
+                    LazyRange lazy_data;
+                };
+
+                struct ModuleInformation
+                {
+                    std::optional<u32> id;
+                    std::optional<u32> parent_id;
+                    std::string name;
+                    std::optional<std::string> type;
+                    std::vector<u32> gate_ids;
+                    std::vector<PinGroupInformation> pin_groups;
+                    DataEntries data;
+                    LazyRange lazy_data;
+                };
+
+                const rapidjson::MemoryStream* m_stream;
+                std::shared_ptr<const LazyDataSource> m_lazy_source;
+                const GateLibrary* m_given_gate_library;
+                u64 m_lazy_begin         = 0;
+                LazyRange* m_lazy_target = nullptr;
+
+                std::vector<Context> m_stack;
+                std::string m_key;
+
+                std::unique_ptr<Netlist> m_nl;
+                std::unordered_map<std::string, GateType*> m_gate_types;
+                std::unordered_map<Module*, std::vector<PinGroupInformation>> m_pin_group_cache;
+                std::vector<FunctionInformation> m_function_cache;
+
+                std::optional<u32> m_version;
+                bool m_has_netlist = false;
+                std::string m_gate_library;
+                std::optional<u32> m_netlist_id;
+                std::optional<std::string> m_input_file;
+                std::optional<std::string> m_design_name;
+                std::optional<std::string> m_device_name;
+                u32 m_num_gates   = 0;
+                u32 m_num_nets    = 0;
+                u32 m_num_modules = 0;
+
+                bool m_gates_seen       = false;
+                bool m_global_vcc_seen  = false;
+                bool m_global_gnd_seen  = false;
+                bool m_nets_seen        = false;
+                bool m_global_in_seen   = false;
+                bool m_global_out_seen  = false;
+                bool m_modules_seen     = false;
+                bool m_gates_complete   = false;
+                bool m_nets_complete    = false;
+                bool m_modules_complete = false;
+                bool m_gates_done       = false;
+                bool m_nets_done        = false;
+                bool m_modules_done     = false;
+
+                // sections that are buffered until the sections they depend on have been deserialized
+                std::vector<GateInformation> m_pending_gates;
+                std::vector<NetInformation> m_pending_nets;
+                std::vector<ModuleInformation> m_pending_modules;
+                std::vector<std::pair<IdList, u32>> m_pending_global_gates;
+                std::vector<std::pair<IdList, u32>> m_pending_global_nets;
+
+                GateInformation m_gate;
+                NetInformation m_net;
+                EndpointInformation m_endpoint;
+                bool m_endpoint_is_source = false;
+                ModuleInformation m_module;
+                PinGroupInformation m_pin_group;
+                PinGroupInformation::PinInformation m_pin;
+                IdList m_id_list = IdList::global_vcc;
+                DataEntries* m_data_target = nullptr;
+                std::vector<std::string> m_data_entry;
+
+                Context top() const
+                {
+                    return m_stack.empty() ? Context::skip : m_stack.back();
+                }
+
+                // every section may only be listed once
+                bool begin_section(bool& seen)
+                {
+                    if (seen)
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has more than one node '{}'", m_key);
+                        return false;
+                    }
+                    seen = true;
+                    return true;
+                }
+
+                bool create_netlist()
+                {
+                    const GateLibrary* glib = (m_given_gate_library != nullptr) ? m_given_gate_library : load_gate_library(m_gate_library);
+                    if (glib == nullptr)
+                    {
+                        return false;
+                    }
+
+                    m_nl = std::make_unique<Netlist>(glib);
+
+                    // disable automatically checking module nets
+                    m_nl->enable_automatic_net_checks(false);
+
+                    // pre-size the containers of the netlist if the file provides the number of objects
+                    m_nl->reserve(m_num_gates, m_num_nets, m_num_modules);
+
+                    m_gate_types = glib->get_gate_types();
+                    return true;
+                }
+
+                /**
+                 * Deserialize all buffered sections whose dependencies have been deserialized in the meantime.
+                 * Gates depend on the gate library, nets and global gates on the gates, and modules and global nets on the nets.
+                 */
+                bool apply_pending()
+                {
+                    if (!m_gates_done)
+                    {
+                        if (!m_gates_complete || m_gate_library.empty())
+                        {
+                            return true;
+                        }
+                        if (m_nl == nullptr && !create_netlist())
+                        {
+                            return false;
+                        }
+                        for (GateInformation& info : m_pending_gates)
+                        {
+                            if (!create_gate(info))
+                            {
+                                return false;
+                            }
+                        }
+                        std::vector<GateInformation>().swap(m_pending_gates);
+                        m_gates_done = true;
+                    }
+
+                    if (!mark_pending_globals(m_pending_global_gates))
+                    {
+                        return false;
+                    }
+
+                    if (!m_nets_done)
+                    {
+                        if (!m_nets_complete)
+                        {
+                            return true;
+                        }
+                        for (NetInformation& info : m_pending_nets)
+                        {
+                            if (!create_net(info))
+                            {
+                                return false;
+                            }
+                        }
+                        std::vector<NetInformation>().swap(m_pending_nets);
+                        m_nets_done = true;
+                    }
+
+                    if (!mark_pending_globals(m_pending_global_nets))
+                    {
+                        return false;
+                    }
+
+                    if (!m_modules_done)
+                    {
+                        if (!m_modules_complete)
+                        {
+                            return true;
+                        }
+                        for (ModuleInformation& info : m_pending_modules)
+                        {
+                            if (!create_module(info))
+                            {
+                                return false;
+                            }
+                        }
+                        std::vector<ModuleInformation>().swap(m_pending_modules);
+                        m_modules_done = true;
+                    }
+
+                    return true;
+                }
+
+                // the array of data entries is either collected or only located for lazy deserialization
+                template<typename Information>
+                Context begin_data(Information& info)
+                {
+                    if (m_lazy_source != nullptr)
+                    {
+                        m_lazy_begin  = m_stream->Tell() - 1;
+                        m_lazy_target = &info.lazy_data;
+                        return Context::lazy_range;
+                    }
+                    m_data_target = &info.data;
+                    return Context::data;
+                }
+
+                // called after the closing bracket has been consumed
+                void finish_lazy_range()
+                {
+                    *m_lazy_target = std::make_pair(m_lazy_begin, (u64)m_stream->Tell() - m_lazy_begin);
+                }
+
+                void set_data(DataContainer* container, const DataEntries& data, const LazyRange& lazy_data)
+                {
+                    if (lazy_data.has_value())
+                    {
+                        container->set_lazy_data(m_lazy_source, lazy_data->first, lazy_data->second);
+                        return;
+                    }
+                    for (const auto& [category, key, data_type, value] : data)
+                    {
+                        container->set_data(category, key, data_type, value);
+                    }
+                }
+
+                bool add_global(u32 id)
+                {
+                    if (m_id_list == IdList::global_vcc || m_id_list == IdList::global_gnd)
+                    {
+                        if (!m_gates_done)
+                        {
+                            m_pending_global_gates.emplace_back(m_id_list, id);
+                            return true;
+                        }
+                    }
+                    else if (!m_nets_done)
+                    {
+                        m_pending_global_nets.emplace_back(m_id_list, id);
+                        return true;
+                    }
+                    return mark_global(m_id_list, id);
+                }
+
+                bool mark_pending_globals(std::vector<std::pair<IdList, u32>>& pending)
+                {
+                    for (const auto& [id_list, id] : pending)
+                    {
+                        if (!mark_global(id_list, id))
+                        {
+                            return false;
+                        }
+                    }
+                    pending.clear();
+                    return true;
+                }
+
+                bool mark_global(IdList id_list, u32 id)
+                {
+                    switch (id_list)
+                    {
+                        case IdList::global_vcc:
+                            if (!m_nl->mark_vcc_gate(m_nl->get_gate_by_id(id)))
+                            {
+                                log_error("netlist_persistent", "could not deserialize netlist: failed to mark VCC gate");
+                                return false;
+                            }
+                            break;
+                        case IdList::global_gnd:
+                            if (!m_nl->mark_gnd_gate(m_nl->get_gate_by_id(id)))
+                            {
+                                log_error("netlist_persistent", "could not deserialize netlist: failed to mark GND gate");
+                                return false;
+                            }
+                            break;
+                        case IdList::global_in:
+                            if (!m_nl->mark_global_input_net(m_nl->get_net_by_id(id)))
+                            {
+                                log_error("netlist_persistent", "could not deserialize netlist: failed to mark global input net");
+                                return false;
+                            }
+                            break;
+                        case IdList::global_out:
+                            if (!m_nl->mark_global_output_net(m_nl->get_net_by_id(id)))
+                            {
+                                log_error("netlist_persistent", "could not deserialize netlist: failed to mark global output net");
+                                return false;
+                            }
+                            break;
+                    }
+                    return true;
+                }
+
+                bool finish_gate()
+                {
+                    // gates are buffered until the gate library is known
+                    if (m_nl == nullptr)
+                    {
+                        m_pending_gates.push_back(std::move(m_gate));
+                        return true;
+                    }
+                    return create_gate(m_gate);
+                }
+
+                bool create_gate(GateInformation& info)
+                {
+                    if (!info.id.has_value())
+                    {
+                        log_error("netlist_persistent", "could not deserialize gate '" + info.name + "': gate has no ID");
+                        return false;
+                    }
+                    const std::string id_str = std::to_string(info.id.value());
+
+                    const auto it = m_gate_types.find(info.type);
+                    if (it == m_gate_types.end())
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize gate '" + info.name + "' with ID " + id_str + ": failed to find gate '" + info.type + "' in gate library '"
+                                      + m_nl->get_gate_library()->get_name() + "'");
+                        return false;
+                    }
+
+                    Gate* gate = m_nl->create_gate(info.id.value(), it->second, info.name);
+                    if (gate == nullptr)
+                    {
+                        log_error("netlist_persistent", "could not deserialize gate '" + info.name + "' with ID " + id_str + ": failed to create gate");
+                        return false;
+                    }
+
+                    set_data(gate, info.data, info.lazy_data);
+
+                    if (info.lazy_functions.has_value())
+                    {
+                        gate->set_lazy_boolean_functions(m_lazy_source, info.lazy_functions->first, info.lazy_functions->second);
+                    }
+
+                    // Boolean functions are parsed in parallel once all gates have been read
+                    for (auto& [name, function_str] : info.functions)
+                    {
+                        m_function_cache.push_back({gate, std::move(name), std::move(function_str)});
+                    }
+
+                    return true;
+                }
+
+                bool add_endpoint(Net* net, const EndpointInformation& ep, bool is_source)
+                {
+                    const std::string kind = is_source ? "source" : "destination";
+
+                    Gate* gate = m_nl->get_gate_by_id(ep.gate_id);
+                    if (gate == nullptr)
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize " + kind + " of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get gate with ID "
+                                      + std::to_string(ep.gate_id));
+                        return false;
+                    }
+
+                    GatePin* pin;
+                    if (ep.pin_id.has_value())
+                    {
+                        pin = gate->get_type()->get_pin_by_id(ep.pin_id.value());
+                        if (pin == nullptr)
+                        {
+                            log_error("netlist_persistent",
+                                      "could not deserialize " + kind + " of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get pin with ID "
+                                          + std::to_string(ep.pin_id.value()));
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        // legacy code for backward compatibility
+                        pin = gate->get_type()->get_pin_by_name(ep.pin_name);
+                        if (pin == nullptr)
+                        {
+                            log_error("netlist_persistent",
+                                      "could not deserialize " + kind + " of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to get pin with name '" + ep.pin_name
+                                          + "'");
+                            return false;
+                        }
+                    }
+
+                    if ((is_source ? net->add_source(gate, pin) : net->add_destination(gate, pin)) == nullptr)
+                    {
+                        log_error("netlist_persistent",
+                                  "could not deserialize " + kind + " of net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()) + ": failed to add pin '" + pin->get_name()
+                                      + "' as " + kind + " to net '" + net->get_name() + "' with ID " + std::to_string(net->get_id()));
+                        return false;
+                    }
+                    return true;
+                }
+
+                bool finish_net()
+                {
+                    // nets are buffered until all gates exist
+                    if (!m_gates_done)
+                    {
+                        m_pending_nets.push_back(std::move(m_net));
+                        return true;
+                    }
+                    return create_net(m_net);
+                }
+
+                bool create_net(NetInformation& info)
+                {
+                    if (!info.id.has_value())
+                    {
+                        log_error("netlist_persistent", "could not deserialize net '" + info.name + "': net has no ID");
+                        return false;
+                    }
+
+                    Net* net = m_nl->create_net(info.id.value(), info.name);
+                    if (net == nullptr)
+                    {
+                        log_error("netlist_persistent", "could not deserialize net '" + info.name + "' with ID " + std::to_string(info.id.value()) + ": failed to create net");
+                        return false;
+                    }
+
+                    for (const EndpointInformation& ep : info.sources)
+                    {
+                        if (!add_endpoint(net, ep, true))
+                        {
+                            return false;
+                        }
+                    }
+
+                    for (const EndpointInformation& ep : info.destinations)
+                    {
+                        if (!add_endpoint(net, ep, false))
+                        {
+                            return false;
+                        }
+                    }
+
+                    set_data(net, info.data, info.lazy_data);
+
+                    return true;
+                }
+
+                bool finish_module()
+                {
+                    // modules are buffered until all nets exist
+                    if (!m_nets_done)
+                    {
+                        m_pending_modules.push_back(std::move(m_module));
+                        return true;
+                    }
+                    return create_module(m_module);
+                }
+
+                bool create_module(ModuleInformation& info)
+                {
+                    if (!info.id.has_value() || !info.parent_id.has_value())
+                    {
+                        log_error("netlist_persistent", "could not deserialize module '" + info.name + "': module has no ID or parent ID");
+                        return false;
+                    }
+
+                    Module* sm = m_nl->get_top_module();
+                    if (info.parent_id.value() == 0)
+                    {
+                        // top_module must not be created but might be renamed
+                        if (info.name != sm->get_name())
+                        {
+                            sm->set_name(info.name);
+                        }
+                    }
+                    else
+                    {
+                        sm = m_nl->create_module(info.id.value(), info.name, m_nl->get_module_by_id(info.parent_id.value()));
+                        if (sm == nullptr)
+                        {
+                            log_error("netlist_persistent", "could not deserialize module '" + info.name + "' with ID " + std::to_string(info.id.value()) + ": failed to create module");
+                            return false;
+                        }
+
+                        std::vector<Gate*> gates;
+                        gates.reserve(info.gate_ids.size());
+                        for (const u32 gate_id : info.gate_ids)
+                        {
+                            gates.push_back(m_nl->get_gate_by_id(gate_id));
+                        }
+                        sm->assign_gates(gates);
+                    }
+
+                    if (info.type.has_value())
+                    {
+                        sm->set_type(info.type.value());
+                    }
+
+                    set_data(sm, info.data, info.lazy_data);
+
+                    // pins need to be cached until all modules have been instantiated
+                    if (!info.pin_groups.empty())
+                    {
+                        for (PinGroupInformation& pin_group : info.pin_groups)
                         {
-                            pin_group.type = PinType::none;
+                            for (PinGroupInformation::PinInformation& pin : pin_group.pins)
+                            {
+                                pin.net = m_nl->get_net_by_id(pin.net_id);
+                            }
                         }
-                        pin_group.ascending   = json_pin_group["ascending"].GetBool();
-                        pin_group.start_index = json_pin_group["start_index"].GetUint();
 
-                        for (const auto& pin_node : json_pin_group["pins"].GetArray())
-                        {
-                            PinGroupInformation::PinInformation pin;
-                            pin.id   = pin_node["id"].GetUint();
-                            pin.name = pin_node["name"].GetString();
-                            pin.net  = nl->get_net_by_id(pin_node["net_id"].GetUint());
-                            pin.type = enum_from_string<PinType>(pin_node["type"].GetString());
-                            pin_group.pins.push_back(pin);
-                        }
-                        pin_group_cache[sm].push_back(pin_group);
+                        auto& cached_pin_groups = m_pin_group_cache[sm];
+                        std::move(info.pin_groups.begin(), info.pin_groups.end(), std::back_inserter(cached_pin_groups));
                     }
+
+                    return true;
                 }
+            };
 
-                // legacy code below
-                if (val.HasMember("input_ports"))
+            // logs the outcome of streamed deserialization and finishes the netlist
+            std::unique_ptr<Netlist> finish_streamed(const rapidjson::ParseResult& res, NetlistHandler& handler)
+            {
+                if (res.IsError())
                 {
-                    for (const auto& json_pin_legacy : val["input_ports"].GetArray())
+                    // the handler has already logged a more specific error
+                    if (res.Code() != rapidjson::kParseErrorTermination)
                     {
-                        PinGroupInformation pin_group;
-                        pin_group.name = json_pin_legacy["port_name"].GetString();
-                        PinGroupInformation::PinInformation pin;
-                        pin.name = json_pin_legacy["port_name"].GetString();
-                        pin.net  = nl->get_net_by_id(json_pin_legacy["net_id"].GetUint());
-                        pin_group.pins.push_back(pin);
-                        pin_group_cache[sm].push_back(pin_group);
+                        log_error("netlist_persistent", "invalid json string for deserialization");
+                    }
+                    else
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate, net, or module");
                     }
+                    return nullptr;
+                }
+
+                return handler.finish();
+            }
+
+            // if a file is given, data entries and custom Boolean functions are decoded from it on first access
+            std::unique_ptr<Netlist> deserialize(std::string_view data, const GateLibrary* gate_library, std::shared_ptr<const MemoryMappedFile> lazy_file = nullptr)
+            {
+                rapidjson::Reader reader;
+                rapidjson::MemoryStream ms(data.data(), data.size());
+                rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream> is(ms);
+                NetlistHandler handler(&ms, (lazy_file != nullptr) ? std::make_shared<JsonLazyDataSource>(std::move(lazy_file)) : nullptr, gate_library);
+
+                const rapidjson::ParseResult res = reader.Parse(is, handler);
+                return finish_streamed(res, handler);
+            }
+
+            /**
+             * A rapidjson input stream that decompresses its data chunk by chunk.
+             * Decompression errors end the stream early and are reported by get_error().
+             */
+            class DecompressingReadStream
+            {
+            public:
+                typedef char Ch;
+
+                DecompressingReadStream(compression::Decompressor& decompressor) : m_decompressor(decompressor), m_buffer(READ_BUFFER_SIZE)
+                {
+                    m_current = m_buffer.data();
+                    m_last    = m_buffer.data();
+                    read();
                 }
 
-                if (val.HasMember("output_ports"))
+                Ch Peek() const
                 {
-                    for (const auto& json_pin_legacy : val["output_ports"].GetArray())
+                    return *m_current;
+                }
+
+                Ch Take()
+                {
+                    const Ch c = *m_current;
+                    if (m_current + 1 < m_last)
                     {
-                        PinGroupInformation pin_group;
-                        pin_group.name = json_pin_legacy["port_name"].GetString();
-                        PinGroupInformation::PinInformation pin;
-                        pin.name = json_pin_legacy["port_name"].GetString();
-                        pin.net  = nl->get_net_by_id(json_pin_legacy["net_id"].GetUint());
-                        pin_group.pins.push_back(pin);
-                        pin_group_cache[sm].push_back(pin_group);
+                        ++m_current;
+                    }
+                    else
+                    {
+                        read();
                     }
+                    return c;
                 }
-                // legacy code above
 
-                return true;
+                size_t Tell() const
+                {
+                    return m_count + (m_current - m_buffer.data());
+                }
+
+                // not implemented, the stream is read-only
+                Ch* PutBegin()
+                {
+                    return nullptr;
+                }
+                void Put(Ch)
+                {
+                }
+                void Flush()
+                {
+                }
+                size_t PutEnd(Ch*)
+                {
+                    return 0;
+                }
+
+                /**
+                 * Get the data that has been decompressed but not yet consumed.
+                 *
+                 * @returns The buffered data.
+                 */
+                std::string_view get_buffered() const
+                {
+                    return m_eof ? std::string_view() : std::string_view(m_current, m_last - m_current);
+                }
+
+                const std::string& get_error() const
+                {
+                    return m_error;
+                }
+
+            private:
+                void read()
+                {
+                    if (m_eof)
+                    {
+                        return;
+                    }
+
+                    m_count += m_last - m_buffer.data();
+                    auto res = m_decompressor.read(m_buffer.data(), m_buffer.size() - 1);
+                    if (res.is_error())
+                    {
+                        m_error = res.get_error().get();
+                    }
+                    const u64 size = res.is_ok() ? res.get() : 0;
+
+                    // a terminating '\0' signals the end of the stream to the reader
+                    m_eof              = (size == 0);
+                    m_buffer[size]     = '\0';
+                    m_current          = m_buffer.data();
+                    m_last             = m_buffer.data() + (m_eof ? 1 : size);
+                }
+
+                compression::Decompressor& m_decompressor;
+                std::vector<Ch> m_buffer;
+                const Ch* m_current = nullptr;
+                const Ch* m_last    = nullptr;
+                size_t m_count      = 0;
+                bool m_eof          = false;
+                std::string m_error;
+            };
+
+            /**
+             * Deserialize a compressed .hal file while decompressing it chunk by chunk, so that the decompressed file is never held in memory as a whole.
+             *
+             * @param[in] data - The compressed contents of the file.
+             * @param[in] gate_library - The gate library of the netlist, or a nullptr to load the gate library referenced by the file.
+             * @param[out] requires_decompression - Set if the file is in the binary format, which requires random access and has to be decompressed as a whole instead.
+             * @returns The netlist on success, a nullptr otherwise.
+             */
+            std::unique_ptr<Netlist> deserialize_compressed(std::string_view data, const GateLibrary* gate_library, bool& requires_decompression)
+            {
+                requires_decompression = false;
+
+                auto decompressor = compression::Decompressor::create(data);
+                if (decompressor.is_error())
+                {
+                    log_error("netlist_persistent", "could not deserialize netlist:\n{}", decompressor.get_error().get());
+                    return nullptr;
+                }
+
+                DecompressingReadStream ds(*decompressor.get());
+                if (netlist_binary_serializer::is_binary_hal(ds.get_buffered()))
+                {
+                    // the binary format requires random access
+                    requires_decompression = true;
+                    return nullptr;
+                }
+
+                rapidjson::Reader reader;
+                rapidjson::EncodedInputStream<rapidjson::UTF8<>, DecompressingReadStream> is(ds);
+                NetlistHandler handler(nullptr, nullptr, gate_library);
+
+                const rapidjson::ParseResult res = reader.Parse(is, handler);
+
+                if (!ds.get_error().empty())
+                {
+                    log_error("netlist_persistent", "could not deserialize netlist:\n{}", ds.get_error());
+                    return nullptr;
+                }
+
+                return finish_streamed(res, handler);
             }
 
-            bool deserialize_module_pins(const std::unordered_map<Module*, std::vector<PinGroupInformation>>& pin_group_cache)
+            // ===== delta records of the netlist journal =====
+
+            template<typename Writer>
+            void serialize_global_ids(const char* key, const std::vector<u32>& unsorted, Writer& writer)
             {
-                for (const auto& [sm, pin_groups] : pin_group_cache)
+                std::vector<u32> ids = unsorted;
+                std::sort(ids.begin(), ids.end());
+                serialize(key, ids, writer);
+            }
+
+            // serialize the current state of all given objects, objects that do not exist anymore are recorded as removed
+            template<typename Writer>
+            void serialize_delta(const Netlist* nl, bool netlist_changed, const std::set<u32>& gate_ids, const std::set<u32>& net_ids, const std::set<u32>& module_ids, Writer& writer)
+            {
+                writer.StartObject();
+                writer.Key("serialization_format_version");
+                writer.Int(SERIALIZATION_FORMAT_VERSION);
+
+                if (netlist_changed)
                 {
-                    for (const PinGroupInformation& pg : pin_groups)
+                    writer.Key("netlist");
+                    writer.StartObject();
+                    writer.Key("id");
+                    writer.Uint(nl->get_id());
+                    writer.Key("input_file");
+                    write_string(writer, nl->get_input_filename().string());
+                    writer.Key("design_name");
+                    write_string(writer, nl->get_design_name());
+                    writer.Key("device_name");
+                    write_string(writer, nl->get_device_name());
+
+                    std::vector<u32> ids;
+                    for (const Gate* gate : nl->get_vcc_gates())
                     {
-                        std::vector<ModulePin*> pins;
-                        for (const PinGroupInformation::PinInformation& p : pg.pins)
+                        ids.push_back(gate->get_id());
+                    }
+                    serialize_global_ids("global_vcc", ids, writer);
+                    ids.clear();
+                    for (const Gate* gate : nl->get_gnd_gates())
+                    {
+                        ids.push_back(gate->get_id());
+                    }
+                    serialize_global_ids("global_gnd", ids, writer);
+                    ids.clear();
+                    for (const Net* net : nl->get_global_input_nets())
+                    {
+                        ids.push_back(net->get_id());
+                    }
+                    serialize_global_ids("global_in", ids, writer);
+                    ids.clear();
+                    for (const Net* net : nl->get_global_output_nets())
+                    {
+                        ids.push_back(net->get_id());
+                    }
+                    serialize_global_ids("global_out", ids, writer);
+                    writer.EndObject();
+                }
+
+                std::vector<u32> removed;
+                writer.Key("gates");
+                writer.StartArray();
+                for (const u32 id : gate_ids)
+                {
+                    if (const Gate* gate = nl->get_gate_by_id(id); gate != nullptr)
+                    {
+                        serialize(gate, writer, true);
+                    }
+                    else
+                    {
+                        removed.push_back(id);
+                    }
+                }
+                writer.EndArray();
+                serialize("removed_gates", removed, writer);
+
+                removed.clear();
+                writer.Key("nets");
+                writer.StartArray();
+                for (const u32 id : net_ids)
+                {
+                    if (const Net* net = nl->get_net_by_id(id); net != nullptr)
+                    {
+                        serialize(net, writer);
+                    }
+                    else
+                    {
+                        removed.push_back(id);
+                    }
+                }
+                writer.EndArray();
+                serialize("removed_nets", removed, writer);
+
+                removed.clear();
+                writer.Key("modules");
+                writer.StartArray();
+                for (const u32 id : module_ids)
+                {
+                    if (const Module* module = nl->get_module_by_id(id); module != nullptr)
+                    {
+                        serialize(module, writer, false);
+                    }
+                    else
+                    {
+                        removed.push_back(id);
+                    }
+                }
+                writer.EndArray();
+                serialize("removed_modules", removed, writer);
+
+                writer.EndObject();
+            }
+
+            std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> deserialize_data_map(const rapidjson::Value& val)
+            {
+                std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> data;
+                if (val.HasMember("data"))
+                {
+                    for (const auto& entry : val["data"].GetArray())
+                    {
+                        data[std::make_tuple(entry[0].GetString(), entry[1].GetString())] = std::make_tuple(entry[2].GetString(), entry[3].GetString());
+                    }
+                }
+                return data;
+            }
+
+            /**
+             * Applies delta records to an existing netlist.<br>
+             * Records contain the complete state of every object they mention, so the last record mentioning an object determines its final state.
+             * References to objects that do not exist (anymore) are skipped, which makes replaying records that are already contained in the netlist harmless.
+             * Module nets and pins are only restored once all records have been applied.
+             */
+            class DeltaApplier
+            {
+            public:
+                DeltaApplier(Netlist* nl) : m_nl(nl), m_gate_types(nl->get_gate_library()->get_gate_types())
+                {
+                    // disable automatically checking module nets
+                    m_nl->enable_automatic_net_checks(false);
+                }
+
+                bool apply(const rapidjson::Document& record)
+                {
+                    if (record.HasMember("netlist"))
+                    {
+                        const auto& root = record["netlist"];
+                        m_nl->set_id(root["id"].GetUint());
+                        m_nl->set_input_filename(root["input_file"].GetString());
+                        m_nl->set_design_name(root["design_name"].GetString());
+                        m_nl->set_device_name(root["device_name"].GetString());
+                    }
+
+                    if (!apply_removals(record))
+                    {
+                        return false;
+                    }
+
+                    if (record.HasMember("gates"))
+                    {
+                        for (const auto& gate_node : record["gates"].GetArray())
                         {
-                            u32 pid = (p.id > 0) ? (u32)p.id : sm->get_unique_pin_id();
-                            if (auto res = sm->create_pin(pid, p.name, p.net, p.type, false); res.is_error())
+                            if (!apply_gate(gate_node))
                             {
-                                log_error("netlist_persistent",
-                                          "could not deserialize pin '" + p.name + "' of module '" + sm->get_name() + "' with ID " + std::to_string(sm->get_id()) + ": failed to create pin\n{}",
-                                          res.get_error().get());
                                 return false;
                             }
-                            else
+                        }
+                    }
+
+                    if (record.HasMember("modules") && !apply_modules(record["modules"]))
+                    {
+                        return false;
+                    }
+
+                    // gates are assigned to their modules once all modules of the record exist
+                    if (record.HasMember("gates"))
+                    {
+                        for (const auto& gate_node : record["gates"].GetArray())
+                        {
+                            Gate* gate     = m_nl->get_gate_by_id(gate_node["id"].GetUint());
+                            Module* module = m_nl->get_module_by_id(gate_node["module"].GetUint());
+                            if (module == nullptr)
                             {
-                                pins.push_back(res.get());
+                                log_warning("netlist_persistent", "skipping module assignment of gate '{}' with ID {}: module does not exist", gate->get_name(), gate->get_id());
+                                continue;
+                            }
+                            if (gate->get_module() != module)
+                            {
+                                module->assign_gate(gate);
                             }
                         }
-                        u32 pgid = (pg.id > 0) ? (u32)pg.id : sm->get_unique_pin_group_id();
-                        if (auto res = sm->create_pin_group(pgid, pg.name, pins, pg.direction, pg.type, pg.ascending, pg.start_index); res.is_error())
+                    }
+
+                    if (record.HasMember("nets") && !apply_nets(record["nets"]))
+                    {
+                        return false;
+                    }
+
+                    if (record.HasMember("netlist"))
+                    {
+                        apply_globals(record["netlist"]);
+                    }
+
+                    return true;
+                }
+
+                bool finish()
+                {
+                    // update module nets, internal nets, input nets, and output nets
+                    m_nl->update_module_nets();
+
+                    // restore the pins of all modules mentioned in a record (nets must have been updated beforehand)
+                    std::unordered_map<Module*, std::vector<PinGroupInformation>> pin_group_cache;
+                    for (const auto& [module_id, pin_groups] : m_module_pins)
+                    {
+                        Module* module = m_nl->get_module_by_id(module_id);
+                        if (module == nullptr)
                         {
-                            log_error("netlist_persistent",
-                                      "could not deserialize pin group '" + pg.name + "' of module '" + sm->get_name() + "' with ID " + std::to_string(sm->get_id())
-                                          + ": failed to create pin group\n{}",
-                                      res.get_error().get());
+                            continue;
+                        }
+
+                        if (auto res = module->clear_pins(); res.is_error())
+                        {
+                            log_error("netlist_persistent", "could not apply journal record: failed to restore pins of module\n{}", res.get_error().get());
                             return false;
                         }
+
+                        if (pin_groups->IsArray())
+                        {
+                            deserialize_pin_groups(m_nl, module, *pin_groups, pin_group_cache);
+                        }
+                    }
+
+                    if (!deserialize_module_pins(pin_group_cache))
+                    {
+                        log_error("netlist_persistent", "could not apply journal record: failed to deserialize module pins");
+                        return false;
+                    }
+
+                    // re-enable automatically checking module nets
+                    m_nl->enable_automatic_net_checks(true);
+
+                    return true;
+                }
+
+            private:
+                Netlist* m_nl;
+                std::unordered_map<std::string, GateType*> m_gate_types;
+                std::map<u32, std::unique_ptr<rapidjson::Document>> m_module_pins;
+
+                bool apply_removals(const rapidjson::Document& record)
+                {
+                    if (record.HasMember("removed_modules"))
+                    {
+                        for (const auto& id_node : record["removed_modules"].GetArray())
+                        {
+                            if (Module* module = m_nl->get_module_by_id(id_node.GetUint()); module != nullptr && !m_nl->delete_module(module))
+                            {
+                                log_error("netlist_persistent", "could not apply journal record: failed to delete module '{}' with ID {}", module->get_name(), module->get_id());
+                                return false;
+                            }
+                        }
+                    }
+
+                    if (record.HasMember("removed_nets"))
+                    {
+                        for (const auto& id_node : record["removed_nets"].GetArray())
+                        {
+                            if (Net* net = m_nl->get_net_by_id(id_node.GetUint()); net != nullptr && !m_nl->delete_net(net))
+                            {
+                                log_error("netlist_persistent", "could not apply journal record: failed to delete net '{}' with ID {}", net->get_name(), net->get_id());
+                                return false;
+                            }
+                        }
+                    }
+
+                    if (record.HasMember("removed_gates"))
+                    {
+                        for (const auto& id_node : record["removed_gates"].GetArray())
+                        {
+                            if (Gate* gate = m_nl->get_gate_by_id(id_node.GetUint()); gate != nullptr && !m_nl->delete_gate(gate))
+                            {
+                                log_error("netlist_persistent", "could not apply journal record: failed to delete gate '{}' with ID {}", gate->get_name(), gate->get_id());
+                                return false;
+                            }
+                        }
                     }
+
+                    return true;
                 }
-                return true;
-            }
 
-            // serialize netlist
-            void serialize(const Netlist* nl, rapidjson::Document& document)
-            {
-                rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-                rapidjson::Value root(rapidjson::kObjectType);
+                bool apply_gate(const rapidjson::Value& val)
+                {
+                    Gate* gate = m_nl->get_gate_by_id(val["id"].GetUint());
+
+                    // the gate type cannot be changed, hence a gate ID that has been reused for a gate of another type is replaced
+                    if (gate != nullptr && gate->get_type()->get_name() != val["type"].GetString())
+                    {
+                        if (!m_nl->delete_gate(gate))
+                        {
+                            log_error("netlist_persistent", "could not apply journal record: failed to replace gate '{}' with ID {}", gate->get_name(), gate->get_id());
+                            return false;
+                        }
+                        gate = nullptr;
+                    }
+
+                    std::vector<FunctionInformation> function_cache;
+                    if (gate == nullptr)
+                    {
+                        return deserialize_gate(m_nl, val, m_gate_types, function_cache) && deserialize_custom_functions(function_cache);
+                    }
 
-                root.AddMember("gate_library", nl->get_gate_library()->get_path().string(), allocator);
-                root.AddMember("id", nl->get_id(), allocator);
-                root.AddMember("input_file", nl->get_input_filename().string(), allocator);
-                root.AddMember("design_name", nl->get_design_name(), allocator);
-                root.AddMember("device_name", nl->get_device_name(), allocator);
+                    gate->set_name(val["name"].GetString());
+                    gate->set_data_map(deserialize_data_map(val));
+                    if (val.HasMember("custom_functions"))
+                    {
+                        auto functions = val["custom_functions"].GetObject();
+                        for (auto f_it = functions.MemberBegin(); f_it != functions.MemberEnd(); ++f_it)
+                        {
+                            function_cache.push_back({gate, f_it->name.GetString(), f_it->value.GetString()});
+                        }
+                    }
+                    return deserialize_custom_functions(function_cache);
+                }
 
+                bool apply_modules(const rapidjson::Value& modules)
                 {
-                    rapidjson::Value gates(rapidjson::kArrayType);
-                    rapidjson::Value global_vccs(rapidjson::kArrayType);
-                    rapidjson::Value global_gnds(rapidjson::kArrayType);
-                    std::vector<Gate*> sorted = nl->get_gates();
-                    std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
-                    for (const Gate* gate : sorted)
+                    std::vector<std::pair<Module*, u32>> parents;
+                    for (const auto& val : modules.GetArray())
                     {
-                        gates.PushBack(serialize(gate, allocator), allocator);
+                        const u32 module_id           = val["id"].GetUint();
+                        const std::string module_name = val["name"].GetString();
 
-                        if (nl->is_gnd_gate(gate))
+                        Module* module = m_nl->get_module_by_id(module_id);
+                        if (module == nullptr)
+                        {
+                            // the actual parent might be part of the same record, so it is assigned afterwards
+                            module = m_nl->create_module(module_id, module_name, m_nl->get_top_module());
+                            if (module == nullptr)
+                            {
+                                log_error("netlist_persistent", "could not apply journal record: failed to create module '{}' with ID {}", module_name, module_id);
+                                return false;
+                            }
+                        }
+                        else
                         {
-                            global_gnds.PushBack(gate->get_id(), allocator);
+                            module->set_name(module_name);
                         }
 
-                        if (nl->is_vcc_gate(gate))
+                        if (val.HasMember("type"))
                         {
-                            global_vccs.PushBack(gate->get_id(), allocator);
+                            module->set_type(val["type"].GetString());
                         }
-                    }
-                    root.AddMember("gates", gates, allocator);
-                    root.AddMember("global_vcc", global_vccs, allocator);
-                    root.AddMember("global_gnd", global_gnds, allocator);
-                }
-                {
-                    rapidjson::Value nets(rapidjson::kArrayType);
-                    rapidjson::Value global_in(rapidjson::kArrayType);
-                    rapidjson::Value global_out(rapidjson::kArrayType);
-                    std::vector<Net*> sorted = nl->get_nets();
-                    std::sort(sorted.begin(), sorted.end(), [](Net* lhs, Net* rhs) { return lhs->get_id() < rhs->get_id(); });
-                    for (const Net* net : sorted)
-                    {
-                        nets.PushBack(serialize(net, allocator), allocator);
+                        module->set_data_map(deserialize_data_map(val));
 
-                        if (nl->is_global_input_net(net))
+                        if (const u32 parent_id = val["parent"].GetUint(); parent_id != 0)
                         {
-                            global_in.PushBack(net->get_id(), allocator);
+                            parents.emplace_back(module, parent_id);
                         }
 
-                        if (nl->is_global_output_net(net))
+                        // pins are restored once all records have been applied, only the latest state of each module is kept
+                        auto pin_groups = std::make_unique<rapidjson::Document>();
+                        if (val.HasMember("pin_groups"))
                         {
-                            global_out.PushBack(net->get_id(), allocator);
+                            pin_groups->CopyFrom(val["pin_groups"], pin_groups->GetAllocator());
                         }
+                        m_module_pins[module_id] = std::move(pin_groups);
                     }
-                    root.AddMember("nets", nets, allocator);
-                    root.AddMember("global_in", global_in, allocator);
-                    root.AddMember("global_out", global_out, allocator);
-                }
-                {
-                    rapidjson::Value modules(rapidjson::kArrayType);
 
-                    // module ids are not sorted to preserve hierarchy
-                    std::queue<const Module*> q;
-                    q.push(nl->get_top_module());
-                    while (!q.empty())
+                    // a module can only be moved below a new parent once that parent is no longer one of its submodules
+                    while (!parents.empty())
                     {
-                        const Module* module = q.front();
-                        q.pop();
-
-                        modules.PushBack(serialize(module, allocator), allocator);
+                        const size_t remaining = parents.size();
+                        for (auto it = parents.begin(); it != parents.end();)
+                        {
+                            auto [module, parent_id] = *it;
+                            Module* parent           = m_nl->get_module_by_id(parent_id);
+                            if (parent == nullptr)
+                            {
+                                log_warning("netlist_persistent", "skipping parent of module '{}' with ID {}: module with ID {} does not exist", module->get_name(), module->get_id(), parent_id);
+                                it = parents.erase(it);
+                            }
+                            else if (module->get_parent_module() == parent || (!module->is_parent_module_of(parent, true) && module->set_parent_module(parent)))
+                            {
+                                it = parents.erase(it);
+                            }
+                            else
+                            {
+                                ++it;
+                            }
+                        }
 
-                        for (const Module* sm : module->get_submodules())
+                        if (parents.size() == remaining)
                         {
-                            q.push(sm);
+                            log_error("netlist_persistent", "could not apply journal record: module hierarchy contains a cycle");
+                            return false;
                         }
                     }
-                    root.AddMember("modules", modules, allocator);
-                }
 
-                document.AddMember("netlist", root, document.GetAllocator());
-            }
-
-            std::unique_ptr<Netlist> deserialize(const rapidjson::Document& document)
-            {
-                if (!document.HasMember("netlist"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: file has no 'netlist' node");
-                    return nullptr;
-                }
-                auto root = document["netlist"].GetObject();
-                if (!root.HasMember("gate_library"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'gate_library'");
-                    return nullptr;
+                    return true;
                 }
 
-                std::filesystem::path glib_path(root["gate_library"].GetString());
+                bool apply_nets(const rapidjson::Value& nets)
+                {
+                    using EndpointSet = std::set<std::pair<Gate*, GatePin*>>;
 
-                GateLibrary* glib = gate_library_manager::get_gate_library(glib_path.string());
+                    const auto get_endpoints = [this](const rapidjson::Value& val, const char* key) {
+                        EndpointSet endpoints;
+                        if (val.HasMember(key))
+                        {
+                            for (const auto& ep_node : val[key].GetArray())
+                            {
+                                Gate* gate = m_nl->get_gate_by_id(ep_node["gate_id"].GetUint());
+                                if (gate == nullptr)
+                                {
+                                    log_warning("netlist_persistent", "skipping endpoint of net with ID {}: gate with ID {} does not exist", val["id"].GetUint(), ep_node["gate_id"].GetUint());
+                                    continue;
+                                }
+                                if (GatePin* pin = gate->get_type()->get_pin_by_id(ep_node["pin_id"].GetUint()); pin != nullptr)
+                                {
+                                    endpoints.emplace(gate, pin);
+                                }
+                            }
+                        }
+                        return endpoints;
+                    };
 
-                if (glib == nullptr)
-                {
-                    if (glib_path.extension() == ".hgl")
-                    {
-                        glib_path.replace_extension(".lib");
-                    }
-                    else
+                    // endpoints are removed from all nets of the record before any endpoint is added, since pins may have moved between nets
+                    std::vector<std::tuple<Net*, EndpointSet, EndpointSet>> connections;
+                    for (const auto& val : nets.GetArray())
                     {
-                        glib_path.replace_extension(".hgl");
-                    }
+                        const u32 net_id           = val["id"].GetUint();
+                        const std::string net_name = val["name"].GetString();
 
-                    glib = gate_library_manager::get_gate_library(glib_path.string());
-                    if (glib == nullptr)
-                    {
-                        log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '" + std::string(root["gate_library"].GetString()) + "'");
-                        return nullptr;
+                        Net* net = m_nl->get_net_by_id(net_id);
+                        if (net == nullptr)
+                        {
+                            net = m_nl->create_net(net_id, net_name);
+                            if (net == nullptr)
+                            {
+                                log_error("netlist_persistent", "could not apply journal record: failed to create net '{}' with ID {}", net_name, net_id);
+                                return false;
+                            }
+                        }
+                        else
+                        {
+                            net->set_name(net_name);
+                        }
+                        net->set_data_map(deserialize_data_map(val));
+
+                        EndpointSet sources      = get_endpoints(val, "srcs");
+                        EndpointSet destinations = get_endpoints(val, "dsts");
+                        for (Endpoint* ep : net->get_sources())
+                        {
+                            if (sources.erase({ep->get_gate(), ep->get_pin()}) == 0)
+                            {
+                                net->remove_source(ep);
+                            }
+                        }
+                        for (Endpoint* ep : net->get_destinations())
+                        {
+                            if (destinations.erase({ep->get_gate(), ep->get_pin()}) == 0)
+                            {
+                                net->remove_destination(ep);
+                            }
+                        }
+                        connections.emplace_back(net, std::move(sources), std::move(destinations));
                     }
-                    else
+
+                    for (const auto& [net, sources, destinations] : connections)
                     {
-                        log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", root["gate_library"].GetString(), glib_path.string());
+                        for (const auto& [gate, pin] : sources)
+                        {
+                            if (net->add_source(gate, pin) == nullptr)
+                            {
+                                log_error("netlist_persistent", "could not apply journal record: failed to add source to net '{}' with ID {}", net->get_name(), net->get_id());
+                                return false;
+                            }
+                        }
+                        for (const auto& [gate, pin] : destinations)
+                        {
+                            if (net->add_destination(gate, pin) == nullptr)
+                            {
+                                log_error("netlist_persistent", "could not apply journal record: failed to add destination to net '{}' with ID {}", net->get_name(), net->get_id());
+                                return false;
+                            }
+                        }
                     }
-                }
-
-                auto nl = std::make_unique<Netlist>(glib);
-
-                // disable automatically checking module nets
-                nl->enable_automatic_net_checks(false);
-
-                if (!root.HasMember("id"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'id'");
-                    return nullptr;
-                }
-                nl->set_id(root["id"].GetUint());
-
-                if (!root.HasMember("input_file"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'input_file'");
-                    return nullptr;
-                }
-                nl->set_input_filename(root["input_file"].GetString());
 
-                if (!root.HasMember("design_name"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'design_name'");
-                    return nullptr;
+                    return true;
                 }
-                nl->set_design_name(root["design_name"].GetString());
 
-                if (!root.HasMember("device_name"))
+                void apply_globals(const rapidjson::Value& root)
                 {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'device_name'");
-                    return nullptr;
-                }
-                nl->set_device_name(root["device_name"].GetString());
+                    const auto get_ids = [](const rapidjson::Value& val, const char* key) {
+                        std::set<u32> ids;
+                        if (val.HasMember(key))
+                        {
+                            for (const auto& id_node : val[key].GetArray())
+                            {
+                                ids.insert(id_node.GetUint());
+                            }
+                        }
+                        return ids;
+                    };
 
-                if (!root.HasMember("gates"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'gates'");
-                    return nullptr;
-                }
-                auto gate_types = nl->get_gate_library()->get_gate_types();
-                for (auto& gate_node : root["gates"].GetArray())
-                {
-                    if (!deserialize_gate(nl.get(), gate_node, gate_types))
+                    // copies are required since unmarking modifies the underlying vectors
+                    const std::set<u32> vcc_ids = get_ids(root, "global_vcc");
+                    for (Gate* gate : std::vector<Gate*>(m_nl->get_vcc_gates()))
                     {
-                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate");
-                        return nullptr;
+                        if (vcc_ids.find(gate->get_id()) == vcc_ids.end())
+                        {
+                            m_nl->unmark_vcc_gate(gate);
+                        }
                     }
-                }
-
-                if (!root.HasMember("global_vcc"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'global_vcc'");
-                    return nullptr;
-                }
-                for (auto& gate_node : root["global_vcc"].GetArray())
-                {
-                    if (!nl->mark_vcc_gate(nl->get_gate_by_id(gate_node.GetUint())))
+                    for (const u32 id : vcc_ids)
                     {
-                        log_error("netlist_persistent", "could not deserialize netlist: failed to mark VCC gate");
-                        return nullptr;
+                        if (Gate* gate = m_nl->get_gate_by_id(id); gate != nullptr && !m_nl->is_vcc_gate(gate))
+                        {
+                            m_nl->mark_vcc_gate(gate);
+                        }
                     }
-                }
 
-                if (!root.HasMember("global_gnd"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'global_gnd'");
-                    return nullptr;
-                }
-                for (auto& gate_node : root["global_gnd"].GetArray())
-                {
-                    if (!nl->mark_gnd_gate(nl->get_gate_by_id(gate_node.GetUint())))
+                    const std::set<u32> gnd_ids = get_ids(root, "global_gnd");
+                    for (Gate* gate : std::vector<Gate*>(m_nl->get_gnd_gates()))
                     {
-                        log_error("netlist_persistent", "could not deserialize netlist: failed to mark GND gate");
-                        return nullptr;
+                        if (gnd_ids.find(gate->get_id()) == gnd_ids.end())
+                        {
+                            m_nl->unmark_gnd_gate(gate);
+                        }
                     }
-                }
-
-                if (!root.HasMember("nets"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'nets'");
-                    return nullptr;
-                }
-                for (auto& net_node : root["nets"].GetArray())
-                {
-                    if (!deserialize_net(nl.get(), net_node))
+                    for (const u32 id : gnd_ids)
                     {
-                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize net");
-                        return nullptr;
+                        if (Gate* gate = m_nl->get_gate_by_id(id); gate != nullptr && !m_nl->is_gnd_gate(gate))
+                        {
+                            m_nl->mark_gnd_gate(gate);
+                        }
                     }
-                }
 
-                if (!root.HasMember("global_in"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'global_in'");
-                    return nullptr;
-                }
-                for (auto& net_node : root["global_in"].GetArray())
-                {
-                    if (!nl->mark_global_input_net(nl->get_net_by_id(net_node.GetUint())))
+                    const std::set<u32> in_ids = get_ids(root, "global_in");
+                    for (Net* net : std::vector<Net*>(m_nl->get_global_input_nets()))
                     {
-                        log_error("netlist_persistent", "could not deserialize netlist: failed to mark global input net");
-                        return nullptr;
+                        if (in_ids.find(net->get_id()) == in_ids.end())
+                        {
+                            m_nl->unmark_global_input_net(net);
+                        }
                     }
-                }
-
-                if (!root.HasMember("global_out"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'global_out'");
-                    return nullptr;
-                }
-                for (auto& net_node : root["global_out"].GetArray())
-                {
-                    if (!nl->mark_global_output_net(nl->get_net_by_id(net_node.GetUint())))
+                    for (const u32 id : in_ids)
                     {
-                        log_error("netlist_persistent", "could not deserialize netlist: failed to mark global output net");
-                        return nullptr;
+                        if (Net* net = m_nl->get_net_by_id(id); net != nullptr && !m_nl->is_global_input_net(net))
+                        {
+                            m_nl->mark_global_input_net(net);
+                        }
                     }
-                }
 
-                if (!root.HasMember("modules"))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'modules'");
-                    return nullptr;
-                }
-                std::unordered_map<Module*, std::vector<PinGroupInformation>> pin_group_cache;
-                for (auto& module_node : root["modules"].GetArray())
-                {
-                    if (!deserialize_module(nl.get(), module_node, pin_group_cache))
+                    const std::set<u32> out_ids = get_ids(root, "global_out");
+                    for (Net* net : std::vector<Net*>(m_nl->get_global_output_nets()))
                     {
-                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module");
-                        return nullptr;
+                        if (out_ids.find(net->get_id()) == out_ids.end())
+                        {
+                            m_nl->unmark_global_output_net(net);
+                        }
+                    }
+                    for (const u32 id : out_ids)
+                    {
+                        if (Net* net = m_nl->get_net_by_id(id); net != nullptr && !m_nl->is_global_output_net(net))
+                        {
+                            m_nl->mark_global_output_net(net);
+                        }
                     }
                 }
-
-                // update module nets, internal nets, input nets, and output nets
-                for (Module* mod : nl->get_modules())
-                {
-                    mod->update_nets();
-                }
-
-                // load module pins (nets must have been updated beforehand)
-                if (!deserialize_module_pins(pin_group_cache))
-                {
-                    log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module pins");
-                    return nullptr;
-                }
-
-                // re-enable automatically checking module nets
-                nl->enable_automatic_net_checks(true);
-
-                return nl;
-            }
+            };
         }    // namespace
 
-        bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file)
+        bool serialize_to_file(const Netlist* nl, const std::filesystem::path& hal_file, CompressionFormat compression_format)
         {
             if (nl == nullptr)
             {
@@ -856,81 +2538,128 @@ namespace hal
                     return false;
             }
 
-            std::ofstream hal_file_stream;
-            hal_file_stream.open(hal_file.string());
-            if (hal_file_stream.fail())
-            {
-                log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", hal_file.string());
-                return false;
-            }
+            // the netlist is written to a temporary file that replaces the target once complete, since lazily loaded entries may still refer to the target file
+            std::filesystem::path tmp_file = hal_file;
+            tmp_file += ".tmp";
 
-            rapidjson::Document document;
-            document.SetObject();
+            if (compression_format == CompressionFormat::none)
+            {
+                // uncompressed files are streamed to disk through a small buffer
+                std::FILE* fp = std::fopen(tmp_file.string().c_str(), "wb");
+                if (fp == nullptr)
+                {
+                    log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", tmp_file.string());
+                    return false;
+                }
 
-            document.AddMember("serialization_format_version", SERIALIZATION_FORMAT_VERSION, document.GetAllocator());
+                std::vector<char> buffer(WRITE_BUFFER_SIZE);
+                rapidjson::FileWriteStream os(fp, buffer.data(), buffer.size());
+                JsonWriter<rapidjson::FileWriteStream> writer(os);
+                serialize(nl, writer);
+                os.Flush();
 
-            serialize(nl, document);
+                const bool write_failed = std::ferror(fp) != 0;
+                if (std::fclose(fp) != 0 || write_failed)
+                {
+                    log_error("netlist_persistent", "could not write file {}: please verify that there is enough space left on the device", tmp_file.string());
+                    std::filesystem::remove(tmp_file);
+                    return false;
+                }
+            }
+            else
+            {
+                // the compressors operate on the whole output at once
+                rapidjson::StringBuffer strbuf;
+                JsonWriter<rapidjson::StringBuffer> writer(strbuf);
+                serialize(nl, writer);
 
-            rapidjson::StringBuffer strbuf;
-#if PRETTY_JSON_OUTPUT == 1
-            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
-#else
-            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
-#endif
-            document.Accept(writer);
+                if (auto res = compression::write_file(tmp_file, std::string_view(strbuf.GetString(), strbuf.GetSize()), compression_format); res.is_error())
+                {
+                    log_error("netlist_persistent",
+                              "could not open or create file {}: please verify that the file and the containing directory is writable\n{}",
+                              tmp_file.string(),
+                              res.get_error().get());
+                    std::filesystem::remove(tmp_file);
+                    return false;
+                }
+            }
 
-            hal_file_stream << strbuf.GetString();
+            utils::sync_file(tmp_file);
 
-            hal_file_stream.close();
+            std::error_code ec;
+            std::filesystem::rename(tmp_file, hal_file, ec);
+            if (ec)
+            {
+                log_error("netlist_persistent", "could not replace file {}: {}", hal_file.string(), ec.message());
+                std::filesystem::remove(tmp_file);
+                return false;
+            }
 
-            log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
+            if (compression_format == CompressionFormat::none)
+            {
+                log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
+            }
+            else
+            {
+                log_info("netlist_persistent", "serialized netlist ({}-compressed) in {:2.2f} seconds", enum_to_string(compression_format), DURATION(begin_time));
+            }
 
             return true;
         }
 
-        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file)
+        std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, bool lazy, const GateLibrary* gate_library)
         {
             auto begin_time = std::chrono::high_resolution_clock::now();
 
             // event_controls::enable_all(false);
 
-            FILE* pFile = fopen(hal_file.string().c_str(), "rb");
-            if (pFile == NULL)
+            // compressed .hal files are detected by their magic bytes and decompressed while being parsed
+            auto file = MemoryMappedFile::open(hal_file, false);
+            if (file.is_error())
             {
-                log_error("netlist_persistent", "unable to open '{}'.", hal_file.string());
+                log_error("netlist_persistent", "unable to open '{}':\n{}", hal_file.string(), file.get_error().get());
                 return nullptr;
             }
 
-            char buffer[65536];
-            rapidjson::FileReadStream is(pFile, buffer, sizeof(buffer));
-            rapidjson::Document document;
-            document.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(is);
-            fclose(pFile);
-
-            if (document.HasParseError())
+            // lazy mode refers to ranges of the decompressed contents, which hence have to be kept in memory as a whole
+            if (file.get()->get_compression_format() != CompressionFormat::none && !lazy)
             {
-                log_error("netlist_persistent", "invalid json string for deserialization");
-                return nullptr;
+                bool requires_decompression = false;
+                auto netlist                = deserialize_compressed(file.get()->get_data(), gate_library, requires_decompression);
+                if (!requires_decompression)
+                {
+                    if (netlist)
+                    {
+                        log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", hal_file.string(), DURATION(begin_time));
+                    }
+                    return netlist;
+                }
             }
 
-            if (document.HasMember("serialization_format_version"))
+            if (file.get()->get_compression_format() != CompressionFormat::none)
             {
-                u32 encoded_version = document["serialization_format_version"].GetUint();
-                if (encoded_version < SERIALIZATION_FORMAT_VERSION)
+                file = MemoryMappedFile::open(hal_file);
+                if (file.is_error())
                 {
-                    log_warning("netlist_persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
-                }
-                else if (encoded_version > SERIALIZATION_FORMAT_VERSION)
-                {
-                    log_warning("netlist_persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
+                    log_error("netlist_persistent", "unable to open '{}':\n{}", hal_file.string(), file.get_error().get());
+                    return nullptr;
                 }
             }
-            else
+
+            // binary .hal files are recognized by their magic bytes as well
+            if (netlist_binary_serializer::is_binary_hal(file.get()->get_data()))
             {
-                log_warning("netlist_persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
+                auto netlist = netlist_binary_serializer::deserialize_from_mapped_file(std::move(file.get()), lazy, gate_library);
+                if (netlist)
+                {
+                    log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", hal_file.string(), DURATION(begin_time));
+                }
+                return netlist;
             }
 
-            auto netlist = deserialize(document);
+            // the file has to stay mapped as long as objects have not been decoded in lazy mode
+            const std::string_view data = file.get()->get_data();
+            auto netlist                = lazy ? deserialize(data, gate_library, std::move(file.get())) : deserialize(data, gate_library);
 
             if (netlist)
             {
@@ -940,6 +2669,47 @@ namespace hal
             // event_controls::enable_all(true);
             return netlist;
         }
+
+        std::string serialize_delta(const Netlist* nl, bool netlist_changed, const std::set<u32>& gate_ids, const std::set<u32>& net_ids, const std::set<u32>& module_ids)
+        {
+            if (nl == nullptr)
+            {
+                return std::string();
+            }
+
+            // records are always written without indentation, one record per line
+            rapidjson::StringBuffer strbuf;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+            serialize_delta(nl, netlist_changed, gate_ids, net_ids, module_ids, writer);
+            return std::string(strbuf.GetString(), strbuf.GetSize());
+        }
+
+        bool deserialize_deltas(Netlist* nl, const std::vector<std::string_view>& records)
+        {
+            if (nl == nullptr)
+            {
+                return false;
+            }
+
+            DeltaApplier applier(nl);
+            for (const std::string_view record : records)
+            {
+                rapidjson::Document document;
+                document.Parse(record.data(), record.size());
+                if (document.HasParseError() || !document.IsObject())
+                {
+                    log_error("netlist_persistent", "could not apply journal record: invalid json string");
+                    return false;
+                }
+
+                if (!applier.apply(document))
+                {
+                    return false;
+                }
+            }
+
+            return applier.finish();
+        }
     }    // namespace netlist_serializer
 }    // namespace hal
 
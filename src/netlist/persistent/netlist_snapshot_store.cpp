@@ -0,0 +1,678 @@
+#include "hal_core/netlist/persistent/netlist_snapshot_store.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/parallel_for_each.h"
+#include "hal_core/utilities/utils.h"
+#include "rapidjson/document.h"
+#include "rapidjson/prettywriter.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+
+namespace hal
+{
+    namespace
+    {
+        // must be increased whenever the layout of manifests or the chunking scheme changes
+        const u32 MANIFEST_VERSION = 1;
+
+        const std::string MANIFEST_EXTENSION = ".json";
+        const std::string CHUNK_DIRECTORY    = "chunks";
+
+        const std::string KIND_MODULES = "modules";
+        const std::string KIND_GATES   = "gates";
+        const std::string KIND_NETS    = "nets";
+        const std::string KIND_NETLIST = "netlist";
+
+        struct Chunk
+        {
+            std::string kind;
+            u32 range;
+            std::string hash;
+            std::string content;
+        };
+
+        struct Manifest
+        {
+            std::string gate_library;
+            std::vector<Chunk> chunks;
+        };
+
+        using ChunkKey = std::pair<std::string, u32>;
+
+        std::string hash_content(std::string_view data)
+        {
+            // FNV-1a, the size is part of the name to further reduce the probability of collisions
+            u64 hash = 0xcbf29ce484222325ULL;
+            for (const char c : data)
+            {
+                hash ^= (u8)c;
+                hash *= 0x100000001b3ULL;
+            }
+
+            char buffer[17];
+            std::snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)hash);
+            return std::string(buffer) + "_" + std::to_string(data.size());
+        }
+
+        bool is_valid_name(const std::string& name)
+        {
+            if (name.empty() || name == "." || name == "..")
+            {
+                return false;
+            }
+            for (const char c : name)
+            {
+                if (!std::isalnum((unsigned char)c) && c != '_' && c != '-' && c != '.')
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool read_file(const std::filesystem::path& file, std::string& content)
+        {
+            std::ifstream ifs(file, std::ios::binary);
+            if (!ifs.good())
+            {
+                return false;
+            }
+            std::stringstream buffer;
+            buffer << ifs.rdbuf();
+            content = buffer.str();
+            return true;
+        }
+
+        // files are written to a temporary file first and renamed afterwards, so that they are either complete or missing
+        bool write_file(const std::filesystem::path& file, const std::string& content)
+        {
+            std::filesystem::path tmp_file = file;
+            tmp_file += ".tmp";
+            {
+                std::ofstream ofs(tmp_file, std::ios::binary | std::ios::trunc);
+                if (!ofs.good())
+                {
+                    log_error("netlist_persistent", "could not open file '{}' for writing.", tmp_file.string());
+                    return false;
+                }
+                ofs.write(content.data(), content.size());
+                if (!ofs.good())
+                {
+                    log_error("netlist_persistent", "could not write file '{}'.", tmp_file.string());
+                    std::filesystem::remove(tmp_file);
+                    return false;
+                }
+            }
+
+            utils::sync_file(tmp_file);
+
+            std::error_code ec;
+            std::filesystem::rename(tmp_file, file, ec);
+            if (ec)
+            {
+                log_error("netlist_persistent", "could not replace file '{}': {}", file.string(), ec.message());
+                std::filesystem::remove(tmp_file);
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * Split the netlist into chunks in the order in which they have to be applied.
+         * Modules come first since gates refer to their module, nets refer to gates, and the netlist properties refer to global gates and nets.
+         */
+        std::vector<Chunk> compute_chunks(const Netlist* nl)
+        {
+            std::map<u32, std::set<u32>> gate_ranges;
+            for (const Gate* gate : nl->get_gates())
+            {
+                gate_ranges[gate->get_id() / NetlistSnapshotStore::CHUNK_SIZE].insert(gate->get_id());
+            }
+            std::map<u32, std::set<u32>> net_ranges;
+            for (const Net* net : nl->get_nets())
+            {
+                net_ranges[net->get_id() / NetlistSnapshotStore::CHUNK_SIZE].insert(net->get_id());
+            }
+
+            // modules refer to their parents by ID in arbitrary order, hence all of them are kept in a single chunk
+            std::set<u32> module_ids;
+            for (const Module* module : nl->get_modules())
+            {
+                module_ids.insert(module->get_id());
+            }
+
+            static const std::set<u32> none;
+            std::vector<Chunk> chunks;
+            std::vector<const std::set<u32>*> ids;
+            chunks.push_back({KIND_MODULES, 0, "", ""});
+            ids.push_back(&module_ids);
+            for (const auto& [range, gate_ids] : gate_ranges)
+            {
+                chunks.push_back({KIND_GATES, range, "", ""});
+                ids.push_back(&gate_ids);
+            }
+            for (const auto& [range, net_ids] : net_ranges)
+            {
+                chunks.push_back({KIND_NETS, range, "", ""});
+                ids.push_back(&net_ids);
+            }
+            chunks.push_back({KIND_NETLIST, 0, "", ""});
+            ids.push_back(&none);
+
+            utils::parallel_for_each(0, (u32)chunks.size(), [nl, &chunks, &ids](u32 i) {
+                Chunk& chunk = chunks[i];
+                if (chunk.kind == KIND_MODULES)
+                {
+                    chunk.content = netlist_serializer::serialize_delta(nl, false, none, none, *ids[i]);
+                }
+                else if (chunk.kind == KIND_GATES)
+                {
+                    chunk.content = netlist_serializer::serialize_delta(nl, false, *ids[i], none, none);
+                }
+                else if (chunk.kind == KIND_NETS)
+                {
+                    chunk.content = netlist_serializer::serialize_delta(nl, false, none, *ids[i], none);
+                }
+                else
+                {
+                    chunk.content = netlist_serializer::serialize_delta(nl, true, none, none, none);
+                }
+                chunk.hash = hash_content(chunk.content);
+            });
+
+            return chunks;
+        }
+
+        std::string serialize_manifest(const Manifest& manifest)
+        {
+            rapidjson::StringBuffer strbuf;
+            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+            writer.StartObject();
+            writer.Key("version");
+            writer.Uint(MANIFEST_VERSION);
+            writer.Key("gate_library");
+            writer.String(manifest.gate_library.c_str(), manifest.gate_library.size());
+            writer.Key("chunks");
+            writer.StartArray();
+            for (const Chunk& chunk : manifest.chunks)
+            {
+                writer.StartObject();
+                writer.Key("kind");
+                writer.String(chunk.kind.c_str(), chunk.kind.size());
+                writer.Key("range");
+                writer.Uint(chunk.range);
+                writer.Key("hash");
+                writer.String(chunk.hash.c_str(), chunk.hash.size());
+                writer.EndObject();
+            }
+            writer.EndArray();
+            writer.EndObject();
+            return std::string(strbuf.GetString(), strbuf.GetSize());
+        }
+
+        Result<Manifest> deserialize_manifest(const std::string& content)
+        {
+            rapidjson::Document document;
+            document.Parse(content.data(), content.size());
+            if (document.HasParseError() || !document.IsObject())
+            {
+                return ERR("manifest is not a valid JSON object");
+            }
+            if (!document.HasMember("version") || !document["version"].IsUint())
+            {
+                return ERR("manifest has no valid version");
+            }
+            if (document["version"].GetUint() != MANIFEST_VERSION)
+            {
+                return ERR("unsupported manifest version " + std::to_string(document["version"].GetUint()));
+            }
+            if (document.HasMember("gate_library") && !document["gate_library"].IsString())
+            {
+                return ERR("manifest has an invalid gate library");
+            }
+            if (!document.HasMember("chunks") || !document["chunks"].IsArray())
+            {
+                return ERR("manifest has no valid list of chunks");
+            }
+
+            Manifest manifest;
+            manifest.gate_library = document.HasMember("gate_library") ? document["gate_library"].GetString() : "";
+            for (const auto& val : document["chunks"].GetArray())
+            {
+                if (!val.IsObject() || !val.HasMember("kind") || !val["kind"].IsString() || !val.HasMember("range") || !val["range"].IsUint() || !val.HasMember("hash") || !val["hash"].IsString())
+                {
+                    return ERR("manifest contains an invalid chunk");
+                }
+
+                const std::string kind = val["kind"].GetString();
+                if (kind != KIND_MODULES && kind != KIND_GATES && kind != KIND_NETS && kind != KIND_NETLIST)
+                {
+                    return ERR("manifest contains a chunk of unknown kind '" + kind + "'");
+                }
+
+                // the hash names the chunk file, hence it must not point outside of the chunk directory
+                const std::string hash = val["hash"].GetString();
+                if (!is_valid_name(hash))
+                {
+                    return ERR("manifest contains a chunk with invalid hash '" + hash + "'");
+                }
+
+                manifest.chunks.push_back({kind, val["range"].GetUint(), hash, ""});
+            }
+            return OK(manifest);
+        }
+
+        /**
+         * Collect the IDs and gate types of the objects contained in a chunk.
+         */
+        bool get_chunk_objects(const std::string& content, const std::string& kind, std::unordered_map<u32, std::string>& objects)
+        {
+            rapidjson::Document document;
+            document.Parse(content.data(), content.size());
+            if (document.HasParseError() || !document.IsObject())
+            {
+                return false;
+            }
+            if (document.HasMember(kind.c_str()))
+            {
+                for (const auto& val : document[kind.c_str()].GetArray())
+                {
+                    objects[val["id"].GetUint()] = val.HasMember("type") ? val["type"].GetString() : "";
+                }
+            }
+            return true;
+        }
+
+        std::string serialize_removals(const std::set<u32>& gate_ids, const std::set<u32>& net_ids, const std::set<u32>& module_ids)
+        {
+            rapidjson::StringBuffer strbuf;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+            const auto write_ids = [&writer](const char* key, const std::set<u32>& ids) {
+                writer.Key(key);
+                writer.StartArray();
+                for (const u32 id : ids)
+                {
+                    writer.Uint(id);
+                }
+                writer.EndArray();
+            };
+
+            writer.StartObject();
+            write_ids("removed_gates", gate_ids);
+            write_ids("removed_nets", net_ids);
+            write_ids("removed_modules", module_ids);
+            writer.EndObject();
+            return std::string(strbuf.GetString(), strbuf.GetSize());
+        }
+    }    // namespace
+
+    NetlistSnapshotStore::NetlistSnapshotStore(const std::filesystem::path& directory) : m_directory(directory)
+    {
+    }
+
+    const std::filesystem::path& NetlistSnapshotStore::get_directory() const
+    {
+        return m_directory;
+    }
+
+    bool NetlistSnapshotStore::create_snapshot(const Netlist* netlist, const std::string& name)
+    {
+        if (netlist == nullptr)
+        {
+            log_error("netlist_persistent", "could not create snapshot '{}': netlist is a 'nullptr'.", name);
+            return false;
+        }
+        if (!is_valid_name(name))
+        {
+            log_error("netlist_persistent", "could not create snapshot '{}': invalid snapshot name.", name);
+            return false;
+        }
+
+        auto begin_time                      = std::chrono::high_resolution_clock::now();
+        const std::filesystem::path chunk_dir = m_directory / CHUNK_DIRECTORY;
+        std::error_code ec;
+        std::filesystem::create_directories(chunk_dir, ec);
+        if (ec)
+        {
+            log_error("netlist_persistent", "could not create snapshot '{}': failed to create directory '{}': {}", name, chunk_dir.string(), ec.message());
+            return false;
+        }
+
+        Manifest manifest;
+        manifest.gate_library = netlist->get_gate_library()->get_path().string();
+        manifest.chunks       = compute_chunks(netlist);
+
+        u32 num_written = 0;
+        for (Chunk& chunk : manifest.chunks)
+        {
+            const std::filesystem::path chunk_file = chunk_dir / chunk.hash;
+            if (!std::filesystem::exists(chunk_file))
+            {
+                if (!write_file(chunk_file, chunk.content))
+                {
+                    log_error("netlist_persistent", "could not create snapshot '{}': failed to write chunk.", name);
+                    return false;
+                }
+                num_written++;
+            }
+            chunk.content.clear();
+        }
+
+        if (!write_file(m_directory / (name + MANIFEST_EXTENSION), serialize_manifest(manifest)))
+        {
+            log_error("netlist_persistent", "could not create snapshot '{}': failed to write manifest.", name);
+            return false;
+        }
+
+        log_info("netlist_persistent",
+                 "created snapshot '{}' with {} chunks ({} new) in {:2.2f} seconds",
+                 name,
+                 manifest.chunks.size(),
+                 num_written,
+                 (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000);
+        return true;
+    }
+
+    bool NetlistSnapshotStore::checkout_snapshot(Netlist* netlist, const std::string& name) const
+    {
+        if (netlist == nullptr)
+        {
+            log_error("netlist_persistent", "could not switch to snapshot '{}': netlist is a 'nullptr'.", name);
+            return false;
+        }
+
+        auto begin_time = std::chrono::high_resolution_clock::now();
+
+        std::string manifest_content;
+        if (!is_valid_name(name) || !read_file(m_directory / (name + MANIFEST_EXTENSION), manifest_content))
+        {
+            log_error("netlist_persistent", "could not switch to snapshot '{}': failed to read manifest.", name);
+            return false;
+        }
+        auto manifest_res = deserialize_manifest(manifest_content);
+        if (manifest_res.is_error())
+        {
+            log_error("netlist_persistent", "could not switch to snapshot '{}':\n{}", name, manifest_res.get_error().get());
+            return false;
+        }
+        Manifest target = manifest_res.get();
+
+        if (netlist->get_gate_library()->get_path().string() != target.gate_library)
+        {
+            log_warning("netlist_persistent", "snapshot '{}' has been created using gate library '{}'.", name, target.gate_library);
+        }
+
+        std::map<ChunkKey, std::string> current_hashes;
+        for (const Chunk& chunk : compute_chunks(netlist))
+        {
+            current_hashes[{chunk.kind, chunk.range}] = chunk.hash;
+        }
+
+        const std::filesystem::path chunk_dir = m_directory / CHUNK_DIRECTORY;
+        const auto load_chunk                 = [&chunk_dir, &name](Chunk& chunk) {
+            if (!chunk.content.empty())
+            {
+                return true;
+            }
+            if (!read_file(chunk_dir / chunk.hash, chunk.content) || hash_content(chunk.content) != chunk.hash)
+            {
+                log_error("netlist_persistent", "could not switch to snapshot '{}': chunk '{}' is missing or corrupted.", name, chunk.hash);
+                return false;
+            }
+            return true;
+        };
+
+        // the netlist chunk is always applied since replacing gates may drop their global markings
+        std::set<u32> changed;
+        std::map<ChunkKey, u32> target_index;
+        for (u32 i = 0; i < target.chunks.size(); i++)
+        {
+            Chunk& chunk = target.chunks[i];
+            target_index[{chunk.kind, chunk.range}] = i;
+            if (auto it = current_hashes.find({chunk.kind, chunk.range}); chunk.kind == KIND_NETLIST || it == current_hashes.end() || it->second != chunk.hash)
+            {
+                if (!load_chunk(chunk))
+                {
+                    return false;
+                }
+                changed.insert(i);
+            }
+        }
+
+        // objects within changed ranges that are not part of the snapshot have to be removed explicitly
+        std::map<ChunkKey, std::unordered_map<u32, std::string>> target_objects;
+        for (const u32 i : changed)
+        {
+            const Chunk& chunk = target.chunks[i];
+            if (chunk.kind != KIND_NETLIST && !get_chunk_objects(chunk.content, chunk.kind, target_objects[{chunk.kind, chunk.range}]))
+            {
+                log_error("netlist_persistent", "could not switch to snapshot '{}': chunk '{}' is invalid.", name, chunk.hash);
+                return false;
+            }
+        }
+
+        std::set<u32> removed_gates;
+        std::set<u32> removed_nets;
+        std::set<u32> removed_modules;
+        std::set<u32> forced_net_ranges;
+        for (Gate* gate : netlist->get_gates())
+        {
+            const ChunkKey key = {KIND_GATES, gate->get_id() / CHUNK_SIZE};
+            auto target_it     = target_index.find(key);
+            if (target_it != target_index.end() && changed.find(target_it->second) == changed.end())
+            {
+                continue;
+            }
+
+            const auto objects_it = target_objects.find(key);
+            if (objects_it == target_objects.end())
+            {
+                removed_gates.insert(gate->get_id());
+                continue;
+            }
+            auto object_it = objects_it->second.find(gate->get_id());
+            if (object_it == objects_it->second.end())
+            {
+                removed_gates.insert(gate->get_id());
+            }
+            else if (object_it->second != gate->get_type()->get_name())
+            {
+                // the gate is replaced by a gate of another type, which drops its connections to nets that may be unchanged otherwise
+                for (const Net* net : gate->get_fan_in_nets())
+                {
+                    forced_net_ranges.insert(net->get_id() / CHUNK_SIZE);
+                }
+                for (const Net* net : gate->get_fan_out_nets())
+                {
+                    forced_net_ranges.insert(net->get_id() / CHUNK_SIZE);
+                }
+            }
+        }
+
+        for (const u32 range : forced_net_ranges)
+        {
+            if (auto it = target_index.find({KIND_NETS, range}); it != target_index.end() && changed.find(it->second) == changed.end())
+            {
+                if (!load_chunk(target.chunks[it->second]))
+                {
+                    return false;
+                }
+                changed.insert(it->second);
+                if (!get_chunk_objects(target.chunks[it->second].content, KIND_NETS, target_objects[{KIND_NETS, range}]))
+                {
+                    log_error("netlist_persistent", "could not switch to snapshot '{}': chunk '{}' is invalid.", name, target.chunks[it->second].hash);
+                    return false;
+                }
+            }
+        }
+
+        for (Net* net : netlist->get_nets())
+        {
+            const ChunkKey key = {KIND_NETS, net->get_id() / CHUNK_SIZE};
+            auto target_it     = target_index.find(key);
+            if (target_it != target_index.end() && changed.find(target_it->second) == changed.end())
+            {
+                continue;
+            }
+
+            const auto objects_it = target_objects.find(key);
+            if (objects_it == target_objects.end() || objects_it->second.find(net->get_id()) == objects_it->second.end())
+            {
+                removed_nets.insert(net->get_id());
+            }
+        }
+
+        if (const auto objects_it = target_objects.find({KIND_MODULES, 0}); objects_it != target_objects.end())
+        {
+            for (Module* module : netlist->get_modules())
+            {
+                if (!module->is_top_module() && objects_it->second.find(module->get_id()) == objects_it->second.end())
+                {
+                    removed_modules.insert(module->get_id());
+                }
+            }
+        }
+
+        std::vector<std::string_view> records;
+        std::string removals;
+        if (!removed_gates.empty() || !removed_nets.empty() || !removed_modules.empty())
+        {
+            removals = serialize_removals(removed_gates, removed_nets, removed_modules);
+            records.push_back(removals);
+        }
+        for (const u32 i : changed)
+        {
+            records.push_back(target.chunks[i].content);
+        }
+
+        if (!netlist_serializer::deserialize_deltas(netlist, records))
+        {
+            log_error("netlist_persistent", "could not switch to snapshot '{}': failed to apply chunks.", name);
+            return false;
+        }
+
+        log_info("netlist_persistent",
+                 "switched to snapshot '{}' applying {} of {} chunks in {:2.2f} seconds",
+                 name,
+                 changed.size(),
+                 target.chunks.size(),
+                 (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000);
+        return true;
+    }
+
+    std::unique_ptr<Netlist> NetlistSnapshotStore::load_snapshot(const std::string& name) const
+    {
+        std::string manifest_content;
+        if (!is_valid_name(name) || !read_file(m_directory / (name + MANIFEST_EXTENSION), manifest_content))
+        {
+            log_error("netlist_persistent", "could not load snapshot '{}': failed to read manifest.", name);
+            return nullptr;
+        }
+        auto manifest_res = deserialize_manifest(manifest_content);
+        if (manifest_res.is_error())
+        {
+            log_error("netlist_persistent", "could not load snapshot '{}':\n{}", name, manifest_res.get_error().get());
+            return nullptr;
+        }
+        Manifest manifest = manifest_res.get();
+
+        GateLibrary* gate_library = gate_library_manager::get_gate_library(manifest.gate_library);
+        if (gate_library == nullptr)
+        {
+            log_error("netlist_persistent", "could not load snapshot '{}': failed to load gate library '{}'.", name, manifest.gate_library);
+            return nullptr;
+        }
+
+        auto netlist = std::make_unique<Netlist>(gate_library);
+        if (!checkout_snapshot(netlist.get(), name))
+        {
+            return nullptr;
+        }
+        return netlist;
+    }
+
+    bool NetlistSnapshotStore::has_snapshot(const std::string& name) const
+    {
+        return is_valid_name(name) && std::filesystem::is_regular_file(m_directory / (name + MANIFEST_EXTENSION));
+    }
+
+    std::vector<std::string> NetlistSnapshotStore::get_snapshot_names() const
+    {
+        std::vector<std::string> names;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(m_directory, ec))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == MANIFEST_EXTENSION)
+            {
+                names.push_back(entry.path().stem().string());
+            }
+        }
+        std::sort(names.begin(), names.end());
+        return names;
+    }
+
+    bool NetlistSnapshotStore::remove_snapshot(const std::string& name)
+    {
+        if (!has_snapshot(name))
+        {
+            log_error("netlist_persistent", "could not remove snapshot '{}': snapshot does not exist.", name);
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::remove(m_directory / (name + MANIFEST_EXTENSION), ec);
+        if (ec)
+        {
+            log_error("netlist_persistent", "could not remove snapshot '{}': {}", name, ec.message());
+            return false;
+        }
+
+        // collect the chunks that are still referenced, keeping all chunks if any manifest cannot be read
+        std::set<std::string> referenced;
+        for (const std::string& other : get_snapshot_names())
+        {
+            std::string content;
+            if (!read_file(m_directory / (other + MANIFEST_EXTENSION), content))
+            {
+                log_warning("netlist_persistent", "keeping all chunks since manifest of snapshot '{}' cannot be read.", other);
+                return true;
+            }
+            auto manifest_res = deserialize_manifest(content);
+            if (manifest_res.is_error())
+            {
+                log_warning("netlist_persistent", "keeping all chunks since manifest of snapshot '{}' cannot be read:\n{}", other, manifest_res.get_error().get());
+                return true;
+            }
+            for (const Chunk& chunk : manifest_res.get().chunks)
+            {
+                referenced.insert(chunk.hash);
+            }
+        }
+
+        for (const auto& entry : std::filesystem::directory_iterator(m_directory / CHUNK_DIRECTORY, ec))
+        {
+            if (entry.is_regular_file() && referenced.find(entry.path().filename().string()) == referenced.end())
+            {
+                std::filesystem::remove(entry.path(), ec);
+            }
+        }
+        return true;
+    }
+}    // namespace hal
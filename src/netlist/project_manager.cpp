@@ -7,9 +7,13 @@
 #include <fstream>
 
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/utils.h"
 #include "hal_core/netlist/project_serializer.h"
 #include "hal_core/netlist/netlist_factory.h"
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+#include "hal_core/netlist/persistent/netlist_journal.h"
 #include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/netlist/persistent/netlist_snapshot_store.h"
 #include "hal_core/netlist/gate_library/gate_library.h"
 #include "hal_core/netlist/netlist.h"
 
@@ -22,13 +26,19 @@
 
 const int SERIALIZATION_FORMAT_VERSION = 10;
 
+// the journal gets merged into the shadow netlist file once it exceeds this fraction of its size
+const int JOURNAL_COMPACTION_RATIO = 4;
+
+// subdirectory of the project directory holding the netlist snapshots
+const std::string SNAPSHOT_DIRECTORY = "snapshots";
+
 namespace hal {
     ProjectManager* ProjectManager::inst = nullptr;
 
     const std::string ProjectManager::s_project_file = ".project.json";
 
     ProjectManager::ProjectManager()
-        : m_project_status(None)
+        : m_project_status(None), m_compression_format(CompressionFormat::none), m_binary_format(false), m_lazy_loading(false), m_shadow_valid(false)
     {;}
 
     ProjectManager* ProjectManager::instance()
@@ -123,23 +133,272 @@ namespace hal {
         m_gatelib_path = glpath;
     }
 
+    void ProjectManager::set_compression_format(CompressionFormat format)
+    {
+        m_compression_format = format;
+    }
+
+    CompressionFormat ProjectManager::get_compression_format() const
+    {
+        return m_compression_format;
+    }
+
+    void ProjectManager::set_binary_format(bool enable)
+    {
+        m_binary_format = enable;
+    }
+
+    bool ProjectManager::get_binary_format() const
+    {
+        return m_binary_format;
+    }
+
+    void ProjectManager::set_lazy_loading(bool enable)
+    {
+        m_lazy_loading = enable;
+    }
+
+    bool ProjectManager::get_lazy_loading() const
+    {
+        return m_lazy_loading;
+    }
+
     bool ProjectManager::serialize_project(Netlist* netlist, bool shadow)
     {
         if (!netlist) return false;
 
+        if (shadow)
+        {
+            wait_for_autosave();
+            if (!start_autosave(netlist)) return false;
+            return wait_for_autosave();
+        }
+
+        // files of a running autosave must not be replaced concurrently
+        wait_for_autosave();
+
         m_netlist_save = netlist;
         const GateLibrary* gl = m_netlist_save->get_gate_library();
         if (gl) m_gatelib_path = gl->get_path().string();
-        if (shadow)
-            m_netlist_file = m_proj_dir.get_shadow_filename(".hal");
+        m_netlist_file = m_proj_dir.get_default_filename(".hal");
+
+        if (m_binary_format)
+        {
+            if (!netlist_binary_serializer::serialize_to_file(m_netlist_save, m_netlist_file, m_compression_format)) return false;
+        }
+        else if (!netlist_serializer::serialize_to_file(m_netlist_save, m_netlist_file, m_compression_format)) return false;
+
+        // journal restored from autosave is contained in the netlist file now
+        std::filesystem::remove(m_proj_dir.get_default_filename(".journal"));
+        attach_journal(m_netlist_save, m_netlist_file, std::string());
+
+        if (!serialize_external(false)) return false;
+
+        return serialize_to_projectfile(false);
+    }
+
+    bool ProjectManager::start_autosave(Netlist* netlist, std::function<void(bool)> on_finished)
+    {
+        if (!netlist) return false;
+
+        if (is_autosave_running())
+        {
+            log_info("project_manager", "previous autosave still in progress, skipping.");
+            return false;
+        }
+        wait_for_autosave();
+
+        m_netlist_save = netlist;
+        const GateLibrary* gl = m_netlist_save->get_gate_library();
+        if (gl) m_gatelib_path = gl->get_path().string();
+        m_netlist_file = m_proj_dir.get_shadow_filename(".hal");
+        std::filesystem::create_directory(m_proj_dir.get_filename(ProjectDirectory::s_shadow_dir));
+
+        std::function<bool()> writeNetlist = capture_shadow_netlist();
+        if (!writeNetlist) return false;
+
+        // external serializers might access state owned by the calling thread
+        if (!serialize_external(true)) return false;
+
+        std::function<bool()> writeProjectFile = capture_projectfile(true);
+
+        m_autosave = std::async(std::launch::async, [writeNetlist, writeProjectFile, on_finished]() {
+            bool success = writeNetlist() && writeProjectFile();
+            if (on_finished) on_finished(success);
+            return success;
+        });
+        return true;
+    }
+
+    std::function<bool()> ProjectManager::capture_shadow_netlist()
+    {
+        std::filesystem::path halPath     = m_netlist_file;
+        std::filesystem::path journalPath = m_proj_dir.get_shadow_filename(".journal");
+        bool binaryFormat                 = m_binary_format;
+        CompressionFormat compressionFormat = m_compression_format;
+
+        if (m_journal && m_journal->get_netlist() == m_netlist_save)
+        {
+            // records are kept until they have been written successfully
+            std::string record = m_journal->take_delta();
+            if (!record.empty()) m_unsaved_records.push_back(record);
+            std::vector<std::string> records = m_unsaved_records;
+
+            // gate library manager must not be accessed from the autosave thread
+            const GateLibrary* gateLib = m_netlist_save->get_gate_library();
+
+            auto appendRecords = [records, gateLib, halPath, journalPath, binaryFormat, compressionFormat]() {
+                for (const std::string& rec : records)
+                    if (!NetlistJournal::append_record(journalPath, rec)) return false;
+                if (records.empty()) return true;
+
+                // merge the journal into the shadow netlist file once it has grown large
+                std::error_code errCode;
+                uintmax_t journalSize = std::filesystem::file_size(journalPath, errCode);
+                if (errCode) return true;
+                uintmax_t halSize = std::filesystem::file_size(halPath, errCode);
+                if (errCode || journalSize < halSize / JOURNAL_COMPACTION_RATIO) return true;
+                if (!NetlistJournal::compact(halPath, journalPath, gateLib, binaryFormat, compressionFormat))
+                    log_warning("project_manager", "cannot compact journal '{}', keeping it.", journalPath.string());
+                return true;
+            };
+
+            if (m_shadow_valid && std::filesystem::exists(halPath)) return appendRecords;
+
+            if (!m_journal_source_netlist.empty())
+            {
+                // rebuild the shadow netlist from the files the netlist has been loaded from or saved to
+                std::filesystem::path sourceHalPath     = m_journal_source_netlist;
+                std::filesystem::path sourceJournalPath = m_journal_source_journal;
+                return [appendRecords, sourceHalPath, sourceJournalPath, halPath, journalPath]() {
+                    std::error_code errCode;
+                    if (std::filesystem::equivalent(sourceHalPath, halPath, errCode)) return appendRecords();
+
+                    // journal refers to the replaced netlist file
+                    std::filesystem::remove(journalPath, errCode);
+
+                    std::filesystem::path tmpPath = halPath;
+                    tmpPath += ".tmp";
+                    std::filesystem::copy_file(sourceHalPath, tmpPath, std::filesystem::copy_options::overwrite_existing, errCode);
+                    if (errCode || !utils::sync_file(tmpPath))
+                    {
+                        log_error("project_manager", "cannot copy netlist '{}' to autosave: '{}'", sourceHalPath.string(), errCode.message());
+                        std::filesystem::remove(tmpPath, errCode);
+                        return false;
+                    }
+                    std::filesystem::rename(tmpPath, halPath, errCode);
+                    if (errCode)
+                    {
+                        log_error("project_manager", "cannot replace autosave netlist '{}': '{}'", halPath.string(), errCode.message());
+                        return false;
+                    }
+
+                    if (!sourceJournalPath.empty() && std::filesystem::exists(sourceJournalPath))
+                    {
+                        std::filesystem::copy_file(sourceJournalPath, journalPath, std::filesystem::copy_options::overwrite_existing, errCode);
+                        if (errCode)
+                        {
+                            log_error("project_manager", "cannot copy journal '{}' to autosave: '{}'", sourceJournalPath.string(), errCode.message());
+                            return false;
+                        }
+                    }
+                    return appendRecords();
+                };
+            }
+        }
+
+        // netlist has neither been loaded from nor saved to a file, encode a copy so that it can be modified while the autosave is running
+        auto res = m_netlist_save->copy();
+        if (res.is_error())
+        {
+            log_error("project_manager", "cannot capture netlist for autosave:\n{}", res.get_error().get());
+            return nullptr;
+        }
+        std::shared_ptr<Netlist> snapshot = std::move(res.get());
+        snapshot->set_id(m_netlist_save->get_id());
+
+        // changes from now on are not part of the snapshot
+        if (m_journal && m_journal->get_netlist() == m_netlist_save)
+            m_journal->clear();
         else
-            m_netlist_file = m_proj_dir.get_default_filename(".hal");
+            m_journal = std::make_unique<NetlistJournal>(m_netlist_save);
+        m_journal_source_netlist.clear();
+        m_journal_source_journal.clear();
+        m_unsaved_records.clear();
+        m_shadow_valid = false;
+
+        return [snapshot, halPath, journalPath, binaryFormat, compressionFormat]() {
+            // journal refers to the replaced netlist file
+            std::error_code errCode;
+            std::filesystem::remove(journalPath, errCode);
+
+            return binaryFormat ? netlist_binary_serializer::serialize_to_file(snapshot.get(), halPath, compressionFormat)
+                                : netlist_serializer::serialize_to_file(snapshot.get(), halPath, compressionFormat);
+        };
+    }
+
+    bool ProjectManager::is_autosave_running() const
+    {
+        return m_autosave.valid() && m_autosave.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+    }
+
+    bool ProjectManager::wait_for_autosave()
+    {
+        if (!m_autosave.valid()) return true;
+        bool success = m_autosave.get();
+
+        // on failure, records are written again by the next autosave
+        if (success)
+        {
+            m_unsaved_records.clear();
+            m_shadow_valid = true;
+        }
+        return success;
+    }
+
+    void ProjectManager::discard_journal()
+    {
+        wait_for_autosave();
+        m_journal.reset();
+        m_journal_source_netlist.clear();
+        m_journal_source_journal.clear();
+        m_unsaved_records.clear();
+        m_shadow_valid = false;
+    }
+
+    void ProjectManager::attach_journal(Netlist* netlist, const std::string& netlistFile, const std::string& journalFile)
+    {
+        m_journal = std::make_unique<NetlistJournal>(netlist);
+        m_journal_source_netlist = netlistFile;
+        m_journal_source_journal = journalFile;
+        m_unsaved_records.clear();
 
-        if (!netlist_serializer::serialize_to_file(m_netlist_save, m_netlist_file)) return false;
+        // shadow netlist file does not belong to the netlist file
+        m_shadow_valid = false;
+    }
 
-        if (!serialize_external(shadow)) return false;
+    bool ProjectManager::create_snapshot(const Netlist* netlist, const std::string& name)
+    {
+        if (m_proj_dir.empty()) return false;
+        return NetlistSnapshotStore(m_proj_dir / SNAPSHOT_DIRECTORY).create_snapshot(netlist, name);
+    }
 
-        return serialize_to_projectfile(shadow);
+    bool ProjectManager::checkout_snapshot(Netlist* netlist, const std::string& name)
+    {
+        if (m_proj_dir.empty()) return false;
+        return NetlistSnapshotStore(m_proj_dir / SNAPSHOT_DIRECTORY).checkout_snapshot(netlist, name);
+    }
+
+    std::vector<std::string> ProjectManager::get_snapshot_names() const
+    {
+        if (m_proj_dir.empty()) return {};
+        return NetlistSnapshotStore(m_proj_dir / SNAPSHOT_DIRECTORY).get_snapshot_names();
+    }
+
+    bool ProjectManager::remove_snapshot(const std::string& name)
+    {
+        if (m_proj_dir.empty()) return false;
+        return NetlistSnapshotStore(m_proj_dir / SNAPSHOT_DIRECTORY).remove_snapshot(name);
     }
 
     std::string ProjectManager::get_netlist_filename() const
@@ -168,29 +427,35 @@ namespace hal {
         doc.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(frs);
         fclose(fp);
 
-        if (doc.HasMember("netlist"))
+        bool modified = false;
+        for (const char* tagname : {"netlist", "journal"})
         {
-            rapidjson::Value::MemberIterator netlistMember = doc.FindMember("netlist");
-            std::string netlistFilename = netlistMember->value.GetString();
+            if (!doc.HasMember(tagname)) continue;
+            rapidjson::Value::MemberIterator fileMember = doc.FindMember(tagname);
+            std::string filename = fileMember->value.GetString();
             int n = ProjectDirectory::s_shadow_dir.size() + 1;
-            if (netlistFilename.substr(0,n) == ProjectDirectory::s_shadow_dir + '/')
+            if (filename.substr(0,n) == ProjectDirectory::s_shadow_dir + '/')
             {
-                netlistFilename.erase(0,n);
-                netlistMember->value.SetString(netlistFilename.c_str(), doc.GetAllocator());
+                filename.erase(0,n);
+                fileMember->value.SetString(filename.c_str(), doc.GetAllocator());
+                modified = true;
+            }
+        }
 
-                std::ofstream of(projFilePath);
-                if (!of.good()) return;
+        if (modified)
+        {
+            std::ofstream of(projFilePath);
+            if (!of.good()) return;
 
-                rapidjson::StringBuffer strbuf;
+            rapidjson::StringBuffer strbuf;
 #if PRETTY_JSON_OUTPUT == 1
-                rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
 #else
-                rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
 #endif
-                doc.Accept(writer);
-                of << strbuf.GetString();
-                of.close();
-            }
+            doc.Accept(writer);
+            of << strbuf.GetString();
+            of.close();
         }
     }
 
@@ -217,12 +482,27 @@ namespace hal {
             m_netlist_file = doc["netlist"].GetString();
             std::filesystem::path netlistPath(m_proj_dir);
             netlistPath.append(m_netlist_file);
-            m_netlist_load = netlist_factory::load_netlist(netlistPath);
+            m_netlist_load = m_lazy_loading ? netlist_serializer::deserialize_from_file(netlistPath, true) : netlist_factory::load_netlist(netlistPath);
             if (!m_netlist_load)
             {
                 log_error("project_manager", "cannot load netlist {}.", netlistPath.string());
                 return false;
             }
+
+            if (doc.HasMember("journal"))
+            {
+                std::filesystem::path journalPath(m_proj_dir);
+                journalPath.append(doc["journal"].GetString());
+                if (!NetlistJournal::replay(m_netlist_load.get(), journalPath))
+                {
+                    log_error("project_manager", "cannot replay journal {}.", journalPath.string());
+                    m_netlist_load.reset();
+                    return false;
+                }
+                attach_journal(m_netlist_load.get(), netlistPath.string(), journalPath.string());
+            }
+            else
+                attach_journal(m_netlist_load.get(), netlistPath.string(), std::string());
         }
         else
         {
@@ -264,6 +544,11 @@ namespace hal {
 
 
     bool ProjectManager::serialize_to_projectfile(bool shadow) const
+    {
+        return capture_projectfile(shadow)();
+    }
+
+    std::function<bool()> ProjectManager::capture_projectfile(bool shadow) const
     {
         std::filesystem::path projFilePath = m_proj_dir.get_filename(s_project_file);
         if (shadow)
@@ -274,11 +559,16 @@ namespace hal {
             projFilePath.append(s_project_file);
         }
 
-        JsonWriteDocument doc;
+        std::shared_ptr<JsonWriteDocument> docPtr = std::make_shared<JsonWriteDocument>();
+        JsonWriteDocument& doc = *docPtr;
         doc["serialization_format_version"] = SERIALIZATION_FORMAT_VERSION;
         doc["netlist"]      = m_proj_dir.get_relative_file_path(m_netlist_file).string();
         doc["gate_library"] = m_proj_dir.get_relative_file_path(m_gatelib_path).string();
 
+        // journal is created by the next autosave if missing
+        if (shadow)
+            doc["journal"] = m_proj_dir.get_relative_file_path(m_proj_dir.get_shadow_filename(".journal").string()).string();
+
         if (!m_filename.empty())
         {
              JsonWriteObject& serial = doc.add_object("serializer");
@@ -289,7 +579,8 @@ namespace hal {
              }
              serial.close();
         }
-        return doc.serialize(projFilePath.string());
+        std::string projFileName = projFilePath.string();
+        return [docPtr, projFileName]() { return docPtr->serialize(projFileName); };
     }
 
     void ProjectManager::dump() const
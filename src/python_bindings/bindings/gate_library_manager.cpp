@@ -52,7 +52,7 @@ namespace hal
             [](const std::string& lib_name) { return RawPtrWrapper<GateLibrary>(gate_library_manager::get_gate_library_by_name(lib_name)); },
             py::arg("lib_name"),
             R"(
-            Get a gate library by name. If no library with the given name is loaded, None will be returned.
+            Get a gate library by name. If no library with the given name is loaded, the gate library manifest is consulted to load it from the standard gate library directories.
 
             :param str lib_name: The name of the gate library.
             :returns: The gate library on success, None otherwise.
@@ -75,5 +75,25 @@ namespace hal
             :returns: A list of gate libraries.
             :rtype:  list[hal_py.GateLibrary]
         )");
+
+        py_gate_library_manager.def(
+            "load_by_gate_types",
+            [](const std::unordered_set<std::string>& gate_type_names) {
+                std::vector<RawPtrWrapper<GateLibrary>> result;
+                for (auto lib : gate_library_manager::load_by_gate_types(gate_type_names))
+                {
+                    result.emplace_back(lib);
+                }
+                return result;
+            },
+            py::arg("gate_type_names"),
+            R"(
+            Load all gate libraries from the standard gate library directories that may provide a gate type for each of the given gate type names according to the gate library manifest.
+            Since the manifest is based on Bloom filters, some of the returned gate libraries may still lack a required gate type.
+
+            :param set[str] gate_type_names: The names of the required gate types.
+            :returns: A list of the loaded gate libraries.
+            :rtype: list[hal_py.GateLibrary]
+        )");
     }
 }    // namespace hal
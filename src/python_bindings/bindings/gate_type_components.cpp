@@ -7,6 +7,7 @@
 #include "hal_core/netlist/gate_library/gate_type_component/ram_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/ram_port_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/timing_component.h"
 #include "hal_core/python_bindings/python_bindings.h"
 
 namespace hal
@@ -28,6 +29,7 @@ namespace hal
             .value("init", GateTypeComponent::ComponentType::init, R"(Initializiation component type.)")
             .value("state", GateTypeComponent::ComponentType::state, R"(State component type.)")
             .value("ram_port", GateTypeComponent::ComponentType::ram_port, R"(RAM port component type.)")
+            .value("timing", GateTypeComponent::ComponentType::timing, R"(Timing component type.)")
             .export_values();
 
         py_gate_type_component.def_property_readonly("type", &GateTypeComponent::get_type, R"(
@@ -543,5 +545,224 @@ namespace hal
 
             :param bool is_write: True if the port is a write port, false if it is a read port.
         )");
+
+        py::class_<TimingComponent, GateTypeComponent, RawPtrWrapper<TimingComponent>> py_timing_component(m, "TimingComponent", R"(
+            A timing component holding the timing arcs, pin capacitances, leakage power, and area of a gate type.
+        )");
+
+        py::class_<TimingComponent::LookupTable> py_lookup_table(py_timing_component, "LookupTable", R"(
+            A non-linear delay model (NLDM) lookup table as used in Liberty files.
+            The values are stored in row-major order.
+        )");
+
+        py_lookup_table.def(py::init<>(), R"(
+            Construct an empty lookup table.
+        )");
+
+        py_lookup_table.def_readwrite("variable_1", &TimingComponent::LookupTable::variable_1, R"(
+            The variable described by the first index.
+
+            :type: str
+        )");
+
+        py_lookup_table.def_readwrite("variable_2", &TimingComponent::LookupTable::variable_2, R"(
+            The variable described by the second index.
+
+            :type: str
+        )");
+
+        py_lookup_table.def_readwrite("index_1", &TimingComponent::LookupTable::index_1, R"(
+            The breakpoints of the first index.
+
+            :type: list[float]
+        )");
+
+        py_lookup_table.def_readwrite("index_2", &TimingComponent::LookupTable::index_2, R"(
+            The breakpoints of the second index.
+
+            :type: list[float]
+        )");
+
+        py_lookup_table.def_readwrite("values", &TimingComponent::LookupTable::values, R"(
+            The table values in row-major order.
+
+            :type: list[float]
+        )");
+
+        py_lookup_table.def("is_empty", &TimingComponent::LookupTable::is_empty, R"(
+            Check whether the table holds any values.
+
+            :returns: True if the table is empty, False otherwise.
+            :rtype: bool
+        )");
+
+        py_lookup_table.def("evaluate", &TimingComponent::LookupTable::evaluate, py::arg("value_1"), py::arg("value_2") = 0.0, R"(
+            Evaluate the table for the given values of the first and second variable using bilinear interpolation.
+            Values outside of the range of an index are linearly extrapolated from the two closest breakpoints.
+            Returns 0 for empty tables.
+
+            :param float value_1: The value of the first variable.
+            :param float value_2: The value of the second variable, ignored for tables with less than two dimensions.
+            :returns: The interpolated value.
+            :rtype: float
+        )");
+
+        py::class_<TimingComponent::TimingArc> py_timing_arc(py_timing_component, "TimingArc", R"(
+            A timing arc from a related (input) pin to a pin of the gate type.
+        )");
+
+        py_timing_arc.def(py::init<>(), R"(
+            Construct an empty timing arc.
+        )");
+
+        py_timing_arc.def_readwrite("pin", &TimingComponent::TimingArc::pin, R"(
+            The name of the pin the arc ends at.
+
+            :type: str
+        )");
+
+        py_timing_arc.def_readwrite("related_pin", &TimingComponent::TimingArc::related_pin, R"(
+            The name of the pin the arc starts at.
+
+            :type: str
+        )");
+
+        py_timing_arc.def_readwrite("timing_sense", &TimingComponent::TimingArc::timing_sense, R"(
+            The unateness of the arc.
+
+            :type: str
+        )");
+
+        py_timing_arc.def_readwrite("timing_type", &TimingComponent::TimingArc::timing_type, R"(
+            The type of the arc.
+
+            :type: str
+        )");
+
+        py_timing_arc.def_readwrite("cell_rise", &TimingComponent::TimingArc::cell_rise, R"(
+            The propagation delay for a rising transition at the pin.
+
+            :type: hal_py.TimingComponent.LookupTable
+        )");
+
+        py_timing_arc.def_readwrite("cell_fall", &TimingComponent::TimingArc::cell_fall, R"(
+            The propagation delay for a falling transition at the pin.
+
+            :type: hal_py.TimingComponent.LookupTable
+        )");
+
+        py_timing_arc.def_readwrite("rise_transition", &TimingComponent::TimingArc::rise_transition, R"(
+            The transition time for a rising transition at the pin.
+
+            :type: hal_py.TimingComponent.LookupTable
+        )");
+
+        py_timing_arc.def_readwrite("fall_transition", &TimingComponent::TimingArc::fall_transition, R"(
+            The transition time for a falling transition at the pin.
+
+            :type: hal_py.TimingComponent.LookupTable
+        )");
+
+        py_timing_component.def_static("is_class_of", &TimingComponent::is_class_of, py::arg("component"), R"(
+            Check whether a component is a TimingComponent.
+
+            :param hal_py.GateTypeComponent component: The component to check.
+            :returns: True if component is a TimingComponent, False otherwise.
+            :rtype: bool
+        )");
+
+        py_timing_component.def_property_readonly("timing_arcs", py::overload_cast<>(&TimingComponent::get_timing_arcs, py::const_), R"(
+            All timing arcs of the gate type.
+
+            :type: list[hal_py.TimingComponent.TimingArc]
+        )");
+
+        py_timing_component.def("get_timing_arcs", py::overload_cast<>(&TimingComponent::get_timing_arcs, py::const_), R"(
+            Get all timing arcs of the gate type.
+
+            :returns: The timing arcs.
+            :rtype: list[hal_py.TimingComponent.TimingArc]
+        )");
+
+        py_timing_component.def("get_timing_arcs", py::overload_cast<const std::string&>(&TimingComponent::get_timing_arcs, py::const_), py::arg("pin"), R"(
+            Get all timing arcs ending at the given pin.
+
+            :param str pin: The name of the pin.
+            :returns: The timing arcs ending at the pin.
+            :rtype: list[hal_py.TimingComponent.TimingArc]
+        )");
+
+        py_timing_component.def("add_timing_arc", &TimingComponent::add_timing_arc, py::arg("arc"), R"(
+            Add a timing arc to the gate type.
+
+            :param hal_py.TimingComponent.TimingArc arc: The timing arc.
+        )");
+
+        py_timing_component.def_property_readonly("pin_capacitances", &TimingComponent::get_pin_capacitances, R"(
+            The input capacitances of all pins for which a capacitance is specified.
+
+            :type: dict[str,float]
+        )");
+
+        py_timing_component.def("get_pin_capacitances", &TimingComponent::get_pin_capacitances, R"(
+            Get the input capacitances of all pins for which a capacitance is specified.
+
+            :returns: A dict from pin name to capacitance.
+            :rtype: dict[str,float]
+        )");
+
+        py_timing_component.def("get_pin_capacitance", &TimingComponent::get_pin_capacitance, py::arg("pin"), R"(
+            Get the input capacitance of the given pin.
+            Returns 0 if no capacitance is specified for the pin.
+
+            :param str pin: The name of the pin.
+            :returns: The capacitance of the pin.
+            :rtype: float
+        )");
+
+        py_timing_component.def("set_pin_capacitance", &TimingComponent::set_pin_capacitance, py::arg("pin"), py::arg("capacitance"), R"(
+            Set the input capacitance of the given pin.
+
+            :param str pin: The name of the pin.
+            :param float capacitance: The capacitance of the pin.
+        )");
+
+        py_timing_component.def_property("leakage_power", &TimingComponent::get_leakage_power, &TimingComponent::set_leakage_power, R"(
+            The leakage power of the gate type.
+
+            :type: float
+        )");
+
+        py_timing_component.def("get_leakage_power", &TimingComponent::get_leakage_power, R"(
+            Get the leakage power of the gate type.
+
+            :returns: The leakage power.
+            :rtype: float
+        )");
+
+        py_timing_component.def("set_leakage_power", &TimingComponent::set_leakage_power, py::arg("leakage_power"), R"(
+            Set the leakage power of the gate type.
+
+            :param float leakage_power: The leakage power.
+        )");
+
+        py_timing_component.def_property("area", &TimingComponent::get_area, &TimingComponent::set_area, R"(
+            The area of the gate type.
+
+            :type: float
+        )");
+
+        py_timing_component.def("get_area", &TimingComponent::get_area, R"(
+            Get the area of the gate type.
+
+            :returns: The area.
+            :rtype: float
+        )");
+
+        py_timing_component.def("set_area", &TimingComponent::set_area, py::arg("area"), R"(
+            Set the area of the gate type.
+
+            :param float area: The area.
+        )");
     }
-}    // namespace hal
\ No newline at end of file
+}    // namespace hal
@@ -230,6 +230,30 @@ namespace hal
             :rtype: bool
         )");
 
+        py_module.def(
+            "update_net",
+            [](Module& self, Net* net) -> bool {
+                auto res = self.update_net(net);
+                if (res.is_ok())
+                {
+                    return true;
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while updating net:\n{}", res.get_error().get());
+                    return false;
+                }
+            },
+            py::arg("net"),
+            R"(
+            Check the connectivity of a single net with respect to this module and all of its parent modules and update their nets, internal nets, input nets, output nets, and pins accordingly.
+            Intended to re-synchronize the affected modules after a batch of edits that have been performed with automatic net checks disabled using hal_py.Netlist.enable_automatic_net_checks.
+
+            :param hal_py.Net net: The net to check.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
         py_module.def("contains_net", &Module::contains_net, py::arg("net"), py::arg("recursive") = false, R"(
             Check whether a net is contained in the module.
             If recursive is set to true, nets in submodules are considered as well.
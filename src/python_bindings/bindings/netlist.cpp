@@ -460,6 +460,19 @@ namespace hal
             :param bool enable_checks: Set True to enable automatic checks, False otherwise.
         )");
 
+        py_netlist.def("reserve", &Netlist::reserve, py::arg("num_gates"), py::arg("num_nets"), py::arg("num_modules"), R"(
+            Pre-allocates memory for the given number of gates, nets, and modules, e.g., before deserializing a netlist of known size.
+
+            :param int num_gates: The expected number of gates.
+            :param int num_nets: The expected number of nets.
+            :param int num_modules: The expected number of modules.
+        )");
+
+        py_netlist.def("update_module_nets", &Netlist::update_module_nets, R"(
+            Recomputes the nets, input nets, output nets, and internal nets of all modules from scratch, processing the modules in parallel.
+            Meant to be called once after the netlist has been built with automatic net checks disabled.
+        )");
+
         py_netlist.def("get_unique_module_id", &Netlist::get_unique_module_id, R"(
             Get a spare module ID.
             The value of 0 is reserved and represents an invalid ID.
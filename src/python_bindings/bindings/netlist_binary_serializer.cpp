@@ -0,0 +1,48 @@
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    void netlist_binary_serializer_init(py::module& m)
+    {
+        auto py_netlist_binary_serializer = m.def_submodule("NetlistBinarySerializer", R"(
+            HAL Netlist Binary Serializer functions.
+        )");
+
+        py_netlist_binary_serializer.def("serialize_to_file",
+                                         netlist_binary_serializer::serialize_to_file,
+                                         py::arg("netlist"),
+                                         py::arg("hal_file"),
+                                         py::arg("compression_format") = CompressionFormat::none,
+                                         R"(
+            Serializes a netlist into a binary .hal file.
+            Uncompressed binary files can be memory-mapped when deserializing them.
+        
+            :param hal_py.Netlist netlist: The netlist to serialize.
+            :param hal_py.hal_path hal_file: The destination .hal file.
+            :param hal_py.CompressionFormat compression_format: The compression format of the written file, uncompressed by default.
+            :returns: True on success, false otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_binary_serializer.def("deserialize_from_file", netlist_binary_serializer::deserialize_from_file, py::arg("hal_file"), py::arg("lazy") = false, py::arg("gate_library") = nullptr, R"(
+            Deserializes a netlist from a binary .hal file.
+            In lazy mode, data entries and custom Boolean functions are decoded from the mapped file when they are accessed for the first time.
+        
+            :param hal_py.hal_path hal_file: The source .hal file.
+            :param bool lazy: Set True to defer decoding data entries and custom Boolean functions, False to decode everything right away.
+            :param hal_py.GateLibrary gate_library: The gate library of the netlist, or None to load the gate library referenced by the file.
+            :returns: The deserialized netlist.
+            :rtype: hal_py.Netlist
+        )");
+
+        py_netlist_binary_serializer.def("convert_file", netlist_binary_serializer::convert_file, py::arg("source_file"), py::arg("destination_file"), R"(
+            Converts a .hal file between the JSON and the binary format.
+            JSON files are converted into binary files and binary files into JSON files.
+        
+            :param hal_py.hal_path source_file: The .hal file to convert.
+            :param hal_py.hal_path destination_file: The destination .hal file.
+            :returns: True on success, false otherwise.
+            :rtype: bool
+        )");
+    }
+}
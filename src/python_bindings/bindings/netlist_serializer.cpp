@@ -4,23 +4,37 @@ namespace hal
 {
     void netlist_serializer_init(py::module& m)
     {
+        py::enum_<CompressionFormat>(m, "CompressionFormat", R"(
+            The compression formats that can be read and written transparently.
+        )")
+            .value("none", CompressionFormat::none, R"(Uncompressed data.)")
+            .value("gzip", CompressionFormat::gzip, R"(gzip (or zlib) compressed data.)")
+            .value("zstd", CompressionFormat::zstd, R"(Zstandard compressed data.)")
+            .export_values();
+
         auto py_netlist_serializer = m.def_submodule("NetlistSerializer", R"(
             HAL Netlist Serializer functions.
         )");
 
-        py_netlist_serializer.def("serialize_to_file", netlist_serializer::serialize_to_file, py::arg("netlist"), py::arg("hal_file"), R"(
+        py_netlist_serializer.def("serialize_to_file", netlist_serializer::serialize_to_file, py::arg("netlist"), py::arg("hal_file"), py::arg("compression_format") = CompressionFormat::none, R"(
             Serializes a netlist into a .hal file.
+            The file may optionally be compressed, it can be deserialized regardless of the compression format used.
         
             :param hal_py.Netlist netlist: The netlist to serialize.
             :param hal_py.hal_path hal_file: The destination .hal file.
+            :param hal_py.CompressionFormat compression_format: The compression format of the written file, uncompressed by default.
             :returns: True on success, false otherwise.
             :rtype: bool
         )");
 
-        py_netlist_serializer.def("deserialize_from_file", netlist_serializer::deserialize_from_file, py::arg("hal_file"), R"(
+        py_netlist_serializer.def("deserialize_from_file", netlist_serializer::deserialize_from_file, py::arg("hal_file"), py::arg("lazy") = false, py::arg("gate_library") = nullptr, R"(
             Deserializes a netlist from a .hal file.
+            Files compressed using gzip or zstd are detected by their magic bytes and decompressed transparently.
+            In lazy mode, data entries and custom Boolean functions are kept as undecoded ranges of the file and only decoded when they are accessed for the first time.
         
             :param hal_py.hal_path hal_file: The source .hal file.
+            :param bool lazy: Set True to defer decoding data entries and custom Boolean functions, False to decode everything right away.
+            :param hal_py.GateLibrary gate_library: The gate library of the netlist, or None to load the gate library referenced by the file.
             :returns: The deserialized netlist.
             :rtype: hal_py.Netlist
         )");
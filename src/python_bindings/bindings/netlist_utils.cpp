@@ -402,5 +402,352 @@ namespace hal
             :returns: A list of gates that form a chain on success, an empty list on error.
             :rtype: list[hal_py.Gate]
         )");
+
+        py::class_<netlist_utils::SweepConfig> py_sweep_config(py_netlist_utils, "SweepConfig", R"(
+            Represents the data structure to configure a netlist sweep.
+        )");
+
+        py_sweep_config.def(py::init<>(), R"(
+            Constructs a new sweep configuration with all optimizations enabled.
+        )");
+
+        py_sweep_config.def_readwrite("propagate_constants", &netlist_utils::SweepConfig::propagate_constants, R"(
+            Controls whether gates whose output evaluates to a constant are replaced by the respective GND or VCC net.
+
+            :type: bool
+        )");
+
+        py_sweep_config.def_readwrite("remove_dangling_logic", &netlist_utils::SweepConfig::remove_dangling_logic, R"(
+            Controls whether combinational gates without any successors are removed.
+
+            :type: bool
+        )");
+
+        py_sweep_config.def_readwrite("collapse_buffers", &netlist_utils::SweepConfig::collapse_buffers, R"(
+            Controls whether gates that implement the identity function of one of their inputs are bypassed.
+
+            :type: bool
+        )");
+
+        py_sweep_config.def_readwrite("collapse_inverter_pairs", &netlist_utils::SweepConfig::collapse_inverter_pairs, R"(
+            Controls whether two consecutive inverting gates are bypassed.
+
+            :type: bool
+        )");
+
+        py_sweep_config.def_readwrite("merge_duplicate_gates", &netlist_utils::SweepConfig::merge_duplicate_gates, R"(
+            Controls whether structurally identical gates are merged.
+
+            :type: bool
+        )");
+
+        py::class_<netlist_utils::SweepStatistics> py_sweep_statistics(py_netlist_utils, "SweepStatistics", R"(
+            Holds the statistics of a netlist sweep.
+        )");
+
+        py_sweep_statistics.def_readonly("propagated_constants", &netlist_utils::SweepStatistics::propagated_constants, R"(
+            The number of gate outputs that have been replaced by a constant net.
+
+            :type: int
+        )");
+
+        py_sweep_statistics.def_readonly("collapsed_buffers", &netlist_utils::SweepStatistics::collapsed_buffers, R"(
+            The number of gate outputs that have been bypassed because they implement the identity function.
+
+            :type: int
+        )");
+
+        py_sweep_statistics.def_readonly("collapsed_inverter_pairs", &netlist_utils::SweepStatistics::collapsed_inverter_pairs, R"(
+            The number of gate outputs that have been bypassed because they form an inverter pair with their predecessor.
+
+            :type: int
+        )");
+
+        py_sweep_statistics.def_readonly("merged_gates", &netlist_utils::SweepStatistics::merged_gates, R"(
+            The number of gates that have been merged into a structurally identical gate.
+
+            :type: int
+        )");
+
+        py_sweep_statistics.def_readonly("removed_gates", &netlist_utils::SweepStatistics::removed_gates, R"(
+            The total number of removed gates.
+
+            :type: int
+        )");
+
+        py_sweep_statistics.def_readonly("removed_nets", &netlist_utils::SweepStatistics::removed_nets, R"(
+            The total number of removed nets.
+
+            :type: int
+        )");
+
+        py_netlist_utils.def(
+            "sweep",
+            [](Netlist* netlist, const netlist_utils::SweepConfig& config) -> std::optional<netlist_utils::SweepStatistics> {
+                auto res = netlist_utils::sweep(netlist, config);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while sweeping netlist:\n{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("netlist"),
+            py::arg("config") = netlist_utils::SweepConfig(),
+            R"(
+            Sweep the combinational logic of the netlist until a fixed point is reached.
+            Depending on the configuration, constants are propagated, buffers and inverter pairs are bypassed, structurally identical gates are merged, and dangling logic is removed.
+            Sequential gates and global output nets are never altered.
+
+            :param hal_py.Netlist netlist: The target netlist.
+            :param hal_py.NetlistUtils.SweepConfig config: The sweep configuration.
+            :returns: The sweep statistics on success, None otherwise.
+            :rtype: hal_py.NetlistUtils.SweepStatistics or None
+        )");
+
+        py_netlist_utils.def(
+            "merge_duplicate_gates",
+            [](Netlist* netlist) -> i32 {
+                auto res = netlist_utils::merge_duplicate_gates(netlist);
+                if (res.is_ok())
+                {
+                    return (i32)res.get();
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while merging duplicate gates of netlist:\n{}", res.get_error().get());
+                    return -1;
+                }
+            },
+            py::arg("netlist"),
+            R"(
+            Merge all structurally identical combinational gates of the netlist, i.e., gates of the same type that are driven by the same signals at each input pin and implement the same custom Boolean functions and INIT data.
+            Gates are hashed bottom-up in topological order such that duplicated logic cones are merged in a single pass.
+            Gates within combinational loops are never merged. Gates driving global output nets are kept, but their successors may still be merged.
+
+            :param hal_py.Netlist netlist: The target netlist.
+            :returns: The number of merged gates on success, -1 otherwise.
+            :rtype: int
+        )");
+
+        py_netlist_utils.def(
+            "compute_net_signatures",
+            [](const Netlist* netlist, u32 num_bits = 256, u64 seed = 0) -> std::optional<std::unordered_map<Net*, std::vector<u64>>> {
+                auto res = netlist_utils::compute_net_signatures(netlist, num_bits, seed);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while computing net signatures:\n{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("netlist"),
+            py::arg("num_bits") = 256,
+            py::arg("seed")     = 0,
+            R"(
+            Compute a simulation signature for every net of the netlist by simulating its combinational logic on random input patterns.
+            Nets that are not driven by exactly one combinational gate, e.g., global input nets or nets driven by sequential gates, are assigned pseudo-random patterns derived from the seed and their ID.
+            Nets driven by GND and VCC gates are assigned constant patterns.
+            Functionally equivalent nets always receive identical signatures, while different signatures prove that two nets are not equivalent.
+
+            :param hal_py.Netlist netlist: The netlist to simulate.
+            :param int num_bits: The width of each signature in bits, must be a multiple of 64 between 64 and 1024.
+            :param int seed: The seed for the generation of random input patterns.
+            :returns: A dict from each net to its signature, given as a list of 64-bit words, on success, None otherwise.
+            :rtype: dict[hal_py.Net,list[int]] or None
+        )");
+
+        py::class_<netlist_utils::NetEquivalenceConfig> py_net_equivalence_config(py_netlist_utils, "NetEquivalenceConfig", R"(
+            Represents the data structure to configure the detection of functionally equivalent nets.
+        )");
+
+        py_net_equivalence_config.def(py::init<>(), R"(
+            Constructs a new configuration for the detection of functionally equivalent nets.
+        )");
+
+        py_net_equivalence_config.def_readwrite("signature_width", &netlist_utils::NetEquivalenceConfig::signature_width, R"(
+            The width of the simulation signatures in bits, must be a multiple of 64 between 64 and 1024.
+
+            :type: int
+        )");
+
+        py_net_equivalence_config.def_readwrite("seed", &netlist_utils::NetEquivalenceConfig::seed, R"(
+            The seed for the generation of random input patterns.
+
+            :type: int
+        )");
+
+        py_net_equivalence_config.def_readwrite("consider_complements", &netlist_utils::NetEquivalenceConfig::consider_complements, R"(
+            Controls whether nets carrying the complement of a signal are placed into the same class as nets carrying the signal itself.
+
+            :type: bool
+        )");
+
+        py_net_equivalence_config.def_readwrite("sat_refinement", &netlist_utils::NetEquivalenceConfig::sat_refinement, R"(
+            Controls whether candidate classes are confirmed or split using a SAT solver. If disabled, the resulting classes are candidates only.
+
+            :type: bool
+        )");
+
+        py_net_equivalence_config.def_readwrite("query_timeout_in_ms", &netlist_utils::NetEquivalenceConfig::query_timeout_in_ms, R"(
+            The timeout for each SAT query in milliseconds. Nets whose equivalence cannot be decided in time are removed from their class.
+
+            :type: int
+        )");
+
+        py::class_<netlist_utils::NetEquivalenceClass> py_net_equivalence_class(py_netlist_utils, "NetEquivalenceClass", R"(
+            A class of nets that carry the same signal or its complement.
+        )");
+
+        py_net_equivalence_class.def_readonly("nets", &netlist_utils::NetEquivalenceClass::nets, R"(
+            The nets of the class, the first net being the representative of the class.
+
+            :type: list[hal_py.Net]
+        )");
+
+        py_net_equivalence_class.def_readonly("complemented", &netlist_utils::NetEquivalenceClass::complemented, R"(
+            For each net, whether it carries the complement of the signal of the representative.
+
+            :type: list[bool]
+        )");
+
+        py_netlist_utils.def(
+            "get_equivalent_nets",
+            [](const Netlist* netlist, const netlist_utils::NetEquivalenceConfig& config) -> std::optional<std::vector<netlist_utils::NetEquivalenceClass>> {
+                auto res = netlist_utils::get_equivalent_nets(netlist, config);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while getting equivalent nets:\n{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("netlist"),
+            py::arg("config") = netlist_utils::NetEquivalenceConfig(),
+            R"(
+            Find classes of functionally equivalent nets within the combinational logic of the netlist.
+            Nets are first bucketed by their simulation signatures, optionally identifying signatures with their complement, to obtain candidate classes.
+            If enabled, each candidate class is refined by proving equivalence of its members to the representative using a single persistent SAT solver.
+
+            :param hal_py.Netlist netlist: The target netlist.
+            :param hal_py.NetlistUtils.NetEquivalenceConfig config: The configuration of the equivalence detection.
+            :returns: All classes consisting of at least two nets on success, None otherwise.
+            :rtype: list[hal_py.NetlistUtils.NetEquivalenceClass] or None
+        )");
+
+        py::class_<netlist_utils::CutEnumerationConfig> py_cut_enumeration_config(py_netlist_utils, "CutEnumerationConfig", R"(
+            Represents the data structure to configure the enumeration of k-feasible cuts.
+        )");
+
+        py_cut_enumeration_config.def(py::init<>(), R"(
+            Constructs a new cut enumeration configuration.
+        )");
+
+        py_cut_enumeration_config.def_readwrite("max_cut_size", &netlist_utils::CutEnumerationConfig::max_cut_size, R"(
+            The maximum number of leaves of a cut, must be between 1 and 8.
+
+            :type: int
+        )");
+
+        py_cut_enumeration_config.def_readwrite("max_cuts_per_net", &netlist_utils::CutEnumerationConfig::max_cuts_per_net, R"(
+            The maximum number of non-trivial cuts that is kept for each net. Cuts with fewer leaves are preferred.
+
+            :type: int
+        )");
+
+        py_cut_enumeration_config.def_readwrite("compute_truth_tables", &netlist_utils::CutEnumerationConfig::compute_truth_tables, R"(
+            Controls whether a truth table is computed for every cut.
+
+            :type: bool
+        )");
+
+        py::class_<netlist_utils::Cut> py_cut(py_netlist_utils, "Cut", R"(
+            A cut of a net, i.e., a set of leaf nets such that every path from a global input or sequential gate to the net passes through at least one leaf.
+        )");
+
+        py_cut.def_readonly("leaves", &netlist_utils::Cut::leaves, R"(
+            The leaves of the cut sorted by their ID.
+
+            :type: list[hal_py.Net]
+        )");
+
+        py_cut.def_readonly("truth_table", &netlist_utils::Cut::truth_table, R"(
+            The function of the net in terms of the leaves, where leaf i is the i-th variable and bit m of the table holds the value for input assignment m.
+            The 2^k bits are packed into 64-bit words starting at the least significant bit. Empty if truth tables have not been computed.
+
+            :type: list[int]
+        )");
+
+        py::class_<netlist_utils::CutEnumeration> py_cut_enumeration(py_netlist_utils, "CutEnumeration", R"(
+            The cuts of all nets within the combinational logic of a netlist.
+        )");
+
+        py_cut_enumeration.def("get_nets", &netlist_utils::CutEnumeration::get_nets, R"(
+            Get all nets for which cuts have been enumerated in topological order.
+
+            :returns: A list of nets.
+            :rtype: list[hal_py.Net]
+        )");
+
+        py_cut_enumeration.def("get_num_cuts", py::overload_cast<const Net*>(&netlist_utils::CutEnumeration::get_num_cuts, py::const_), py::arg("net"), R"(
+            Get the number of cuts of a net, including the trivial cut that consists of the net itself.
+
+            :param hal_py.Net net: The net.
+            :returns: The number of cuts, or 0 if no cuts have been enumerated for the net.
+            :rtype: int
+        )");
+
+        py_cut_enumeration.def("get_num_cuts", py::overload_cast<>(&netlist_utils::CutEnumeration::get_num_cuts, py::const_), R"(
+            Get the total number of cuts of all nets.
+
+            :returns: The number of cuts.
+            :rtype: int
+        )");
+
+        py_cut_enumeration.def("get_cuts", &netlist_utils::CutEnumeration::get_cuts, py::arg("net"), R"(
+            Get all cuts of a net, the first one being the trivial cut that consists of the net itself.
+
+            :param hal_py.Net net: The net.
+            :returns: A list of cuts, empty if no cuts have been enumerated for the net.
+            :rtype: list[hal_py.NetlistUtils.Cut]
+        )");
+
+        py_netlist_utils.def(
+            "enumerate_cuts",
+            [](const Netlist* netlist, const netlist_utils::CutEnumerationConfig& config) -> std::optional<netlist_utils::CutEnumeration> {
+                auto res = netlist_utils::enumerate_cuts(netlist, config);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "error encountered while enumerating cuts:\n{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("netlist"),
+            py::arg("config") = netlist_utils::CutEnumerationConfig(),
+            R"(
+            Enumerate the k-feasible cuts of all nets that are driven by a combinational gate.
+            Cuts are computed bottom-up in topological order by merging the cuts of the fan-in nets of each gate, while only the best cuts of each net are kept (priority cuts).
+            Cuts are ranked by their number of leaves and cuts whose leaves are a superset of the leaves of another cut are discarded.
+            Nets that are not driven by exactly one combinational gate only act as leaves.
+            Nets driven by a combinational gate with a missing or unsupported Boolean function only have their trivial cut.
+
+            :param hal_py.Netlist netlist: The target netlist.
+            :param hal_py.NetlistUtils.CutEnumerationConfig config: The configuration of the cut enumeration.
+            :returns: The cuts of all nets on success, None otherwise.
+            :rtype: hal_py.NetlistUtils.CutEnumeration or None
+        )");
     }
 }    // namespace hal
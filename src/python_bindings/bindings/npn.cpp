@@ -0,0 +1,266 @@
+#include "hal_core/python_bindings/python_bindings.h"
+
+namespace hal
+{
+    void npn_init(py::module& m)
+    {
+        auto py_npn = m.def_submodule("NPN", R"(
+            NPN canonicalization and matching of truth tables.
+        )");
+
+        py::class_<NPN::TruthTable> py_npn_truth_table(py_npn, "TruthTable", R"(
+            The truth table of a single-output Boolean function of up to 8 input variables.
+            Bit m of the table holds the function value for input assignment m, where variable i corresponds to bit i of m.
+        )");
+
+        py_npn_truth_table.def_readonly("num_variables", &NPN::TruthTable::num_variables, R"(
+            The number of input variables.
+
+            :type: int
+        )");
+
+        py_npn_truth_table.def_static(
+            "from_words",
+            [](const std::vector<u64>& words, u32 num_variables) -> std::optional<NPN::TruthTable> {
+                auto res = NPN::TruthTable::from_words(words, num_variables);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("words"),
+            py::arg("num_variables"),
+            R"(
+            Construct a truth table from a list of 64-bit words as used by hal_py.NetlistUtils.Cut.
+
+            :param list[int] words: The packed truth table.
+            :param int num_variables: The number of input variables.
+            :returns: The truth table on success, None otherwise.
+            :rtype: hal_py.NPN.TruthTable or None
+        )");
+
+        py_npn_truth_table.def_static(
+            "from_values",
+            [](const std::vector<BooleanFunction::Value>& values) -> std::optional<NPN::TruthTable> {
+                auto res = NPN::TruthTable::from_values(values);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("values"),
+            R"(
+            Construct a truth table from the output of hal_py.BooleanFunction.compute_truth_table for a single output bit.
+
+            :param list[hal_py.BooleanFunction.Value] values: The function values for all 2^n input assignments.
+            :returns: The truth table on success, None otherwise.
+            :rtype: hal_py.NPN.TruthTable or None
+        )");
+
+        py_npn_truth_table.def("to_words", &NPN::TruthTable::to_words, R"(
+            Get the packed truth table as a list of 64-bit words.
+
+            :returns: A list holding max(1, 2^n / 64) words.
+            :rtype: list[int]
+        )");
+
+        py_npn_truth_table.def(py::self == py::self, R"(
+            Check whether two truth tables are equal.
+
+            :returns: True if both truth tables are equal, False otherwise.
+            :rtype: bool
+        )");
+
+        py_npn_truth_table.def(py::self != py::self, R"(
+            Check whether two truth tables are unequal.
+
+            :returns: True if both truth tables are unequal, False otherwise.
+            :rtype: bool
+        )");
+
+        py::class_<NPN::Transform> py_npn_transform(py_npn, "Transform", R"(
+            An NPN transformation, i.e., a negation of inputs, followed by a permutation of inputs, followed by an optional negation of the output.
+        )");
+
+        py_npn_transform.def(py::init<>(), R"(
+            Constructs a new identity transformation without any variables.
+        )");
+
+        py_npn_transform.def_readwrite("input_negations", &NPN::Transform::input_negations, R"(
+            Bit i is set if input variable i is negated.
+
+            :type: int
+        )");
+
+        py_npn_transform.def_readwrite("permutation", &NPN::Transform::permutation, R"(
+            Input variable i becomes variable permutation[i] of the transformed function.
+
+            :type: list[int]
+        )");
+
+        py_npn_transform.def_readwrite("output_negation", &NPN::Transform::output_negation, R"(
+            Whether the output is negated.
+
+            :type: bool
+        )");
+
+        py::class_<NPN::CanonicalForm> py_npn_canonical_form(py_npn, "CanonicalForm", R"(
+            The NPN canonical form of a truth table together with the transformation that yields it.
+        )");
+
+        py_npn_canonical_form.def_readonly("truth_table", &NPN::CanonicalForm::truth_table, R"(
+            The canonical truth table, which is identical for all functions of the same NPN class.
+
+            :type: hal_py.NPN.TruthTable
+        )");
+
+        py_npn_canonical_form.def_readonly("transform", &NPN::CanonicalForm::transform, R"(
+            The transformation that turns the original truth table into the canonical one.
+
+            :type: hal_py.NPN.Transform
+        )");
+
+        py_npn.def(
+            "apply_transform",
+            [](const NPN::TruthTable& truth_table, const NPN::Transform& transform) -> std::optional<NPN::TruthTable> {
+                auto res = NPN::apply_transform(truth_table, transform);
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            py::arg("truth_table"),
+            py::arg("transform"),
+            R"(
+            Apply an NPN transformation to a truth table.
+
+            :param hal_py.NPN.TruthTable truth_table: The truth table.
+            :param hal_py.NPN.Transform transform: The transformation, whose permutation must cover all variables of the truth table.
+            :returns: The transformed truth table on success, None otherwise.
+            :rtype: hal_py.NPN.TruthTable or None
+        )");
+
+        py_npn.def("canonicalize", &NPN::canonicalize, py::arg("truth_table"), R"(
+            Compute the exact NPN canonical form of a truth table, i.e., the smallest truth table that can be obtained by negating inputs, permuting inputs, and negating the output.
+
+            :param hal_py.NPN.TruthTable truth_table: The truth table.
+            :returns: The canonical form.
+            :rtype: hal_py.NPN.CanonicalForm
+        )");
+
+        py::class_<NPN::Match> py_npn_match(py_npn, "Match", R"(
+            A function of a library that matched a cut of a net.
+        )");
+
+        py_npn_match.def_readonly("net", &NPN::Match::net, R"(
+            The net whose cut matched.
+
+            :type: hal_py.Net
+        )");
+
+        py_npn_match.def_readonly("cut", &NPN::Match::cut, R"(
+            The matched cut.
+
+            :type: hal_py.NetlistUtils.Cut
+        )");
+
+        py_npn_match.def_readonly("name", &NPN::Match::name, R"(
+            The name of the matched library function.
+
+            :type: str
+        )");
+
+        py_npn_match.def_readonly("cut_transform", &NPN::Match::cut_transform, R"(
+            The transformation that turns the function of the cut into the canonical form.
+
+            :type: hal_py.NPN.Transform
+        )");
+
+        py_npn_match.def_readonly("library_transform", &NPN::Match::library_transform, R"(
+            The transformation that turns the library function into the canonical form.
+
+            :type: hal_py.NPN.Transform
+        )");
+
+        py::class_<NPN::Library> py_npn_library(py_npn, "Library", R"(
+            A collection of named functions indexed by their NPN canonical form.
+        )");
+
+        py_npn_library.def(py::init<>(), R"(
+            Constructs a new empty library.
+        )");
+
+        py_npn_library.def("add_function", py::overload_cast<const std::string&, const NPN::TruthTable&>(&NPN::Library::add_function), py::arg("name"), py::arg("truth_table"), R"(
+            Add a function to the library.
+
+            :param str name: The name of the function.
+            :param hal_py.NPN.TruthTable truth_table: The truth table of the function.
+        )");
+
+        py_npn_library.def(
+            "add_function",
+            [](NPN::Library& self, const std::string& name, const BooleanFunction& function, const std::vector<std::string>& ordered_variables = {}) -> bool {
+                auto res = self.add_function(name, function, ordered_variables);
+                if (res.is_ok())
+                {
+                    return true;
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return false;
+                }
+            },
+            py::arg("name"),
+            py::arg("function"),
+            py::arg("ordered_variables") = std::vector<std::string>(),
+            R"(
+            Add a single-output Boolean function of at most 8 variables to the library.
+
+            :param str name: The name of the function.
+            :param hal_py.BooleanFunction function: The Boolean function.
+            :param list[str] ordered_variables: The order of input variables used to compute the truth table, defaults to the alphabetical order.
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_npn_library.def("size", &NPN::Library::size, R"(
+            Get the number of functions within the library.
+
+            :returns: The number of functions.
+            :rtype: int
+        )");
+
+        py_npn_library.def("find", &NPN::Library::find, py::arg("truth_table"), R"(
+            Find all library functions that are NPN-equivalent to the given truth table.
+
+            :param hal_py.NPN.TruthTable truth_table: The truth table.
+            :returns: The names of the matching functions.
+            :rtype: list[str]
+        )");
+
+        py_npn_library.def("match", &NPN::Library::match, py::arg("cuts"), R"(
+            Match the cuts of all nets against the library in parallel.
+            Trivial cuts and cuts without truth tables are skipped.
+
+            :param hal_py.NetlistUtils.CutEnumeration cuts: The enumerated cuts.
+            :returns: All matches ordered by net and cut.
+            :rtype: list[hal_py.NPN.Match]
+        )");
+    }
+}    // namespace hal
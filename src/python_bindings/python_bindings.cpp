@@ -35,6 +35,8 @@ namespace hal
 
         netlist_serializer_init(m);
 
+        netlist_binary_serializer_init(m);
+
         netlist_utils_init(m);
 
         base_pin_init(m);
@@ -65,6 +67,8 @@ namespace hal
 
         smt_init(m);
 
+        npn_init(m);
+
 #ifndef PYBIND11_MODULE
         return m.ptr();
 #endif    // PYBIND11_MODULE
@@ -0,0 +1,393 @@
+#include "hal_core/utilities/compression.h"
+
+#include "hal_core/utilities/utils.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+#include <zlib.h>
+
+#ifdef HAL_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace hal
+{
+    template<>
+    std::map<CompressionFormat, std::string> EnumStrings<CompressionFormat>::data = {{CompressionFormat::none, "none"}, {CompressionFormat::gzip, "gzip"}, {CompressionFormat::zstd, "zstd"}};
+
+    namespace compression
+    {
+        namespace
+        {
+            // size of the chunks that are handed to the (de)compressor at once
+            constexpr u64 CHUNK_SIZE = 1 << 20;
+
+            class GzipDecompressor : public Decompressor
+            {
+            public:
+                GzipDecompressor(std::string_view data) : m_data(data)
+                {
+                }
+
+                ~GzipDecompressor() override
+                {
+                    if (m_initialized)
+                    {
+                        inflateEnd(&m_stream);
+                    }
+                }
+
+                Result<std::monostate> init()
+                {
+                    // 15 + 32 enables automatic detection of gzip and zlib headers
+                    if (inflateInit2(&m_stream, 15 + 32) != Z_OK)
+                    {
+                        return ERR("could not decompress gzip data: unable to initialize zlib");
+                    }
+                    m_initialized = true;
+                    return OK({});
+                }
+
+                Result<u64> read(char* buffer, u64 size) override
+                {
+                    if (m_finished)
+                    {
+                        return OK(0);
+                    }
+
+                    const uInt out_size = static_cast<uInt>(std::min<u64>(size, CHUNK_SIZE));
+                    m_stream.next_out   = reinterpret_cast<Bytef*>(buffer);
+                    m_stream.avail_out  = out_size;
+                    while (m_stream.avail_out > 0)
+                    {
+                        if (m_stream.avail_in == 0 && m_in_offset < m_data.size())
+                        {
+                            const u64 in_size = std::min<u64>(CHUNK_SIZE, m_data.size() - m_in_offset);
+                            m_stream.next_in  = reinterpret_cast<Bytef*>(const_cast<char*>(m_data.data() + m_in_offset));
+                            m_stream.avail_in = static_cast<uInt>(in_size);
+                            m_in_offset += in_size;
+                        }
+
+                        const int status = inflate(&m_stream, Z_NO_FLUSH);
+                        if (status == Z_STREAM_END)
+                        {
+                            // concatenated gzip members (e.g., written by pigz or bgzip) are decompressed in sequence
+                            if (m_stream.avail_in == 0 && m_in_offset == m_data.size())
+                            {
+                                m_finished = true;
+                                break;
+                            }
+                            inflateReset(&m_stream);
+                        }
+                        else if (status != Z_OK && !(status == Z_BUF_ERROR && m_stream.avail_in == 0 && m_in_offset < m_data.size()))
+                        {
+                            const std::string error = (m_stream.msg != nullptr) ? m_stream.msg : "truncated input";
+                            return ERR("could not decompress gzip data: " + error);
+                        }
+                    }
+
+                    return OK(u64(out_size - m_stream.avail_out));
+                }
+
+            private:
+                std::string_view m_data;
+                z_stream m_stream  = {};
+                u64 m_in_offset    = 0;
+                bool m_initialized = false;
+                bool m_finished    = false;
+            };
+
+            Result<std::monostate> write_gzip(std::ofstream& ofs, std::string_view data)
+            {
+                z_stream stream = {};
+                // 15 + 16 writes a gzip header instead of a zlib header
+                if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+                {
+                    return ERR("could not compress data: unable to initialize zlib");
+                }
+
+                std::vector<char> buffer(CHUNK_SIZE);
+                u64 in_offset = 0;
+                int status    = Z_OK;
+                do
+                {
+                    const u64 in_size = std::min<u64>(CHUNK_SIZE, data.size() - in_offset);
+                    stream.next_in    = reinterpret_cast<Bytef*>(const_cast<char*>(data.data() + in_offset));
+                    stream.avail_in   = static_cast<uInt>(in_size);
+                    in_offset += in_size;
+
+                    const int flush = (in_offset == data.size()) ? Z_FINISH : Z_NO_FLUSH;
+                    do
+                    {
+                        stream.next_out  = reinterpret_cast<Bytef*>(buffer.data());
+                        stream.avail_out = static_cast<uInt>(buffer.size());
+                        status           = deflate(&stream, flush);
+                        ofs.write(buffer.data(), buffer.size() - stream.avail_out);
+                    } while (stream.avail_out == 0);
+                } while (status != Z_STREAM_END);
+
+                deflateEnd(&stream);
+                return OK({});
+            }
+
+#ifdef HAL_HAS_ZSTD
+            class ZstdDecompressor : public Decompressor
+            {
+            public:
+                ZstdDecompressor(std::string_view data) : m_input{data.data(), data.size(), 0}
+                {
+                }
+
+                ~ZstdDecompressor() override
+                {
+                    if (m_stream != nullptr)
+                    {
+                        ZSTD_freeDStream(m_stream);
+                    }
+                }
+
+                Result<std::monostate> init()
+                {
+                    m_stream = ZSTD_createDStream();
+                    if (m_stream == nullptr)
+                    {
+                        return ERR("could not decompress zstd data: unable to initialize zstd");
+                    }
+                    return OK({});
+                }
+
+                Result<u64> read(char* buffer, u64 size) override
+                {
+                    ZSTD_outBuffer output = {buffer, size, 0};
+                    while (output.pos < output.size)
+                    {
+                        if (m_input.pos == m_input.size)
+                        {
+                            // flush whatever is still buffered within the decoder
+                            if (m_status == 0)
+                            {
+                                break;
+                            }
+                            const size_t previous_pos = output.pos;
+                            m_status                  = ZSTD_decompressStream(m_stream, &output, &m_input);
+                            if (ZSTD_isError(m_status) || output.pos == previous_pos)
+                            {
+                                return ERR("could not decompress zstd data: truncated input");
+                            }
+                            continue;
+                        }
+
+                        m_status = ZSTD_decompressStream(m_stream, &output, &m_input);
+                        if (ZSTD_isError(m_status))
+                        {
+                            return ERR("could not decompress zstd data: " + std::string(ZSTD_getErrorName(m_status)));
+                        }
+                    }
+
+                    return OK(u64(output.pos));
+                }
+
+            private:
+                ZSTD_inBuffer m_input;
+                ZSTD_DStream* m_stream = nullptr;
+                size_t m_status        = 0;
+            };
+
+            Result<std::monostate> write_zstd(std::ofstream& ofs, std::string_view data)
+            {
+                ZSTD_CStream* stream = ZSTD_createCStream();
+                if (stream == nullptr)
+                {
+                    return ERR("could not compress data: unable to initialize zstd");
+                }
+                ZSTD_CCtx_setParameter(stream, ZSTD_c_compressionLevel, ZSTD_CLEVEL_DEFAULT);
+                ZSTD_CCtx_setPledgedSrcSize(stream, data.size());
+
+                std::vector<char> buffer(ZSTD_CStreamOutSize());
+                ZSTD_inBuffer input = {data.data(), data.size(), 0};
+                size_t remaining    = 0;
+                do
+                {
+                    ZSTD_outBuffer output = {buffer.data(), buffer.size(), 0};
+                    remaining             = ZSTD_compressStream2(stream, &output, &input, ZSTD_e_end);
+                    if (ZSTD_isError(remaining))
+                    {
+                        const std::string error = ZSTD_getErrorName(remaining);
+                        ZSTD_freeCStream(stream);
+                        return ERR("could not compress data: " + error);
+                    }
+                    ofs.write(buffer.data(), output.pos);
+                } while (remaining != 0);
+
+                ZSTD_freeCStream(stream);
+                return OK({});
+            }
+#endif
+        }    // namespace
+
+        CompressionFormat detect_format(std::string_view data)
+        {
+            if (data.size() >= 2 && static_cast<u8>(data[0]) == 0x1f && static_cast<u8>(data[1]) == 0x8b)
+            {
+                return CompressionFormat::gzip;
+            }
+            if (data.size() >= 4 && static_cast<u8>(data[0]) == 0x28 && static_cast<u8>(data[1]) == 0xb5 && static_cast<u8>(data[2]) == 0x2f && static_cast<u8>(data[3]) == 0xfd)
+            {
+                return CompressionFormat::zstd;
+            }
+            return CompressionFormat::none;
+        }
+
+        bool is_supported(CompressionFormat format)
+        {
+            if (format == CompressionFormat::zstd)
+            {
+#ifdef HAL_HAS_ZSTD
+                return true;
+#else
+                return false;
+#endif
+            }
+            return true;
+        }
+
+        Result<std::unique_ptr<Decompressor>> Decompressor::create(std::string_view data)
+        {
+            switch (detect_format(data))
+            {
+                case CompressionFormat::gzip: {
+                    auto decompressor = std::make_unique<GzipDecompressor>(data);
+                    if (auto res = decompressor->init(); res.is_error())
+                    {
+                        return ERR(res.get_error());
+                    }
+                    return OK(std::unique_ptr<Decompressor>(std::move(decompressor)));
+                }
+                case CompressionFormat::zstd: {
+#ifdef HAL_HAS_ZSTD
+                    auto decompressor = std::make_unique<ZstdDecompressor>(data);
+                    if (auto res = decompressor->init(); res.is_error())
+                    {
+                        return ERR(res.get_error());
+                    }
+                    return OK(std::unique_ptr<Decompressor>(std::move(decompressor)));
+#else
+                    return ERR("could not decompress zstd data: HAL has been built without zstd support");
+#endif
+                }
+                default:
+                    return ERR("could not decompress data: data is not compressed");
+            }
+        }
+
+        Result<std::string> decompress(std::string_view data)
+        {
+            const CompressionFormat format = detect_format(data);
+            if (format == CompressionFormat::none)
+            {
+                return OK(std::string(data));
+            }
+
+            auto decompressor = Decompressor::create(data);
+            if (decompressor.is_error())
+            {
+                return ERR(decompressor.get_error());
+            }
+
+            std::string res;
+#ifdef HAL_HAS_ZSTD
+            if (const unsigned long long content_size = (format == CompressionFormat::zstd) ? ZSTD_getFrameContentSize(data.data(), data.size()) : ZSTD_CONTENTSIZE_UNKNOWN;
+                content_size != ZSTD_CONTENTSIZE_UNKNOWN && content_size != ZSTD_CONTENTSIZE_ERROR)
+            {
+                res.reserve(content_size);
+            }
+            else
+#endif
+            {
+                res.reserve(data.size() * 4);
+            }
+
+            while (true)
+            {
+                const u64 out_offset = res.size();
+                res.resize(out_offset + CHUNK_SIZE);
+                auto read = decompressor.get()->read(res.data() + out_offset, CHUNK_SIZE);
+                if (read.is_error())
+                {
+                    return ERR(read.get_error());
+                }
+                res.resize(out_offset + read.get());
+                if (read.get() == 0)
+                {
+                    break;
+                }
+            }
+
+            return OK(std::move(res));
+        }
+
+        Result<std::monostate> write_file(const std::filesystem::path& file_path, std::string_view data, CompressionFormat format)
+        {
+            std::ofstream ofs(file_path, std::ios::out | std::ios::binary);
+            if (!ofs.is_open())
+            {
+                return ERR("could not write file '" + file_path.string() + "': unable to open file");
+            }
+
+            Result<std::monostate> res = OK({});
+            switch (format)
+            {
+                case CompressionFormat::gzip:
+                    res = write_gzip(ofs, data);
+                    break;
+                case CompressionFormat::zstd:
+#ifdef HAL_HAS_ZSTD
+                    res = write_zstd(ofs, data);
+#else
+                    res = ERR("could not compress data: HAL has been built without zstd support");
+#endif
+                    break;
+                default:
+                    ofs.write(data.data(), data.size());
+                    break;
+            }
+
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not write file '" + file_path.string() + "'");
+            }
+
+            ofs.close();
+            if (ofs.fail())
+            {
+                return ERR("could not write file '" + file_path.string() + "': unable to write to file");
+            }
+
+            return OK({});
+        }
+
+        CompressionFormat get_format_from_extension(const std::filesystem::path& file_path)
+        {
+            const std::string extension = utils::to_lower(file_path.extension().string());
+            if (extension == ".gz" || extension == ".gzip")
+            {
+                return CompressionFormat::gzip;
+            }
+            if (extension == ".zst" || extension == ".zstd")
+            {
+                return CompressionFormat::zstd;
+            }
+            return CompressionFormat::none;
+        }
+
+        std::filesystem::path strip_extension(const std::filesystem::path& file_path)
+        {
+            if (get_format_from_extension(file_path) == CompressionFormat::none)
+            {
+                return file_path;
+            }
+            return std::filesystem::path(file_path).replace_extension();
+        }
+    }    // namespace compression
+}    // namespace hal
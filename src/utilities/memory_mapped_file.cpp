@@ -0,0 +1,126 @@
+#include "hal_core/utilities/memory_mapped_file.h"
+
+#ifdef _WIN32
+#include <fstream>
+#include <sstream>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hal
+{
+    MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& file_path) : m_path(file_path)
+    {
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+#ifndef _WIN32
+        if (m_mapped)
+        {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+    }
+
+    Result<std::unique_ptr<MemoryMappedFile>> MemoryMappedFile::open(const std::filesystem::path& file_path, bool decompress)
+    {
+        auto file = std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(file_path));
+
+#ifdef _WIN32
+        std::ifstream ifs(file_path.string(), std::ios::in | std::ios::binary);
+        if (!ifs.is_open())
+        {
+            return ERR("could not open file '" + file_path.string() + "': unable to open file");
+        }
+        std::stringstream ss;
+        ss << ifs.rdbuf();
+        file->m_buffer = ss.str();
+        file->m_data   = file->m_buffer.data();
+        file->m_size   = file->m_buffer.size();
+#else
+        int fd = ::open(file_path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return ERR("could not open file '" + file_path.string() + "': " + std::strerror(errno));
+        }
+
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) == -1)
+        {
+            const std::string error = std::strerror(errno);
+            close(fd);
+            return ERR("could not open file '" + file_path.string() + "': " + error);
+        }
+
+        // mapping an empty file is not allowed, an empty view is returned instead
+        if (file_stat.st_size > 0)
+        {
+            void* data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                const std::string error = std::strerror(errno);
+                close(fd);
+                return ERR("could not map file '" + file_path.string() + "' into memory: " + error);
+            }
+
+            // the file is usually consumed front to back, so allow aggressive read-ahead
+            madvise(data, file_stat.st_size, MADV_SEQUENTIAL);
+
+            file->m_data   = static_cast<const char*>(data);
+            file->m_size   = file_stat.st_size;
+            file->m_mapped = true;
+        }
+
+        // the mapping stays valid after closing the descriptor
+        close(fd);
+#endif
+
+        // compressed files are decompressed straight from the mapping, which is released afterwards
+        file->m_compression_format = compression::detect_format(file->get_data());
+        if (decompress && file->m_compression_format != CompressionFormat::none)
+        {
+            auto res = compression::decompress(file->get_data());
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not open file '" + file_path.string() + "'");
+            }
+            std::string buffer = res.get();
+
+#ifndef _WIN32
+            munmap(const_cast<char*>(file->m_data), file->m_size);
+            file->m_mapped = false;
+#endif
+            file->m_buffer = std::move(buffer);
+            file->m_data   = file->m_buffer.data();
+            file->m_size   = file->m_buffer.size();
+        }
+
+        return OK(std::move(file));
+    }
+
+    std::string_view MemoryMappedFile::get_data() const
+    {
+        return std::string_view(m_data, m_size);
+    }
+
+    u64 MemoryMappedFile::get_size() const
+    {
+        return m_size;
+    }
+
+    const std::filesystem::path& MemoryMappedFile::get_path() const
+    {
+        return m_path;
+    }
+
+    CompressionFormat MemoryMappedFile::get_compression_format() const
+    {
+        return m_compression_format;
+    }
+}    // namespace hal
@@ -1,4 +1,5 @@
 #include "hal_core/utilities/project_directory.h"
+#include "hal_core/utilities/compression.h"
 #include <sstream>
 #include <iostream>
 #include <time.h>
@@ -7,7 +8,7 @@ namespace hal {
     const std::string ProjectDirectory::s_shadow_dir = "autosave";
 
     ProjectDirectory::ProjectDirectory(const std::string& path_)
-        : std::filesystem::path(path_)
+        : std::filesystem::path(compression::strip_extension(path_))
     {
         replace_extension(); // remove any extension
     }
@@ -3,6 +3,7 @@
 #include "hal_core/utilities/log.h"
 
 #include <dirent.h>
+#include <fcntl.h>
 #include <fstream>
 #include <sstream>
 #include <sys/stat.h>
@@ -11,13 +12,16 @@
 #ifdef _WIN32
 #include <tchar.h>
 #include <windows.h>
+#include <psapi.h>
 #elif __APPLE__ && __MACH__
 
 #include <mach-o/dyld.h>
+#include <sys/resource.h>
 #include <unistd.h>
 
 #elif __linux__
 #include <stdlib.h>
+#include <sys/resource.h>
 #include <unistd.h>
 #endif
 
@@ -58,6 +62,29 @@ namespace hal
 #endif
         }
 
+        bool sync_file(const std::filesystem::path& path)
+        {
+#ifdef _WIN32
+            HANDLE handle = CreateFileW(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (handle == INVALID_HANDLE_VALUE)
+            {
+                return false;
+            }
+            bool success = FlushFileBuffers(handle) != 0;
+            CloseHandle(handle);
+            return success;
+#else
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                return false;
+            }
+            bool success = fsync(fd) == 0;
+            close(fd);
+            return success;
+#endif
+        }
+
         std::filesystem::path get_binary_directory()
         {
             char buf[1024] = {0};
@@ -262,6 +289,31 @@ namespace hal
             return std::filesystem::path();
         }
 
+        u64 get_peak_memory_usage()
+        {
+#ifdef _WIN32
+            PROCESS_MEMORY_COUNTERS counters;
+            if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            {
+                return counters.PeakWorkingSetSize;
+            }
+            return 0;
+#else
+            struct rusage usage;
+            if (getrusage(RUSAGE_SELF, &usage) != 0)
+            {
+                return 0;
+            }
+#if __APPLE__ && __MACH__
+            // macOS reports bytes
+            return usage.ru_maxrss;
+#else
+            // Linux reports kilobytes
+            return (u64)usage.ru_maxrss * 1024;
+#endif
+#endif
+        }
+
         std::string get_open_source_licenses()
         {
             return R"(pybind11 (https://github.com/pybind/pybind11):
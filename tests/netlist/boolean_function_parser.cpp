@@ -0,0 +1,229 @@
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/parser.h"
+
+#include <random>
+
+namespace hal {
+    namespace {
+        using BooleanFunctionParser::ParserType;
+
+        /**
+         * Reference implementation based on the token-based grammars.
+         */
+        Result<BooleanFunction> parse_with_tokens(const std::string& expression) {
+            const std::vector<std::tuple<ParserType, std::function<Result<std::vector<BooleanFunctionParser::Token>>(const std::string&)>>> parsers = {
+                {ParserType::Standard, BooleanFunctionParser::parse_with_standard_grammar},
+                {ParserType::Liberty, BooleanFunctionParser::parse_with_liberty_grammar},
+            };
+
+            for (const auto& [parser_type, parser] : parsers) {
+                auto tokens = parser(expression);
+                if (tokens.is_error()) {
+                    continue;
+                }
+                tokens = BooleanFunctionParser::reverse_polish_notation(tokens.get(), expression, parser_type);
+                if (tokens.is_error()) {
+                    continue;
+                }
+                if (auto function = BooleanFunctionParser::translate(tokens.get(), expression); function.is_ok()) {
+                    return function;
+                }
+            }
+            return ERR("could not parse '" + expression + "'");
+        }
+
+        /**
+         * Generates random well-formed expressions in the standard or Liberty syntax.
+         */
+        class ExpressionGenerator {
+        public:
+            ExpressionGenerator(u32 seed) : m_rng(seed) {
+            }
+
+            /**
+             * Returns a random expression together with the same expression stripped of all optional whitespace, since the token-based Liberty grammar does not allow whitespace around operators.
+             */
+            std::pair<std::string, std::string> generate(ParserType type, u32 depth) {
+                if (type == ParserType::Standard) {
+                    const std::string expression = standard(depth);
+                    return {expression, expression};
+                }
+
+                std::string expression, compact;
+                for (char c : liberty(depth)) {
+                    if (c == OPTIONAL_WHITESPACE) {
+                        expression += pick<std::string>({"", " ", "  ", "\t"});
+                    } else {
+                        expression += c;
+                        compact += c;
+                    }
+                }
+                return {expression, compact};
+            }
+
+            template<typename T>
+            const T& pick(const std::vector<T>& elements) {
+                return elements.at(std::uniform_int_distribution<u32>(0, elements.size() - 1)(m_rng));
+            }
+
+            u32 random(u32 max) {
+                return std::uniform_int_distribution<u32>(0, max)(m_rng);
+            }
+
+        private:
+            static constexpr char OPTIONAL_WHITESPACE = '\x01';
+
+            std::mt19937 m_rng;
+
+            std::string whitespace() {
+                return pick<std::string>({"", "", " ", "  ", "\t", " \n"});
+            }
+
+            std::string standard(u32 depth) {
+                switch ((depth == 0) ? random(1) : random(5)) {
+                    case 0:
+                        return pick<std::string>({"A", "b_1", "I0", "RDATA(3)", "Q[2]", "\\O[0]", "\\D(-1)", "CLK(+12)", "x(007)"});
+                    case 1:
+                        return pick<std::string>({"0", "1", "0b0", "0b1", "0b 1", "0'b1", "1'b1"});
+                    case 2:
+                        return pick<std::string>({"!", "~"}) + whitespace() + standard(depth - 1);
+                    case 3:
+                        return "(" + whitespace() + standard(depth - 1) + whitespace() + ")";
+                    default:
+                        return standard(depth - 1) + whitespace() + pick<std::string>({"&", "|", "^"}) + whitespace() + standard(depth - 1);
+                }
+            }
+
+            std::string liberty_primary(u32 depth) {
+                std::string res;
+                switch ((depth == 0) ? random(1) : random(2)) {
+                    case 0:
+                        res = pick<std::string>({"A", "b_1", "I0", "RDATA(3)", "D(-1)", "CLK(+12)"});
+                        break;
+                    case 1:
+                        res = pick<std::string>({"0", "1"});
+                        break;
+                    default:
+                        res = "(" + liberty_whitespace() + liberty(depth - 1) + liberty_whitespace() + ")";
+                        break;
+                }
+                return res + std::string(random(3) / 2, '\'');
+            }
+
+            // whitespace around operators and within brackets is optional, except for the implicit AND
+            std::string liberty_whitespace() {
+                return (random(1) == 0) ? "" : std::string(1, OPTIONAL_WHITESPACE);
+            }
+
+            std::string liberty(u32 depth) {
+                switch ((depth == 0) ? 0 : random(3)) {
+                    case 0:
+                        return liberty_primary(depth);
+                    case 1:
+                        return "!" + liberty_whitespace() + liberty(depth - 1);
+                    default:
+                        return liberty(depth - 1) + liberty_whitespace() + pick<std::string>({" ", "&", "*", "|", "+", "^"}) + liberty_whitespace() + liberty(depth - 1);
+                }
+            }
+        };
+
+        // inputs with unbalanced closing brackets or without any operand are not supported by the token-based parsers
+        bool is_supported_by_token_parsers(const std::string& expression) {
+            i32 level = 0;
+            for (char c : expression) {
+                level += (c == '(') ? 1 : ((c == ')') ? -1 : 0);
+                if (level < 0) {
+                    return false;
+                }
+            }
+            return expression.find_first_of("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ01") != std::string::npos;
+        }
+    }    // namespace
+
+    TEST(BooleanFunctionParser, Examples) {
+        const std::vector<std::tuple<std::string, ParserType, BooleanFunction>> data = {
+            {"A & B & C", ParserType::Standard, BooleanFunction::Var("A") & (BooleanFunction::Var("B") & BooleanFunction::Var("C"))},
+            {"A | B & C ^ D", ParserType::Standard, BooleanFunction::Var("A") | ((BooleanFunction::Var("B") & BooleanFunction::Var("C")) ^ BooleanFunction::Var("D"))},
+            {"~\\A[3] & 0b 1", ParserType::Standard, ~BooleanFunction::Var("A[3]") & BooleanFunction::Const(1, 1)},
+            {"A(+01) ^ 0'b1", ParserType::Standard, BooleanFunction::Var("A(1)") ^ BooleanFunction::Const(0, 1)},
+            {"!A' B", ParserType::Liberty, ~(~BooleanFunction::Var("A")) & BooleanFunction::Var("B")},
+            {"A + B * C", ParserType::Liberty, BooleanFunction::Var("A") | (BooleanFunction::Var("B") & BooleanFunction::Var("C"))},
+            {"(A B)' (C)", ParserType::Liberty, ~(BooleanFunction::Var("A") & BooleanFunction::Var("B")) & BooleanFunction::Var("C")},
+        };
+
+        for (const auto& [expression, type, expected] : data) {
+            auto function = BooleanFunctionParser::parse_expression(expression, type);
+            ASSERT_TRUE(function.is_ok()) << expression;
+            EXPECT_EQ(function.get(), expected) << expression;
+        }
+
+        const std::vector<std::tuple<std::string, ParserType>> invalid = {
+            {"", ParserType::Standard},
+            {"A &", ParserType::Standard},
+            {"A B", ParserType::Standard},
+            {"(A | B", ParserType::Standard},
+            {"A | B)", ParserType::Standard},
+            {"\\A", ParserType::Standard},
+            {"A'", ParserType::Standard},
+            {"A(B)", ParserType::Liberty},
+            {"~A", ParserType::Liberty},
+            {"A[0]", ParserType::Liberty},
+            {"0b1", ParserType::Liberty},
+        };
+
+        for (const auto& [expression, type] : invalid) {
+            EXPECT_TRUE(BooleanFunctionParser::parse_expression(expression, type).is_error()) << expression;
+        }
+    }
+
+    TEST(BooleanFunctionParser, FuzzEquivalence) {
+        ExpressionGenerator generator(0x5eed);
+        const std::string alphabet = "AB01()!~&|^*+' \t[]\\b";
+
+        u32 num_mutants_compared = 0;
+        for (u32 i = 0; i < 20000; i++) {
+            const ParserType type        = (i % 2 == 0) ? ParserType::Standard : ParserType::Liberty;
+            const auto [expression, compact] = generator.generate(type, 1 + (i % 5));
+
+            // well-formed expressions must be accepted by both parsers and result in the same Boolean function
+            auto expected = parse_with_tokens(compact);
+            auto function = BooleanFunction::from_string(expression);
+            ASSERT_TRUE(expected.is_ok()) << expression;
+            ASSERT_TRUE(function.is_ok()) << expression;
+            ASSERT_EQ(function.get(), expected.get()) << expression;
+
+            // mutated expressions must be handled gracefully and, if accepted by both parsers, result in the same Boolean function
+            std::string mutant = expression;
+            for (u32 j = 0; j <= generator.random(2); j++) {
+                const u32 pos = generator.random(mutant.size());
+                switch (generator.random(2)) {
+                    case 0:
+                        if (pos < mutant.size()) {
+                            mutant.erase(pos, 1);
+                        }
+                        break;
+                    case 1:
+                        mutant.insert(pos, 1, alphabet.at(generator.random(alphabet.size() - 1)));
+                        break;
+                    default:
+                        if (pos < mutant.size()) {
+                            mutant.at(pos) = alphabet.at(generator.random(alphabet.size() - 1));
+                        }
+                        break;
+                }
+            }
+
+            auto mutant_function = BooleanFunction::from_string(mutant);
+            if (!is_supported_by_token_parsers(mutant)) {
+                continue;
+            }
+            if (auto mutant_expected = parse_with_tokens(mutant); mutant_expected.is_ok() && mutant_function.is_ok()) {
+                ASSERT_EQ(mutant_function.get(), mutant_expected.get()) << mutant;
+                num_mutants_compared++;
+            }
+        }
+        EXPECT_GT(num_mutants_compared, 0);
+    }
+}    // namespace hal
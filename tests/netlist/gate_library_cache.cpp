@@ -0,0 +1,288 @@
+#include "hal_core/netlist/gate_library/gate_library_cache.h"
+
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/lut_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_port_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/timing_component.h"
+#include "netlist_test_utils.h"
+
+#include "gtest/gtest.h"
+#include <fstream>
+
+namespace hal
+{
+    /**
+     * Tests for the gate library cache.
+     */
+
+    class GateLibraryCacheTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+            test_utils::create_sandbox_directory();
+        }
+
+        virtual void TearDown()
+        {
+            test_utils::remove_sandbox_directory();
+        }
+
+        std::unique_ptr<GateLibrary> create_library(const std::filesystem::path& path)
+        {
+            auto gl = std::make_unique<GateLibrary>(path, "cached_lib");
+            gl->set_gate_location_data_category("location");
+            gl->set_gate_location_data_identifiers("LOC_X", "LOC_Y");
+            gl->add_include("some/include.h");
+
+            GateType* gt_and = gl->create_gate_type("AND2", {GateTypeProperty::combinational, GateTypeProperty::c_and});
+            gt_and->create_pin("A", PinDirection::input);
+            gt_and->create_pin("B", PinDirection::input);
+            gt_and->create_pin("O", PinDirection::output);
+            gt_and->add_boolean_function("O", BooleanFunction::from_string("A & B").get());
+
+            GateType* gt_ff = gl->create_gate_type(
+                "DFF",
+                {GateTypeProperty::sequential, GateTypeProperty::ff},
+                GateTypeComponent::create_ff_component(GateTypeComponent::create_state_component(nullptr, "IQ", "IQN"), BooleanFunction::Var("D"), BooleanFunction::Var("CLK")));
+            gt_ff->create_pin("D", PinDirection::input, PinType::data);
+            gt_ff->create_pin("CLK", PinDirection::input, PinType::clock);
+            gt_ff->create_pin("R", PinDirection::input, PinType::reset);
+            gt_ff->create_pin("Q", PinDirection::output, PinType::state);
+            FFComponent* ff = gt_ff->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
+            ff->set_async_reset_function(BooleanFunction::from_string("!R").get());
+            ff->set_async_set_reset_behavior(AsyncSetResetBehavior::L, AsyncSetResetBehavior::H);
+            gt_ff->add_boolean_function("Q", BooleanFunction::Var("IQ"));
+
+            GateType* gt_lut = gl->create_gate_type("LUT2",
+                                                    {GateTypeProperty::combinational, GateTypeProperty::c_lut},
+                                                    GateTypeComponent::create_lut_component(GateTypeComponent::create_init_component("generic", {"INIT"}), false));
+            auto i0 = gt_lut->create_pin(3, "I0", PinDirection::input, PinType::none, false).get();
+            auto i1 = gt_lut->create_pin(7, "I1", PinDirection::input, PinType::none, false).get();
+            gt_lut->create_pin_group(5, "I", {i0, i1}, PinDirection::input, PinType::none, false, 4);
+            gt_lut->create_pin("O", PinDirection::output, PinType::lut);
+
+            GateType* gt_ram = gl->create_gate_type(
+                "RAM",
+                {GateTypeProperty::sequential, GateTypeProperty::ram},
+                GateTypeComponent::create_ram_port_component(GateTypeComponent::create_ram_component(nullptr, 64), "DATA", "ADDR", BooleanFunction::Var("WCLK"), BooleanFunction::Var("WE"), true));
+            gt_ram->create_pin("WCLK", PinDirection::input, PinType::clock);
+            gt_ram->create_pin("WE", PinDirection::input, PinType::enable);
+
+            GateType* gt_inv = gl->create_gate_type("INV", {GateTypeProperty::combinational, GateTypeProperty::c_inverter}, GateTypeComponent::create_timing_component(nullptr));
+            gt_inv->create_pin("A", PinDirection::input);
+            gt_inv->create_pin("O", PinDirection::output);
+            gt_inv->add_boolean_function("O", BooleanFunction::from_string("!A").get());
+            TimingComponent* timing = gt_inv->get_component_as<TimingComponent>([](const GateTypeComponent* c) { return TimingComponent::is_class_of(c); });
+            timing->set_area(1.5);
+            timing->set_leakage_power(0.25);
+            timing->set_pin_capacitance("A", 0.002);
+            TimingComponent::TimingArc arc;
+            arc.pin                  = "O";
+            arc.related_pin          = "A";
+            arc.timing_sense         = "negative_unate";
+            arc.timing_type          = "combinational";
+            arc.cell_rise.variable_1 = "input_net_transition";
+            arc.cell_rise.variable_2 = "total_output_net_capacitance";
+            arc.cell_rise.index_1    = {0.1, 0.5};
+            arc.cell_rise.index_2    = {0.01, 0.02};
+            arc.cell_rise.values     = {0.1, 0.2, 0.3, 0.4};
+            arc.cell_fall.values     = {0.05};
+            timing->add_timing_arc(arc);
+
+            GateType* gt_gnd = gl->create_gate_type("GND", {GateTypeProperty::combinational, GateTypeProperty::ground});
+            gt_gnd->create_pin("O", PinDirection::output, PinType::ground);
+            gt_gnd->add_boolean_function("O", BooleanFunction::Const(BooleanFunction::Value::ZERO));
+            gl->mark_gnd_gate_type(gt_gnd);
+
+            GateType* gt_vcc = gl->create_gate_type("VCC", {GateTypeProperty::combinational, GateTypeProperty::power});
+            gt_vcc->create_pin("O", PinDirection::output, PinType::power);
+            gt_vcc->add_boolean_function("O", BooleanFunction::Const({BooleanFunction::Value::ONE, BooleanFunction::Value::X, BooleanFunction::Value::Z}));
+            gl->mark_vcc_gate_type(gt_vcc);
+
+            return gl;
+        }
+
+        void expect_equal_libraries(const GateLibrary* expected, const GateLibrary* actual)
+        {
+            EXPECT_EQ(expected->get_name(), actual->get_name());
+            EXPECT_EQ(expected->get_gate_location_data_category(), actual->get_gate_location_data_category());
+            EXPECT_EQ(expected->get_gate_location_data_identifiers(), actual->get_gate_location_data_identifiers());
+            EXPECT_EQ(expected->get_includes(), actual->get_includes());
+
+            auto expected_vcc = expected->get_vcc_gate_types();
+            auto actual_vcc   = actual->get_vcc_gate_types();
+            auto expected_gnd = expected->get_gnd_gate_types();
+            auto actual_gnd   = actual->get_gnd_gate_types();
+            EXPECT_EQ(expected_vcc.size(), actual_vcc.size());
+            EXPECT_EQ(expected_gnd.size(), actual_gnd.size());
+
+            auto expected_types = expected->get_gate_types();
+            auto actual_types   = actual->get_gate_types();
+            ASSERT_EQ(expected_types.size(), actual_types.size());
+            for (const auto& [name, expected_gt] : expected_types)
+            {
+                ASSERT_TRUE(actual_types.find(name) != actual_types.end());
+                const GateType* actual_gt = actual_types.at(name);
+
+                EXPECT_EQ(expected_gt->get_id(), actual_gt->get_id());
+                EXPECT_EQ(expected_gt->get_properties(), actual_gt->get_properties());
+                EXPECT_EQ(expected_vcc.find(name) != expected_vcc.end(), actual_vcc.find(name) != actual_vcc.end());
+                EXPECT_EQ(expected_gnd.find(name) != expected_gnd.end(), actual_gnd.find(name) != actual_gnd.end());
+
+                auto expected_groups = expected_gt->get_pin_groups();
+                auto actual_groups   = actual_gt->get_pin_groups();
+                ASSERT_EQ(expected_groups.size(), actual_groups.size());
+                for (u32 i = 0; i < expected_groups.size(); i++)
+                {
+                    EXPECT_TRUE(*expected_groups.at(i) == *actual_groups.at(i));
+                }
+
+                EXPECT_EQ(expected_gt->get_boolean_functions(), actual_gt->get_boolean_functions());
+
+                auto expected_components = expected_gt->get_components();
+                auto actual_components   = actual_gt->get_components();
+                ASSERT_EQ(expected_components.size(), actual_components.size());
+                for (u32 i = 0; i < expected_components.size(); i++)
+                {
+                    EXPECT_EQ(expected_components.at(i)->get_type(), actual_components.at(i)->get_type());
+                }
+
+                if (const auto* expected_timing = expected_gt->get_component_as<TimingComponent>([](const GateTypeComponent* c) { return TimingComponent::is_class_of(c); });
+                    expected_timing != nullptr)
+                {
+                    const auto* actual_timing = actual_gt->get_component_as<TimingComponent>([](const GateTypeComponent* c) { return TimingComponent::is_class_of(c); });
+                    ASSERT_NE(actual_timing, nullptr);
+                    EXPECT_EQ(expected_timing->get_area(), actual_timing->get_area());
+                    EXPECT_EQ(expected_timing->get_leakage_power(), actual_timing->get_leakage_power());
+                    EXPECT_EQ(expected_timing->get_pin_capacitances(), actual_timing->get_pin_capacitances());
+                    EXPECT_EQ(expected_timing->get_timing_arcs(), actual_timing->get_timing_arcs());
+                }
+            }
+        }
+    };
+
+    /**
+     * Testing writing a gate library to a cache file and reading it back.
+     *
+     * Functions: write, read
+     */
+    TEST_F(GateLibraryCacheTest, check_round_trip)
+    {
+        TEST_START
+        {
+            std::filesystem::path lib_path   = test_utils::create_sandbox_file("cached_lib.hgl", "{\"library\": \"cached_lib\"}");
+            std::filesystem::path cache_path = test_utils::create_sandbox_path("cached_lib.hglc");
+            auto gl                          = create_library(lib_path);
+
+            ASSERT_TRUE(gate_library_cache::write(gl.get(), lib_path, cache_path).is_ok());
+            auto res = gate_library_cache::read(lib_path, cache_path);
+            ASSERT_TRUE(res.is_ok()) << res.get_error().get();
+            auto cached_gl = res.get();
+
+            expect_equal_libraries(gl.get(), cached_gl.get());
+
+            // check component contents
+            GateType* gt_ff = cached_gl->get_gate_type_by_name("DFF");
+            ASSERT_NE(gt_ff, nullptr);
+            FFComponent* ff = gt_ff->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
+            ASSERT_NE(ff, nullptr);
+            EXPECT_EQ(ff->get_next_state_function(), BooleanFunction::Var("D"));
+            EXPECT_EQ(ff->get_clock_function(), BooleanFunction::Var("CLK"));
+            EXPECT_EQ(ff->get_async_reset_function(), BooleanFunction::from_string("!R").get());
+            EXPECT_TRUE(ff->get_async_set_function().is_empty());
+            EXPECT_EQ(ff->get_async_set_reset_behavior(), std::make_pair(AsyncSetResetBehavior::L, AsyncSetResetBehavior::H));
+            StateComponent* state = gt_ff->get_component_as<StateComponent>([](const GateTypeComponent* c) { return StateComponent::is_class_of(c); });
+            ASSERT_NE(state, nullptr);
+            EXPECT_EQ(state->get_state_identifier(), "IQ");
+            EXPECT_EQ(state->get_neg_state_identifier(), "IQN");
+
+            GateType* gt_lut = cached_gl->get_gate_type_by_name("LUT2");
+            ASSERT_NE(gt_lut, nullptr);
+            LUTComponent* lut = gt_lut->get_component_as<LUTComponent>([](const GateTypeComponent* c) { return LUTComponent::is_class_of(c); });
+            ASSERT_NE(lut, nullptr);
+            EXPECT_FALSE(lut->is_init_ascending());
+            InitComponent* init = gt_lut->get_component_as<InitComponent>([](const GateTypeComponent* c) { return InitComponent::is_class_of(c); });
+            ASSERT_NE(init, nullptr);
+            EXPECT_EQ(init->get_init_category(), "generic");
+            EXPECT_EQ(init->get_init_identifiers(), std::vector<std::string>({"INIT"}));
+            ASSERT_NE(gt_lut->get_pin_by_id(7), nullptr);
+            EXPECT_EQ(gt_lut->get_pin_by_id(7)->get_name(), "I1");
+            ASSERT_NE(gt_lut->get_pin_group_by_id(5), nullptr);
+            EXPECT_EQ(gt_lut->get_pin_group_by_id(5)->get_start_index(), 4);
+
+            GateType* gt_ram = cached_gl->get_gate_type_by_name("RAM");
+            ASSERT_NE(gt_ram, nullptr);
+            RAMPortComponent* port = gt_ram->get_component_as<RAMPortComponent>([](const GateTypeComponent* c) { return RAMPortComponent::is_class_of(c); });
+            ASSERT_NE(port, nullptr);
+            EXPECT_EQ(port->get_data_group(), "DATA");
+            EXPECT_EQ(port->get_address_group(), "ADDR");
+            EXPECT_EQ(port->get_clock_function(), BooleanFunction::Var("WCLK"));
+            EXPECT_EQ(port->get_enable_function(), BooleanFunction::Var("WE"));
+            EXPECT_TRUE(port->is_write_port());
+
+            // gate types created afterwards continue the ID sequence
+            GateType* gt_new = cached_gl->create_gate_type("NEW");
+            ASSERT_NE(gt_new, nullptr);
+            EXPECT_EQ(gt_new->get_id(), gl->get_gate_types().size() + 1);
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing that cache files are rejected once the gate library file changes and accepted if only the modification time changes.
+     *
+     * Functions: write, read
+     */
+    TEST_F(GateLibraryCacheTest, check_invalidation)
+    {
+        TEST_START
+        {
+            std::filesystem::path lib_path   = test_utils::create_sandbox_file("cached_lib.hgl", "{\"library\": \"cached_lib\"}");
+            std::filesystem::path cache_path = test_utils::create_sandbox_path("cached_lib.hglc");
+            auto gl                          = create_library(lib_path);
+
+            // missing cache file
+            EXPECT_TRUE(gate_library_cache::read(lib_path, cache_path).is_error());
+
+            ASSERT_TRUE(gate_library_cache::write(gl.get(), lib_path, cache_path).is_ok());
+            EXPECT_TRUE(gate_library_cache::read(lib_path, cache_path).is_ok());
+
+            // only the modification time changes
+            std::filesystem::last_write_time(lib_path, std::filesystem::last_write_time(lib_path) - std::chrono::hours(1));
+            EXPECT_TRUE(gate_library_cache::read(lib_path, cache_path).is_ok());
+
+            // content changes but size stays the same
+            {
+                std::ofstream ofs(lib_path, std::ios::trunc);
+                ofs << "{\"library\": \"cached_lix\"}";
+            }
+            EXPECT_TRUE(gate_library_cache::read(lib_path, cache_path).is_error());
+
+            // content and size change
+            {
+                std::ofstream ofs(lib_path, std::ios::app);
+                ofs << "\n";
+            }
+            EXPECT_TRUE(gate_library_cache::read(lib_path, cache_path).is_error());
+
+            // a cache file for a different gate library file
+            std::filesystem::path other_path = test_utils::create_sandbox_file("other_lib.hgl", "{\"library\": \"other_lib\"}");
+            EXPECT_TRUE(gate_library_cache::read(other_path, cache_path).is_error());
+
+            // truncated cache file
+            ASSERT_TRUE(gate_library_cache::write(gl.get(), lib_path, cache_path).is_ok());
+            std::filesystem::resize_file(cache_path, std::filesystem::file_size(cache_path) - 5);
+            EXPECT_TRUE(gate_library_cache::read(lib_path, cache_path).is_error());
+
+            // default cache paths differ for different gate library files
+            EXPECT_NE(gate_library_cache::get_cache_path(lib_path), gate_library_cache::get_cache_path(other_path));
+        }
+        TEST_END
+    }
+}    // namespace hal
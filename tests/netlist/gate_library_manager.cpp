@@ -9,6 +9,7 @@
 #include "netlist_test_utils.h"
 
 #include "gtest/gtest.h"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
@@ -190,6 +191,46 @@ namespace hal
         TEST_END
     }
 
+    /**
+     * Testing the ranking of loaded gate libraries by the fraction of required gate types they provide.
+     *
+     * Functions: get_gate_libraries_by_coverage
+     */
+    TEST_F(GateLibraryManagerTest, check_gate_libraries_by_coverage)
+    {
+        TEST_START
+        NO_COUT_TEST_BLOCK;
+        create_test_lib();
+        GateLibrary* test_lib = gate_library_manager::get_gate_library(m_test_lib_path);
+        ASSERT_NE(test_lib, nullptr);
+
+        const auto find_coverage = [test_lib](const std::vector<std::pair<GateLibrary*, double>>& ranking) {
+            for (const auto& [lib, coverage] : ranking)
+            {
+                if (lib == test_lib)
+                {
+                    return coverage;
+                }
+            }
+            return -1.0;
+        };
+
+        // names are compared case-insensitively
+        EXPECT_EQ(find_coverage(gate_library_manager::get_gate_libraries_by_coverage({"GND", "vcc"})), 1.0);
+        EXPECT_EQ(find_coverage(gate_library_manager::get_gate_libraries_by_coverage({"GND", "VCC", "NOT_A_GATE_TYPE", "ALSO_NOT_A_GATE_TYPE"})), 0.5);
+        EXPECT_EQ(find_coverage(gate_library_manager::get_gate_libraries_by_coverage({"NOT_A_GATE_TYPE"})), 0.0);
+        EXPECT_EQ(find_coverage(gate_library_manager::get_gate_libraries_by_coverage({})), 1.0);
+
+        // libraries are sorted by decreasing coverage
+        const auto ranking = gate_library_manager::get_gate_libraries_by_coverage({"GND", "VCC", "NOT_A_GATE_TYPE"});
+        EXPECT_TRUE(std::is_sorted(ranking.begin(), ranking.end(), [](const auto& a, const auto& b) { return a.second > b.second; }));
+
+        // removed libraries are no longer ranked
+        gate_library_manager::remove(m_test_lib_path);
+        EXPECT_EQ(find_coverage(gate_library_manager::get_gate_libraries_by_coverage({"GND"})), -1.0);
+        TEST_END
+    }
+
     /**
     * Testing the handling of various invalid inputs.
     *
@@ -0,0 +1,135 @@
+#include "hal_core/netlist/gate_library/gate_library_manifest.h"
+
+#include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "netlist_test_utils.h"
+
+#include "gtest/gtest.h"
+#include <fstream>
+
+namespace hal
+{
+    /**
+     * Tests for the gate library manifest.
+     */
+
+    class GateLibraryManifestTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+            test_utils::create_sandbox_directory();
+        }
+
+        virtual void TearDown()
+        {
+            test_utils::remove_sandbox_directory();
+        }
+    };
+
+    /**
+     * Testing the creation of manifest entries and the gate type lookup via the Bloom filter.
+     *
+     * Functions: create_entry, Entry::may_contain_gate_type, Entry::is_valid, Entry::is_up_to_date
+     */
+    TEST_F(GateLibraryManifestTest, check_entry)
+    {
+        TEST_START
+        {
+            std::filesystem::path lib_path = test_utils::create_sandbox_file("manifest_lib.hgl", "{}");
+
+            GateLibrary gl(lib_path, "manifest_lib");
+            for (u32 i = 0; i < 500; i++)
+            {
+                gl.create_gate_type("CELL_" + std::to_string(i));
+            }
+
+            auto entry = gate_library_manifest::create_entry(lib_path, &gl);
+            EXPECT_TRUE(entry.is_valid());
+            EXPECT_TRUE(entry.is_up_to_date());
+            EXPECT_EQ(entry.name, "manifest_lib");
+            EXPECT_EQ(entry.num_gate_types, 500);
+            EXPECT_EQ(entry.path, std::filesystem::absolute(lib_path));
+
+            // no false negatives, names are compared case-insensitively
+            for (u32 i = 0; i < 500; i++)
+            {
+                EXPECT_TRUE(entry.may_contain_gate_type("CELL_" + std::to_string(i)));
+                EXPECT_TRUE(entry.may_contain_gate_type("cell_" + std::to_string(i)));
+            }
+
+            // few false positives
+            u32 num_false_positives = 0;
+            for (u32 i = 0; i < 1000; i++)
+            {
+                if (entry.may_contain_gate_type("OTHER_" + std::to_string(i)))
+                {
+                    num_false_positives++;
+                }
+            }
+            EXPECT_LT(num_false_positives, 50);
+
+            // files that could not be loaded as gate library
+            auto invalid_entry = gate_library_manifest::create_entry(lib_path, nullptr);
+            EXPECT_FALSE(invalid_entry.is_valid());
+            EXPECT_FALSE(invalid_entry.may_contain_gate_type("CELL_0"));
+
+            // modified gate library file
+            {
+                std::ofstream ofs(lib_path, std::ios::app);
+                ofs << "\n";
+            }
+            EXPECT_FALSE(entry.is_up_to_date());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing writing and reading manifest files.
+     *
+     * Functions: write, read
+     */
+    TEST_F(GateLibraryManifestTest, check_persistence)
+    {
+        TEST_START
+        {
+            std::filesystem::path lib_path      = test_utils::create_sandbox_file("manifest_lib.hgl", "{}");
+            std::filesystem::path other_path    = test_utils::create_sandbox_file("README.md", "not a gate library");
+            std::filesystem::path manifest_path = test_utils::create_sandbox_path("manifest.bin");
+
+            GateLibrary gl(lib_path, "manifest_lib");
+            gl.create_gate_type("AND2");
+            gl.create_gate_type("DFF");
+
+            std::vector<gate_library_manifest::Entry> entries = {gate_library_manifest::create_entry(lib_path, &gl), gate_library_manifest::create_entry(other_path, nullptr)};
+
+            // missing manifest file
+            EXPECT_TRUE(gate_library_manifest::read(manifest_path).is_error());
+
+            ASSERT_TRUE(gate_library_manifest::write(entries, manifest_path).is_ok());
+            auto res = gate_library_manifest::read(manifest_path);
+            ASSERT_TRUE(res.is_ok()) << res.get_error().get();
+            auto read_entries = res.get();
+
+            ASSERT_EQ(read_entries.size(), entries.size());
+            for (u32 i = 0; i < entries.size(); i++)
+            {
+                EXPECT_EQ(read_entries.at(i).path, entries.at(i).path);
+                EXPECT_EQ(read_entries.at(i).name, entries.at(i).name);
+                EXPECT_EQ(read_entries.at(i).mtime, entries.at(i).mtime);
+                EXPECT_EQ(read_entries.at(i).size, entries.at(i).size);
+                EXPECT_EQ(read_entries.at(i).num_gate_types, entries.at(i).num_gate_types);
+                EXPECT_EQ(read_entries.at(i).gate_type_filter, entries.at(i).gate_type_filter);
+                EXPECT_TRUE(read_entries.at(i).is_up_to_date());
+            }
+            EXPECT_TRUE(read_entries.at(0).may_contain_gate_type("DFF"));
+            EXPECT_FALSE(read_entries.at(1).is_valid());
+
+            // corrupted manifest file
+            std::filesystem::resize_file(manifest_path, std::filesystem::file_size(manifest_path) - 3);
+            EXPECT_TRUE(gate_library_manifest::read(manifest_path).is_error());
+        }
+        TEST_END
+    }
+}    // namespace hal
@@ -5,6 +5,7 @@
 #include "hal_core/netlist/gate_library/gate_type_component/latch_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/lut_component.h"
 #include "hal_core/netlist/gate_library/gate_type_component/state_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/timing_component.h"
 #include "hal_core/utilities/log.h"
 #include "netlist_test_utils.h"
 
@@ -951,4 +952,65 @@ TEST_F(GateTypeTest, check_latch_gt)
 
     TEST_END
 }
+
+/**
+     * Testing timing gate type component.
+     */
+TEST_F(GateTypeTest, check_timing_gt)
+{
+    TEST_START
+
+    GateLibrary gl("no_path", "example_gl");
+
+    GateType* gt = gl.create_gate_type("dummy", {GateTypeProperty::ff}, GateTypeComponent::create_timing_component(GateTypeComponent::create_state_component(nullptr, "IQ", "IQN")));
+    ASSERT_NE(gt, nullptr);
+    TimingComponent* timing_component = gt->get_component_as<TimingComponent>([](const GateTypeComponent* c) { return TimingComponent::is_class_of(c); });
+    ASSERT_NE(timing_component, nullptr);
+    EXPECT_NE(gt->get_component_as<StateComponent>([](const GateTypeComponent* c) { return StateComponent::is_class_of(c); }), nullptr);
+
+    EXPECT_TRUE(timing_component->get_timing_arcs().empty());
+    EXPECT_TRUE(timing_component->get_pin_capacitances().empty());
+    EXPECT_EQ(timing_component->get_pin_capacitance("D"), 0.0);
+    EXPECT_EQ(timing_component->get_leakage_power(), 0.0);
+    EXPECT_EQ(timing_component->get_area(), 0.0);
+
+    timing_component->set_pin_capacitance("D", 0.5);
+    timing_component->set_leakage_power(2.0);
+    timing_component->set_area(4.0);
+    EXPECT_EQ(timing_component->get_pin_capacitance("D"), 0.5);
+    EXPECT_EQ(timing_component->get_leakage_power(), 2.0);
+    EXPECT_EQ(timing_component->get_area(), 4.0);
+
+    TimingComponent::TimingArc arc;
+    arc.pin                     = "Q";
+    arc.related_pin             = "CLK";
+    arc.timing_type             = "rising_edge";
+    arc.cell_rise.index_1       = {1.0, 3.0};
+    arc.cell_rise.index_2       = {10.0, 20.0, 40.0};
+    arc.cell_rise.values        = {1.0, 2.0, 4.0, 3.0, 4.0, 6.0};
+    arc.rise_transition.index_1 = {1.0, 2.0};
+    arc.rise_transition.values  = {5.0, 7.0};
+    arc.fall_transition.values  = {0.5};
+    timing_component->add_timing_arc(arc);
+    ASSERT_EQ(timing_component->get_timing_arcs().size(), 1);
+    EXPECT_EQ(timing_component->get_timing_arcs().at(0), arc);
+    EXPECT_EQ(timing_component->get_timing_arcs("Q").size(), 1);
+    EXPECT_TRUE(timing_component->get_timing_arcs("QN").empty());
+
+    // two-dimensional interpolation and extrapolation
+    EXPECT_DOUBLE_EQ(arc.cell_rise.evaluate(1.0, 10.0), 1.0);
+    EXPECT_DOUBLE_EQ(arc.cell_rise.evaluate(3.0, 40.0), 6.0);
+    EXPECT_DOUBLE_EQ(arc.cell_rise.evaluate(2.0, 15.0), 2.5);
+    EXPECT_DOUBLE_EQ(arc.cell_rise.evaluate(2.0, 30.0), 4.0);
+    EXPECT_DOUBLE_EQ(arc.cell_rise.evaluate(5.0, 10.0), 5.0);
+    EXPECT_DOUBLE_EQ(arc.cell_rise.evaluate(1.0, 0.0), 0.0);
+
+    // one-dimensional, scalar, and empty tables
+    EXPECT_DOUBLE_EQ(arc.rise_transition.evaluate(1.5), 6.0);
+    EXPECT_DOUBLE_EQ(arc.fall_transition.evaluate(100.0, 100.0), 0.5);
+    EXPECT_TRUE(arc.cell_fall.is_empty());
+    EXPECT_DOUBLE_EQ(arc.cell_fall.evaluate(1.0, 1.0), 0.0);
+
+    TEST_END
+}
 }    //namespace hal
@@ -1396,6 +1396,51 @@ namespace hal {
         TEST_END
     }
 
+    /**
+    * Testing the update of all module nets at once
+    *
+    * Functions: update_module_nets, reserve
+    */
+    TEST_F(NetlistTest, check_update_module_nets) {
+        TEST_START
+            {
+                // Build the same modules with and without automatic net checks and compare the module nets
+                auto nl_ref = test_utils::create_example_netlist();
+                auto nl = test_utils::create_example_netlist();
+                nl->reserve(16, 32, 4);
+                nl->enable_automatic_net_checks(false);
+
+                for (Netlist* netlist : {nl_ref.get(), nl.get()})
+                {
+                    Module* m_0 = netlist->create_module(2, "module_0", netlist->get_top_module(), {netlist->get_gate_by_id(0), netlist->get_gate_by_id(3)});
+                    netlist->create_module(3, "module_1", m_0, {netlist->get_gate_by_id(4), netlist->get_gate_by_id(5)});
+                }
+
+                nl->update_module_nets();
+                nl->enable_automatic_net_checks(true);
+
+                for (Module* mod_ref : nl_ref->get_modules())
+                {
+                    Module* mod = nl->get_module_by_id(mod_ref->get_id());
+                    ASSERT_NE(mod, nullptr);
+
+                    auto to_ids = [](const std::unordered_set<Net*>& nets) {
+                        std::set<u32> ids;
+                        for (const Net* net : nets)
+                        {
+                            ids.insert(net->get_id());
+                        }
+                        return ids;
+                    };
+                    EXPECT_EQ(to_ids(mod->get_nets()), to_ids(mod_ref->get_nets()));
+                    EXPECT_EQ(to_ids(mod->get_input_nets()), to_ids(mod_ref->get_input_nets()));
+                    EXPECT_EQ(to_ids(mod->get_output_nets()), to_ids(mod_ref->get_output_nets()));
+                    EXPECT_EQ(to_ids(mod->get_internal_nets()), to_ids(mod_ref->get_internal_nets()));
+                }
+            }
+        TEST_END
+    }
+
     /***************************************************
      *               Grouping Functions
      ***************************************************/
@@ -0,0 +1,301 @@
+#include "hal_core/netlist/persistent/netlist_binary_serializer.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/plugin_system/plugin_manager.h"
+#include "gate_library_test_utils.h"
+#include "netlist_test_utils.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace hal {
+
+    class NetlistBinarySerializerTest : public ::testing::Test {
+    protected:
+        const GateLibrary* m_gl;
+
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+            plugin_manager::load_all_plugins();
+            test_utils::create_sandbox_directory();
+
+            // gate library needs to be registered through gate_library_manager for serialization
+            std::unique_ptr<GateLibrary> gl_tmp = test_utils::create_gate_library(test_utils::create_sandbox_path("testing_gate_library.hgl"));
+            gate_library_manager::save(gl_tmp->get_path(), gl_tmp.get(), true);
+            m_gl = gate_library_manager::load(gl_tmp->get_path());
+        }
+
+        virtual void TearDown()
+        {
+            plugin_manager::unload_all_plugins();
+            test_utils::remove_sandbox_directory();
+        }
+
+        std::unique_ptr<Netlist> create_example_serializer_netlist()
+        {
+            std::unique_ptr<Netlist> nl = std::make_unique<Netlist>(m_gl);
+            nl->set_id(123);
+            nl->set_input_filename("esnl_input_filename");
+            nl->set_device_name("esnl_device_name");
+            nl->set_design_name("design_name");
+            nl->get_top_module()->set_type("top_mod_type");
+
+            Gate* gate_0 = nl->create_gate(1, m_gl->get_gate_type_by_name("AND2"), "gate_0", 3, 4);
+            Gate* gate_1 = nl->create_gate(2, m_gl->get_gate_type_by_name("GND"), "gate_1");
+            Gate* gate_2 = nl->create_gate(3, m_gl->get_gate_type_by_name("VCC"), "gate_2");
+            Gate* gate_3 = nl->create_gate(4, m_gl->get_gate_type_by_name("BUF"), "gate_3");
+            Gate* gate_4 = nl->create_gate(5, m_gl->get_gate_type_by_name("INV"), "gate_4");
+            Gate* gate_5 = nl->create_gate(6, m_gl->get_gate_type_by_name("OR2"), "gate_5");
+
+            Net* net_1_3 = nl->create_net(13, "net_1_3");
+            net_1_3->add_source(gate_1, "O");
+            net_1_3->add_destination(gate_3, "I");
+
+            Net* net_3_0 = nl->create_net(30, "net_3_0");
+            net_3_0->add_source(gate_3, "O");
+            net_3_0->add_destination(gate_0, "I0");
+
+            Net* net_2_0 = nl->create_net(20, "net_2_0");
+            net_2_0->add_source(gate_2, "O");
+            net_2_0->add_destination(gate_0, "I1");
+
+            Net* net_0_4_5 = nl->create_net(45, "net_0_4_5");
+            net_0_4_5->add_source(gate_0, "O");
+            net_0_4_5->add_destination(gate_4, "I");
+            net_0_4_5->add_destination(gate_5, "I0");
+
+            gate_1->mark_gnd_gate();
+            gate_2->mark_vcc_gate();
+            net_1_3->mark_global_input_net();
+            net_3_0->mark_global_output_net();
+
+            Module* test_m_0 = nl->create_module(2, "test_mod_0", nl->get_top_module());
+            test_m_0->set_type("test_mod_type_0");
+            test_m_0->assign_gate(gate_0);
+            test_m_0->assign_gate(gate_3);
+
+            Module* test_m_1 = nl->create_module(3, "test_mod_1", test_m_0);
+            test_m_1->set_type("test_mod_type_1");
+            test_m_1->assign_gate(gate_1);
+
+            gate_1->set_data("category_0", "key_0", "data_type", "test_value");
+            gate_1->set_data("category_1", "key_1", "data_type", "test_value_1");
+            net_1_3->set_data("category", "key_2", "data_type", "test_value");
+            test_m_0->set_data("category", "key_3", "data_type", "test_value");
+
+            ModulePin* pin_1 = test_m_0->get_pin_by_net(net_1_3);
+            assert(pin_1 != nullptr);
+            assert(test_m_0->set_pin_name(pin_1, "test_m_0_net_1_3_in"));
+            ModulePin* pin_2 = test_m_0->get_pin_by_net(net_2_0);
+            assert(pin_2 != nullptr);
+            assert(test_m_0->create_pin_group("great_group", {pin_1, pin_2}).is_ok());
+
+            gate_0->add_boolean_function("O_and", BooleanFunction::from_string("I0 & I1").get());
+            gate_4->add_boolean_function("O_const", BooleanFunction::from_string("(I & 0b1) | 0b0").get());
+
+            return nl;
+        }
+    };
+
+    /**
+     * Testing the serialization and a followed deserialization of the example netlist in the binary format.
+     *
+     * Functions: serialize_to_file, deserialize_from_file, is_binary_hal
+     */
+    TEST_F(NetlistBinarySerializerTest, check_serialize_and_deserialize) {
+        TEST_START
+            {
+                // serialize and deserialize the example netlist and compare the result with the original netlist
+                auto nl = create_example_serializer_netlist();
+
+                std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+
+                std::ifstream ifs(test_hal_file_path.string(), std::ios::binary);
+                std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+                EXPECT_TRUE(netlist_binary_serializer::is_binary_hal(contents));
+
+                auto des_nl = netlist_binary_serializer::deserialize_from_file(test_hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                EXPECT_TRUE(*nl == *des_nl);
+                EXPECT_EQ(des_nl->get_gate_by_id(1)->get_location_x(), 3);
+                EXPECT_EQ(des_nl->get_gate_by_id(1)->get_location_y(), 4);
+
+                // binary files are detected by the regular deserializer as well
+                des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                EXPECT_TRUE(*nl == *des_nl);
+            }
+            {
+                // serialize and deserialize an empty netlist and compare the result with the original netlist
+                auto nl = std::make_unique<Netlist>(m_gl);
+
+                std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                auto des_nl = netlist_binary_serializer::deserialize_from_file(test_hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                EXPECT_TRUE(*nl == *des_nl);
+            }
+            if (compression::is_supported(CompressionFormat::gzip))
+            {
+                // compressed binary files are decompressed transparently
+                auto nl = create_example_serializer_netlist();
+
+                std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_hal_file_path, CompressionFormat::gzip));
+                auto des_nl = netlist_binary_serializer::deserialize_from_file(test_hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                EXPECT_TRUE(*nl == *des_nl);
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the lazy deserialization of data entries and custom Boolean functions from binary .hal files.
+     *
+     * Functions: deserialize_from_file
+     */
+    TEST_F(NetlistBinarySerializerTest, check_lazy_deserialization) {
+        TEST_START
+            {
+                // data entries and functions are only decoded on first access
+                auto nl = create_example_serializer_netlist();
+
+                std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+
+                auto des_nl = netlist_binary_serializer::deserialize_from_file(test_hal_file_path, true);
+                ASSERT_NE(des_nl, nullptr);
+
+                Gate* gate_1 = des_nl->get_gate_by_id(2);
+                ASSERT_NE(gate_1, nullptr);
+                EXPECT_TRUE(gate_1->has_lazy_data());
+                EXPECT_TRUE(des_nl->get_net_by_id(13)->has_lazy_data());
+                EXPECT_TRUE(des_nl->get_module_by_id(2)->has_lazy_data());
+                EXPECT_EQ(gate_1->get_data("category_1", "key_1"), std::make_tuple("data_type", "test_value_1"));
+                EXPECT_FALSE(gate_1->has_lazy_data());
+
+                EXPECT_EQ(des_nl->get_gate_by_id(1)->get_boolean_function("O_and"), BooleanFunction::from_string("I0 & I1").get());
+
+                // modifications are applied on top of the decoded entries
+                Net* net_1_3 = des_nl->get_net_by_id(13);
+                EXPECT_TRUE(net_1_3->set_data("category", "key_4", "data_type", "new_value"));
+                EXPECT_FALSE(net_1_3->has_lazy_data());
+                EXPECT_EQ(net_1_3->get_data_map().size(), 2);
+                EXPECT_TRUE(net_1_3->delete_data("category", "key_4"));
+
+                EXPECT_TRUE(*nl == *des_nl);
+            }
+            {
+                // lazily deserialized netlists can be copied and serialized again
+                auto nl = create_example_serializer_netlist();
+
+                std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                auto des_nl = netlist_binary_serializer::deserialize_from_file(test_hal_file_path, true);
+                ASSERT_NE(des_nl, nullptr);
+
+                auto copied_nl = des_nl->copy();
+                ASSERT_TRUE(copied_nl.is_ok());
+                EXPECT_TRUE(*nl == *copied_nl.get());
+
+                std::filesystem::path other_hal_file_path = test_utils::create_sandbox_path("other_hal_file.hal");
+                ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(des_nl.get(), other_hal_file_path));
+                auto other_nl = netlist_binary_serializer::deserialize_from_file(other_hal_file_path);
+                ASSERT_NE(other_nl, nullptr);
+                EXPECT_TRUE(*nl == *other_nl);
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the conversion between JSON and binary .hal files.
+     *
+     * Functions: convert_file
+     */
+    TEST_F(NetlistBinarySerializerTest, check_convert_file) {
+        TEST_START
+            {
+                auto nl = create_example_serializer_netlist();
+
+                std::filesystem::path json_file_path   = test_utils::create_sandbox_path("test_hal_file.hal");
+                std::filesystem::path binary_file_path = test_utils::create_sandbox_path("test_hal_file_binary.hal");
+                std::filesystem::path back_file_path   = test_utils::create_sandbox_path("test_hal_file_back.hal");
+                ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), json_file_path));
+
+                // JSON to binary
+                ASSERT_TRUE(netlist_binary_serializer::convert_file(json_file_path, binary_file_path));
+                std::ifstream ifs(binary_file_path.string(), std::ios::binary);
+                std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+                EXPECT_TRUE(netlist_binary_serializer::is_binary_hal(contents));
+
+                // binary to JSON
+                ASSERT_TRUE(netlist_binary_serializer::convert_file(binary_file_path, back_file_path));
+                auto des_nl = netlist_serializer::deserialize_from_file(back_file_path);
+                ASSERT_NE(des_nl, nullptr);
+
+                // JSON .hal files do not store gate locations, hence the result is compared to the original JSON file
+                auto json_nl = netlist_serializer::deserialize_from_file(json_file_path);
+                ASSERT_NE(json_nl, nullptr);
+                EXPECT_TRUE(*json_nl == *des_nl);
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the serialization and deserialization of binary .hal files with invalid input.
+     *
+     * Functions: serialize_to_file, deserialize_from_file, deserialize_from_buffer
+     */
+    TEST_F(NetlistBinarySerializerTest, check_serialize_and_deserialize_negative) {
+        TEST_START
+            {
+                // serialize a netlist which is a nullptr
+                std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                EXPECT_FALSE(netlist_binary_serializer::serialize_to_file(nullptr, test_hal_file_path));
+            }
+            {
+                // deserialize a netlist from a non existing path
+                NO_COUT_TEST_BLOCK;
+                EXPECT_EQ(netlist_binary_serializer::deserialize_from_file(std::filesystem::path("/using/this/file/is/let.hal")), nullptr);
+            }
+            {
+                // deserialize a truncated or corrupted file
+                NO_COUT_TEST_BLOCK;
+                auto nl = create_example_serializer_netlist();
+
+                std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                ASSERT_TRUE(netlist_binary_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                std::ifstream ifs(test_hal_file_path.string(), std::ios::binary);
+                std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+                ifs.close();
+
+                // copy into 8-byte aligned buffers
+                for (u64 size : {(u64)8, (u64)32, contents.size() / 2, contents.size() - 1})
+                {
+                    std::vector<u64> buffer(size / sizeof(u64) + 1);
+                    std::memcpy(buffer.data(), contents.data(), size);
+                    EXPECT_EQ(netlist_binary_serializer::deserialize_from_buffer(std::string_view(reinterpret_cast<const char*>(buffer.data()), size)), nullptr);
+                }
+
+                std::vector<u64> buffer(contents.size() / sizeof(u64) + 1);
+                std::memcpy(buffer.data(), contents.data(), contents.size());
+                std::string_view data(reinterpret_cast<const char*>(buffer.data()), contents.size());
+                ASSERT_NE(netlist_binary_serializer::deserialize_from_buffer(data), nullptr);
+
+                // unsupported version
+                reinterpret_cast<char*>(buffer.data())[8] = 0x7f;
+                EXPECT_EQ(netlist_binary_serializer::deserialize_from_buffer(data), nullptr);
+
+                // not a binary file at all
+                EXPECT_EQ(netlist_binary_serializer::deserialize_from_buffer("I h4ve no b1nary f0rmat!!!"), nullptr);
+            }
+        TEST_END
+    }
+}    //namespace hal
@@ -0,0 +1,330 @@
+#include "hal_core/netlist/persistent/netlist_journal.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/netlist/project_manager.h"
+#include "hal_core/plugin_system/plugin_manager.h"
+#include "gate_library_test_utils.h"
+#include "netlist_test_utils.h"
+
+#include <fstream>
+
+namespace hal {
+
+    class NetlistJournalTest : public ::testing::Test {
+    protected:
+        const GateLibrary* m_gl;
+
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+            plugin_manager::load_all_plugins();
+            test_utils::create_sandbox_directory();
+
+            // gate library needs to be registered through gate_library_manager for serialization
+            std::unique_ptr<GateLibrary> gl_tmp = test_utils::create_gate_library(test_utils::create_sandbox_path("testing_gate_library.hgl"));
+            gate_library_manager::save(gl_tmp->get_path(), gl_tmp.get(), true);
+            m_gl = gate_library_manager::load(gl_tmp->get_path());
+        }
+
+        virtual void TearDown()
+        {
+            plugin_manager::unload_all_plugins();
+            test_utils::remove_sandbox_directory();
+        }
+
+        std::unique_ptr<Netlist> create_example_journal_netlist()
+        {
+            std::unique_ptr<Netlist> nl = std::make_unique<Netlist>(m_gl);
+            nl->set_id(123);
+            nl->set_input_filename("esnl_input_filename");
+            nl->set_device_name("esnl_device_name");
+            nl->set_design_name("design_name");
+            nl->get_top_module()->set_type("top_mod_type");
+
+            Gate* gate_0 = nl->create_gate(1, m_gl->get_gate_type_by_name("AND2"), "gate_0");
+            Gate* gate_1 = nl->create_gate(2, m_gl->get_gate_type_by_name("GND"), "gate_1");
+            Gate* gate_2 = nl->create_gate(3, m_gl->get_gate_type_by_name("VCC"), "gate_2");
+            Gate* gate_3 = nl->create_gate(4, m_gl->get_gate_type_by_name("BUF"), "gate_3");
+            Gate* gate_4 = nl->create_gate(5, m_gl->get_gate_type_by_name("INV"), "gate_4");
+
+            Net* net_1_3 = nl->create_net(13, "net_1_3");
+            net_1_3->add_source(gate_1, "O");
+            net_1_3->add_destination(gate_3, "I");
+
+            Net* net_3_0 = nl->create_net(30, "net_3_0");
+            net_3_0->add_source(gate_3, "O");
+            net_3_0->add_destination(gate_0, "I0");
+
+            Net* net_2_0 = nl->create_net(20, "net_2_0");
+            net_2_0->add_source(gate_2, "O");
+            net_2_0->add_destination(gate_0, "I1");
+
+            Net* net_0_4 = nl->create_net(40, "net_0_4");
+            net_0_4->add_source(gate_0, "O");
+            net_0_4->add_destination(gate_4, "I");
+
+            gate_1->mark_gnd_gate();
+            gate_2->mark_vcc_gate();
+            net_1_3->mark_global_input_net();
+
+            Module* test_m_0 = nl->create_module(2, "test_mod_0", nl->get_top_module());
+            test_m_0->set_type("test_mod_type_0");
+            test_m_0->assign_gate(gate_0);
+            test_m_0->assign_gate(gate_3);
+
+            gate_1->set_data("category_0", "key_0", "data_type", "test_value");
+            net_1_3->set_data("category", "key_2", "data_type", "test_value");
+
+            return nl;
+        }
+
+        // apply a set of changes that touches every part of the netlist covered by delta records
+        void modify_example_journal_netlist(Netlist* nl)
+        {
+            nl->set_design_name("modified_design_name");
+
+            Gate* gate_0 = nl->get_gate_by_id(1);
+            Gate* gate_4 = nl->get_gate_by_id(5);
+            gate_0->set_name("gate_0_renamed");
+            gate_0->set_data("category_0", "key_0", "data_type", "new_value");
+            gate_0->add_boolean_function("O_and", BooleanFunction::from_string("I0 & I1").get());
+
+            // new gate connected to an existing net and a new net
+            Gate* gate_5 = nl->create_gate(6, m_gl->get_gate_type_by_name("OR2"), "gate_5");
+            nl->get_net_by_id(40)->add_destination(gate_5, "I0");
+            Net* net_5_out = nl->create_net(50, "net_5_out");
+            net_5_out->add_source(gate_5, "O");
+            net_5_out->mark_global_output_net();
+
+            // removed data, net and gate
+            nl->get_gate_by_id(2)->delete_data("category_0", "key_0");
+            nl->delete_net(nl->get_net_by_id(30));
+            nl->delete_gate(gate_4);
+
+            // module hierarchy and pins
+            Module* test_m_0 = nl->get_module_by_id(2);
+            Module* test_m_1 = nl->create_module(3, "test_mod_1", nl->get_top_module());
+            test_m_1->set_type("test_mod_type_1");
+            test_m_1->assign_gate(gate_5);
+            test_m_0->set_parent_module(test_m_1);
+            test_m_1->set_data("category", "key_3", "data_type", "test_value");
+
+            ModulePin* pin = test_m_1->get_pin_by_net(net_5_out);
+            ASSERT_NE(pin, nullptr);
+            EXPECT_TRUE(test_m_1->set_pin_name(pin, "test_m_1_out"));
+        }
+    };
+
+    /**
+     * Testing that replaying the journal on top of the snapshot restores the netlist.
+     *
+     * Functions: append_delta, replay, has_changes
+     */
+    TEST_F(NetlistJournalTest, check_append_and_replay) {
+        TEST_START
+            {
+                auto nl = create_example_journal_netlist();
+
+                std::filesystem::path hal_file_path     = test_utils::create_sandbox_path("test_hal_file.hal");
+                std::filesystem::path journal_file_path = test_utils::create_sandbox_path("test_hal_file.journal");
+                ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), hal_file_path));
+
+                NetlistJournal journal(nl.get());
+                EXPECT_FALSE(journal.has_changes());
+                EXPECT_TRUE(journal.append_delta(journal_file_path));
+                EXPECT_FALSE(std::filesystem::exists(journal_file_path));
+
+                modify_example_journal_netlist(nl.get());
+                EXPECT_TRUE(journal.has_changes());
+                ASSERT_TRUE(journal.append_delta(journal_file_path));
+                EXPECT_FALSE(journal.has_changes());
+
+                // second record modifies objects of the first one
+                nl->get_gate_by_id(6)->set_name("gate_5_renamed");
+                nl->delete_module(nl->get_module_by_id(3));
+                ASSERT_TRUE(journal.append_delta(journal_file_path));
+
+                auto des_nl = netlist_serializer::deserialize_from_file(hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                EXPECT_FALSE(*nl == *des_nl);
+                ASSERT_TRUE(NetlistJournal::replay(des_nl.get(), journal_file_path));
+                EXPECT_TRUE(*nl == *des_nl);
+            }
+            {
+                // an incomplete last record is ignored
+                auto nl = create_example_journal_netlist();
+
+                std::filesystem::path hal_file_path     = test_utils::create_sandbox_path("test_hal_file.hal");
+                std::filesystem::path journal_file_path = test_utils::create_sandbox_path("test_hal_file_torn.journal");
+                ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), hal_file_path));
+
+                NetlistJournal journal(nl.get());
+                nl->get_gate_by_id(1)->set_name("gate_0_renamed");
+                ASSERT_TRUE(journal.append_delta(journal_file_path));
+
+                std::ofstream ofs(journal_file_path, std::ios::binary | std::ios::app);
+                ofs << "{\"serialization_format_version\":11,\"gates\":[{\"id\":1";
+                ofs.close();
+
+                auto des_nl = netlist_serializer::deserialize_from_file(hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                ASSERT_TRUE(NetlistJournal::replay(des_nl.get(), journal_file_path));
+                EXPECT_TRUE(*nl == *des_nl);
+            }
+            {
+                // a missing journal is treated as empty
+                auto nl = create_example_journal_netlist();
+                EXPECT_TRUE(NetlistJournal::replay(nl.get(), test_utils::create_sandbox_path("missing.journal")));
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing that a journal outliving its netlist does not access the destroyed netlist.
+     *
+     * Functions: get_netlist, take_delta
+     */
+    TEST_F(NetlistJournalTest, check_netlist_destroyed) {
+        TEST_START
+            {
+                auto nl = create_example_journal_netlist();
+
+                auto journal = std::make_unique<NetlistJournal>(nl.get());
+                EXPECT_EQ(journal->get_netlist(), nl.get());
+                nl->get_gate_by_id(1)->set_name("gate_0_renamed");
+                EXPECT_TRUE(journal->has_changes());
+
+                nl.reset();
+                EXPECT_EQ(journal->get_netlist(), nullptr);
+                EXPECT_TRUE(journal->take_delta().empty());
+                journal.reset();
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the compaction of a journal into its snapshot.
+     *
+     * Functions: compact
+     */
+    TEST_F(NetlistJournalTest, check_compact) {
+        TEST_START
+            {
+                auto nl = create_example_journal_netlist();
+
+                std::filesystem::path hal_file_path     = test_utils::create_sandbox_path("test_hal_file.hal");
+                std::filesystem::path journal_file_path = test_utils::create_sandbox_path("test_hal_file.journal");
+                ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), hal_file_path));
+
+                NetlistJournal journal(nl.get());
+                modify_example_journal_netlist(nl.get());
+                ASSERT_TRUE(journal.append_delta(journal_file_path));
+
+                // keep the compacted records to simulate a crash between replacing the snapshot and truncating the journal
+                std::ifstream ifs(journal_file_path.string(), std::ios::binary);
+                std::string records((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+                ifs.close();
+
+                ASSERT_TRUE(NetlistJournal::compact(hal_file_path, journal_file_path, m_gl));
+                EXPECT_EQ(std::filesystem::file_size(journal_file_path), 0);
+
+                auto des_nl = netlist_serializer::deserialize_from_file(hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                EXPECT_TRUE(*nl == *des_nl);
+
+                // replaying records that are already part of the snapshot does not change the netlist
+                std::filesystem::path stale_journal_file_path = test_utils::create_sandbox_path("test_hal_file_stale.journal");
+                std::ofstream ofs(stale_journal_file_path, std::ios::binary);
+                ofs << records;
+                ofs.close();
+                ASSERT_TRUE(NetlistJournal::replay(des_nl.get(), stale_journal_file_path));
+                EXPECT_TRUE(*nl == *des_nl);
+
+                // records appended after compaction are replayed on top of the new snapshot
+                nl->get_net_by_id(13)->set_name("net_1_3_renamed");
+                ASSERT_TRUE(journal.append_delta(journal_file_path));
+                des_nl = netlist_serializer::deserialize_from_file(hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                ASSERT_TRUE(NetlistJournal::replay(des_nl.get(), journal_file_path));
+                EXPECT_TRUE(*nl == *des_nl);
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing that autosaves running in the background capture a consistent state of the netlist.
+     *
+     * Functions: start_autosave, wait_for_autosave, discard_journal, serialize_project
+     */
+    TEST_F(NetlistJournalTest, check_background_autosave) {
+        TEST_START
+            {
+                auto nl = create_example_journal_netlist();
+
+                ProjectManager* pm = ProjectManager::instance();
+                ASSERT_TRUE(pm->create_project_directory(test_utils::create_sandbox_path("autosave_project").string()));
+                std::filesystem::path hal_file_path     = pm->get_project_directory().get_shadow_filename(".hal");
+                std::filesystem::path journal_file_path = pm->get_project_directory().get_shadow_filename(".journal");
+
+                // first autosave writes the entire netlist, edits made in the meantime are not part of it
+                ASSERT_TRUE(pm->start_autosave(nl.get()));
+                auto saved_nl = nl->copy().get();
+                modify_example_journal_netlist(nl.get());
+                ASSERT_TRUE(pm->wait_for_autosave());
+
+                auto des_nl = netlist_serializer::deserialize_from_file(hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                ASSERT_TRUE(NetlistJournal::replay(des_nl.get(), journal_file_path));
+                EXPECT_TRUE(*saved_nl == *des_nl);
+
+                // second autosave appends the edits to the journal
+                ASSERT_TRUE(pm->start_autosave(nl.get()));
+                ASSERT_TRUE(pm->wait_for_autosave());
+
+                des_nl = netlist_serializer::deserialize_from_file(hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                ASSERT_TRUE(NetlistJournal::replay(des_nl.get(), journal_file_path));
+                EXPECT_TRUE(*nl == *des_nl);
+
+                pm->discard_journal();
+            }
+            {
+                // first autosave of a saved netlist copies the netlist file and appends the changes since saving
+                auto nl = create_example_journal_netlist();
+
+                ProjectManager* pm = ProjectManager::instance();
+                ASSERT_TRUE(pm->create_project_directory(test_utils::create_sandbox_path("autosave_saved_project").string()));
+                std::filesystem::path hal_file_path     = pm->get_project_directory().get_shadow_filename(".hal");
+                std::filesystem::path journal_file_path = pm->get_project_directory().get_shadow_filename(".journal");
+                ASSERT_TRUE(pm->serialize_project(nl.get()));
+
+                modify_example_journal_netlist(nl.get());
+                ASSERT_TRUE(pm->start_autosave(nl.get()));
+                auto saved_nl = nl->copy().get();
+                nl->get_gate_by_id(6)->set_name("gate_5_renamed");
+                ASSERT_TRUE(pm->wait_for_autosave());
+
+                auto des_nl = netlist_serializer::deserialize_from_file(hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                ASSERT_TRUE(NetlistJournal::replay(des_nl.get(), journal_file_path));
+                EXPECT_TRUE(*saved_nl == *des_nl);
+
+                // netlist is tracked from now on, even if it is destroyed before the journal is discarded
+                ASSERT_TRUE(pm->start_autosave(nl.get()));
+                ASSERT_TRUE(pm->wait_for_autosave());
+                des_nl = netlist_serializer::deserialize_from_file(hal_file_path);
+                ASSERT_NE(des_nl, nullptr);
+                ASSERT_TRUE(NetlistJournal::replay(des_nl.get(), journal_file_path));
+                EXPECT_TRUE(*nl == *des_nl);
+
+                nl.reset();
+                pm->discard_journal();
+            }
+        TEST_END
+    }
+}    //namespace hal
@@ -240,6 +240,194 @@ namespace hal {
          TEST_END
      }
 
+     /**
+      * Testing the serialization of compressed .hal files and their transparent decompression during deserialization.
+      *
+      * Functions: serialize_netlist, deserialize_netlist
+      */
+     TEST_F(NetlistSerializerTest, check_serialize_and_deserialize_compressed) {
+         TEST_START
+             for (const CompressionFormat format : {CompressionFormat::gzip, CompressionFormat::zstd})
+             {
+                 if (!compression::is_supported(format))
+                 {
+                     continue;
+                 }
+
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path, format));
+
+                 std::ifstream ifs(test_hal_file_path.string(), std::ios::binary);
+                 std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+                 EXPECT_EQ(compression::detect_format(contents), format);
+
+                 auto des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+
+                 // lazy mode decompresses the file as a whole
+                 des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path, true);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+
+                 // decompressing in small chunks yields the same contents as decompressing at once
+                 auto decompressor = compression::Decompressor::create(contents);
+                 ASSERT_TRUE(decompressor.is_ok());
+                 std::unique_ptr<compression::Decompressor> chunked = decompressor.get();
+                 std::string chunked_contents;
+                 char chunk[7];
+                 while (true)
+                 {
+                     auto read = chunked->read(chunk, sizeof(chunk));
+                     ASSERT_TRUE(read.is_ok());
+                     if (read.get() == 0)
+                     {
+                         break;
+                     }
+                     chunked_contents.append(chunk, read.get());
+                 }
+                 EXPECT_EQ(chunked_contents, compression::decompress(contents).get());
+
+                 // the same file can be found via a compression extension
+                 std::filesystem::path test_compressed_file_path = test_utils::create_sandbox_path((format == CompressionFormat::gzip) ? "test_hal_file.hal.gz" : "test_hal_file.hal.zst");
+                 std::filesystem::copy_file(test_hal_file_path, test_compressed_file_path, std::filesystem::copy_options::overwrite_existing);
+                 EXPECT_EQ(compression::strip_extension(test_compressed_file_path), test_hal_file_path);
+                 des_nl = netlist_serializer::deserialize_from_file(test_compressed_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+
+                 // truncated files are rejected
+                 NO_COUT_TEST_BLOCK;
+                 std::ofstream ofs(test_hal_file_path.string(), std::ios::binary | std::ios::trunc);
+                 ofs << contents.substr(0, contents.size() / 2);
+                 ofs.close();
+                 EXPECT_EQ(netlist_serializer::deserialize_from_file(test_hal_file_path), nullptr);
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing the lazy deserialization of data entries and custom Boolean functions from JSON .hal files.
+      *
+      * Functions: deserialize_netlist
+      */
+     TEST_F(NetlistSerializerTest, check_lazy_deserialization) {
+         TEST_START
+             {
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 auto des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path, true);
+                 ASSERT_NE(des_nl, nullptr);
+
+                 // data entries are only decoded on first access
+                 Gate* gate_1 = des_nl->get_gate_by_id(2);
+                 ASSERT_NE(gate_1, nullptr);
+                 EXPECT_TRUE(gate_1->has_lazy_data());
+                 EXPECT_TRUE(des_nl->get_net_by_id(13)->has_lazy_data());
+                 EXPECT_TRUE(gate_1->has_data("category_1", "key_0"));
+                 EXPECT_FALSE(gate_1->has_lazy_data());
+                 EXPECT_EQ(gate_1->get_data("category_1", "key_0"), std::make_tuple("data_type", "test_value_2"));
+
+                 Gate* gate_0 = des_nl->get_gate_by_id(1);
+                 EXPECT_EQ(gate_0->get_boolean_function("O_or"), BooleanFunction::from_string("I0 & I1").get());
+                 EXPECT_EQ(gate_0->get_boolean_functions(true).size(), 2);
+
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing that a lazily deserialized netlist can be serialized to the very file it has been loaded from.
+      *
+      * Functions: serialize_to_file, deserialize_from_file
+      */
+     TEST_F(NetlistSerializerTest, check_lazy_serialize_to_source_file) {
+         TEST_START
+             {
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+                 auto lazy_nl = netlist_serializer::deserialize_from_file(test_hal_file_path, true);
+                 ASSERT_NE(lazy_nl, nullptr);
+
+                 // the lazy entries still refer to the file that is overwritten
+                 ASSERT_TRUE(lazy_nl->get_gate_by_id(2)->has_lazy_data());
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(lazy_nl.get(), test_hal_file_path));
+                 EXPECT_FALSE(std::filesystem::exists(test_hal_file_path.string() + ".tmp"));
+
+                 auto des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+
+                 Gate* gate_1 = des_nl->get_gate_by_id(2);
+                 ASSERT_NE(gate_1, nullptr);
+                 EXPECT_EQ(gate_1->get_data("category_1", "key_0"), std::make_tuple("data_type", "test_value_2"));
+                 EXPECT_EQ(des_nl->get_gate_by_id(1)->get_boolean_function("O_or"), BooleanFunction::from_string("I0 & I1").get());
+                 EXPECT_EQ(des_nl->get_gate_by_id(1)->get_boolean_functions(true), nl->get_gate_by_id(1)->get_boolean_functions(true));
+
+                 EXPECT_TRUE(*nl == *des_nl);
+                 EXPECT_TRUE(*lazy_nl == *des_nl);
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing the deserialization of a .hal file whose members are not in the order written by the serializer, so that sections have to be buffered until their dependencies are known.
+      *
+      * Functions: deserialize_netlist
+      */
+     TEST_F(NetlistSerializerTest, check_deserialize_unordered) {
+         TEST_START
+             {
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 std::ofstream ofs(test_hal_file_path.string());
+                 ofs << "{\"netlist\": {"
+                     << "\"modules\": [{\"id\": 1, \"type\": \"top_mod_type\", \"name\": \"top_module\", \"parent\": 0},"
+                     << "{\"id\": 2, \"name\": \"sub_module\", \"parent\": 1, \"gates\": [1], \"pin_groups\": [{\"id\": 1, \"name\": \"A\", \"direction\": \"input\", \"type\": \"none\","
+                     << "\"ascending\": false, \"start_index\": 0, \"pins\": [{\"id\": 1, \"name\": \"A\", \"net_id\": 10, \"type\": \"none\"}]}]}],"
+                     << "\"global_out\": [], \"global_in\": [10],"
+                     << "\"nets\": [{\"id\": 10, \"name\": \"net_0\", \"dsts\": [{\"gate_id\": 1, \"pin_type\": \"I\"}]}],"
+                     << "\"global_gnd\": [], \"global_vcc\": [],"
+                     << "\"gates\": [{\"id\": 1, \"name\": \"gate_0\", \"type\": \"BUF\"}],"
+                     << "\"device_name\": \"device\", \"design_name\": \"design\", \"input_file\": \"input\", \"id\": 7,"
+                     << "\"gate_library\": \"" << m_gl->get_path().string() << "\"}, \"serialization_format_version\": 11}";
+                 ofs.close();
+
+                 auto des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_EQ(des_nl->get_id(), 7);
+                 EXPECT_EQ(des_nl->get_design_name(), "design");
+                 ASSERT_NE(des_nl->get_gate_by_id(1), nullptr);
+                 ASSERT_NE(des_nl->get_net_by_id(10), nullptr);
+                 EXPECT_EQ(des_nl->get_net_by_id(10)->get_num_of_destinations(), 1);
+                 EXPECT_TRUE(des_nl->is_global_input_net(des_nl->get_net_by_id(10)));
+                 EXPECT_EQ(des_nl->get_top_module()->get_type(), "top_mod_type");
+
+                 Module* sub_module = des_nl->get_module_by_id(2);
+                 ASSERT_NE(sub_module, nullptr);
+                 EXPECT_TRUE(sub_module->contains_gate(des_nl->get_gate_by_id(1)));
+                 ModulePin* pin = sub_module->get_pin_by_id(1);
+                 ASSERT_NE(pin, nullptr);
+                 EXPECT_EQ(pin->get_net(), des_nl->get_net_by_id(10));
+             }
+             {
+                 // every section may only be listed once
+                 std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+                 std::ofstream ofs(test_hal_file_path.string());
+                 ofs << "{\"netlist\": {\"gate_library\": \"" << m_gl->get_path().string() << "\", \"gates\": [], \"gates\": []}}";
+                 ofs.close();
+
+                 NO_COUT_TEST_BLOCK;
+                 EXPECT_EQ(netlist_serializer::deserialize_from_file(test_hal_file_path), nullptr);
+             }
+         TEST_END
+     }
+
      /**
       * Testing the serialization and deserialization of a netlist with invalid input
       *
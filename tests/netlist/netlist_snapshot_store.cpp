@@ -0,0 +1,280 @@
+#include "hal_core/netlist/persistent/netlist_snapshot_store.h"
+
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/project_manager.h"
+#include "hal_core/plugin_system/plugin_manager.h"
+#include "gate_library_test_utils.h"
+#include "netlist_test_utils.h"
+
+#include <fstream>
+
+namespace hal {
+
+    class NetlistSnapshotStoreTest : public ::testing::Test {
+    protected:
+        const GateLibrary* m_gl;
+
+        virtual void SetUp()
+        {
+            test_utils::init_log_channels();
+            plugin_manager::load_all_plugins();
+            test_utils::create_sandbox_directory();
+
+            // gate library needs to be registered through gate_library_manager for loading snapshots
+            std::unique_ptr<GateLibrary> gl_tmp = test_utils::create_gate_library(test_utils::create_sandbox_path("testing_gate_library.hgl"));
+            gate_library_manager::save(gl_tmp->get_path(), gl_tmp.get(), true);
+            m_gl = gate_library_manager::load(gl_tmp->get_path());
+        }
+
+        virtual void TearDown()
+        {
+            plugin_manager::unload_all_plugins();
+            test_utils::remove_sandbox_directory();
+        }
+
+        std::unique_ptr<Netlist> create_example_snapshot_netlist()
+        {
+            std::unique_ptr<Netlist> nl = std::make_unique<Netlist>(m_gl);
+            nl->set_id(123);
+            nl->set_design_name("design_name");
+            nl->get_top_module()->set_type("top_mod_type");
+
+            Gate* gate_0 = nl->create_gate(1, m_gl->get_gate_type_by_name("AND2"), "gate_0");
+            Gate* gate_1 = nl->create_gate(2, m_gl->get_gate_type_by_name("GND"), "gate_1");
+            Gate* gate_2 = nl->create_gate(3, m_gl->get_gate_type_by_name("VCC"), "gate_2");
+            Gate* gate_3 = nl->create_gate(4, m_gl->get_gate_type_by_name("BUF"), "gate_3");
+            Gate* gate_4 = nl->create_gate(5, m_gl->get_gate_type_by_name("INV"), "gate_4");
+
+            // gate in another chunk
+            Gate* gate_5 = nl->create_gate(NetlistSnapshotStore::CHUNK_SIZE + 1, m_gl->get_gate_type_by_name("BUF"), "gate_5");
+
+            Net* net_1_3 = nl->create_net(13, "net_1_3");
+            net_1_3->add_source(gate_1, "O");
+            net_1_3->add_destination(gate_3, "I");
+
+            Net* net_3_0 = nl->create_net(30, "net_3_0");
+            net_3_0->add_source(gate_3, "O");
+            net_3_0->add_destination(gate_0, "I0");
+
+            Net* net_2_0 = nl->create_net(20, "net_2_0");
+            net_2_0->add_source(gate_2, "O");
+            net_2_0->add_destination(gate_0, "I1");
+
+            Net* net_0_4 = nl->create_net(40, "net_0_4");
+            net_0_4->add_source(gate_0, "O");
+            net_0_4->add_destination(gate_4, "I");
+
+            Net* net_4_5 = nl->create_net(NetlistSnapshotStore::CHUNK_SIZE + 1, "net_4_5");
+            net_4_5->add_source(gate_4, "O");
+            net_4_5->add_destination(gate_5, "I");
+
+            gate_1->mark_gnd_gate();
+            gate_2->mark_vcc_gate();
+            net_1_3->mark_global_input_net();
+
+            Module* test_m_0 = nl->create_module(2, "test_mod_0", nl->get_top_module());
+            test_m_0->set_type("test_mod_type_0");
+            test_m_0->assign_gate(gate_0);
+            test_m_0->assign_gate(gate_3);
+
+            gate_1->set_data("category_0", "key_0", "data_type", "test_value");
+
+            return nl;
+        }
+
+        // modifies the first chunk of gates and nets as well as the modules, leaving the second chunks untouched
+        void modify_example_snapshot_netlist(Netlist* nl)
+        {
+            nl->set_design_name("modified_design_name");
+            nl->get_gate_by_id(1)->set_name("gate_0_renamed");
+
+            // replace gate_4 by a gate of another type using the same ID
+            nl->delete_gate(nl->get_gate_by_id(5));
+            Gate* gate_4 = nl->create_gate(5, m_gl->get_gate_type_by_name("BUF"), "gate_4");
+            nl->get_net_by_id(40)->add_destination(gate_4, "I");
+            nl->get_net_by_id(NetlistSnapshotStore::CHUNK_SIZE + 1)->add_source(gate_4, "O");
+
+            Gate* gate_6 = nl->create_gate(7, m_gl->get_gate_type_by_name("OR2"), "gate_6");
+            nl->get_net_by_id(40)->add_destination(gate_6, "I0");
+            Net* net_6_out = nl->create_net(60, "net_6_out");
+            net_6_out->add_source(gate_6, "O");
+            net_6_out->mark_global_output_net();
+
+            nl->delete_net(nl->get_net_by_id(20));
+
+            Module* test_m_1 = nl->create_module(3, "test_mod_1", nl->get_top_module());
+            test_m_1->assign_gate(gate_6);
+            nl->get_module_by_id(2)->set_parent_module(test_m_1);
+        }
+
+        u32 count_files(const std::filesystem::path& dir)
+        {
+            u32 count = 0;
+            for (const auto& entry : std::filesystem::directory_iterator(dir))
+            {
+                if (entry.is_regular_file())
+                {
+                    count++;
+                }
+            }
+            return count;
+        }
+    };
+
+    /**
+     * Testing that snapshots can be stored and loaded into new netlists.
+     *
+     * Functions: create_snapshot, load_snapshot, has_snapshot, get_snapshot_names
+     */
+    TEST_F(NetlistSnapshotStoreTest, check_create_and_load) {
+        TEST_START
+            {
+                auto nl = create_example_snapshot_netlist();
+                NetlistSnapshotStore store(test_utils::create_sandbox_path("snapshots"));
+
+                EXPECT_FALSE(store.has_snapshot("original"));
+                ASSERT_TRUE(store.create_snapshot(nl.get(), "original"));
+                EXPECT_TRUE(store.has_snapshot("original"));
+
+                auto des_nl = store.load_snapshot("original");
+                ASSERT_NE(des_nl, nullptr);
+                EXPECT_TRUE(*nl == *des_nl);
+
+                // unchanged chunks are shared between snapshots
+                std::filesystem::path chunk_dir = store.get_directory() / "chunks";
+                u32 num_chunks                  = count_files(chunk_dir);
+                ASSERT_TRUE(store.create_snapshot(nl.get(), "copy"));
+                EXPECT_EQ(count_files(chunk_dir), num_chunks);
+
+                nl->get_gate_by_id(1)->set_name("gate_0_renamed");
+                ASSERT_TRUE(store.create_snapshot(nl.get(), "renamed"));
+                EXPECT_EQ(count_files(chunk_dir), num_chunks + 1);
+
+                EXPECT_EQ(store.get_snapshot_names(), std::vector<std::string>({"copy", "original", "renamed"}));
+            }
+            {
+                // invalid and missing snapshots
+                auto nl = create_example_snapshot_netlist();
+                NetlistSnapshotStore store(test_utils::create_sandbox_path("snapshots_invalid"));
+                EXPECT_FALSE(store.create_snapshot(nl.get(), "../escape"));
+                EXPECT_FALSE(store.create_snapshot(nl.get(), ""));
+                EXPECT_FALSE(store.create_snapshot(nullptr, "snapshot"));
+                EXPECT_EQ(store.load_snapshot("missing"), nullptr);
+                EXPECT_FALSE(store.checkout_snapshot(nl.get(), "missing"));
+                EXPECT_TRUE(store.get_snapshot_names().empty());
+            }
+            {
+                // corrupt manifests are rejected
+                auto nl = create_example_snapshot_netlist();
+                NetlistSnapshotStore store(test_utils::create_sandbox_path("snapshots_corrupt"));
+                ASSERT_TRUE(store.create_snapshot(nl.get(), "original"));
+
+                for (const std::string& manifest : {std::string("[]"),
+                                                    std::string("{\"version\":\"1\",\"chunks\":[]}"),
+                                                    std::string("{\"version\":1,\"gate_library\":2,\"chunks\":[]}"),
+                                                    std::string("{\"version\":1,\"chunks\":{}}"),
+                                                    std::string("{\"version\":1,\"chunks\":[{\"kind\":\"gates\",\"range\":-1,\"hash\":\"0\"}]}"),
+                                                    std::string("{\"version\":1,\"chunks\":[{\"kind\":\"groupings\",\"range\":0,\"hash\":\"0\"}]}"),
+                                                    std::string("{\"version\":1,\"chunks\":[{\"kind\":\"gates\",\"range\":0,\"hash\":\"../original.json\"}]}")})
+                {
+                    std::ofstream ofs(store.get_directory() / "corrupt.json", std::ios::binary | std::ios::trunc);
+                    ofs << manifest;
+                    ofs.close();
+
+                    EXPECT_EQ(store.load_snapshot("corrupt"), nullptr);
+                    EXPECT_FALSE(store.checkout_snapshot(nl.get(), "corrupt"));
+                }
+
+                // chunks are kept as long as any manifest cannot be read
+                ASSERT_TRUE(store.remove_snapshot("original"));
+                EXPECT_GT(count_files(store.get_directory() / "chunks"), 0);
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing that a netlist can be switched back and forth between snapshots.
+     *
+     * Functions: checkout_snapshot
+     */
+    TEST_F(NetlistSnapshotStoreTest, check_checkout) {
+        TEST_START
+            {
+                auto nl = create_example_snapshot_netlist();
+                NetlistSnapshotStore store(test_utils::create_sandbox_path("snapshots"));
+
+                auto original_nl = nl->copy().get();
+                ASSERT_TRUE(store.create_snapshot(nl.get(), "original"));
+                modify_example_snapshot_netlist(nl.get());
+                auto modified_nl = nl->copy().get();
+                ASSERT_TRUE(store.create_snapshot(nl.get(), "modified"));
+
+                ASSERT_TRUE(store.checkout_snapshot(nl.get(), "original"));
+                EXPECT_TRUE(*nl == *original_nl);
+                ASSERT_TRUE(store.checkout_snapshot(nl.get(), "modified"));
+                EXPECT_TRUE(*nl == *modified_nl);
+
+                // checking out the current state does not change the netlist
+                ASSERT_TRUE(store.checkout_snapshot(nl.get(), "modified"));
+                EXPECT_TRUE(*nl == *modified_nl);
+
+                // objects created after the snapshot are removed
+                nl->create_gate(2 * NetlistSnapshotStore::CHUNK_SIZE, m_gl->get_gate_type_by_name("INV"), "gate_new");
+                nl->create_module(4, "test_mod_new", nl->get_top_module());
+                ASSERT_TRUE(store.checkout_snapshot(nl.get(), "original"));
+                EXPECT_TRUE(*nl == *original_nl);
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the removal of snapshots and their chunks.
+     *
+     * Functions: remove_snapshot
+     */
+    TEST_F(NetlistSnapshotStoreTest, check_remove) {
+        TEST_START
+            {
+                auto nl = create_example_snapshot_netlist();
+                NetlistSnapshotStore store(test_utils::create_sandbox_path("snapshots"));
+                std::filesystem::path chunk_dir = store.get_directory() / "chunks";
+
+                ASSERT_TRUE(store.create_snapshot(nl.get(), "original"));
+                u32 num_chunks = count_files(chunk_dir);
+                modify_example_snapshot_netlist(nl.get());
+                ASSERT_TRUE(store.create_snapshot(nl.get(), "modified"));
+                EXPECT_GT(count_files(chunk_dir), num_chunks);
+
+                ASSERT_TRUE(store.remove_snapshot("modified"));
+                EXPECT_FALSE(store.has_snapshot("modified"));
+                EXPECT_EQ(count_files(chunk_dir), num_chunks);
+                EXPECT_FALSE(store.remove_snapshot("modified"));
+
+                auto des_nl = store.load_snapshot("original");
+                ASSERT_NE(des_nl, nullptr);
+            }
+            {
+                // snapshots are stored inside the project directory
+                auto nl = create_example_snapshot_netlist();
+                ProjectManager* pm = ProjectManager::instance();
+                ASSERT_TRUE(pm->create_project_directory(test_utils::create_sandbox_path("snapshot_project").string()));
+
+                auto original_nl = nl->copy().get();
+                ASSERT_TRUE(pm->create_snapshot(nl.get(), "original"));
+                EXPECT_TRUE(std::filesystem::exists(pm->get_project_directory() / "snapshots" / "original.json"));
+                EXPECT_EQ(pm->get_snapshot_names(), std::vector<std::string>({"original"}));
+
+                modify_example_snapshot_netlist(nl.get());
+                ASSERT_TRUE(pm->checkout_snapshot(nl.get(), "original"));
+                EXPECT_TRUE(*nl == *original_nl);
+
+                ASSERT_TRUE(pm->remove_snapshot("original"));
+                EXPECT_TRUE(pm->get_snapshot_names().empty());
+            }
+        TEST_END
+    }
+}    //namespace hal
@@ -846,4 +846,646 @@ namespace hal
         TEST_END
     }
 
+    /**
+     * Testing the sweep of combinational logic.
+     *
+     * Functions: sweep
+     */
+    TEST_F(NetlistUtilsTest, check_sweep)
+    {
+        TEST_START
+        {
+            // constant propagation and removal of dangling logic
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* gnd_gate = nl->create_gate(gl->get_gate_type_by_name("GND"), "gnd");
+            nl->mark_gnd_gate(gnd_gate);
+            Net* gnd_net = nl->create_net("gnd");
+            gnd_net->add_source(gnd_gate, "O");
+
+            Gate* g0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "g0");
+            Gate* g1 = nl->create_gate(gl->get_gate_type_by_name("OR2"), "g1");
+
+            Net* n0 = nl->create_net("n0");
+            n0->add_destination(g0, "I1");
+            n0->mark_global_input_net();
+            gnd_net->add_destination(g0, "I0");
+
+            Net* n1 = nl->create_net("n1");
+            n1->add_destination(g1, "I1");
+            n1->mark_global_input_net();
+
+            test_utils::connect(nl.get(), g0, "O", g1, "I0");
+            Net* n3 = nl->create_net("n3");
+            n3->add_source(g1, "O");
+            n3->mark_global_output_net();
+
+            auto res = netlist_utils::sweep(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            const netlist_utils::SweepStatistics stats = res.get();
+            EXPECT_EQ(stats.propagated_constants, 1);
+            EXPECT_EQ(stats.collapsed_buffers, 0);
+            EXPECT_EQ(stats.collapsed_inverter_pairs, 0);
+            EXPECT_EQ(stats.merged_gates, 0);
+            EXPECT_EQ(stats.removed_gates, 1);
+            EXPECT_EQ(stats.removed_nets, 1);
+
+            EXPECT_EQ(nl->get_gates().size(), 2);
+            EXPECT_EQ(nl->get_nets().size(), 4);
+            EXPECT_EQ(g1->get_fan_in_net("I0"), gnd_net);
+            EXPECT_EQ(g1->get_fan_out_net("O"), n3);
+        }
+        {
+            // buffers and inverter pairs, including gates within a submodule
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* inv0 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv0");
+            Gate* inv1 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv1");
+            Gate* buf0 = nl->create_gate(gl->get_gate_type_by_name("BUF"), "buf0");
+            Gate* and0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+
+            Net* n0 = nl->create_net("n0");
+            n0->add_destination(inv0, "I");
+            n0->mark_global_input_net();
+
+            Net* n1 = nl->create_net("n1");
+            n1->add_destination(buf0, "I");
+            n1->mark_global_input_net();
+
+            test_utils::connect(nl.get(), inv0, "O", inv1, "I");
+            test_utils::connect(nl.get(), inv1, "O", and0, "I0");
+            test_utils::connect(nl.get(), buf0, "O", and0, "I1");
+
+            Net* n5 = nl->create_net("n5");
+            n5->add_source(and0, "O");
+            n5->mark_global_output_net();
+
+            Module* mod = nl->create_module("inverters", nl->get_top_module(), {inv0, inv1});
+            ASSERT_NE(mod, nullptr);
+            EXPECT_EQ(mod->get_pins().size(), 2);
+
+            auto res = netlist_utils::sweep(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            const netlist_utils::SweepStatistics stats = res.get();
+            EXPECT_EQ(stats.propagated_constants, 0);
+            EXPECT_EQ(stats.collapsed_buffers, 1);
+            EXPECT_EQ(stats.collapsed_inverter_pairs, 1);
+            EXPECT_EQ(stats.merged_gates, 0);
+            EXPECT_EQ(stats.removed_gates, 3);
+            EXPECT_EQ(stats.removed_nets, 3);
+
+            EXPECT_EQ(nl->get_gates(), std::vector<Gate*>({and0}));
+            EXPECT_EQ(and0->get_fan_in_net("I0"), n0);
+            EXPECT_EQ(and0->get_fan_in_net("I1"), n1);
+
+            EXPECT_TRUE(mod->get_gates().empty());
+            EXPECT_TRUE(mod->get_nets().empty());
+            EXPECT_TRUE(mod->get_pins().empty());
+        }
+        {
+            // merging of structurally identical gates
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* and0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+            Gate* and1 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and1");
+            Gate* xor0 = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor0");
+
+            Net* n0 = nl->create_net("n0");
+            n0->add_destination(and0, "I0");
+            n0->add_destination(and1, "I0");
+            n0->mark_global_input_net();
+
+            Net* n1 = nl->create_net("n1");
+            n1->add_destination(and0, "I1");
+            n1->add_destination(and1, "I1");
+            n1->mark_global_input_net();
+
+            Net* n2 = test_utils::connect(nl.get(), and0, "O", xor0, "I0");
+            test_utils::connect(nl.get(), and1, "O", xor0, "I1");
+
+            Net* n4 = nl->create_net("n4");
+            n4->add_source(xor0, "O");
+            n4->mark_global_output_net();
+
+            // disabling all optimizations must not change anything
+            {
+                netlist_utils::SweepConfig config;
+                config.propagate_constants     = false;
+                config.remove_dangling_logic   = false;
+                config.collapse_buffers        = false;
+                config.collapse_inverter_pairs = false;
+                config.merge_duplicate_gates   = false;
+
+                auto res = netlist_utils::sweep(nl.get(), config);
+                ASSERT_TRUE(res.is_ok());
+                EXPECT_EQ(nl->get_gates().size(), 3);
+                EXPECT_EQ(nl->get_nets().size(), 5);
+            }
+
+            auto res = netlist_utils::sweep(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            const netlist_utils::SweepStatistics stats = res.get();
+            EXPECT_EQ(stats.merged_gates, 1);
+            EXPECT_EQ(stats.removed_gates, 1);
+            EXPECT_EQ(stats.removed_nets, 1);
+
+            EXPECT_EQ(nl->get_gates().size(), 2);
+            EXPECT_EQ(nl->get_nets().size(), 4);
+            EXPECT_EQ(xor0->get_fan_in_net("I0"), n2);
+            EXPECT_EQ(xor0->get_fan_in_net("I1"), n2);
+        }
+        // NEGATIVE
+        {
+            auto res = netlist_utils::sweep(nullptr);
+            EXPECT_TRUE(res.is_error());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the merging of structurally identical gates.
+     *
+     * Functions: merge_duplicate_gates
+     */
+    TEST_F(NetlistUtilsTest, check_merge_duplicate_gates)
+    {
+        TEST_START
+        {
+            // two identical logic cones of depth two
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* and0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+            Gate* and1 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and1");
+            Gate* or0  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or0");
+            Gate* or1  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or1");
+            Gate* xor0 = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor0");
+            Gate* lut0 = nl->create_gate(gl->get_gate_type_by_name("LUT2"), "lut0");
+            Gate* lut1 = nl->create_gate(gl->get_gate_type_by_name("LUT2"), "lut1");
+
+            Net* n0 = nl->create_net("n0");
+            n0->mark_global_input_net();
+            Net* n1 = nl->create_net("n1");
+            n1->mark_global_input_net();
+            Net* n2 = nl->create_net("n2");
+            n2->mark_global_input_net();
+
+            for (Gate* g : {and0, and1, lut0, lut1})
+            {
+                n0->add_destination(g, "I0");
+                n1->add_destination(g, "I1");
+            }
+            lut0->set_init_data({"0x8"});
+            lut1->set_init_data({"0x6"});
+
+            Net* n3 = test_utils::connect(nl.get(), and0, "O", or0, "I0");
+            test_utils::connect(nl.get(), and1, "O", or1, "I0");
+            n2->add_destination(or0, "I1");
+            n2->add_destination(or1, "I1");
+
+            Net* n5 = test_utils::connect(nl.get(), or0, "O", xor0, "I0");
+            test_utils::connect(nl.get(), or1, "O", xor0, "I1");
+
+            Net* n7 = nl->create_net("n7");
+            n7->add_source(xor0, "O");
+            n7->mark_global_output_net();
+
+            Net* n8 = nl->create_net("n8");
+            n8->add_source(lut0, "O");
+            n8->mark_global_output_net();
+            Net* n9 = nl->create_net("n9");
+            n9->add_source(lut1, "O");
+            n9->mark_global_output_net();
+
+            Module* mod = nl->create_module("cone", nl->get_top_module(), {and1, or1});
+            ASSERT_NE(mod, nullptr);
+
+            auto res = netlist_utils::merge_duplicate_gates(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get(), 2);
+
+            EXPECT_EQ(nl->get_gates().size(), 5);
+            EXPECT_EQ(nl->get_nets().size(), 8);
+            EXPECT_TRUE(nl->is_gate_in_netlist(and0));
+            EXPECT_TRUE(nl->is_gate_in_netlist(or0));
+            EXPECT_EQ(or0->get_fan_in_net("I0"), n3);
+            EXPECT_EQ(xor0->get_fan_in_net("I0"), n5);
+            EXPECT_EQ(xor0->get_fan_in_net("I1"), n5);
+
+            // LUTs with different INIT data must not be merged
+            EXPECT_TRUE(nl->is_gate_in_netlist(lut0));
+            EXPECT_TRUE(nl->is_gate_in_netlist(lut1));
+
+            EXPECT_TRUE(mod->get_gates().empty());
+            EXPECT_TRUE(mod->get_pins().empty());
+
+            // nothing left to merge
+            res = netlist_utils::merge_duplicate_gates(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get(), 0);
+        }
+        {
+            // duplicates driving global outputs are kept, but their successors are merged
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* inv0 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv0");
+            Gate* inv1 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv1");
+            Gate* buf0 = nl->create_gate(gl->get_gate_type_by_name("BUF"), "buf0");
+            Gate* buf1 = nl->create_gate(gl->get_gate_type_by_name("BUF"), "buf1");
+            Gate* and0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+
+            Net* n0 = nl->create_net("n0");
+            n0->mark_global_input_net();
+            n0->add_destination(inv0, "I");
+            n0->add_destination(inv1, "I");
+
+            test_utils::connect(nl.get(), inv0, "O", buf0, "I");
+            Net* n2 = test_utils::connect(nl.get(), inv1, "O", buf1, "I");
+            n2->mark_global_output_net();
+
+            Net* n3 = test_utils::connect(nl.get(), buf0, "O", and0, "I0");
+            test_utils::connect(nl.get(), buf1, "O", and0, "I1");
+
+            Net* n5 = nl->create_net("n5");
+            n5->add_source(and0, "O");
+            n5->mark_global_output_net();
+
+            auto res = netlist_utils::merge_duplicate_gates(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get(), 1);
+
+            EXPECT_TRUE(nl->is_gate_in_netlist(inv1));
+            EXPECT_FALSE(nl->is_gate_in_netlist(buf1));
+            EXPECT_EQ(inv1->get_fan_out_net("O"), n2);
+            EXPECT_TRUE(n2->get_destinations().empty());
+            EXPECT_EQ(and0->get_fan_in_net("I0"), n3);
+            EXPECT_EQ(and0->get_fan_in_net("I1"), n3);
+        }
+        {
+            // gates within combinational loops are not merged
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            ASSERT_NE(nl, nullptr);
+            const GateLibrary* gl = nl->get_gate_library();
+            ASSERT_NE(gl, nullptr);
+
+            Gate* and0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+            Gate* and1 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and1");
+
+            Net* n0 = nl->create_net("n0");
+            n0->mark_global_input_net();
+            n0->add_destination(and0, "I0");
+            n0->add_destination(and1, "I0");
+
+            test_utils::connect(nl.get(), and0, "O", and1, "I1");
+            test_utils::connect(nl.get(), and1, "O", and0, "I1");
+
+            auto res = netlist_utils::merge_duplicate_gates(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get(), 0);
+            EXPECT_EQ(nl->get_gates().size(), 2);
+        }
+        // NEGATIVE
+        {
+            auto res = netlist_utils::merge_duplicate_gates(nullptr);
+            EXPECT_TRUE(res.is_error());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the simulation-based detection of functionally equivalent nets.
+     *
+     * Functions: compute_net_signatures, get_equivalent_nets
+     */
+    TEST_F(NetlistUtilsTest, check_get_equivalent_nets)
+    {
+        TEST_START
+        // AND gate implemented twice, once directly and once via De Morgan, as well as a wide AND gate that rarely evaluates to 1
+        std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+        ASSERT_NE(nl, nullptr);
+        const GateLibrary* gl = nl->get_gate_library();
+        ASSERT_NE(gl, nullptr);
+
+        Gate* gnd_gate = nl->create_gate(gl->get_gate_type_by_name("GND"), "gnd");
+        nl->mark_gnd_gate(gnd_gate);
+        Net* gnd_net = nl->create_net("gnd");
+        gnd_net->add_source(gnd_gate, "O");
+
+        std::vector<Net*> inputs;
+        for (u32 i = 0; i < 8; i++)
+        {
+            Net* n = nl->create_net("in_" + std::to_string(i));
+            n->mark_global_input_net();
+            inputs.push_back(n);
+        }
+
+        Gate* and0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+        inputs.at(0)->add_destination(and0, "I0");
+        inputs.at(1)->add_destination(and0, "I1");
+        Net* n_and = nl->create_net("n_and");
+        n_and->add_source(and0, "O");
+        n_and->mark_global_output_net();
+
+        Gate* inv0 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv0");
+        Gate* inv1 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv1");
+        Gate* or0  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or0");
+        Gate* inv2 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv2");
+        inputs.at(0)->add_destination(inv0, "I");
+        inputs.at(1)->add_destination(inv1, "I");
+        Net* n_inv0 = test_utils::connect(nl.get(), inv0, "O", or0, "I0");
+        test_utils::connect(nl.get(), inv1, "O", or0, "I1");
+        Net* n_nand = test_utils::connect(nl.get(), or0, "O", inv2, "I");
+        Net* n_demorgan = nl->create_net("n_demorgan");
+        n_demorgan->add_source(inv2, "O");
+        n_demorgan->mark_global_output_net();
+
+        Gate* and1 = nl->create_gate(gl->get_gate_type_by_name("AND4"), "and1");
+        Gate* and2 = nl->create_gate(gl->get_gate_type_by_name("AND4"), "and2");
+        Gate* and3 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and3");
+        for (u32 i = 0; i < 4; i++)
+        {
+            inputs.at(i)->add_destination(and1, "I" + std::to_string(i));
+            inputs.at(i + 4)->add_destination(and2, "I" + std::to_string(i));
+        }
+        test_utils::connect(nl.get(), and1, "O", and3, "I0");
+        test_utils::connect(nl.get(), and2, "O", and3, "I1");
+        Net* n_wide_and = nl->create_net("n_wide_and");
+        n_wide_and->add_source(and3, "O");
+        n_wide_and->mark_global_output_net();
+
+        const auto find_class = [](const std::vector<netlist_utils::NetEquivalenceClass>& classes, const Net* net) -> const netlist_utils::NetEquivalenceClass* {
+            for (const auto& eq_class : classes)
+            {
+                if (std::find(eq_class.nets.begin(), eq_class.nets.end(), net) != eq_class.nets.end())
+                {
+                    return &eq_class;
+                }
+            }
+            return nullptr;
+        };
+
+        const auto is_complemented = [](const netlist_utils::NetEquivalenceClass& eq_class, const Net* a, const Net* b) {
+            const auto index_a = std::distance(eq_class.nets.begin(), std::find(eq_class.nets.begin(), eq_class.nets.end(), a));
+            const auto index_b = std::distance(eq_class.nets.begin(), std::find(eq_class.nets.begin(), eq_class.nets.end(), b));
+            return eq_class.complemented.at(index_a) != eq_class.complemented.at(index_b);
+        };
+
+        {
+            // signatures
+            auto res = netlist_utils::compute_net_signatures(nl.get(), 128, 42);
+            ASSERT_TRUE(res.is_ok());
+            const auto signatures = res.get();
+            EXPECT_EQ(signatures.size(), nl->get_nets().size());
+            EXPECT_EQ(signatures.at(gnd_net), std::vector<u64>({0, 0}));
+            EXPECT_EQ(signatures.at(n_and), signatures.at(n_demorgan));
+            EXPECT_EQ(signatures.at(n_and).at(0), signatures.at(inputs.at(0)).at(0) & signatures.at(inputs.at(1)).at(0));
+            EXPECT_EQ(signatures.at(n_nand).at(1), ~signatures.at(n_and).at(1));
+            EXPECT_NE(signatures.at(inputs.at(0)), signatures.at(inputs.at(1)));
+
+            // signatures are deterministic
+            EXPECT_EQ(netlist_utils::compute_net_signatures(nl.get(), 128, 42).get(), signatures);
+        }
+        {
+            // candidates only, the wide AND gate is indistinguishable from GND on 64 random patterns
+            netlist_utils::NetEquivalenceConfig config;
+            config.signature_width = 64;
+            config.sat_refinement  = false;
+
+            auto res = netlist_utils::get_equivalent_nets(nl.get(), config);
+            ASSERT_TRUE(res.is_ok());
+            const auto classes = res.get();
+
+            const auto* gnd_class = find_class(classes, gnd_net);
+            ASSERT_NE(gnd_class, nullptr);
+            EXPECT_NE(std::find(gnd_class->nets.begin(), gnd_class->nets.end(), n_wide_and), gnd_class->nets.end());
+        }
+        {
+            // SAT refinement
+            netlist_utils::NetEquivalenceConfig config;
+            config.signature_width = 64;
+
+            auto res = netlist_utils::get_equivalent_nets(nl.get(), config);
+            ASSERT_TRUE(res.is_ok());
+            const auto classes = res.get();
+
+            const auto* and_class = find_class(classes, n_and);
+            ASSERT_NE(and_class, nullptr);
+            EXPECT_EQ(and_class->nets.size(), 3);
+            EXPECT_EQ(find_class(classes, n_demorgan), and_class);
+            EXPECT_EQ(find_class(classes, n_nand), and_class);
+            EXPECT_FALSE(is_complemented(*and_class, n_and, n_demorgan));
+            EXPECT_TRUE(is_complemented(*and_class, n_and, n_nand));
+
+            const auto* inv_class = find_class(classes, n_inv0);
+            ASSERT_NE(inv_class, nullptr);
+            EXPECT_EQ(inv_class->nets.size(), 2);
+            EXPECT_EQ(find_class(classes, inputs.at(0)), inv_class);
+            EXPECT_TRUE(is_complemented(*inv_class, n_inv0, inputs.at(0)));
+
+            EXPECT_EQ(find_class(classes, n_wide_and), nullptr);
+            EXPECT_EQ(find_class(classes, gnd_net), nullptr);
+        }
+        {
+            // without complements
+            netlist_utils::NetEquivalenceConfig config;
+            config.consider_complements = false;
+
+            auto res = netlist_utils::get_equivalent_nets(nl.get(), config);
+            ASSERT_TRUE(res.is_ok());
+            const auto classes = res.get();
+
+            const auto* and_class = find_class(classes, n_and);
+            ASSERT_NE(and_class, nullptr);
+            EXPECT_EQ(and_class->nets, std::vector<Net*>({n_and, n_demorgan}));
+            EXPECT_EQ(find_class(classes, n_inv0), nullptr);
+        }
+        // NEGATIVE
+        {
+            EXPECT_TRUE(netlist_utils::compute_net_signatures(nullptr).is_error());
+            EXPECT_TRUE(netlist_utils::compute_net_signatures(nl.get(), 100).is_error());
+            EXPECT_TRUE(netlist_utils::compute_net_signatures(nl.get(), 2048).is_error());
+            EXPECT_TRUE(netlist_utils::get_equivalent_nets(nullptr).is_error());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing the enumeration of k-feasible cuts.
+     *
+     * Functions: enumerate_cuts
+     */
+    TEST_F(NetlistUtilsTest, check_enumerate_cuts)
+    {
+        TEST_START
+        // (n0 & n1) | n2 followed by a flip-flop and an inverter
+        std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+        ASSERT_NE(nl, nullptr);
+        const GateLibrary* gl = nl->get_gate_library();
+        ASSERT_NE(gl, nullptr);
+
+        Net* n0 = nl->create_net("n0");
+        n0->mark_global_input_net();
+        Net* n1 = nl->create_net("n1");
+        n1->mark_global_input_net();
+        Net* n2 = nl->create_net("n2");
+        n2->mark_global_input_net();
+
+        Gate* and0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+        Gate* or0  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or0");
+        Gate* ff0  = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff0");
+        Gate* inv0 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv0");
+        n0->add_destination(and0, "I0");
+        n1->add_destination(and0, "I1");
+        Net* n3 = test_utils::connect(nl.get(), and0, "O", or0, "I0");
+        n2->add_destination(or0, "I1");
+        Net* n4 = test_utils::connect(nl.get(), or0, "O", ff0, "D");
+        Net* n5 = test_utils::connect(nl.get(), ff0, "Q", inv0, "I");
+        Net* n6 = nl->create_net("n6");
+        n6->add_source(inv0, "O");
+        n6->mark_global_output_net();
+
+        {
+            auto res = netlist_utils::enumerate_cuts(nl.get());
+            ASSERT_TRUE(res.is_ok());
+            const auto cuts = res.get();
+
+            EXPECT_EQ(cuts.get_nets(), std::vector<Net*>({n3, n6, n4}));
+            EXPECT_EQ(cuts.get_num_cuts(), 7);
+            EXPECT_EQ(cuts.get_num_cuts(n0), 0);
+            EXPECT_TRUE(cuts.get_cuts(n5).empty());
+
+            const auto n3_cuts = cuts.get_cuts(n3);
+            ASSERT_EQ(n3_cuts.size(), 2);
+            EXPECT_EQ(n3_cuts.at(0).leaves, std::vector<Net*>({n3}));
+            EXPECT_EQ(n3_cuts.at(0).truth_table, std::vector<u64>({0x2}));
+            EXPECT_EQ(n3_cuts.at(1).leaves, std::vector<Net*>({n0, n1}));
+            EXPECT_EQ(n3_cuts.at(1).truth_table, std::vector<u64>({0x8}));
+
+            const auto n4_cuts = cuts.get_cuts(n4);
+            ASSERT_EQ(n4_cuts.size(), 3);
+            EXPECT_EQ(n4_cuts.at(1).leaves, std::vector<Net*>({n2, n3}));
+            EXPECT_EQ(n4_cuts.at(1).truth_table, std::vector<u64>({0xE}));
+            EXPECT_EQ(n4_cuts.at(2).leaves, std::vector<Net*>({n0, n1, n2}));
+            EXPECT_EQ(n4_cuts.at(2).truth_table, std::vector<u64>({0xF8}));
+
+            // the flip-flop output acts as a leaf
+            const auto n6_cuts = cuts.get_cuts(n6);
+            ASSERT_EQ(n6_cuts.size(), 2);
+            EXPECT_EQ(n6_cuts.at(1).leaves, std::vector<Net*>({n5}));
+            EXPECT_EQ(n6_cuts.at(1).truth_table, std::vector<u64>({0x1}));
+        }
+        {
+            // limit the size and number of cuts
+            netlist_utils::CutEnumerationConfig config;
+            config.max_cut_size         = 2;
+            config.compute_truth_tables = false;
+
+            auto res = netlist_utils::enumerate_cuts(nl.get(), config);
+            ASSERT_TRUE(res.is_ok());
+            const auto n4_cuts = res.get().get_cuts(n4);
+            ASSERT_EQ(n4_cuts.size(), 2);
+            EXPECT_EQ(n4_cuts.at(1).leaves, std::vector<Net*>({n2, n3}));
+            EXPECT_TRUE(n4_cuts.at(1).truth_table.empty());
+
+            config.max_cut_size     = 3;
+            config.max_cuts_per_net = 1;
+            res                     = netlist_utils::enumerate_cuts(nl.get(), config);
+            ASSERT_TRUE(res.is_ok());
+            EXPECT_EQ(res.get().get_num_cuts(n4), 2);
+        }
+        {
+            // truth tables spanning multiple words
+            std::unique_ptr<Netlist> nl_wide = test_utils::create_empty_netlist();
+            std::vector<Net*> inputs;
+            Gate* and0_wide = nl_wide->create_gate(gl->get_gate_type_by_name("AND4"), "and0");
+            Gate* and1_wide = nl_wide->create_gate(gl->get_gate_type_by_name("AND4"), "and1");
+            Gate* xor_wide  = nl_wide->create_gate(gl->get_gate_type_by_name("XOR2"), "xor");
+            for (u32 i = 0; i < 8; i++)
+            {
+                Net* n = nl_wide->create_net("in_" + std::to_string(i));
+                n->mark_global_input_net();
+                n->add_destination((i < 4) ? and0_wide : and1_wide, "I" + std::to_string(i % 4));
+                inputs.push_back(n);
+            }
+            test_utils::connect(nl_wide.get(), and0_wide, "O", xor_wide, "I0");
+            test_utils::connect(nl_wide.get(), and1_wide, "O", xor_wide, "I1");
+            Net* out = nl_wide->create_net("out");
+            out->add_source(xor_wide, "O");
+
+            netlist_utils::CutEnumerationConfig config;
+            config.max_cut_size = 8;
+
+            auto res = netlist_utils::enumerate_cuts(nl_wide.get(), config);
+            ASSERT_TRUE(res.is_ok());
+            const auto out_cuts = res.get().get_cuts(out);
+            ASSERT_EQ(out_cuts.size(), 5);
+
+            const auto& widest_cut = out_cuts.back();
+            EXPECT_EQ(widest_cut.leaves, inputs);
+            ASSERT_EQ(widest_cut.truth_table.size(), 4);
+            for (u32 m = 0; m < 256; m++)
+            {
+                const bool expected = ((m & 0xF) == 0xF) != ((m & 0xF0) == 0xF0);
+                EXPECT_EQ((bool)((widest_cut.truth_table.at(m >> 6) >> (m & 63)) & 1), expected);
+            }
+        }
+        {
+            // nets driven by a gate with an unsupported Boolean function only have their trivial cut
+            std::unique_ptr<Netlist> nl_unsupported = test_utils::create_empty_netlist();
+            Gate* and0_unsupported = nl_unsupported->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+            Gate* inv0_unsupported = nl_unsupported->create_gate(gl->get_gate_type_by_name("INV"), "inv0");
+            for (const std::string pin : {"I0", "I1"})
+            {
+                Net* n = nl_unsupported->create_net(pin);
+                n->mark_global_input_net();
+                n->add_destination(and0_unsupported, pin);
+            }
+            ASSERT_TRUE(and0_unsupported->add_boolean_function("O", BooleanFunction::Var("unknown")));
+            Net* and_out = test_utils::connect(nl_unsupported.get(), and0_unsupported, "O", inv0_unsupported, "I");
+            Net* inv_out = nl_unsupported->create_net("inv_out");
+            inv_out->add_source(inv0_unsupported, "O");
+
+            auto res = netlist_utils::enumerate_cuts(nl_unsupported.get());
+            ASSERT_TRUE(res.is_ok());
+            const auto cuts = res.get();
+            EXPECT_EQ(cuts.get_nets(), std::vector<Net*>({and_out, inv_out}));
+
+            const auto and_out_cuts = cuts.get_cuts(and_out);
+            ASSERT_EQ(and_out_cuts.size(), 1);
+            EXPECT_EQ(and_out_cuts.at(0).leaves, std::vector<Net*>({and_out}));
+            EXPECT_EQ(and_out_cuts.at(0).truth_table, std::vector<u64>({0x2}));
+
+            const auto inv_out_cuts = cuts.get_cuts(inv_out);
+            ASSERT_EQ(inv_out_cuts.size(), 2);
+            EXPECT_EQ(inv_out_cuts.at(1).leaves, std::vector<Net*>({and_out}));
+            EXPECT_EQ(inv_out_cuts.at(1).truth_table, std::vector<u64>({0x1}));
+        }
+        // NEGATIVE
+        {
+            EXPECT_TRUE(netlist_utils::enumerate_cuts(nullptr).is_error());
+
+            netlist_utils::CutEnumerationConfig config;
+            config.max_cut_size = 9;
+            EXPECT_TRUE(netlist_utils::enumerate_cuts(nl.get(), config).is_error());
+            config.max_cut_size     = 4;
+            config.max_cuts_per_net = 0;
+            EXPECT_TRUE(netlist_utils::enumerate_cuts(nl.get(), config).is_error());
+        }
+        TEST_END
+    }
+
 }    //namespace hal
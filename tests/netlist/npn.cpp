@@ -0,0 +1,198 @@
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/npn.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist_utils.h"
+
+#include <algorithm>
+#include <bitset>
+#include <numeric>
+#include <random>
+#include <set>
+
+namespace hal {
+    namespace {
+        NPN::TruthTable random_truth_table(std::mt19937_64& rng, u32 num_variables) {
+            std::vector<u64> words(4);
+            for (auto& w : words) {
+                w = rng();
+            }
+            return NPN::TruthTable::from_words(words, num_variables).get();
+        }
+
+        NPN::Transform random_transform(std::mt19937_64& rng, u32 num_variables) {
+            NPN::Transform transform;
+            transform.input_negations = rng() & ((1u << num_variables) - 1);
+            transform.output_negation = rng() & 1;
+            transform.permutation.resize(num_variables);
+            std::iota(transform.permutation.begin(), transform.permutation.end(), 0);
+            std::shuffle(transform.permutation.begin(), transform.permutation.end(), rng);
+            return transform;
+        }
+    }    // namespace
+
+    TEST(NPN, TruthTableConstruction) {
+        auto function = BooleanFunction::from_string("(A & B) | C").get();
+        auto values   = function.compute_truth_table({"A", "B", "C"}).get().front();
+
+        auto res = NPN::TruthTable::from_values(values);
+        ASSERT_TRUE(res.is_ok());
+        EXPECT_EQ(res.get().num_variables, 3);
+        EXPECT_EQ(res.get().to_words(), std::vector<u64>({0xF8}));
+
+        EXPECT_EQ(NPN::TruthTable::from_words({0xFFFF}, 3).get().to_words(), std::vector<u64>({0xFF}));
+        EXPECT_EQ(NPN::TruthTable::from_words({1, 2, 3, 4}, 8).get().to_words(), std::vector<u64>({1, 2, 3, 4}));
+
+        EXPECT_TRUE(NPN::TruthTable::from_words({1}, 7).is_error());
+        EXPECT_TRUE(NPN::TruthTable::from_words({1, 2, 3, 4}, 9).is_error());
+        EXPECT_TRUE(NPN::TruthTable::from_values({BooleanFunction::Value::ZERO, BooleanFunction::Value::ONE, BooleanFunction::Value::ZERO}).is_error());
+        EXPECT_TRUE(NPN::TruthTable::from_values({BooleanFunction::Value::ZERO, BooleanFunction::Value::X}).is_error());
+    }
+
+    TEST(NPN, ApplyTransform) {
+        // !A & B
+        auto tt = NPN::TruthTable::from_words({0x4}, 2).get();
+
+        NPN::Transform transform;
+        transform.input_negations = 0x0;
+        transform.permutation     = {1, 0};
+        transform.output_negation = false;
+
+        // swapping A and B yields A & !B
+        auto res = NPN::apply_transform(tt, transform);
+        ASSERT_TRUE(res.is_ok());
+        EXPECT_EQ(res.get().to_words(), std::vector<u64>({0x2}));
+
+        // negating A first yields A & B, which is not affected by the swap, and negating the output yields !(A & B)
+        transform.input_negations = 0x1;
+        transform.output_negation = true;
+        res                       = NPN::apply_transform(tt, transform);
+        ASSERT_TRUE(res.is_ok());
+        EXPECT_EQ(res.get().to_words(), std::vector<u64>({0x7}));
+
+        transform.permutation = {0, 0};
+        EXPECT_TRUE(NPN::apply_transform(tt, transform).is_error());
+        transform.permutation = {0};
+        EXPECT_TRUE(NPN::apply_transform(tt, transform).is_error());
+    }
+
+    TEST(NPN, CanonicalFormIsInvariant) {
+        std::mt19937_64 rng(0);
+        for (u32 n = 0; n <= 8; n++) {
+            for (u32 i = 0; i < 20; i++) {
+                const auto tt        = random_truth_table(rng, n);
+                const auto canonical = NPN::canonicalize(tt);
+
+                // the transformation yields the canonical form
+                auto applied = NPN::apply_transform(tt, canonical.transform);
+                ASSERT_TRUE(applied.is_ok());
+                EXPECT_EQ(applied.get(), canonical.truth_table);
+
+                // all members of the NPN class share the same canonical form
+                for (u32 j = 0; j < 3; j++) {
+                    const auto transformed = NPN::apply_transform(tt, random_transform(rng, n)).get();
+                    EXPECT_EQ(NPN::canonicalize(transformed).truth_table, canonical.truth_table);
+                }
+            }
+        }
+    }
+
+    TEST(NPN, SymmetricFunctions) {
+        // parity and conjunction of eight variables are fully symmetric
+        std::vector<u64> parity(4, 0), conjunction(4, 0);
+        for (u32 m = 0; m < 256; m++) {
+            if (std::bitset<8>(m).count() % 2 == 1) {
+                parity[m >> 6] |= 1ull << (m & 63);
+            }
+        }
+        conjunction[3] = 1ull << 63;
+
+        const auto parity_tt = NPN::TruthTable::from_words(parity, 8).get();
+        EXPECT_EQ(NPN::apply_transform(parity_tt, NPN::canonicalize(parity_tt).transform).get(), NPN::canonicalize(parity_tt).truth_table);
+
+        // AND, OR, NAND, and NOR belong to the same class
+        const auto canonical_and = NPN::canonicalize(NPN::TruthTable::from_words(conjunction, 8).get()).truth_table;
+        std::vector<u64> disjunction = {~1ull, ~0ull, ~0ull, ~0ull};
+        EXPECT_EQ(NPN::canonicalize(NPN::TruthTable::from_words(disjunction, 8).get()).truth_table, canonical_and);
+        EXPECT_NE(NPN::canonicalize(parity_tt).truth_table, canonical_and);
+    }
+
+    TEST(NPN, NumberOfClasses) {
+        // there are 14 NPN classes of functions with 3 inputs and 222 NPN classes of functions with 4 inputs
+        std::set<NPN::TruthTable> classes_3;
+        for (u64 f = 0; f < 256; f++) {
+            classes_3.insert(NPN::canonicalize(NPN::TruthTable::from_words({f}, 3).get()).truth_table);
+        }
+        EXPECT_EQ(classes_3.size(), 14);
+
+        std::set<NPN::TruthTable> classes_4;
+        for (u64 f = 0; f < 65536; f++) {
+            classes_4.insert(NPN::canonicalize(NPN::TruthTable::from_words({f}, 4).get()).truth_table);
+        }
+        EXPECT_EQ(classes_4.size(), 222);
+    }
+
+    TEST(NPN, LibraryMatching) {
+        NPN::Library library;
+        ASSERT_TRUE(library.add_function("and2", BooleanFunction::from_string("A & B").get()).is_ok());
+        ASSERT_TRUE(library.add_function("xor3", BooleanFunction::from_string("A ^ B ^ C").get()).is_ok());
+        ASSERT_TRUE(library.add_function("mux", BooleanFunction::from_string("(S & B) | (!S & A)").get(), {"A", "B", "S"}).is_ok());
+        EXPECT_EQ(library.size(), 3);
+        EXPECT_TRUE(library.add_function("wide", BooleanFunction::Var("A", 2)).is_error());
+
+        EXPECT_EQ(library.find(NPN::TruthTable::from_words({0x7}, 2).get()), std::vector<std::string>({"and2"}));
+        EXPECT_EQ(library.find(NPN::TruthTable::from_words({0x69}, 3).get()), std::vector<std::string>({"xor3"}));
+        EXPECT_TRUE(library.find(NPN::TruthTable::from_words({0x80}, 3).get()).empty());
+
+        // NAND gate built from an OR gate with inverted inputs and a 3-input XOR built from two XOR gates
+        std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+        ASSERT_NE(nl, nullptr);
+        const GateLibrary* gl = nl->get_gate_library();
+
+        std::vector<Net*> inputs;
+        for (u32 i = 0; i < 3; i++) {
+            Net* n = nl->create_net("in_" + std::to_string(i));
+            n->mark_global_input_net();
+            inputs.push_back(n);
+        }
+
+        Gate* inv0 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv0");
+        Gate* inv1 = nl->create_gate(gl->get_gate_type_by_name("INV"), "inv1");
+        Gate* or0  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or0");
+        Gate* xor0 = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor0");
+        Gate* xor1 = nl->create_gate(gl->get_gate_type_by_name("XOR2"), "xor1");
+        inputs.at(0)->add_destination(inv0, "I");
+        inputs.at(1)->add_destination(inv1, "I");
+        test_utils::connect(nl.get(), inv0, "O", or0, "I0");
+        test_utils::connect(nl.get(), inv1, "O", or0, "I1");
+        Net* nand_net = nl->create_net("nand");
+        nand_net->add_source(or0, "O");
+
+        inputs.at(0)->add_destination(xor0, "I0");
+        inputs.at(1)->add_destination(xor0, "I1");
+        test_utils::connect(nl.get(), xor0, "O", xor1, "I0");
+        inputs.at(2)->add_destination(xor1, "I1");
+        Net* xor_net = nl->create_net("xor");
+        xor_net->add_source(xor1, "O");
+
+        auto cuts = netlist_utils::enumerate_cuts(nl.get());
+        ASSERT_TRUE(cuts.is_ok());
+
+        const auto matches = library.match(cuts.get());
+        std::set<std::pair<Net*, std::string>> matched;
+        for (const auto& match : matches) {
+            matched.insert({match.net, match.name});
+
+            // both transformations lead to the same canonical form
+            auto cut_tt     = NPN::TruthTable::from_words(match.cut.truth_table, match.cut.leaves.size()).get();
+            auto canonical  = NPN::apply_transform(cut_tt, match.cut_transform).get();
+            EXPECT_EQ(canonical, NPN::canonicalize(cut_tt).truth_table);
+        }
+
+        EXPECT_NE(matched.find({nand_net, "and2"}), matched.end());
+        EXPECT_NE(matched.find({xor_net, "xor3"}), matched.end());
+        EXPECT_EQ(matched.find({nand_net, "xor3"}), matched.end());
+    }
+}    // namespace hal